@@ -656,12 +656,13 @@ void BenchmarkConfigParser::PrintUsage(FILE *out) {
       "Keys:\n"
       "  --role|-r            target|initiator\n"
       "  --group              result grouping name (default default)\n"
-      "  --transport          hccs|roce|fabric_mem|uboe|ub_rtp|ub "
+      "  --transport          hccs|roce|fabric_mem|uboe|ub_rtp|ub|loopback "
       "(hccs: D2D everywhere; extra H2rD|rD2H on A3-class SOC only; fabric_mem adds EnableUseFabricMem=1; "
       "hccs/roce/uboe/ub_rtp add GlobalResourceConfig protocol_desc by default unless LocalCommRes is set; "
       "ub adds LocalCommRes with version:1.3, only on A5; "
       "roce: RDMA over Converged Ethernet, supported on A2, A3 and A5; on A5 uses HixlCS LocalCommRes with "
-      "protocol:roce placement:host and requires --host_roce_ip)\n"
+      "protocol:roce placement:host and requires --host_roce_ip; "
+      "loopback: CPU memcpy backend without NPU, host memory and a single endpoint only, measures host-side cost)\n"
       "  --host_roce_ip       Host RoCE NIC IP address for LocalCommRes endpoint (data plane; required for "
       "transport=roce\n"
       " on A5 unless -H LocalCommRes is used; ignored on A2/A3). Note: this is separate from host IP used by\n"
@@ -799,6 +800,21 @@ void AddDefaultProtocolDesc(const BenchmarkConfig &cfg, std::map<AscendString, A
   (*options)[AscendString(OPTION_GLOBAL_RESOURCE_CONFIG)] = BuildProtocolDescConfig(protocol_desc);
 }
 
+void AddLoopbackOptions(const BenchmarkConfig &cfg, std::map<AscendString, AscendString> *options) {
+  if (!HasExplicitLocalCommRes(cfg)) {
+    const std::string comm_id = cfg.host_roce_ip.empty() ? "127.0.0.1" : cfg.host_roce_ip;
+    const std::string local_comm_res =
+        "{\"version\":\"1.3\",\"net_instance_id\":\"default\",\"endpoint_list\":["
+        "{\"protocol\":\"roce\",\"comm_id\":\"" +
+        comm_id + "\",\"placement\":\"host\"}]}";
+    (*options)[AscendString(OPTION_LOCAL_COMM_RES)] = AscendString(local_comm_res.c_str());
+  }
+  if (!HasInitOption(cfg.hixl_init_options, OPTION_GLOBAL_RESOURCE_CONFIG)) {
+    (*options)[AscendString(OPTION_GLOBAL_RESOURCE_CONFIG)] =
+        AscendString("{\"comm_resource_config.transport\":\"loopback\"}");
+  }
+}
+
 }  // namespace
 
 std::map<AscendString, AscendString> BenchmarkConfigParser::BuildInitializeOptions(const BenchmarkConfig &cfg,
@@ -821,6 +837,9 @@ std::map<AscendString, AscendString> BenchmarkConfigParser::BuildInitializeOptio
   if (cfg.transport == "ub" && !HasExplicitLocalCommRes(cfg)) {
     options[AscendString(OPTION_LOCAL_COMM_RES)] = AscendString("{\"version\":\"1.3\"}");
   }
+  if (cfg.transport == "loopback") {
+    AddLoopbackOptions(cfg, &options);
+  }
   if (cfg.transport == "roce") {
     const BenchSocKind soc_kind = ResolveSocKindForHccs(&cfg);
     if (soc_kind == BenchSocKind::kA5) {
@@ -1004,8 +1023,9 @@ bool ValidateTransferOp(const std::string &op) {
 
 bool ValidateTransport(const std::string &transport) {
   if (transport != "hccs" && transport != "roce" && transport != "fabric_mem" && transport != "uboe" &&
-      transport != "ub_rtp" && transport != "ub") {
-    fprintf(stderr, "[ERROR] Invalid transport: %s (expect hccs|roce|fabric_mem|uboe|ub_rtp|ub)\n", transport.c_str());
+      transport != "ub_rtp" && transport != "ub" && transport != "loopback") {
+    fprintf(stderr, "[ERROR] Invalid transport: %s (expect hccs|roce|fabric_mem|uboe|ub_rtp|ub|loopback)\n",
+            transport.c_str());
     return false;
   }
   return true;
@@ -1174,8 +1194,23 @@ bool ValidateRoceConfig(BenchmarkConfig *cfg) {
   return true;
 }
 
+bool ValidateLoopbackConfig(BenchmarkConfig *cfg) {
+  // Loopback copies with the CPU, so both buffers are malloc'ed host memory and no device is bound.
+  cfg->roce_endpoint_placement = "host";
+  if (cfg->initiator_memory_type != "host" || cfg->target_memory_type != "host") {
+    fprintf(stderr, "[ERROR] transport=loopback requires host memory on both sides, got initiator=%s target=%s\n",
+            cfg->initiator_memory_type.c_str(), cfg->target_memory_type.c_str());
+    return false;
+  }
+  if (cfg->expanded_local_engines.size() > 1U) {
+    fprintf(stderr, "[ERROR] transport=loopback supports a single local_engine and remote_engine only\n");
+    return false;
+  }
+  return true;
+}
+
 bool ValidateBenchmarkWorkload(BenchmarkConfig *cfg) {
-  if (cfg->soc_variant == "auto") {
+  if (cfg->soc_variant == "auto" && cfg->transport != "loopback") {
     const BenchSocKind kind = ResolveSocKindForHccs(cfg);
     switch (kind) {
       case BenchSocKind::kA2:
@@ -1202,6 +1237,9 @@ bool ValidateBenchmarkWorkload(BenchmarkConfig *cfg) {
   if (cfg->transport == "roce" && !ValidateRoceConfig(cfg)) {
     return false;
   }
+  if (cfg->transport == "loopback" && !ValidateLoopbackConfig(cfg)) {
+    return false;
+  }
   if (!ValidateBufferSize(cfg)) {
     return false;
   }
@@ -84,7 +84,7 @@ struct BenchmarkConfig {
   std::vector<int32_t> expanded_device_ids;
   std::vector<std::string> expanded_local_engines;
   std::vector<std::string> expanded_remote_engines;
-  /// Host RoCE NIC IP address, used to build LocalCommRes when transport=roce.
+  /// Host RoCE NIC IP address, used to build LocalCommRes when transport=roce (loopback: optional host endpoint id).
   std::string host_roce_ip;
   /// Parsed from `--host_roce_ip` (comma-separated); if empty before Validate, set to `{host_roce_ip}`.
   std::vector<std::string> host_roce_ip_list;
@@ -103,6 +103,16 @@ inline std::string ExtractTcpHost(const std::string &remote_engine) {
   return remote_engine.substr(0, pos);
 }
 
+/// Host buffers are plain malloc memory when no NPU DMA engine touches them (host-NIC RoCE, CPU loopback).
+inline bool UseMallocHostBuffer(const std::string &transport, const std::string &roce_endpoint_placement) {
+  return transport == "loopback" || (transport == "roce" && roce_endpoint_placement == "host");
+}
+
+/// loopback moves data with the CPU only and runs without binding an NPU device.
+inline bool NeedsDeviceBinding(const BenchmarkConfig &cfg) {
+  return cfg.transport != "loopback";
+}
+
 bool ExtractEndpointHostAndPort(const std::string &endpoint, std::string &host, uint16_t &port);
 
 uint16_t DerivePeerCoordPort(uint16_t engine_port);
@@ -14,6 +14,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstdio>
+#include <ctime>
 #include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
 #include <fstream>
@@ -44,6 +45,7 @@ namespace {
 
 using hixl_benchmark::BenchmarkConfig;
 using hixl_benchmark::BenchmarkConfigParser;
+using hixl_benchmark::UseMallocHostBuffer;
 
 const char *RecentErrMsg() {
   const char *errmsg = aclGetRecentErrMsg();
@@ -57,6 +59,8 @@ const char *RecentErrMsg() {
 constexpr double kDecimalBytesPerGb = 1000.0 * 1000.0 * 1000.0;
 constexpr double kMicrosecondsPerSecond = 1000.0 * 1000.0;
 constexpr int32_t kMsPerSecond = 1000;
+constexpr int64_t kUsPerSecond = 1000000;
+constexpr int64_t kNsPerUs = 1000;
 constexpr int32_t kWaitTransTimeSec = 60;
 constexpr int32_t kTransferSyncTimeoutMs = kMsPerSecond * kWaitTransTimeSec;
 // Read verification fill patterns: server fills 'S', client fills 'C'.
@@ -112,7 +116,7 @@ void FreeHostBuffers(const std::vector<void *> &buffers, const std::string &tran
     }
     if (transport == "fabric_mem") {
       (void)FabricMemTransferService::FreeMem(element);
-    } else if (transport == "roce" && roce_endpoint_placement == "host") {
+    } else if (UseMallocHostBuffer(transport, roce_endpoint_placement)) {
       std::free(element);
     } else {
       (void)aclrtFreeHost(element);
@@ -157,7 +161,7 @@ int32_t AllocLocalBuffer(const BenchmarkConfig &cfg, bool *is_host, void **out_s
       std::fprintf(stderr, "[ERROR] client fabric_mem host alloc failed status=%d\n", static_cast<int>(status));
       return -1;
     }
-  } else if (*is_host && cfg.transport == "roce" && cfg.roce_endpoint_placement == "host") {
+  } else if (*is_host && UseMallocHostBuffer(cfg.transport, cfg.roce_endpoint_placement)) {
     tmp = std::malloc(alloc_size);
     if (tmp == nullptr) {
       std::fprintf(stderr, "[ERROR] client alloc host failed: malloc returned null\n");
@@ -278,6 +282,16 @@ void PrintBenchRecords(const std::vector<TransferBenchRecord> &recs) {
   std::printf("\n");
 }
 
+int64_t ProcessCpuTimeUs() {
+  timespec ts{};
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * kUsPerSecond + static_cast<int64_t>(ts.tv_nsec) / kNsPerUs;
+}
+
+double CpuUsPerOp(const TransferBenchRecord &record) {
+  return record.trans_num == 0U ? 0.0 : static_cast<double>(record.cpu_time_us) / record.trans_num;
+}
+
 std::string CommResultBasePath(const BenchmarkConfig &cfg) {
   return cfg.output_dir + "/comm_result_" + std::to_string(static_cast<long long>(getpid()));
 }
@@ -295,7 +309,7 @@ void AppendCommResult(const BenchmarkConfig &cfg, const TransferBenchRecord &rec
   }
   if (need_header) {
     csv << "benchmark,pattern,model,token_length,block_size,batch_size,threads,transport,direction,initiator_memory,"
-           "target_memory,bandwidth_gbps,ops_per_sec,avg_latency_us,p99_us,error_count,consistency\n";
+           "target_memory,bandwidth_gbps,ops_per_sec,avg_latency_us,p99_us,error_count,consistency,cpu_us_per_op\n";
   }
   const double avg_us = record.trans_num == 0U ? 0.0 : static_cast<double>(record.time_us) / record.trans_num;
   const double ops =
@@ -305,7 +319,7 @@ void AppendCommResult(const BenchmarkConfig &cfg, const TransferBenchRecord &rec
       << cfg.transport << ','
       << BenchmarkConfig::ComputeDirection(cfg.initiator_memory_type, cfg.target_memory_type, cfg.op) << ','
       << cfg.initiator_memory_type << ',' << cfg.target_memory_type << ',' << record.throughput_gbps << ',' << ops
-      << ',' << avg_us << ',' << avg_us << ",0," << record.consistency << '\n';
+      << ',' << avg_us << ',' << avg_us << ",0," << record.consistency << ',' << CpuUsPerOp(record) << '\n';
 
   std::ofstream json(CommResultBasePath(cfg) + ".jsonl", std::ios::app);
   if (json.good()) {
@@ -315,7 +329,7 @@ void AppendCommResult(const BenchmarkConfig &cfg, const TransferBenchRecord &rec
          << BenchmarkConfig::ComputeDirection(cfg.initiator_memory_type, cfg.target_memory_type, cfg.op)
          << "\",\"initiator_memory\":\"" << cfg.initiator_memory_type << "\",\"target_memory\":\""
          << cfg.target_memory_type << "\",\"bandwidth_gbps\":" << record.throughput_gbps << ",\"p99_us\":" << avg_us
-         << ",\"consistency\":\"" << record.consistency << "\"}\n";
+         << ",\"consistency\":\"" << record.consistency << "\",\"cpu_us_per_op\":" << CpuUsPerOp(record) << "}\n";
   }
 }
 
@@ -437,23 +451,23 @@ void PublishBenchRecord(const TransferBlockStepCtx &ctx, const TransferBenchReco
   }
 }
 
-void LogSyncTransferSuccess(const TransferBlockStepCtx &ctx, uint32_t block_size, uint32_t trans_num, int64_t time_us,
-                            double throughput) {
-  const std::string bs_log = FormatBlockSizeHuman(static_cast<uint64_t>(block_size));
+void LogSyncTransferSuccess(const TransferBlockStepCtx &ctx, const TransferBenchRecord &rec) {
+  const std::string bs_log = FormatBlockSizeHuman(static_cast<uint64_t>(rec.block_size));
   std::printf(
       "[INFO] Transfer success, loop %u/%u, step %u, block size: %s, transfer num: %u, time cost: %ld us, "
-      "throughput: %.3lf GB/s\n",
-      ctx.loop + 1U, ctx.cfg->loops, ctx.step_index, bs_log.c_str(), trans_num, static_cast<long>(time_us), throughput);
+      "throughput: %.3lf GB/s, cpu/op: %.3lf us\n",
+      ctx.loop + 1U, ctx.cfg->loops, ctx.step_index, bs_log.c_str(), rec.trans_num, static_cast<long>(rec.time_us),
+      rec.throughput_gbps, CpuUsPerOp(rec));
 }
 
-void LogAsyncTransferSuccess(const TransferBlockStepCtx &ctx, uint32_t block_size, uint32_t trans_num, int64_t total_us,
-                             int64_t submit_us, int64_t wait_us, double throughput) {
-  const std::string bs_log = FormatBlockSizeHuman(static_cast<uint64_t>(block_size));
+void LogAsyncTransferSuccess(const TransferBlockStepCtx &ctx, const TransferBenchRecord &rec) {
+  const std::string bs_log = FormatBlockSizeHuman(static_cast<uint64_t>(rec.block_size));
   std::printf(
       "[INFO] Async transfer success, loop %u/%u, step %u, block size: %s, trans_num: %u, batch_num: %u, "
-      "total: %ld us (submit: %ld, wait: %ld), %.3lf GB/s\n",
-      ctx.loop + 1U, ctx.cfg->loops, ctx.step_index, bs_log.c_str(), trans_num, ctx.cfg->async_batch_num,
-      static_cast<long>(total_us), static_cast<long>(submit_us), static_cast<long>(wait_us), throughput);
+      "total: %ld us (submit: %ld, wait: %ld), %.3lf GB/s, cpu/op: %.3lf us\n",
+      ctx.loop + 1U, ctx.cfg->loops, ctx.step_index, bs_log.c_str(), rec.trans_num, ctx.cfg->async_batch_num,
+      static_cast<long>(rec.time_us), static_cast<long>(rec.submit_time_us), static_cast<long>(rec.wait_time_us),
+      rec.throughput_gbps, CpuUsPerOp(rec));
 }
 
 std::vector<TransferOpDesc> BuildSyncTransferDescriptors(const TransferBlockStepCtx &ctx, uint32_t block_size,
@@ -471,12 +485,13 @@ std::vector<TransferOpDesc> BuildSyncTransferDescriptors(const TransferBlockStep
 }
 
 void FinishSyncBenchStep(const TransferBlockStepCtx &ctx, uint32_t block_size, uint32_t trans_num, int64_t time_us,
-                         double throughput) {
+                         double throughput, int64_t cpu_us) {
   TransferBenchRecord rec = MakeSyncTransferRecord(ctx, block_size, trans_num, time_us, throughput);
+  rec.cpu_time_us = cpu_us;
   VerifyAndSetConsistency(ctx, &rec);
   PublishBenchRecord(ctx, rec);
   if (ctx.bench_records == nullptr) {
-    LogSyncTransferSuccess(ctx, block_size, trans_num, time_us, throughput);
+    LogSyncTransferSuccess(ctx, rec);
   }
 }
 
@@ -488,9 +503,11 @@ int32_t TransferOneBlockStep(Hixl &hixl_engine, const TransferBlockStepCtx &ctx)
   }
   const auto trans_num = static_cast<uint32_t>(ctx.cfg->transfer_size / ctx.block_size_u);
   std::vector<TransferOpDesc> descs = BuildSyncTransferDescriptors(ctx, block_size, trans_num);
+  const int64_t cpu_start = ProcessCpuTimeUs();
   const auto start = std::chrono::steady_clock::now();
   const auto ret =
       hixl_engine.TransferSync(AscendString(ctx.remote_engine), ctx.transfer_op, descs, kTransferSyncTimeoutMs);
+  const int64_t cpu_us = ProcessCpuTimeUs() - cpu_start;
   if (ret != SUCCESS) {
     std::printf("[ERROR] TransferSync failed, ret = %u, errmsg: %s\n", ret, RecentErrMsg());
     return -1;
@@ -499,7 +516,7 @@ int32_t TransferOneBlockStep(Hixl &hixl_engine, const TransferBlockStepCtx &ctx)
       std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
   const double time_second = static_cast<double>(time_cost) / kMicrosecondsPerSecond;
   const double throughput = static_cast<double>(ctx.cfg->transfer_size) / kDecimalBytesPerGb / time_second;
-  FinishSyncBenchStep(ctx, block_size, trans_num, time_cost, throughput);
+  FinishSyncBenchStep(ctx, block_size, trans_num, time_cost, throughput, cpu_us);
   return 0;
 }
 
@@ -508,10 +525,13 @@ struct AsyncTransferContext {
   std::chrono::steady_clock::time_point submit_start;
   std::chrono::steady_clock::time_point submit_end;
   std::chrono::steady_clock::time_point wait_end;
+  int64_t cpu_start_us = 0;
+  int64_t cpu_end_us = 0;
 };
 
 int32_t SubmitAsyncRequests(Hixl &hixl_engine, const TransferBlockStepCtx &ctx, uint64_t per_req_size,
                             uint32_t block_size, uint32_t per_req_trans_num, AsyncTransferContext &async_ctx) {
+  async_ctx.cpu_start_us = ProcessCpuTimeUs();
   async_ctx.submit_start = std::chrono::steady_clock::now();
   TransferArgs optional_args{};
   for (uint32_t batch_idx = 0; batch_idx < ctx.cfg->async_batch_num; ++batch_idx) {
@@ -574,6 +594,7 @@ int32_t WaitAsyncRequests(Hixl &hixl_engine, AsyncTransferContext &async_ctx) {
     }
   }
   async_ctx.wait_end = std::chrono::steady_clock::now();
+  async_ctx.cpu_end_us = ProcessCpuTimeUs();
   return has_waiting ? -1 : 0;
 }
 
@@ -588,10 +609,11 @@ void RecordAsyncBenchResult(const TransferBlockStepCtx &ctx, uint32_t block_size
   const auto total_trans_num = static_cast<uint32_t>(ctx.cfg->transfer_size / ctx.block_size_u);
   TransferBenchRecord rec =
       MakeAsyncTransferRecord(ctx, block_size, total_trans_num, total_us, submit_us, wait_us, throughput);
+  rec.cpu_time_us = actx.cpu_end_us - actx.cpu_start_us;
   VerifyAndSetConsistency(ctx, &rec);
   PublishBenchRecord(ctx, rec);
   if (ctx.bench_records == nullptr) {
-    LogAsyncTransferSuccess(ctx, block_size, total_trans_num, total_us, submit_us, wait_us, throughput);
+    LogAsyncTransferSuccess(ctx, rec);
   }
 }
 
@@ -938,6 +960,9 @@ bool ClientRunner::Init() {
     return true;
   }
   device_id_ = cfg_.expanded_device_ids[0];
+  if (!NeedsDeviceBinding(cfg_)) {
+    return true;
+  }
   if (aclrtSetDevice(device_id_) != ACL_ERROR_NONE) {
     std::printf("[ERROR] ClientRunner aclrtSetDevice(%d) failed\n", static_cast<int>(device_id_));
     return false;
@@ -42,6 +42,8 @@ struct TransferBenchRecord {
   std::int64_t time_us = 0;
   std::int64_t submit_time_us = 0;
   std::int64_t wait_time_us = 0;
+  /// Process CPU time consumed while the step's transfer calls ran (all threads of this process).
+  std::int64_t cpu_time_us = 0;
   double throughput_gbps = 0;
   std::string consistency = "not_checked";
 };
@@ -27,6 +27,8 @@ using hixl::SUCCESS;
 
 namespace {
 
+using hixl_benchmark::UseMallocHostBuffer;
+
 // Read verification fill pattern: server fills 'S'.
 constexpr uint8_t kServerFillPattern = static_cast<uint8_t>('S');
 
@@ -70,7 +72,7 @@ void FreeHostBuffers(const std::vector<void *> &buffers, const std::string &tran
     }
     if (transport == "fabric_mem") {
       (void)FabricMemTransferService::FreeMem(buffer);
-    } else if (transport == "roce" && roce_endpoint_placement == "host") {
+    } else if (UseMallocHostBuffer(transport, roce_endpoint_placement)) {
       std::free(buffer);
     } else {
       (void)aclrtFreeHost(buffer);
@@ -156,7 +158,7 @@ void ServerRunner::ReleaseServerResources() {
     if (is_host_) {
       if (cfg_.transport == "fabric_mem") {
         (void)FabricMemTransferService::FreeMem(buffer_);
-      } else if (cfg_.transport == "roce" && cfg_.roce_endpoint_placement == "host") {
+      } else if (UseMallocHostBuffer(cfg_.transport, cfg_.roce_endpoint_placement)) {
         std::free(buffer_);
       } else {
         (void)aclrtFreeHost(buffer_);
@@ -173,6 +175,9 @@ void ServerRunner::ReleaseServerResources() {
 
 bool ServerRunner::Init() {
   device_id_ = cfg_.expanded_device_ids[0];
+  if (!NeedsDeviceBinding(cfg_)) {
+    return true;
+  }
   if (aclrtSetDevice(device_id_) != ACL_ERROR_NONE) {
     return false;
   }
@@ -197,7 +202,7 @@ bool ServerRunner::AllocServerBufferForRun() {
       std::printf("[ERROR] server fabric_mem alloc failed status=%d\n", static_cast<int>(status));
       return false;
     }
-  } else if (is_host_ && cfg_.transport == "roce" && cfg_.roce_endpoint_placement == "host") {
+  } else if (is_host_ && UseMallocHostBuffer(cfg_.transport, cfg_.roce_endpoint_placement)) {
     buffer_ = std::malloc(alloc_size);
     if (buffer_ == nullptr) {
       std::printf("[ERROR] server alloc host failed: malloc returned null\n");
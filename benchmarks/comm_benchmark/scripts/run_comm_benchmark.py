@@ -186,6 +186,8 @@ def supported_types_for_transport(transport: str, gate_soc: str | None) -> list[
     """Return ordered direction names supported for transport on this SOC."""
     if transport == 'hccs' and gate_soc == 'a5':
         return []
+    if transport == 'loopback':
+        return [bench_type for bench_type in ALL_TYPES if TYPE_MAP[bench_type][:2] == ('host', 'host')]
     return [bench_type for bench_type in ALL_TYPES if hccs_combo_allowed(transport, bench_type, gate_soc)]
 
 
@@ -524,9 +526,10 @@ def _add_transfer_args(parser) -> None:
     )
     parser.add_argument(
         '--transport',
-        choices=['hccs', 'roce', 'fabric_mem', 'uboe', 'ub_rtp', 'ub', 'all'],
+        choices=['hccs', 'roce', 'fabric_mem', 'uboe', 'ub_rtp', 'ub', 'loopback', 'all'],
         default=None,
-        help='Transport path. Dual-machine default: all platform-supported transports.',
+        help='Transport path. Dual-machine default: all platform-supported transports. '
+        'loopback runs the CPU-only backend (H2rH/rH2H, no NPU) and is never part of "all".',
     )
     parser.add_argument(
         '--host_roce_ip',
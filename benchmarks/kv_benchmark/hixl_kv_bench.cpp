@@ -12,9 +12,12 @@
 #include <cctype>
 #include <chrono>
 #include <cinttypes>
+#include <condition_variable>
+#include <ctime>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
 #include <experimental/filesystem>
 namespace fs = std::experimental::filesystem;
 #include <functional>
@@ -24,6 +27,7 @@ namespace fs = std::experimental::filesystem;
 #include <sstream>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -34,6 +38,7 @@ namespace fs = std::experimental::filesystem;
 #include "acl/acl.h"
 #include "fabric_mem/fabric_mem_transfer_service.h"
 #include "hixl/hixl.h"
+#include "kv_trace.h"
 #include "kv_transfer_executor.h"
 #include "kvstore.h"
 #include "kv_slice_layout.h"
@@ -71,6 +76,7 @@ constexpr const char *kTransportHccs = "hccs";
 constexpr const char *kTransportUboe = "uboe";
 constexpr const char *kTransportUbRtp = "ub_rtp";
 constexpr const char *kTransportUb = "ub";
+constexpr const char *kTransportLoopback = "loopback";
 constexpr const char *kPoolMemoryHost = "host";
 constexpr const char *kDefaultModel = "deepseek-r1";
 constexpr const char *kDefaultKeyCounts = "16,32,48,64";
@@ -95,11 +101,14 @@ using hixl_kv_benchmark::KvSliceEntry;
 using hixl_kv_benchmark::KvStore;
 using hixl_kv_benchmark::KvTransferExecutor;
 using hixl_kv_benchmark::LoadModelSpecsFromJson;
+using hixl_kv_benchmark::LoadTraceFile;
 using hixl_kv_benchmark::ModelSpec;
 using hixl_kv_benchmark::ParseTokenLength;
 using hixl_kv_benchmark::RankMeta;
 using hixl_kv_benchmark::SegmentManager;
 using hixl_kv_benchmark::SupportedModelNames;
+using hixl_kv_benchmark::TraceKeyCount;
+using hixl_kv_benchmark::TraceRequest;
 
 struct KvBenchConfig {
   std::uint32_t rank = 0U;
@@ -116,6 +125,8 @@ struct KvBenchConfig {
   std::string run_id = "manual";
   std::string listen_host = "127.0.0.1";
   std::string connect_host = "127.0.0.1";
+  /// Non-empty switches to trace replay: requests are issued open-loop at their recorded arrival times.
+  std::string trace_file;
   std::uint32_t base_port = kDefaultBasePort;
   std::uint32_t warmup = kDefaultWarmup;
   std::uint32_t repeat = kDefaultRepeat;
@@ -139,6 +150,8 @@ struct KvWorkload {
 struct TimingStats {
   double avg_us = 0.0;
   double p99_us = 0.0;
+  /// Process CPU time per measured iteration, i.e. the host-side cost of the transfer stack.
+  double cpu_avg_us = 0.0;
 };
 
 struct TransferStageTiming {
@@ -179,6 +192,21 @@ struct KvBenchResult {
   double put_p99_us = 0.0;
   double get_p99_us = 0.0;
   std::vector<std::uint64_t> key_distribution;
+  double put_cpu_us_per_slice = 0.0;
+  double get_cpu_us_per_slice = 0.0;
+};
+
+/// Per-request replay timing, all measured from the request's scheduled trace arrival: queue_us is arrival to the
+/// first transfer starting (time spent behind earlier requests), transfer_us is first start to completion and
+/// latency_us is arrival to completion.
+struct ReplayRequestResult {
+  std::uint64_t arrival_us = 0U;
+  std::uint64_t token_count = 0U;
+  std::uint64_t block_count = 0U;
+  std::uint64_t total_bytes = 0U;
+  double queue_us = 0.0;
+  double transfer_us = 0.0;
+  double latency_us = 0.0;
 };
 
 struct KvRuntime {
@@ -194,6 +222,31 @@ struct KvRuntime {
   bool pool_registered = false;
 };
 
+bool IsLoopbackTransport(const KvBenchConfig &cfg) {
+  return cfg.transport == kTransportLoopback;
+}
+
+/// fabric_mem and loopback move the self-rank slices through HIXL too; other transports copy them with aclrtMemcpy.
+bool TransferSelfThroughHixl(const KvBenchConfig &cfg) {
+  return cfg.transport == kTransportFabricMem || IsLoopbackTransport(cfg);
+}
+
+/// loopback keeps the KV cache in host memory, so put/get are host to remote host.
+const char *PutTransferType(const KvBenchConfig &cfg) {
+  return IsLoopbackTransport(cfg) ? "h2rh" : "d2rh";
+}
+
+const char *GetTransferType(const KvBenchConfig &cfg) {
+  return IsLoopbackTransport(cfg) ? "rh2h" : "rh2d";
+}
+
+double ProcessCpuTimeUs() {
+  timespec ts{};
+  (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return static_cast<double>(ts.tv_sec) * kMicrosecondsPerSecond +
+         static_cast<double>(ts.tv_nsec) / kNanosecondsPerMicrosecond;
+}
+
 const char *RecentErrMsg() {
   const char *errmsg = aclGetRecentErrMsg();
   return errmsg == nullptr ? "no error" : errmsg;
@@ -324,6 +377,7 @@ KvBenchConfig ParseConfig(const std::vector<std::string> &argv) {
   if (args.count("--run_id") != 0U) cfg.run_id = args.at("--run_id");
   if (args.count("--listen_host") != 0U) cfg.listen_host = args.at("--listen_host");
   if (args.count("--connect_host") != 0U) cfg.connect_host = args.at("--connect_host");
+  if (args.count("--trace_file") != 0U) cfg.trace_file = args.at("--trace_file");
   if (cfg.key_counts.empty()) {
     cfg.key_counts = kDefaultKeyCounts;
   }
@@ -334,7 +388,7 @@ bool ValidateConfig(const KvBenchConfig &cfg) {
   // KV workload uses host-side pool memory; HCCS comm path is restricted to D2D-only in benchmarks.
   const bool transport_ok = cfg.transport == kTransportRoce || cfg.transport == kTransportFabricMem ||
                             cfg.transport == kTransportUboe || cfg.transport == kTransportUbRtp ||
-                            cfg.transport == kTransportUb;
+                            cfg.transport == kTransportUb || cfg.transport == kTransportLoopback;
   const bool workload_ok = !cfg.key_counts.empty();
   return cfg.num_processes > 0U && cfg.rank < cfg.num_processes && cfg.transfer_threads > 0U && cfg.repeat > 0U &&
          cfg.local_buffer_min > 0U && cfg.pool_memory == kPoolMemoryHost && transport_ok && workload_ok;
@@ -366,6 +420,15 @@ std::map<AscendString, AscendString> BuildInitializeOptions(const KvBenchConfig
   if (cfg.transport == kTransportUb) {
     options[AscendString(hixl::OPTION_LOCAL_COMM_RES)] = AscendString("{\"version\":\"1.3\"}");
   }
+  if (IsLoopbackTransport(cfg)) {
+    const std::string local_comm_res =
+        "{\"version\":\"1.3\",\"net_instance_id\":\"default\",\"endpoint_list\":["
+        "{\"protocol\":\"roce\",\"comm_id\":\"" +
+        cfg.listen_host + "\",\"placement\":\"host\"}]}";
+    options[AscendString(hixl::OPTION_LOCAL_COMM_RES)] = AscendString(local_comm_res.c_str());
+    options[AscendString(hixl::OPTION_GLOBAL_RESOURCE_CONFIG)] =
+        AscendString("{\"comm_resource_config.transport\":\"loopback\"}");
+  }
   return options;
 }
 
@@ -385,6 +448,11 @@ SegmentManager BuildSegmentManagerFromPoolSizes(const std::vector<std::uint64_t>
   return manager;
 }
 
+KvWorkload MakeWorkload(const ModelSpec &model, std::uint64_t key_count) {
+  return KvWorkload{key_count * model.tokens_per_key, key_count, model.MaxSliceBytesForKeys(key_count),
+                    model.CountTransferSlicesForKeys(key_count), model.TransferBytesForKeys(key_count)};
+}
+
 std::vector<KvWorkload> BuildWorkloads(const KvBenchConfig &cfg, const ModelSpec &model) {
   std::vector<KvWorkload> workloads;
   if (cfg.key_counts.empty()) {
@@ -395,8 +463,7 @@ std::vector<KvWorkload> BuildWorkloads(const KvBenchConfig &cfg, const ModelSpec
     if (key_count == 0U) {
       throw std::invalid_argument("key_count must be greater than zero");
     }
-    workloads.push_back(KvWorkload{key_count * model.tokens_per_key, key_count, model.MaxSliceBytesForKeys(key_count),
-                                   model.CountTransferSlicesForKeys(key_count), model.TransferBytesForKeys(key_count)});
+    workloads.push_back(MakeWorkload(model, key_count));
   }
   return workloads;
 }
@@ -602,6 +669,13 @@ void AllocHostBuffer(const KvBenchConfig &cfg, std::uint64_t size, void **buffer
     }
     return;
   }
+  if (IsLoopbackTransport(cfg)) {
+    *buffer = std::malloc(static_cast<size_t>(size));
+    if (*buffer == nullptr) {
+      throw std::runtime_error("loopback host allocation failed");
+    }
+    return;
+  }
   const auto ret = aclrtMallocHost(buffer, static_cast<size_t>(size));
   if (ret != ACL_ERROR_NONE) {
     throw std::runtime_error("aclrtMallocHost failed");
@@ -614,6 +688,8 @@ void FreeHostBuffer(const KvBenchConfig &cfg, void *buffer) {
   }
   if (cfg.transport == kTransportFabricMem) {
     (void)FabricMemTransferService::FreeMem(buffer);
+  } else if (IsLoopbackTransport(cfg)) {
+    std::free(buffer);
   } else {
     (void)aclrtFreeHost(buffer);
   }
@@ -629,7 +705,7 @@ void RegisterMem(Hixl &hixl, void *buffer, std::uint64_t size, MemType type, Mem
   }
 }
 
-void InitRuntime(const KvBenchConfig &cfg, std::uint64_t local_size, std::uint64_t pool_size, KvRuntime *runtime) {
+void BindDevice(const KvBenchConfig &cfg, KvRuntime *runtime) {
   if (aclrtSetDevice(cfg.device_id) != ACL_ERROR_NONE) {
     throw std::runtime_error("aclrtSetDevice failed");
   }
@@ -639,6 +715,27 @@ void InitRuntime(const KvBenchConfig &cfg, std::uint64_t local_size, std::uint64
     throw std::runtime_error("aclrtGetCurrentContext failed, ret=" + std::to_string(ctx_ret) +
                              ", errmsg: " + RecentErrMsg());
   }
+}
+
+void AllocLocalBuffer(const KvBenchConfig &cfg, std::uint64_t local_size, KvRuntime *runtime) {
+  if (IsLoopbackTransport(cfg)) {
+    // loopback: the "device" local buffer is host memory, registered below as MEM_HOST.
+    runtime->local_buffer = std::malloc(static_cast<size_t>(local_size));
+    if (runtime->local_buffer == nullptr) {
+      throw std::runtime_error("malloc local buffer failed");
+    }
+    return;
+  }
+  if (aclrtMalloc(&runtime->local_buffer, static_cast<size_t>(local_size), ACL_MEM_MALLOC_HUGE_ONLY) !=
+      ACL_ERROR_NONE) {
+    throw std::runtime_error("aclrtMalloc device buffer failed");
+  }
+}
+
+void InitRuntime(const KvBenchConfig &cfg, std::uint64_t local_size, std::uint64_t pool_size, KvRuntime *runtime) {
+  if (!IsLoopbackTransport(cfg)) {
+    BindDevice(cfg, runtime);
+  }
 
   const auto init_options = BuildInitializeOptions(cfg);
   const auto init_ret = runtime->hixl.Initialize(AscendString(LocalListenEndpoint(cfg).c_str()), init_options);
@@ -647,16 +744,14 @@ void InitRuntime(const KvBenchConfig &cfg, std::uint64_t local_size, std::uint64
   }
   runtime->hixl_initialized = true;
 
-  if (aclrtMalloc(&runtime->local_buffer, static_cast<size_t>(local_size), ACL_MEM_MALLOC_HUGE_ONLY) !=
-      ACL_ERROR_NONE) {
-    throw std::runtime_error("aclrtMalloc device buffer failed");
-  }
+  AllocLocalBuffer(cfg, local_size, runtime);
   if (runtime->local_buffer == nullptr) {
     throw std::runtime_error("device buffer allocation succeeded but returned null");
   }
   // fabric_mem: only host pool is registered; aclrtMalloc device local_buffer is used via TransferSync addresses only.
   if (cfg.transport != kTransportFabricMem) {
-    RegisterMem(runtime->hixl, runtime->local_buffer, local_size, MemType::MEM_DEVICE, &runtime->local_handle);
+    const MemType local_type = IsLoopbackTransport(cfg) ? MemType::MEM_HOST : MemType::MEM_DEVICE;
+    RegisterMem(runtime->hixl, runtime->local_buffer, local_size, local_type, &runtime->local_handle);
     runtime->local_registered = true;
   }
 
@@ -670,7 +765,7 @@ void InitRuntime(const KvBenchConfig &cfg, std::uint64_t local_size, std::uint64
 
 void CleanupRuntime(const KvBenchConfig &cfg, KvRuntime *runtime, const std::vector<RankMeta> &metas) {
   if (runtime->hixl_initialized) {
-    const bool disconnect_self = cfg.transport == kTransportFabricMem;
+    const bool disconnect_self = TransferSelfThroughHixl(cfg);
     for (const auto &meta : metas) {
       if (meta.rank == cfg.rank && !disconnect_self) {
         continue;
@@ -689,7 +784,11 @@ void CleanupRuntime(const KvBenchConfig &cfg, KvRuntime *runtime, const std::vec
     runtime->hixl_initialized = false;
   }
   if (runtime->local_buffer != nullptr) {
-    (void)aclrtFree(runtime->local_buffer);
+    if (IsLoopbackTransport(cfg)) {
+      std::free(runtime->local_buffer);
+    } else {
+      (void)aclrtFree(runtime->local_buffer);
+    }
     runtime->local_buffer = nullptr;
   }
   FreeHostBuffer(cfg, runtime->pool_buffer);
@@ -702,7 +801,7 @@ void CleanupRuntime(const KvBenchConfig &cfg, KvRuntime *runtime, const std::vec
 }
 
 void ConnectPeers(const KvBenchConfig &cfg, KvRuntime *runtime, const std::vector<RankMeta> &metas) {
-  const bool connect_self = cfg.transport == kTransportFabricMem;
+  const bool connect_self = TransferSelfThroughHixl(cfg);
   for (const auto &meta : metas) {
     if (meta.rank == cfg.rank && !connect_self) {
       continue;
@@ -748,6 +847,11 @@ std::uint64_t ElapsedUs(const std::chrono::steady_clock::time_point &start,
   return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
 }
 
+double DurationUs(const std::chrono::steady_clock::time_point &start, const std::chrono::steady_clock::time_point &end) {
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) /
+         kNanosecondsPerMicrosecond;
+}
+
 void PrintTransferPlanSummary(const KvBenchConfig &cfg, const std::vector<KeyTransferTask> &tasks, TransferOp op,
                               const KvWorkload &workload) {
   if (!IsTraceRank(cfg)) {
@@ -879,7 +983,7 @@ TransferStageTiming ExecuteKvTransfer(const KvBenchConfig &cfg, KvTransferExecut
                                       const std::vector<std::uint64_t> &rank_pool_sizes, WorkloadTransferState *state,
                                       bool trace_transfer) {
   const auto plan_start = std::chrono::steady_clock::now();
-  const bool local_copy_for_self = cfg.transport != kTransportFabricMem;
+  const bool local_copy_for_self = !TransferSelfThroughHixl(cfg);
   if (op == hixl::WRITE) {
     GeneratePlacements(rank_pool_sizes, state);
   } else if (!state->placements_ready) {
@@ -913,19 +1017,23 @@ TimingStats MeasureRepeated(const KvBenchConfig &cfg, const std::string &name,
                             const std::function<TransferStageTiming(bool)> &fn, bool sync_all_ranks,
                             const std::function<void(const TransferStageTiming &)> &after_iteration) {
   std::vector<double> samples;
+  double cpu_total_us = 0.0;
   const auto total = cfg.warmup + cfg.repeat;
   for (std::uint32_t i = 0U; i < total; ++i) {
     if (sync_all_ranks) {
       Barrier(cfg, name + "_ready_" + std::to_string(i));
     }
+    const double cpu_start = ProcessCpuTimeUs();
     const auto start = std::chrono::steady_clock::now();
     const auto stage_timing = fn(IsTraceRank(cfg));
     const auto end = std::chrono::steady_clock::now();
+    const double cpu_us = ProcessCpuTimeUs() - cpu_start;
     if (sync_all_ranks) {
       Barrier(cfg, name + "_done_" + std::to_string(i));
     }
     after_iteration(stage_timing);
     if (i >= cfg.warmup) {
+      cpu_total_us += cpu_us;
       samples.push_back(static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) /
                         kNanosecondsPerMicrosecond);
     }
@@ -934,7 +1042,8 @@ TimingStats MeasureRepeated(const KvBenchConfig &cfg, const std::string &name,
     return TimingStats{};
   }
   const double sum = std::accumulate(samples.begin(), samples.end(), 0.0);
-  return TimingStats{sum / static_cast<double>(samples.size()), Percentile99(samples)};
+  const auto sample_count = static_cast<double>(samples.size());
+  return TimingStats{sum / sample_count, Percentile99(samples), cpu_total_us / sample_count};
 }
 
 double BandwidthGbps(std::uint64_t bytes, double us) {
@@ -952,15 +1061,21 @@ TimingStats RunWorkloadPut(const KvBenchConfig &cfg, KvTransferExecutor *transfe
   if (model.IsShared() && cfg.rank != 0U) {
     return TimingStats{};
   }
+  const double cpu_start = ProcessCpuTimeUs();
   const auto put_start = std::chrono::steady_clock::now();
   const auto put_timing = ExecuteKvTransfer(cfg, transfer_executor, metas, workload, hixl::WRITE, rank_pool_sizes,
                                             transfer_state, IsTraceRank(cfg));
   const auto put_end = std::chrono::steady_clock::now();
+  const double put_cpu_us = ProcessCpuTimeUs() - cpu_start;
   const double put_us =
       static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(put_end - put_start).count()) /
       kNanosecondsPerMicrosecond;
   PrintStageTiming(cfg, hixl::WRITE, workload, put_timing.plan_us, put_timing.transfer_us);
-  return TimingStats{put_us, put_us};
+  return TimingStats{put_us, put_us, put_cpu_us};
+}
+
+double CpuUsPerSlice(const TimingStats &timing, const KvWorkload &workload) {
+  return workload.slice_count == 0U ? 0.0 : timing.cpu_avg_us / static_cast<double>(workload.slice_count);
 }
 
 KvBenchResult RunWorkload(const KvBenchConfig &cfg, KvRuntime *runtime, KvTransferExecutor *transfer_executor,
@@ -1000,7 +1115,9 @@ KvBenchResult RunWorkload(const KvBenchConfig &cfg, KvRuntime *runtime, KvTransf
                        get.avg_us,
                        put.p99_us,
                        get.p99_us,
-                       key_distribution};
+                       key_distribution,
+                       CpuUsPerSlice(put, workload),
+                       CpuUsPerSlice(get, workload)};
 }
 
 std::vector<KvBenchResult> RunBenchmark(const KvBenchConfig &cfg, KvRuntime *runtime,
@@ -1014,20 +1131,191 @@ std::vector<KvBenchResult> RunBenchmark(const KvBenchConfig &cfg, KvRuntime *run
   return results;
 }
 
+std::vector<TraceRequest> LoadReplayRequests(const KvBenchConfig &cfg) {
+  auto requests = LoadTraceFile(cfg.trace_file);
+  std::vector<TraceRequest> selected;
+  for (auto &request : requests) {
+    if (request.model == cfg.model) {
+      selected.push_back(std::move(request));
+    }
+  }
+  if (cfg.rank == 0U) {
+    std::cout << "[INFO] trace=" << cfg.trace_file << " model=" << cfg.model << " requests=" << selected.size()
+              << " skipped_other_models=" << (requests.size() - selected.size()) << std::endl;
+  }
+  if (selected.empty()) {
+    throw std::runtime_error("trace has no request for model " + cfg.model);
+  }
+  return selected;
+}
+
+/// Index the per-key tasks of the whole key space so each trace request only copies the blocks it lists.
+std::vector<KeyTransferTask> IndexTasksByKey(std::vector<KeyTransferTask> tasks, std::uint64_t key_count) {
+  std::vector<KeyTransferTask> tasks_by_key(static_cast<std::size_t>(key_count));
+  for (auto &task : tasks) {
+    if (task.key_index < key_count) {
+      tasks_by_key[static_cast<std::size_t>(task.key_index)] = std::move(task);
+    }
+  }
+  return tasks_by_key;
+}
+
+/// Tracks replayed requests that are still in flight and keeps the first failure.
+class ReplayCompletion {
+ public:
+  void Add() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++pending_;
+  }
+
+  void Done(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (error && !first_error_) {
+      first_error_ = error;
+    }
+    --pending_;
+    cv_.notify_all();
+  }
+
+  std::exception_ptr WaitAll() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return pending_ == 0U; });
+    return first_error_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::size_t pending_ = 0U;
+  std::exception_ptr first_error_;
+};
+
+void DispatchReplayRequest(KvTransferExecutor *transfer_executor, const std::vector<KeyTransferTask> &tasks_by_key,
+                           const TraceRequest &request, const std::chrono::steady_clock::time_point &origin,
+                           ReplayRequestResult *result, ReplayCompletion *completion) {
+  // Open loop: each request is issued at its trace arrival without waiting for earlier ones, so a slow request
+  // shows up as queueing delay of the ones behind it instead of delaying their arrival.
+  const auto arrival = origin + std::chrono::microseconds(request.arrival_us);
+  std::this_thread::sleep_until(arrival);
+  result->arrival_us = request.arrival_us;
+  result->token_count = request.token_count;
+  result->block_count = request.blocks.size();
+  std::vector<KeyTransferTask> tasks;
+  tasks.reserve(request.blocks.size());
+  for (const auto block : request.blocks) {
+    const auto &task = tasks_by_key.at(static_cast<std::size_t>(block));
+    if (task.descs.empty()) {
+      continue;
+    }
+    result->total_bytes += SumTransferBytes(task.descs);
+    tasks.push_back(task);
+  }
+  completion->Add();
+  transfer_executor->Submit(
+      hixl::READ, std::move(tasks), false,
+      [arrival, result, completion](const std::chrono::steady_clock::time_point &first_start,
+                                    std::exception_ptr error) {
+        const auto done = std::chrono::steady_clock::now();
+        const auto start = std::max(first_start, arrival);
+        result->queue_us = DurationUs(arrival, start);
+        result->transfer_us = DurationUs(start, done);
+        result->latency_us = DurationUs(arrival, done);
+        completion->Done(error);
+      });
+}
+
+std::vector<ReplayRequestResult> ExecuteKvReplay(const KvBenchConfig &cfg, KvRuntime *runtime,
+                                                 const std::vector<RankMeta> &metas, const ModelSpec &model,
+                                                 const KvWorkload &workload,
+                                                 const std::vector<std::uint64_t> &rank_pool_sizes,
+                                                 const std::vector<TraceRequest> &requests) {
+  const bool local_copy_for_self = !TransferSelfThroughHixl(cfg);
+  KvTransferExecutor transfer_executor(&runtime->hixl, BuildRankMetaByRank(metas), cfg.rank, cfg.transfer_threads,
+                                       kDefaultTransferTimeoutMs, runtime->aclrt_context, RecentErrMsg,
+                                       local_copy_for_self);
+  WorkloadTransferState transfer_state = BuildWorkloadTransferState(runtime->local_buffer, workload, model);
+  Barrier(cfg, "replay_ready");
+  (void)RunWorkloadPut(cfg, &transfer_executor, metas, model, workload, rank_pool_sizes, &transfer_state);
+  Barrier(cfg, "replay_put_done");
+  EnsurePlacementMetadata(rank_pool_sizes, &transfer_state);
+  const auto tasks_by_key =
+      IndexTasksByKey(BuildKeyTransferTasks(metas, transfer_state, cfg.rank, local_copy_for_self), workload.key_count);
+
+  Barrier(cfg, "replay_start");
+  // Sized up front: in-flight completions write into their own slot while later requests are dispatched.
+  std::vector<ReplayRequestResult> results(requests.size());
+  ReplayCompletion completion;
+  const auto origin = std::chrono::steady_clock::now();
+  try {
+    for (std::size_t i = 0U; i < requests.size(); ++i) {
+      DispatchReplayRequest(&transfer_executor, tasks_by_key, requests[i], origin, &results[i], &completion);
+    }
+  } catch (...) {
+    // Outstanding callbacks still reference results and completion.
+    (void)completion.WaitAll();
+    throw;
+  }
+  const auto error = completion.WaitAll();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  Barrier(cfg, "replay_done");
+  return results;
+}
+
+void WriteReplayCsv(const KvBenchConfig &cfg, const std::vector<ReplayRequestResult> &results) {
+  fs::create_directories(cfg.output_dir);
+  std::ofstream out(cfg.output_dir + "/kv_replay_rank" + std::to_string(cfg.rank) + ".csv");
+  out << "rank,model,transport,request,arrival_us,token_count,block_count,total_bytes,queue_us,transfer_us,"
+         "latency_us\n";
+  for (std::size_t i = 0U; i < results.size(); ++i) {
+    const auto &r = results[i];
+    out << cfg.rank << ',' << cfg.model << ',' << cfg.transport << ',' << i << ',' << r.arrival_us << ','
+        << r.token_count << ',' << r.block_count << ',' << r.total_bytes << ',' << r.queue_us << ',' << r.transfer_us
+        << ',' << r.latency_us << '\n';
+  }
+}
+
+void PrintReplaySummary(const KvBenchConfig &cfg, const std::vector<ReplayRequestResult> &results) {
+  std::vector<double> queue_us;
+  std::vector<double> transfer_us;
+  std::vector<double> latency_us;
+  std::uint64_t total_bytes = 0U;
+  double makespan_us = 0.0;
+  for (const auto &r : results) {
+    queue_us.push_back(r.queue_us);
+    transfer_us.push_back(r.transfer_us);
+    latency_us.push_back(r.latency_us);
+    total_bytes += r.total_bytes;
+    makespan_us = std::max(makespan_us, static_cast<double>(r.arrival_us) + r.latency_us);
+  }
+  const auto avg = [](const std::vector<double> &values) {
+    return values.empty() ? 0.0 : std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(values.size());
+  };
+  std::cout << "[INFO] rank=" << cfg.rank << " model=" << cfg.model << " replay_requests=" << results.size()
+            << " total_transfer=" << FormatBytesKiB(total_bytes) << " makespan_us=" << makespan_us
+            << " bandwidth_gbps=" << BandwidthGbps(total_bytes, makespan_us) << " queue_avg_us=" << avg(queue_us)
+            << " queue_p99_us=" << Percentile99(queue_us) << " transfer_avg_us=" << avg(transfer_us)
+            << " transfer_p99_us=" << Percentile99(transfer_us) << " latency_avg_us=" << avg(latency_us)
+            << " latency_p99_us=" << Percentile99(latency_us) << std::endl;
+}
+
 void WriteCsv(const KvBenchConfig &cfg, const std::vector<KvBenchResult> &results, std::uint64_t rank_pool_size_bytes) {
   fs::create_directories(cfg.output_dir);
   std::ofstream out(cfg.output_dir + "/kv_result_rank" + std::to_string(cfg.rank) + ".csv");
   out << "rank,model,token_length,key_count,tokens_per_key,max_slice_bytes,slice_count,total_bytes,transfer_threads,"
          "process_count,device_count,segment_count,pool_size_bytes,pool_memory,put_transfer_type,get_transfer_type,"
-         "transport,warmup,repeat,put_bandwidth_gbps,get_bandwidth_gbps,put_avg_us,get_avg_us,put_p99_us,get_p99_us\n";
+         "transport,warmup,repeat,put_bandwidth_gbps,get_bandwidth_gbps,put_avg_us,get_avg_us,put_p99_us,get_p99_us,"
+         "put_cpu_us_per_slice,get_cpu_us_per_slice\n";
   for (const auto &result : results) {
     out << cfg.rank << ',' << result.model << ',' << result.token_length << ',' << result.key_count << ','
         << result.tokens_per_key << ',' << result.max_slice_bytes << ',' << result.slice_count << ','
         << result.total_bytes << ',' << cfg.transfer_threads << ',' << cfg.num_processes << ',' << cfg.num_processes
-        << ',' << cfg.num_processes << ',' << rank_pool_size_bytes << ',' << cfg.pool_memory << ",d2rh,rh2d,"
-        << cfg.transport << ',' << cfg.warmup << ',' << cfg.repeat << ',' << result.put_bandwidth_gbps << ','
-        << result.get_bandwidth_gbps << ',' << result.put_avg_us << ',' << result.get_avg_us << ',' << result.put_p99_us
-        << ',' << result.get_p99_us << '\n';
+        << ',' << cfg.num_processes << ',' << rank_pool_size_bytes << ',' << cfg.pool_memory << ','
+        << PutTransferType(cfg) << ',' << GetTransferType(cfg) << ',' << cfg.transport << ',' << cfg.warmup << ','
+        << cfg.repeat << ',' << result.put_bandwidth_gbps << ',' << result.get_bandwidth_gbps << ','
+        << result.put_avg_us << ',' << result.get_avg_us << ',' << result.put_p99_us << ',' << result.get_p99_us << ','
+        << result.put_cpu_us_per_slice << ',' << result.get_cpu_us_per_slice << '\n';
   }
 }
 
@@ -1041,7 +1329,9 @@ void WriteJson(const KvBenchConfig &cfg, const std::vector<KvBenchResult> &resul
         << ",\"slice_count\":" << r.slice_count << ",\"total_bytes\":" << r.total_bytes
         << ",\"put_avg_us\":" << r.put_avg_us << ",\"get_avg_us\":" << r.get_avg_us
         << ",\"put_p99_us\":" << r.put_p99_us << ",\"get_p99_us\":" << r.get_p99_us
-        << ",\"put_transfer_type\":\"d2rh\",\"get_transfer_type\":\"rh2d\"}";
+        << ",\"put_cpu_us_per_slice\":" << r.put_cpu_us_per_slice
+        << ",\"get_cpu_us_per_slice\":" << r.get_cpu_us_per_slice << ",\"put_transfer_type\":\""
+        << PutTransferType(cfg) << "\",\"get_transfer_type\":\"" << GetTransferType(cfg) << "\"}";
   }
   out << "]}\n";
 }
@@ -1071,9 +1361,11 @@ void PrintSummary(const KvBenchConfig &cfg, const std::vector<KvBenchResult> &re
     std::cout << "[INFO] rank=" << cfg.rank << " model=" << result.model << " key_count=" << result.key_count
               << " total_transfer=" << FormatBytesKiB(result.total_bytes) << " slice_count=" << result.slice_count
               << " max_slice=" << FormatBytesKiB(result.max_slice_bytes) << " token_length=" << result.token_length
-              << " put=d2rh get=rh2d"
+              << " put=" << PutTransferType(cfg) << " get=" << GetTransferType(cfg)
               << " put_avg_us=" << result.put_avg_us << " get_avg_us=" << result.get_avg_us
               << " put_p99_us=" << result.put_p99_us << " get_p99_us=" << result.get_p99_us
+              << " put_cpu_us_per_slice=" << result.put_cpu_us_per_slice
+              << " get_cpu_us_per_slice=" << result.get_cpu_us_per_slice
               << " segment_key_distribution=" << FormatKeyDistribution(result.key_distribution) << std::endl;
   }
 }
@@ -1108,7 +1400,7 @@ std::vector<KvBenchResult> ExecuteKvBenchmark(const KvBenchConfig &cfg, KvRuntim
                                               const std::vector<RankMeta> &metas, const ModelSpec &model,
                                               const std::vector<KvWorkload> &workloads,
                                               const std::vector<std::uint64_t> &rank_pool_sizes) {
-  const bool local_copy_for_self = cfg.transport != kTransportFabricMem;
+  const bool local_copy_for_self = !TransferSelfThroughHixl(cfg);
   KvTransferExecutor transfer_executor(&runtime->hixl, BuildRankMetaByRank(metas), cfg.rank, cfg.transfer_threads,
                                        kDefaultTransferTimeoutMs, runtime->aclrt_context, RecentErrMsg,
                                        local_copy_for_self);
@@ -1134,7 +1426,12 @@ int RunKvBenchParsed(KvBenchConfig &cfg, KvRuntime *runtime, std::vector<RankMet
               << ")" << std::endl;
     return 1;
   }
-  const auto workloads = BuildWorkloads(cfg, *model);
+  std::vector<TraceRequest> requests;
+  if (!cfg.trace_file.empty()) {
+    requests = LoadReplayRequests(cfg);
+  }
+  const auto workloads = requests.empty() ? BuildWorkloads(cfg, *model)
+                                          : std::vector<KvWorkload>{MakeWorkload(*model, TraceKeyCount(requests))};
   if (cfg.rank == 0U) {
     PrintWorkloadTransferPlan(model->name, workloads);
   }
@@ -1154,10 +1451,17 @@ int RunKvBenchParsed(KvBenchConfig &cfg, KvRuntime *runtime, std::vector<RankMet
   ConnectPeers(cfg, runtime, *metas);
   Barrier(cfg, "all_connected");
 
-  const auto results = ExecuteKvBenchmark(cfg, runtime, *metas, *model, workloads, rank_pool_sizes);
-  WriteCsv(cfg, results, pool_size);
-  WriteJson(cfg, results);
-  PrintSummary(cfg, results);
+  if (!requests.empty()) {
+    const auto replay =
+        ExecuteKvReplay(cfg, runtime, *metas, *model, workloads.front(), rank_pool_sizes, requests);
+    WriteReplayCsv(cfg, replay);
+    PrintReplaySummary(cfg, replay);
+  } else {
+    const auto results = ExecuteKvBenchmark(cfg, runtime, *metas, *model, workloads, rank_pool_sizes);
+    WriteCsv(cfg, results, pool_size);
+    WriteJson(cfg, results);
+    PrintSummary(cfg, results);
+  }
   Barrier(cfg, "all_done");
   CleanupRuntime(cfg, runtime, *metas);
   return 0;
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "kv_trace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace hixl_kv_benchmark {
+namespace {
+
+std::uint64_t ParseTraceNumber(const std::string &text, const char *field, std::size_t line_no) {
+  std::size_t pos = 0U;
+  std::uint64_t value = 0U;
+  try {
+    value = std::stoull(text, &pos, 10);
+  } catch (const std::exception &) {
+    pos = 0U;
+  }
+  if (text.empty() || pos != text.size()) {
+    throw std::invalid_argument("trace line " + std::to_string(line_no) + ": invalid " + field + " '" + text + "'");
+  }
+  return value;
+}
+
+}  // namespace
+
+TraceRequest ParseTraceLine(const std::string &line, std::size_t line_no) {
+  std::istringstream fields(line);
+  std::string arrival;
+  std::string tokens;
+  std::string blocks;
+  TraceRequest request;
+  if (!(fields >> arrival >> request.model >> tokens >> blocks)) {
+    throw std::invalid_argument("trace line " + std::to_string(line_no) +
+                                ": expect <arrival_us> <model> <token_count> <blocks>");
+  }
+  std::string extra;
+  if (fields >> extra) {
+    throw std::invalid_argument("trace line " + std::to_string(line_no) + ": unexpected field '" + extra + "'");
+  }
+  request.arrival_us = ParseTraceNumber(arrival, "arrival_us", line_no);
+  request.token_count = ParseTraceNumber(tokens, "token_count", line_no);
+  std::istringstream block_list(blocks);
+  std::string block;
+  while (std::getline(block_list, block, ',')) {
+    request.blocks.push_back(ParseTraceNumber(block, "block", line_no));
+  }
+  if (request.blocks.empty()) {
+    throw std::invalid_argument("trace line " + std::to_string(line_no) + ": empty block list");
+  }
+  return request;
+}
+
+std::vector<TraceRequest> LoadTraceFile(const std::string &path) {
+  std::ifstream in(path);
+  if (!in.good()) {
+    throw std::runtime_error("failed to open trace file: " + path);
+  }
+  std::vector<TraceRequest> requests;
+  std::string line;
+  std::size_t line_no = 0U;
+  while (std::getline(in, line)) {
+    ++line_no;
+    const auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+    requests.push_back(ParseTraceLine(line, line_no));
+  }
+  std::stable_sort(requests.begin(), requests.end(), [](const TraceRequest &lhs, const TraceRequest &rhs) {
+    return lhs.arrival_us < rhs.arrival_us;
+  });
+  return requests;
+}
+
+std::uint64_t TraceKeyCount(const std::vector<TraceRequest> &requests) {
+  std::uint64_t key_count = 0U;
+  for (const auto &request : requests) {
+    for (const auto block : request.blocks) {
+      key_count = std::max(key_count, block + 1U);
+    }
+  }
+  return key_count;
+}
+
+}  // namespace hixl_kv_benchmark
@@ -0,0 +1,41 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef HIXL_KV_BENCHMARK_KV_TRACE_H
+#define HIXL_KV_BENCHMARK_KV_TRACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hixl_kv_benchmark {
+
+/// One request of a replay trace. Trace lines are whitespace separated:
+/// `<arrival_us> <model> <token_count> <block>[,<block>...]`; empty lines and `#` comments are skipped.
+/// Blocks are KV key indices, so requests sharing a prefix list the same leading blocks.
+struct TraceRequest {
+  std::uint64_t arrival_us = 0U;
+  std::string model;
+  std::uint64_t token_count = 0U;
+  std::vector<std::uint64_t> blocks;
+};
+
+TraceRequest ParseTraceLine(const std::string &line, std::size_t line_no);
+
+/// Loads all requests ordered by arrival time; throws on malformed lines.
+std::vector<TraceRequest> LoadTraceFile(const std::string &path);
+
+/// Number of keys the trace touches, i.e. largest block index + 1.
+std::uint64_t TraceKeyCount(const std::vector<TraceRequest> &requests);
+
+}  // namespace hixl_kv_benchmark
+
+#endif  // HIXL_KV_BENCHMARK_KV_TRACE_H
@@ -10,8 +10,10 @@
 
 #include "kv_transfer_executor.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
+#include <future>
 #include <iostream>
 #include <mutex>
 #include <stdexcept>
@@ -75,8 +77,9 @@ void TraceLocalCopy(const char *stage, std::uint32_t local_rank, std::uint32_t w
 }
 
 void SetWorkerContext(aclrtContext device_context) {
+  // Host-only transports (loopback) run without binding a device; device transports always pass a context.
   if (device_context == nullptr) {
-    throw std::runtime_error("missing aclrt context for transfer worker");
+    return;
   }
   const auto ret = aclrtSetCurrentContext(device_context);
   if (ret != ACL_ERROR_NONE) {
@@ -186,48 +189,64 @@ void KvTransferExecutor::WaitWorkersReady() {
   }
 }
 
-void KvTransferExecutor::RecordErrorAndCancelPending() {
-  if (!first_error_) {
-    first_error_ = std::current_exception();
+void KvTransferExecutor::RecordErrorAndCancelPending(TransferJob *job) {
+  if (!job->first_error) {
+    job->first_error = std::current_exception();
+  }
+  if (job->next_task < job->tasks.size()) {
+    const auto canceled = job->tasks.size() - job->next_task;
+    job->next_task = job->tasks.size();
+    job->remaining_tasks -= std::min(job->remaining_tasks, canceled);
+    for (auto it = jobs_.begin(); it != jobs_.end(); ++it) {
+      if (it->get() == job) {
+        jobs_.erase(it);
+        break;
+      }
+    }
   }
-  const auto canceled = tasks_.size() - next_task_;
-  next_task_ = tasks_.size();
-  remaining_tasks_ -= std::min(remaining_tasks_, canceled);
 }
 
-bool KvTransferExecutor::AcquireWorkerTask(KeyTransferTask *task, TransferOp *op, bool *trace_transfer) {
+std::shared_ptr<KvTransferExecutor::TransferJob> KvTransferExecutor::AcquireWorkerTask(KeyTransferTask *task) {
   std::unique_lock<std::mutex> lock(mutex_);
-  work_cv_.wait(lock, [this]() { return stop_ || (work_active_ && next_task_ < tasks_.size()); });
+  work_cv_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
   if (stop_) {
-    return false;
+    return nullptr;
+  }
+  auto job = jobs_.front();
+  if (job->next_task == 0U) {
+    job->first_start = std::chrono::steady_clock::now();
+  }
+  *task = std::move(job->tasks.at(job->next_task++));
+  if (job->next_task == job->tasks.size()) {
+    jobs_.pop_front();
   }
-  *task = std::move(tasks_.at(next_task_++));
-  *op = op_;
-  *trace_transfer = trace_transfer_;
-  return true;
+  return job;
 }
 
-void KvTransferExecutor::RunWorkerTask(std::uint32_t worker_id, const KeyTransferTask &task, TransferOp op,
-                                       bool trace_transfer) {
+void KvTransferExecutor::RunWorkerTask(std::uint32_t worker_id, const std::shared_ptr<TransferJob> &job,
+                                       const KeyTransferTask &task) {
+  std::mutex *trace_mu = job->trace_transfer ? &trace_mu_ : nullptr;
   try {
     if (task.is_self) {
-      RunLocalKeyCopy(self_rank_, worker_id, task, op, recent_errmsg_, trace_transfer ? &trace_mu_ : nullptr);
+      RunLocalKeyCopy(self_rank_, worker_id, task, job->op, recent_errmsg_, trace_mu);
     } else {
-      RunOneRemoteKey(*hixl_, self_rank_, worker_id, task, op, timeout_ms_, recent_errmsg_,
-                      trace_transfer ? &trace_mu_ : nullptr);
+      RunOneRemoteKey(*hixl_, self_rank_, worker_id, task, job->op, timeout_ms_, recent_errmsg_, trace_mu);
     }
   } catch (...) {
     std::lock_guard<std::mutex> lock(mutex_);
-    RecordErrorAndCancelPending();
+    RecordErrorAndCancelPending(job.get());
   }
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (remaining_tasks_ > 0U) {
-    --remaining_tasks_;
-  }
-  if (remaining_tasks_ == 0U && work_active_) {
-    work_active_ = false;
-    done_cv_.notify_one();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (job->remaining_tasks > 0U) {
+      --job->remaining_tasks;
+    }
+    if (job->remaining_tasks != 0U) {
+      return;
+    }
   }
+  // The last finishing task reports the batch; the lock is released so the callback may submit again.
+  job->on_done(job->first_start, job->first_error);
 }
 
 void KvTransferExecutor::WorkerLoop(std::uint32_t worker_id) {
@@ -245,15 +264,13 @@ void KvTransferExecutor::WorkerLoop(std::uint32_t worker_id) {
     ++ready_workers_;
     ready_cv_.notify_one();
   }
-  bool has_task = true;
-  while (has_task) {
+  while (true) {
     KeyTransferTask task;
-    TransferOp op = hixl::WRITE;
-    bool trace_transfer = false;
-    has_task = AcquireWorkerTask(&task, &op, &trace_transfer);
-    if (has_task) {
-      RunWorkerTask(worker_id, task, op, trace_transfer);
+    const auto job = AcquireWorkerTask(&task);
+    if (job == nullptr) {
+      break;
     }
+    RunWorkerTask(worker_id, job, task);
   }
 }
 
@@ -261,30 +278,36 @@ void KvTransferExecutor::Transfer(TransferOp op, std::vector<KeyTransferTask> ta
   if (tasks.empty()) {
     return;
   }
+  std::promise<void> done;
+  auto done_future = done.get_future();
+  Submit(op, std::move(tasks), trace_transfer,
+         [&done](const std::chrono::steady_clock::time_point &, std::exception_ptr error) {
+           if (error) {
+             done.set_exception(error);
+           } else {
+             done.set_value();
+           }
+         });
+  done_future.get();
+}
+
+void KvTransferExecutor::Submit(TransferOp op, std::vector<KeyTransferTask> tasks, bool trace_transfer,
+                                DoneCallback on_done) {
+  if (tasks.empty()) {
+    on_done(std::chrono::steady_clock::now(), nullptr);
+    return;
+  }
+  auto job = std::make_shared<TransferJob>();
+  job->op = op;
+  job->tasks = std::move(tasks);
+  job->trace_transfer = trace_transfer;
+  job->remaining_tasks = job->tasks.size();
+  job->on_done = std::move(on_done);
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (work_active_) {
-      throw std::runtime_error("internal error: transfer executor is already active");
-    }
-    tasks_ = std::move(tasks);
-    op_ = op;
-    next_task_ = 0U;
-    remaining_tasks_ = tasks_.size();
-    first_error_ = nullptr;
-    trace_transfer_ = trace_transfer;
-    work_active_ = true;
+    jobs_.push_back(std::move(job));
   }
   work_cv_.notify_all();
-  std::exception_ptr error;
-  {
-    std::unique_lock<std::mutex> lock(mutex_);
-    done_cv_.wait(lock, [this]() { return !work_active_; });
-    error = first_error_;
-    tasks_.clear();
-  }
-  if (error) {
-    std::rethrow_exception(error);
-  }
 }
 
 }  // namespace hixl_kv_benchmark
@@ -11,11 +11,15 @@
 #ifndef HIXL_KV_BENCHMARK_KV_TRANSFER_EXECUTOR_H
 #define HIXL_KV_BENCHMARK_KV_TRANSFER_EXECUTOR_H
 
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <exception>
+#include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
@@ -52,16 +56,35 @@ class KvTransferExecutor {
   KvTransferExecutor(const KvTransferExecutor &) = delete;
   KvTransferExecutor &operator=(const KvTransferExecutor &) = delete;
 
+  /// Called on a worker thread once every task of a submitted batch has finished. first_start is when a worker
+  /// picked up the batch's first task; error is the first failure, if any.
+  using DoneCallback =
+      std::function<void(const std::chrono::steady_clock::time_point &first_start, std::exception_ptr error)>;
+
+  /// Runs the tasks on the worker pool and blocks until all of them have finished.
   void Transfer(hixl::TransferOp op, std::vector<KeyTransferTask> tasks, bool trace_transfer);
+  /// Queues the tasks behind earlier batches and returns immediately; batches may overlap.
+  void Submit(hixl::TransferOp op, std::vector<KeyTransferTask> tasks, bool trace_transfer, DoneCallback on_done);
 
  private:
+  struct TransferJob {
+    hixl::TransferOp op = hixl::WRITE;
+    std::vector<KeyTransferTask> tasks;
+    bool trace_transfer = false;
+    std::size_t next_task = 0U;
+    std::size_t remaining_tasks = 0U;
+    std::chrono::steady_clock::time_point first_start;
+    std::exception_ptr first_error;
+    DoneCallback on_done;
+  };
+
   void StartWorkers();
   void StopWorkers();
   void WaitWorkersReady();
   void WorkerLoop(std::uint32_t worker_id);
-  bool AcquireWorkerTask(KeyTransferTask *task, hixl::TransferOp *op, bool *trace_transfer);
-  void RunWorkerTask(std::uint32_t worker_id, const KeyTransferTask &task, hixl::TransferOp op, bool trace_transfer);
-  void RecordErrorAndCancelPending();
+  std::shared_ptr<TransferJob> AcquireWorkerTask(KeyTransferTask *task);
+  void RunWorkerTask(std::uint32_t worker_id, const std::shared_ptr<TransferJob> &job, const KeyTransferTask &task);
+  void RecordErrorAndCancelPending(TransferJob *job);
 
   hixl::Hixl *hixl_ = nullptr;
   std::map<std::uint32_t, RankMeta> metas_by_rank_;
@@ -74,18 +97,12 @@ class KvTransferExecutor {
 
   std::mutex mutex_;
   std::condition_variable work_cv_;
-  std::condition_variable done_cv_;
   std::condition_variable ready_cv_;
   std::vector<std::thread> workers_;
-  std::vector<KeyTransferTask> tasks_;
-  hixl::TransferOp op_ = hixl::WRITE;
-  std::size_t next_task_ = 0U;
-  std::size_t remaining_tasks_ = 0U;
+  // Batches with tasks not yet handed to a worker, in submission order.
+  std::deque<std::shared_ptr<TransferJob>> jobs_;
   std::uint32_t ready_workers_ = 0U;
-  bool work_active_ = false;
   bool stop_ = false;
-  bool trace_transfer_ = false;
-  std::exception_ptr first_error_;
   std::exception_ptr startup_error_;
   std::mutex trace_mu_;
 };
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# ----------------------------------------------------------------------------
+# Copyright (c) 2026 Huawei Technologies Co., Ltd.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# ----------------------------------------------------------------------------
+
+"""Generate a synthetic request trace for ``hixl_kv_bench --trace_file``.
+
+Each output line is ``<arrival_us> <model> <token_count> <block>[,<block>...]``.
+
+- Arrivals are a two-state (calm/burst) modulated Poisson process.
+- Prompt lengths are log-normal.
+- A share of requests starts with one of a small set of popular prefixes, chosen Zipf-like.
+  Those requests list the same leading blocks.
+- The remaining blocks of each request come from a ring over ``--num_blocks``, so the key space
+  (and the benchmark pool size) stays bounded.
+
+The same ``--seed`` always yields the same trace.
+"""
+
+import argparse
+import logging
+import math
+import random
+import sys
+from pathlib import Path
+
+_BENCHMARKS_DIR = Path(__file__).resolve().parents[2]
+if str(_BENCHMARKS_DIR) not in sys.path:
+    sys.path.insert(0, str(_BENCHMARKS_DIR))
+
+from benchmark_log import configure_logging  # noqa: E402
+
+configure_logging()
+log = logging.getLogger(__name__)
+
+_US_PER_SECOND = 1_000_000
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Generate a synthetic HIXL KV replay trace')
+    parser.add_argument('--output', required=True, help='Trace file to write')
+    parser.add_argument('--model', default='deepseek-r1')
+    parser.add_argument('--requests', type=int, default=1000)
+    parser.add_argument('--rate', type=float, default=50.0, help='Mean arrival rate in calm state (requests/s)')
+    parser.add_argument('--burst_factor', type=float, default=8.0, help='Arrival rate multiplier in burst state')
+    parser.add_argument('--burst_fraction', type=float, default=0.1, help='Long-run fraction of time in burst state')
+    parser.add_argument('--burst_dwell_ms', type=float, default=200.0, help='Mean burst duration (ms)')
+    parser.add_argument('--tokens_per_key', type=int, default=128, help='Tokens per KV block (see models.json)')
+    parser.add_argument('--prompt_median', type=int, default=2048, help='Median prompt length (tokens)')
+    parser.add_argument('--prompt_sigma', type=float, default=0.8, help='Log-normal sigma of prompt length')
+    parser.add_argument('--prompt_max', type=int, default=32768)
+    parser.add_argument('--prefix_count', type=int, default=16, help='Number of shared prefixes')
+    parser.add_argument('--prefix_blocks', type=int, default=8, help='Blocks per shared prefix')
+    parser.add_argument('--prefix_share', type=float, default=0.5, help='Fraction of requests reusing a prefix')
+    parser.add_argument('--num_blocks', type=int, default=512, help='Total KV blocks addressed by the trace')
+    parser.add_argument('--seed', type=int, default=1)
+    return parser.parse_args()
+
+
+def validate(args):
+    if args.requests <= 0 or args.rate <= 0 or args.tokens_per_key <= 0 or args.prompt_median <= 0:
+        raise ValueError('requests, rate, tokens_per_key and prompt_median must be positive')
+    if not 0.0 <= args.burst_fraction < 1.0 or not 0.0 <= args.prefix_share <= 1.0:
+        raise ValueError('burst_fraction must be in [0, 1) and prefix_share in [0, 1]')
+    prefix_region = args.prefix_count * args.prefix_blocks
+    max_request_blocks = math.ceil(args.prompt_max / args.tokens_per_key)
+    if args.num_blocks < prefix_region + max_request_blocks:
+        raise ValueError(
+            f'num_blocks must be at least prefix_count*prefix_blocks + ceil(prompt_max/tokens_per_key) '
+            f'= {prefix_region + max_request_blocks}'
+        )
+
+
+class ArrivalProcess:
+    """Two-state Markov-modulated Poisson arrivals."""
+
+    def __init__(self, args, rng):
+        self._rng = rng
+        self._calm_rate = args.rate / _US_PER_SECOND
+        self._burst_rate = self._calm_rate * args.burst_factor
+        burst_dwell_us = args.burst_dwell_ms * 1000.0
+        self._burst_dwell_us = burst_dwell_us
+        self._calm_dwell_us = (burst_dwell_us * (1.0 - args.burst_fraction) / args.burst_fraction
+                               if args.burst_fraction > 0.0 else math.inf)
+        self._in_burst = False
+        self._state_end_us = self._draw_dwell()
+        self._now_us = 0.0
+
+    def _draw_dwell(self):
+        mean = self._burst_dwell_us if self._in_burst else self._calm_dwell_us
+        return math.inf if math.isinf(mean) else self._rng.expovariate(1.0 / mean)
+
+    def next_arrival_us(self):
+        while True:
+            rate = self._burst_rate if self._in_burst else self._calm_rate
+            candidate = self._now_us + self._rng.expovariate(rate)
+            if candidate < self._state_end_us:
+                self._now_us = candidate
+                return int(candidate)
+            # Memoryless: restart the draw at the state boundary with the new rate.
+            self._now_us = self._state_end_us
+            self._in_burst = not self._in_burst
+            self._state_end_us = self._now_us + self._draw_dwell()
+
+
+def prompt_tokens(args, rng):
+    tokens = int(rng.lognormvariate(math.log(args.prompt_median), args.prompt_sigma))
+    return max(1, min(tokens, args.prompt_max))
+
+
+def generate(args):
+    rng = random.Random(args.seed)
+    arrivals = ArrivalProcess(args, rng)
+    prefix_region = args.prefix_count * args.prefix_blocks
+    prefix_weights = [1.0 / (i + 1) for i in range(args.prefix_count)]
+    next_block = prefix_region
+    lines = []
+    for _ in range(args.requests):
+        arrival_us = arrivals.next_arrival_us()
+        tokens = prompt_tokens(args, rng)
+        block_count = math.ceil(tokens / args.tokens_per_key)
+        blocks = []
+        if args.prefix_count > 0 and rng.random() < args.prefix_share:
+            prefix = rng.choices(range(args.prefix_count), weights=prefix_weights)[0]
+            first = prefix * args.prefix_blocks
+            blocks.extend(range(first, first + min(args.prefix_blocks, block_count)))
+        while len(blocks) < block_count:
+            if next_block >= args.num_blocks:
+                next_block = prefix_region
+            blocks.append(next_block)
+            next_block += 1
+        lines.append(f'{arrival_us} {args.model} {tokens} {",".join(str(b) for b in blocks)}')
+    return lines
+
+
+def main():
+    args = parse_args()
+    try:
+        validate(args)
+    except ValueError as err:
+        log.error('[ERROR] %s', err)
+        return 1
+    lines = generate(args)
+    output = Path(args.output)
+    output.parent.mkdir(parents=True, exist_ok=True)
+    with output.open('w', encoding='utf-8') as trace_file:
+        trace_file.write(f'# hixl_kv_bench trace model={args.model} seed={args.seed} requests={args.requests}\n')
+        trace_file.write('\n'.join(lines) + '\n')
+    log.info('[INFO] wrote %d requests to %s', len(lines), output)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
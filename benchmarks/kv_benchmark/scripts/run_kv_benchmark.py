@@ -104,9 +104,10 @@ def parse_args():
     )
     parser.add_argument(
         '--transport',
-        choices=['roce', 'fabric_mem', 'uboe', 'ub_rtp', 'ub'],
+        choices=['roce', 'fabric_mem', 'uboe', 'ub_rtp', 'ub', 'loopback'],
         default=None,
-        help='Transport path (default: roce on A2, fabric_mem on A3/A5; uboe, ub_rtp, ub only available on A5)',
+        help='Transport path (default: roce on A2, fabric_mem on A3/A5; uboe, ub_rtp, ub only available on A5; '
+        'loopback is the CPU-only backend that needs no NPU and reports host-side CPU cost)',
     )
     parser.add_argument('--base_port', type=int, default=19000)
     parser.add_argument('--listen_host', default='127.0.0.1')
@@ -115,13 +116,18 @@ def parse_args():
     parser.add_argument('--repeat', type=int, default=10)
     parser.add_argument('--sync_timeout_sec', type=int, default=300)
     parser.add_argument('--skip_plot', action='store_true', help='Skip automatic plot generation')
+    parser.add_argument(
+        '--trace_file',
+        default=None,
+        help='Replay a request trace (see scripts/gen_kv_trace.py) instead of the key_counts loops',
+    )
     return parser.parse_args()
 
 
 def prepare_output_dir(output_dir: str) -> None:
     out_dir = Path(output_dir)
     out_dir.mkdir(parents=True, exist_ok=True)
-    for pattern in ('kv_result_rank*.csv', 'kv_result_rank*.json', 'kv_result_all.csv'):
+    for pattern in ('kv_result_rank*.csv', 'kv_result_rank*.json', 'kv_result_all.csv', 'kv_replay_rank*.csv'):
         for path in out_dir.glob(pattern):
             path.unlink()
     shutil.rmtree(out_dir / '.kv_sync', ignore_errors=True)
@@ -151,7 +157,7 @@ def combine_results(output_dir: str, num_processes: int) -> Path | None:
 
 
 def generate_plots(args):
-    if args.skip_plot:
+    if args.skip_plot or args.trace_file:
         return
     csv_path = Path(args.output_dir) / 'kv_result_all.csv'
     if not csv_path.exists():
@@ -205,6 +211,8 @@ def _kv_process_cmd(spec: KvProcessSpec) -> list[str]:
     ]
     if args.trace:
         cmd.append('--trace=1')
+    if args.trace_file:
+        cmd.append(f'--trace_file={args.trace_file}')
     return cmd
 
 
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 测量HixlBatchPut/Get在kernel内将HixlOneSideOpDesc转换为HcommBatchTransferDesc的单描述符开销。
+// legacy: 每次调用分配vector并逐元素判断读写方向；arena: 复用预分配数组并按方向特化转换循环。
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "hixl_batch_desc.h"
+
+namespace {
+constexpr uint32_t kDefaultIterations = 20000U;
+constexpr uint32_t kBatchSizes[] = {1U, 8U, 32U, 128U, 1024U, 8192U};
+
+// 防止编译器把转换结果优化掉
+volatile uint64_t g_sink = 0U;
+
+void Consume(const HcommBatchTransferDesc *descs, uint32_t num) {
+  g_sink = g_sink + descs[num - 1U].transferInfo.write.len + static_cast<uint64_t>(descs[0].transType);
+}
+
+void LegacyConvert(bool is_read, const HixlOneSideOpDesc *op_list, uint32_t list_num) {
+  std::vector<HcommBatchTransferDesc> descs(list_num);
+  for (uint32_t i = 0; i < list_num; i++) {
+    descs[i].transType = is_read ? HCOMM_TRANSFER_TYPE_READ : HCOMM_TRANSFER_TYPE_WRITE;
+    if (is_read) {
+      descs[i].transferInfo.read.len = op_list[i].len;
+      descs[i].transferInfo.read.dst = op_list[i].local_buf;
+      descs[i].transferInfo.read.src = op_list[i].remote_buf;
+    } else {
+      descs[i].transferInfo.write.len = op_list[i].len;
+      descs[i].transferInfo.write.dst = op_list[i].remote_buf;
+      descs[i].transferInfo.write.src = op_list[i].local_buf;
+    }
+  }
+  Consume(descs.data(), list_num);
+}
+
+void ArenaConvert(bool is_read, const HixlOneSideOpDesc *op_list, uint32_t list_num,
+                  std::vector<HcommBatchTransferDesc> &arena) {
+  if (arena.size() < list_num) {
+    arena.resize(list_num);
+  }
+  if (is_read) {
+    hixl::FillBatchTransferDescs<true>(op_list, list_num, arena.data());
+  } else {
+    hixl::FillBatchTransferDescs<false>(op_list, list_num, arena.data());
+  }
+  Consume(arena.data(), list_num);
+}
+
+template <typename Func>
+double MeasureNsPerDesc(uint32_t iterations, uint32_t batch, Func &&func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0U; i < iterations; ++i) {
+    func(static_cast<bool>(i & 1U));
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+  return total_ns / (static_cast<double>(iterations) * batch);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t iterations = kDefaultIterations;
+  if (argc > 1) {
+    iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    iterations = (iterations == 0U) ? kDefaultIterations : iterations;
+  }
+  std::vector<uint8_t> local(kBatchSizes[sizeof(kBatchSizes) / sizeof(kBatchSizes[0]) - 1U]);
+  std::vector<uint8_t> remote(local.size());
+  std::vector<HixlOneSideOpDesc> ops(local.size());
+  for (size_t i = 0U; i < ops.size(); ++i) {
+    ops[i] = HixlOneSideOpDesc{&remote[i], &local[i], static_cast<uint64_t>(i + 1U)};
+  }
+  std::vector<HcommBatchTransferDesc> arena;
+  std::printf("%-10s %-10s %-18s %-18s %-8s\n", "batch", "iters", "legacy(ns/desc)", "arena(ns/desc)", "speedup");
+  for (uint32_t batch : kBatchSizes) {
+    // 大batch减少迭代次数，使每组耗时量级接近
+    const uint32_t iters = std::max(1U, iterations / std::max(1U, batch / 32U));
+    const double legacy = MeasureNsPerDesc(iters, batch, [&](bool is_read) {
+      LegacyConvert(is_read, ops.data(), batch);
+    });
+    const double arena_ns = MeasureNsPerDesc(iters, batch, [&](bool is_read) {
+      ArenaConvert(is_read, ops.data(), batch, arena);
+    });
+    std::printf("%-10u %-10u %-18.3f %-18.3f %-8.2f\n", batch, iters, legacy, arena_ns,
+                (arena_ns > 0.0) ? legacy / arena_ns : 0.0);
+  }
+  return 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 后台线程持续发起大块TransferAsync时，测量同一远端上小块TransferSync的时延分布。
+// 分别以NORMAL与BULK优先级发起后台大块请求：NORMAL整块一次下发，小块请求需等待整块完成；
+// BULK按块拆分、随状态查询逐块下发，小块请求最多等待一个块。
+// 同一进程内起server/client两个Hixl，使用loopback传输后端(数据面为内存拷贝)，不依赖device。
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "hixl/hixl.h"
+
+namespace {
+constexpr uint32_t kDefaultIterations = 2000U;
+constexpr size_t kSmallSize = 4096U;
+constexpr size_t kBulkSize = 64U * 1024U * 1024U;
+constexpr int32_t kTimeoutMs = 3000;
+constexpr const char kServerEngine[] = "127.0.0.1:26451";
+constexpr const char kClientEngine[] = "127.0.0.1";
+constexpr double kNsPerSecond = 1e9;
+constexpr double kNsPerUs = 1e3;
+
+struct LatencyStat {
+  double p50_us = 0.0;
+  double p99_us = 0.0;
+  double max_us = 0.0;
+  uint64_t bulk_done = 0U;
+};
+
+double NowNs() {
+  timespec ts{};
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) * kNsPerSecond + static_cast<double>(ts.tv_nsec);
+}
+
+std::map<hixl::AscendString, hixl::AscendString> LoopbackOptions() {
+  std::map<hixl::AscendString, hixl::AscendString> options;
+  options[hixl::OPTION_BUFFER_POOL] = "0:0";
+  options[hixl::OPTION_LOCAL_COMM_RES] =
+      "{\"version\":\"1.3\",\"net_instance_id\":\"default\",\"endpoint_list\":["
+      "{\"protocol\":\"roce\",\"comm_id\":\"127.0.0.1\",\"placement\":\"host\"}]}";
+  options[hixl::OPTION_GLOBAL_RESOURCE_CONFIG] = "{\"comm_resource_config.transport\":\"loopback\"}";
+  return options;
+}
+
+bool Check(hixl::Status ret, const char *what) {
+  if (ret != hixl::SUCCESS) {
+    std::fprintf(stderr, "%s failed, ret:%u\n", what, ret);
+    return false;
+  }
+  return true;
+}
+
+// 后台循环发起大块请求并轮询至完成，直到stop置位
+void RunBulkLoad(hixl::Hixl &client, hixl::RemoteHandle handle, const std::vector<hixl::TransferOpDesc> &op_descs,
+                 hixl::TransferPriority priority, const std::atomic<bool> &stop, std::atomic<uint64_t> &done) {
+  hixl::TransferArgs args{};
+  args.priority = priority;
+  while (!stop.load()) {
+    hixl::TransferReq req = nullptr;
+    if (client.TransferAsync(handle, hixl::WRITE, op_descs, args, req) != hixl::SUCCESS) {
+      std::fprintf(stderr, "bulk TransferAsync failed\n");
+      std::exit(EXIT_FAILURE);
+    }
+    hixl::TransferStatus status = hixl::TransferStatus::WAITING;
+    while (status == hixl::TransferStatus::WAITING) {
+      if (client.GetTransferStatus(req, status) != hixl::SUCCESS) {
+        std::fprintf(stderr, "bulk GetTransferStatus failed\n");
+        std::exit(EXIT_FAILURE);
+      }
+    }
+    done.fetch_add(1U);
+  }
+}
+
+LatencyStat MeasureSmall(hixl::Hixl &client, hixl::RemoteHandle handle, uint32_t iterations,
+                         const std::vector<hixl::TransferOpDesc> &small_descs,
+                         const std::vector<hixl::TransferOpDesc> *bulk_descs, hixl::TransferPriority priority) {
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> bulk_done{0U};
+  std::thread bulk_thread;
+  if (bulk_descs != nullptr) {
+    bulk_thread = std::thread([&]() { RunBulkLoad(client, handle, *bulk_descs, priority, stop, bulk_done); });
+  }
+  std::vector<double> latencies;
+  latencies.reserve(iterations);
+  for (uint32_t i = 0U; i < iterations; ++i) {
+    const double start = NowNs();
+    if (client.TransferSync(handle, hixl::WRITE, small_descs, kTimeoutMs) != hixl::SUCCESS) {
+      std::fprintf(stderr, "small TransferSync failed at iteration %u\n", i);
+      std::exit(EXIT_FAILURE);
+    }
+    latencies.emplace_back((NowNs() - start) / kNsPerUs);
+  }
+  stop = true;
+  if (bulk_thread.joinable()) {
+    bulk_thread.join();
+  }
+  std::sort(latencies.begin(), latencies.end());
+  LatencyStat stat;
+  stat.p50_us = latencies[latencies.size() / 2U];
+  stat.p99_us = latencies[latencies.size() * 99U / 100U];
+  stat.max_us = latencies.back();
+  stat.bulk_done = bulk_done.load();
+  return stat;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t iterations = kDefaultIterations;
+  if (argc > 1) {
+    iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    iterations = (iterations == 0U) ? kDefaultIterations : iterations;
+  }
+  std::vector<uint8_t> local(kBulkSize + kSmallSize, 0x5AU);
+  std::vector<uint8_t> remote(kBulkSize + kSmallSize, 0U);
+  hixl::Hixl server;
+  hixl::Hixl client;
+  hixl::MemHandle server_mem = nullptr;
+  hixl::MemHandle client_mem = nullptr;
+  hixl::RemoteHandle remote_handle = nullptr;
+  hixl::MemDesc remote_desc{reinterpret_cast<uintptr_t>(remote.data()), remote.size()};
+  hixl::MemDesc local_desc{reinterpret_cast<uintptr_t>(local.data()), local.size()};
+  if (!Check(server.Initialize(kServerEngine, LoopbackOptions()), "server Initialize") ||
+      !Check(client.Initialize(kClientEngine, LoopbackOptions()), "client Initialize") ||
+      !Check(server.RegisterMem(remote_desc, hixl::MEM_HOST, server_mem), "server RegisterMem") ||
+      !Check(client.RegisterMem(local_desc, hixl::MEM_HOST, client_mem), "client RegisterMem") ||
+      !Check(client.Connect(kServerEngine, kTimeoutMs), "Connect") ||
+      !Check(client.ResolveRemote(kServerEngine, remote_handle, kTimeoutMs), "ResolveRemote")) {
+    return EXIT_FAILURE;
+  }
+
+  const std::vector<hixl::TransferOpDesc> bulk_descs{
+      {reinterpret_cast<uintptr_t>(local.data()), reinterpret_cast<uintptr_t>(remote.data()), kBulkSize}};
+  const std::vector<hixl::TransferOpDesc> small_descs{{reinterpret_cast<uintptr_t>(local.data() + kBulkSize),
+                                                       reinterpret_cast<uintptr_t>(remote.data() + kBulkSize),
+                                                       kSmallSize}};
+  // 预热，排除首次调用的一次性开销
+  (void)client.TransferSync(remote_handle, hixl::WRITE, small_descs, kTimeoutMs);
+
+  std::printf("small=%zuB bulk=%zuB iters=%u\n", kSmallSize, kBulkSize, iterations);
+  std::printf("%-16s %-12s %-12s %-12s %-12s\n", "bulk_load", "p50(us)", "p99(us)", "max(us)", "bulk_done");
+  struct Case {
+    const char *name;
+    const std::vector<hixl::TransferOpDesc> *bulk;
+    hixl::TransferPriority priority;
+  };
+  const Case cases[] = {{"none", nullptr, hixl::TransferPriority::NORMAL},
+                        {"normal", &bulk_descs, hixl::TransferPriority::NORMAL},
+                        {"bulk", &bulk_descs, hixl::TransferPriority::BULK}};
+  for (const auto &c : cases) {
+    const LatencyStat stat = MeasureSmall(client, remote_handle, iterations, small_descs, c.bulk, c.priority);
+    std::printf("%-16s %-12.1f %-12.1f %-12.1f %-12lu\n", c.name, stat.p50_us, stat.p99_us, stat.max_us,
+                stat.bulk_done);
+  }
+
+  (void)client.ReleaseRemote(remote_handle);
+  (void)client.Disconnect(kServerEngine, kTimeoutMs);
+  (void)client.DeregisterMem(client_mem);
+  (void)server.DeregisterMem(server_mem);
+  client.Finalize();
+  server.Finalize();
+  return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 对比按远端名称与经ResolveRemote句柄发起小块TransferSync的单次调用开销。
+// 同一进程内起server/client两个Hixl，使用loopback传输后端(数据面为内存拷贝)，
+// 传输本身耗时极小，测得的墙钟与线程CPU时间基本即为接口层开销。不依赖device。
+// 按名称的路径每次调用都会打印INFO日志，开启INFO级别日志时两者差距更大。
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "hixl/hixl.h"
+
+namespace {
+constexpr uint32_t kDefaultIterations = 200000U;
+constexpr size_t kTransferSizes[] = {8U, 64U, 512U, 4096U};
+constexpr size_t kBufferSize = 4096U;
+constexpr int32_t kTimeoutMs = 3000;
+constexpr const char kServerEngine[] = "127.0.0.1:26450";
+constexpr const char kClientEngine[] = "127.0.0.1";
+constexpr double kNsPerSecond = 1e9;
+
+struct CallCost {
+  double wall_ns = 0.0;
+  double cpu_ns = 0.0;
+};
+
+double NowNs(clockid_t clock_id) {
+  timespec ts{};
+  (void)clock_gettime(clock_id, &ts);
+  return static_cast<double>(ts.tv_sec) * kNsPerSecond + static_cast<double>(ts.tv_nsec);
+}
+
+std::map<hixl::AscendString, hixl::AscendString> LoopbackOptions() {
+  std::map<hixl::AscendString, hixl::AscendString> options;
+  options[hixl::OPTION_BUFFER_POOL] = "0:0";
+  options[hixl::OPTION_LOCAL_COMM_RES] =
+      "{\"version\":\"1.3\",\"net_instance_id\":\"default\",\"endpoint_list\":["
+      "{\"protocol\":\"roce\",\"comm_id\":\"127.0.0.1\",\"placement\":\"host\"}]}";
+  options[hixl::OPTION_GLOBAL_RESOURCE_CONFIG] = "{\"comm_resource_config.transport\":\"loopback\"}";
+  return options;
+}
+
+template <typename TransferFunc>
+CallCost Measure(uint32_t iterations, const TransferFunc &transfer) {
+  const double wall_start = NowNs(CLOCK_MONOTONIC);
+  const double cpu_start = NowNs(CLOCK_THREAD_CPUTIME_ID);
+  for (uint32_t i = 0U; i < iterations; ++i) {
+    if (transfer() != hixl::SUCCESS) {
+      std::fprintf(stderr, "TransferSync failed at iteration %u\n", i);
+      std::exit(EXIT_FAILURE);
+    }
+  }
+  CallCost cost;
+  cost.cpu_ns = (NowNs(CLOCK_THREAD_CPUTIME_ID) - cpu_start) / iterations;
+  cost.wall_ns = (NowNs(CLOCK_MONOTONIC) - wall_start) / iterations;
+  return cost;
+}
+
+bool Check(hixl::Status ret, const char *what) {
+  if (ret != hixl::SUCCESS) {
+    std::fprintf(stderr, "%s failed, ret:%u\n", what, ret);
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t iterations = kDefaultIterations;
+  if (argc > 1) {
+    iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    iterations = (iterations == 0U) ? kDefaultIterations : iterations;
+  }
+  std::vector<uint8_t> local(kBufferSize, 0x5AU);
+  std::vector<uint8_t> remote(kBufferSize, 0U);
+  hixl::Hixl server;
+  hixl::Hixl client;
+  hixl::MemHandle server_mem = nullptr;
+  hixl::MemHandle client_mem = nullptr;
+  hixl::RemoteHandle remote_handle = nullptr;
+  hixl::MemDesc remote_desc{reinterpret_cast<uintptr_t>(remote.data()), remote.size()};
+  hixl::MemDesc local_desc{reinterpret_cast<uintptr_t>(local.data()), local.size()};
+  if (!Check(server.Initialize(kServerEngine, LoopbackOptions()), "server Initialize") ||
+      !Check(client.Initialize(kClientEngine, LoopbackOptions()), "client Initialize") ||
+      !Check(server.RegisterMem(remote_desc, hixl::MEM_HOST, server_mem), "server RegisterMem") ||
+      !Check(client.RegisterMem(local_desc, hixl::MEM_HOST, client_mem), "client RegisterMem") ||
+      !Check(client.Connect(kServerEngine, kTimeoutMs), "Connect") ||
+      !Check(client.ResolveRemote(kServerEngine, remote_handle, kTimeoutMs), "ResolveRemote")) {
+    return EXIT_FAILURE;
+  }
+
+  std::printf("%-10s %-10s %-16s %-16s %-16s %-16s %-12s\n", "size(B)", "iters", "name_wall(ns)", "name_cpu(ns)",
+              "handle_wall(ns)", "handle_cpu(ns)", "cpu_saved(%)");
+  const hixl::AscendString remote_engine(kServerEngine);
+  for (size_t size : kTransferSizes) {
+    const std::vector<hixl::TransferOpDesc> op_descs{
+        {reinterpret_cast<uintptr_t>(local.data()), reinterpret_cast<uintptr_t>(remote.data()), size}};
+    // 预热，排除首次调用的一次性开销
+    (void)client.TransferSync(remote_engine, hixl::WRITE, op_descs, kTimeoutMs);
+    (void)client.TransferSync(remote_handle, hixl::WRITE, op_descs, kTimeoutMs);
+    const CallCost by_name = Measure(
+        iterations, [&]() { return client.TransferSync(remote_engine, hixl::WRITE, op_descs, kTimeoutMs); });
+    const CallCost by_handle = Measure(
+        iterations, [&]() { return client.TransferSync(remote_handle, hixl::WRITE, op_descs, kTimeoutMs); });
+    const double saved = (by_name.cpu_ns > 0.0) ? (by_name.cpu_ns - by_handle.cpu_ns) * 100.0 / by_name.cpu_ns : 0.0;
+    std::printf("%-10zu %-10u %-16.1f %-16.1f %-16.1f %-16.1f %-12.1f\n", size, iterations, by_name.wall_ns,
+                by_name.cpu_ns, by_handle.wall_ns, by_handle.cpu_ns, saved);
+  }
+
+  (void)client.ReleaseRemote(remote_handle);
+  (void)client.Disconnect(kServerEngine, kTimeoutMs);
+  (void)client.DeregisterMem(client_mem);
+  (void)server.DeregisterMem(server_mem);
+  client.Finalize();
+  server.Finalize();
+  return 0;
+}
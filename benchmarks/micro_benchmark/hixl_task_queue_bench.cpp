@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 线程池任务队列吞吐对比：原实现(std::mutex + std::condition_variable + std::queue<std::function>)
+// 与BlockingMpmcQueue<InlineTask>。多个生产者并发提交小任务，多个工作线程取出执行，统计每秒完成的任务数。
+// 任务按commit的写法封装为std::packaged_task：原实现经shared_ptr包装后放入std::function，新实现直接移入InlineTask。
+// 仅依赖头文件，不依赖device。
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "common/inline_task.h"
+#include "common/mpmc_queue.h"
+
+namespace {
+constexpr uint64_t kDefaultTasksPerProducer = 200000U;
+constexpr size_t kQueueCapacity = 4096U;
+constexpr double kNsPerSecond = 1e9;
+constexpr double kMillion = 1e6;
+
+double NowNs() {
+  timespec ts{};
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) * kNsPerSecond + static_cast<double>(ts.tv_nsec);
+}
+
+// 模拟std::bind后携带若干参数的任务
+struct TaskArgs {
+  std::atomic<uint64_t> *counter;
+  uint64_t args[3U];
+};
+
+void RunTask(const TaskArgs &args) {
+  args.counter->fetch_add(1U, std::memory_order_relaxed);
+}
+
+// 与改造前ThreadPool::commit/PopTask一致的队列
+class MutexTaskQueue {
+ public:
+  void Push(const TaskArgs &args) {
+    const auto task = std::make_shared<std::packaged_task<void()>>([args]() { RunTask(args); });
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      tasks_.emplace([task]() { (*task)(); });
+    }
+    cond_var_.notify_one();
+  }
+
+  bool Pop(std::function<void()> &task) {
+    std::unique_lock<std::mutex> lock{mutex_};
+    cond_var_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+    if (tasks_.empty()) {
+      return false;
+    }
+    task = std::move(tasks_.front());
+    tasks_.pop();
+    return true;
+  }
+
+  void Close() {
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      stopped_ = true;
+    }
+    cond_var_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cond_var_;
+  std::queue<std::function<void()>> tasks_;
+  bool stopped_ = false;
+};
+
+class MpmcTaskQueue {
+ public:
+  void Push(const TaskArgs &args) {
+    (void)queue_.Emplace(std::packaged_task<void()>([args]() { RunTask(args); }));
+  }
+
+  bool Pop(hixl::InlineTask &task) {
+    return queue_.Pop(task);
+  }
+
+  void Close() {
+    queue_.Close();
+  }
+
+ private:
+  hixl::BlockingMpmcQueue<hixl::InlineTask> queue_{kQueueCapacity};
+};
+
+template <typename Queue, typename Task>
+double Measure(uint32_t producer_num, uint32_t worker_num, uint64_t tasks_per_producer) {
+  Queue queue;
+  std::atomic<uint64_t> done{0U};
+  std::vector<std::thread> workers;
+  for (uint32_t i = 0U; i < worker_num; ++i) {
+    workers.emplace_back([&queue]() {
+      Task task;
+      while (queue.Pop(task)) {
+        task();
+      }
+    });
+  }
+  const double start = NowNs();
+  std::vector<std::thread> producers;
+  for (uint32_t i = 0U; i < producer_num; ++i) {
+    producers.emplace_back([&queue, &done, tasks_per_producer]() {
+      for (uint64_t n = 0U; n < tasks_per_producer; ++n) {
+        queue.Push(TaskArgs{&done, {n, n + 1U, n + 2U}});
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  const uint64_t total = static_cast<uint64_t>(producer_num) * tasks_per_producer;
+  while (done.load(std::memory_order_relaxed) < total) {
+    std::this_thread::yield();
+  }
+  const double elapsed_ns = NowNs() - start;
+  queue.Close();
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  return static_cast<double>(total) / (elapsed_ns / kNsPerSecond) / kMillion;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint64_t tasks_per_producer = kDefaultTasksPerProducer;
+  if (argc > 1) {
+    tasks_per_producer = std::strtoull(argv[1], nullptr, 10);
+    tasks_per_producer = (tasks_per_producer == 0U) ? kDefaultTasksPerProducer : tasks_per_producer;
+  }
+  struct Case {
+    uint32_t producers;
+    uint32_t workers;
+  };
+  const Case cases[] = {{1U, 1U}, {1U, 4U}, {4U, 4U}, {8U, 4U}, {8U, 16U}};
+  std::printf("tasks_per_producer=%lu capacity=%zu\n", tasks_per_producer, kQueueCapacity);
+  std::printf("%-10s %-10s %-18s %-18s %-8s\n", "producers", "workers", "mutex(Mtask/s)", "mpmc(Mtask/s)", "speedup");
+  for (const auto &c : cases) {
+    const double mutex_rate =
+        Measure<MutexTaskQueue, std::function<void()>>(c.producers, c.workers, tasks_per_producer);
+    const double mpmc_rate = Measure<MpmcTaskQueue, hixl::InlineTask>(c.producers, c.workers, tasks_per_producer);
+    std::printf("%-10u %-10u %-18.2f %-18.2f %-8.2f\n", c.producers, c.workers, mutex_rate, mpmc_rate,
+                mpmc_rate / mutex_rate);
+  }
+  return 0;
+}
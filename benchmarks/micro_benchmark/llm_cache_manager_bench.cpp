@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 测量CacheManager在大量存活key下的分配/释放开销及并发查询延迟。
+// 先注册live_keys个cache(每个cache一个key)，之后每轮释放最老的cache并注册一个新cache，
+// 同时一个查询线程持续按key调用GetCacheEntry，统计查询吞吐与最大延迟。
+// Register/UnregisterCacheEntry与Allocate/Deallocate共用索引增删路径，且不依赖device内存池。
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "cache_mgr/cache_manager.h"
+
+namespace {
+constexpr uint32_t kDefaultIterations = 200000U;
+constexpr uint32_t kLiveKeyNums[] = {1000U, 10000U, 100000U};
+constexpr uint64_t kModelId = 0U;
+constexpr int64_t kTensorSize = 4096;
+
+struct ChurnResult {
+  double churn_ns = 0.0;
+  double lookup_mops = 0.0;
+  double lookup_max_us = 0.0;
+};
+
+std::vector<llm::CacheKey> MakeCacheKeys(uint64_t req_id) {
+  llm::CacheKey cache_key{};
+  cache_key.req_id = req_id;
+  cache_key.model_id = kModelId;
+  return {cache_key};
+}
+
+bool Register(llm::CacheManager &cache_manager, const llm::CacheDesc &cache_desc, int64_t cache_id) {
+  std::vector<uintptr_t> addrs(cache_desc.num_tensors, static_cast<uintptr_t>(cache_id + 1));
+  return cache_manager.RegisterCacheEntry(cache_id, MakeCacheKeys(static_cast<uint64_t>(cache_id)), cache_desc, addrs,
+                                          kTensorSize) == ge::SUCCESS;
+}
+
+ChurnResult RunChurn(uint32_t live_keys, uint32_t iterations) {
+  llm::CacheDesc cache_desc{};
+  cache_desc.num_tensors = 2U;
+  cache_desc.data_type = ge::DT_FLOAT16;
+  cache_desc.shape = {1, kTensorSize / 2};
+  llm::CacheManager cache_manager;
+  for (uint32_t i = 0U; i < live_keys; ++i) {
+    (void)Register(cache_manager, cache_desc, static_cast<int64_t>(i));
+  }
+
+  std::atomic<bool> stop{false};
+  std::atomic<int64_t> oldest{0};
+  uint64_t lookups = 0U;
+  double lookup_max_ns = 0.0;
+  std::thread reader([&]() {
+    llm::CacheEntry cache_entry;
+    uint64_t seed = 0x9e3779b97f4a7c15ULL;
+    while (!stop.load(std::memory_order_relaxed)) {
+      seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+      // 在当前存活窗口内随机挑选key，命中与否均计入
+      const uint64_t req_id = static_cast<uint64_t>(oldest.load(std::memory_order_relaxed)) + (seed >> 33U) % live_keys;
+      const auto start = std::chrono::steady_clock::now();
+      (void)cache_manager.GetCacheEntry(llm::DataCacheKey{req_id, kModelId}, false, cache_entry);
+      const auto end = std::chrono::steady_clock::now();
+      lookup_max_ns = std::max(lookup_max_ns, std::chrono::duration<double, std::nano>(end - start).count());
+      ++lookups;
+    }
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0U; i < iterations; ++i) {
+    const int64_t victim = static_cast<int64_t>(i);
+    (void)cache_manager.UnregisterCacheEntry(victim);
+    oldest.store(victim + 1, std::memory_order_relaxed);
+    (void)Register(cache_manager, cache_desc, static_cast<int64_t>(live_keys) + victim);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  stop.store(true, std::memory_order_relaxed);
+  reader.join();
+
+  const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+  ChurnResult result;
+  result.churn_ns = total_ns / iterations;
+  result.lookup_mops = (total_ns > 0.0) ? static_cast<double>(lookups) * 1000.0 / total_ns : 0.0;
+  result.lookup_max_us = lookup_max_ns / 1000.0;
+  cache_manager.Finalize();
+  return result;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t iterations = kDefaultIterations;
+  if (argc > 1) {
+    iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    iterations = (iterations == 0U) ? kDefaultIterations : iterations;
+  }
+  std::printf("%-10s %-10s %-20s %-20s %-18s\n", "live_keys", "iters", "churn(ns/op)", "lookup(Mops/s)",
+              "lookup_max(us)");
+  for (uint32_t live_keys : kLiveKeyNums) {
+    const ChurnResult result = RunChurn(live_keys, iterations);
+    std::printf("%-10u %-10u %-20.1f %-20.3f %-18.1f\n", live_keys, iterations, result.churn_ns, result.lookup_mops,
+                result.lookup_max_us);
+  }
+  return 0;
+}
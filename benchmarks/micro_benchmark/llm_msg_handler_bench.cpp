@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 测量MsgHandlerPlugin在本机回环TCP连接上的消息收发开销。
+// 客户端通过MsgHandlerPlugin::Connect建连，服务端线程对每条消息原样回送，
+// 统计不同消息大小下的往返吞吐(msgs/s)与p50/p99往返时延。不依赖device。
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "common/msg_handler_plugin.h"
+
+namespace {
+constexpr uint32_t kDefaultIterations = 100000U;
+constexpr size_t kMsgSizes[] = {64U, 1024U, 16U * 1024U, 256U * 1024U};
+constexpr int32_t kMsgType = 1;
+constexpr int32_t kConnectTimeoutMs = 3000;
+
+struct EchoResult {
+  double msgs_per_sec = 0.0;
+  double p50_us = 0.0;
+  double p99_us = 0.0;
+};
+
+bool Listen(int32_t &listen_fd, uint32_t &port) {
+  listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (listen_fd < 0) {
+    return false;
+  }
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  socklen_t addr_len = sizeof(addr);
+  if ((bind(listen_fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0) || (listen(listen_fd, 1) != 0) ||
+      (getsockname(listen_fd, reinterpret_cast<sockaddr *>(&addr), &addr_len) != 0)) {
+    close(listen_fd);
+    return false;
+  }
+  port = ntohs(addr.sin_port);
+  return true;
+}
+
+void EchoServer(int32_t listen_fd, uint32_t iterations) {
+  const int32_t conn_fd = accept(listen_fd, nullptr, nullptr);
+  if (conn_fd < 0) {
+    return;
+  }
+  int32_t msg_type = 0;
+  std::vector<char> msg;
+  for (uint32_t i = 0U; i < iterations; ++i) {
+    if ((llm::MsgHandlerPlugin::RecvMsg(conn_fd, msg_type, msg) != ge::SUCCESS) ||
+        (llm::MsgHandlerPlugin::SendMsg(conn_fd, msg_type, std::string(msg.data(), msg.size() - 1U)) !=
+         ge::SUCCESS)) {
+      break;
+    }
+  }
+  close(conn_fd);
+}
+
+bool RunEcho(size_t msg_size, uint32_t iterations, EchoResult &result) {
+  int32_t listen_fd = -1;
+  uint32_t port = 0U;
+  if (!Listen(listen_fd, port)) {
+    return false;
+  }
+  std::thread server(EchoServer, listen_fd, iterations);
+  int32_t conn_fd = -1;
+  if (llm::MsgHandlerPlugin::Connect("127.0.0.1", port, conn_fd, kConnectTimeoutMs, ge::FAILED) != ge::SUCCESS) {
+    close(listen_fd);
+    server.join();
+    return false;
+  }
+  const std::string payload(msg_size, 'x');
+  std::vector<double> latencies_us;
+  latencies_us.reserve(iterations);
+  int32_t msg_type = 0;
+  std::vector<char> reply;
+  bool ok = true;
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0U; i < iterations; ++i) {
+    const auto send_start = std::chrono::steady_clock::now();
+    if ((llm::MsgHandlerPlugin::SendMsg(conn_fd, kMsgType, payload) != ge::SUCCESS) ||
+        (llm::MsgHandlerPlugin::RecvMsg(conn_fd, msg_type, reply) != ge::SUCCESS)) {
+      ok = false;
+      break;
+    }
+    const auto recv_end = std::chrono::steady_clock::now();
+    latencies_us.emplace_back(std::chrono::duration<double, std::micro>(recv_end - send_start).count());
+  }
+  const auto end = std::chrono::steady_clock::now();
+  llm::MsgHandlerPlugin::Disconnect(conn_fd);
+  server.join();
+  close(listen_fd);
+  if (!ok || latencies_us.empty()) {
+    return false;
+  }
+  std::sort(latencies_us.begin(), latencies_us.end());
+  const double total_s = std::chrono::duration<double>(end - start).count();
+  result.msgs_per_sec = (total_s > 0.0) ? static_cast<double>(latencies_us.size()) / total_s : 0.0;
+  result.p50_us = latencies_us[latencies_us.size() / 2U];
+  result.p99_us = latencies_us[latencies_us.size() * 99U / 100U];
+  return true;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  uint32_t iterations = kDefaultIterations;
+  if (argc > 1) {
+    iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    iterations = (iterations == 0U) ? kDefaultIterations : iterations;
+  }
+  llm::MsgHandlerPlugin plugin;
+  plugin.Initialize();
+  std::printf("%-12s %-10s %-16s %-12s %-12s\n", "msg_size(B)", "iters", "round_trip/s", "p50(us)", "p99(us)");
+  for (size_t msg_size : kMsgSizes) {
+    EchoResult result;
+    if (!RunEcho(msg_size, iterations, result)) {
+      std::printf("%-12zu echo failed\n", msg_size);
+      return -1;
+    }
+    std::printf("%-12zu %-10u %-16.0f %-12.1f %-12.1f\n", msg_size, iterations, result.msgs_per_sec, result.p50_us,
+                result.p99_us);
+  }
+  return 0;
+}
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// 请求/响应模式下拉取N个key的开销对比：逐key请求(N次往返)与PullCaches合并请求(每kMaxBatchPullItemNum个key一次往返)。
+// 客户端按TransferCacheReq格式组包写入请求缓冲，服务端线程解析请求并写回ResponseInfo，
+// 每次往返额外忙等一段链路时延(默认20us，模拟HCCL写请求/响应与stream同步)，统计每秒拉取的key数。不依赖device。
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "common/common.h"
+#include "common/transfer_message_limits.h"
+
+namespace {
+using llm::ResponseInfo;
+using llm::TransferCacheReq;
+using llm::TransferInfo;
+using llm::transfer_message_limits::CalcMinRequestSize;
+using llm::transfer_message_limits::CalcResponseSize;
+using llm::transfer_message_limits::kBufferInfoMultiplierD2dH2d;
+using llm::transfer_message_limits::kDefaultReqBufferSize;
+using llm::transfer_message_limits::kDefaultRespBufferSize;
+using llm::transfer_message_limits::kMaxBatchPullItemNum;
+using llm::transfer_message_limits::kMaxRequestPayloadSize;
+
+constexpr double kDefaultRttUs = 20.0;
+constexpr uint32_t kIterations = 20U;
+constexpr uint32_t kDstAddrCount = 2U;
+constexpr uint32_t kBlocksPerKey = 4U;
+constexpr uint32_t kKeyNums[] = {1U, 8U, 64U, 256U, 1024U};
+constexpr double kNsPerSecond = 1e9;
+constexpr double kNsPerUs = 1e3;
+
+double NowNs() {
+  timespec ts{};
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<double>(ts.tv_sec) * kNsPerSecond + static_cast<double>(ts.tv_nsec);
+}
+
+void SpinFor(double ns) {
+  const double deadline = NowNs() + ns;
+  while (NowNs() < deadline) {
+  }
+}
+
+// 模拟对端的请求/响应缓冲与SendState的解析
+class LoopbackPeer {
+ public:
+  explicit LoopbackPeer(double rtt_ns)
+      : rtt_ns_(rtt_ns), req_(kDefaultReqBufferSize), resp_(kDefaultRespBufferSize), server_([this]() { Serve(); }) {}
+
+  ~LoopbackPeer() {
+    stopped_.store(true, std::memory_order_release);
+    server_.join();
+  }
+
+  uint8_t *RequestBuffer() {
+    return req_.data();
+  }
+
+  // 发出请求并等待响应，返回响应中的子请求个数
+  uint32_t RoundTrip() {
+    const uint32_t seq = req_seq_.load(std::memory_order_relaxed) + 1U;
+    req_seq_.store(seq, std::memory_order_release);
+    while (resp_seq_.load(std::memory_order_acquire) != seq) {
+      std::this_thread::yield();
+    }
+    return reinterpret_cast<const ResponseInfo *>(resp_.data())->transfer_count;
+  }
+
+ private:
+  void Serve() {
+    uint32_t handled = 0U;
+    while (!stopped_.load(std::memory_order_acquire)) {
+      const uint32_t seq = req_seq_.load(std::memory_order_acquire);
+      if (seq == handled) {
+        std::this_thread::yield();
+        continue;
+      }
+      SpinFor(rtt_ns_);
+      const auto *header = reinterpret_cast<const TransferCacheReq *>(req_.data());
+      auto *resp = new (resp_.data()) ResponseInfo{};
+      resp->ret_code = 0;
+      if (header->is_pull_block == llm::kBatchPullFlag) {
+        uint64_t offset = sizeof(TransferCacheReq);
+        for (uint32_t i = 0U; i < header->buffer_info_count; ++i) {
+          const auto *item = reinterpret_cast<const TransferCacheReq *>(req_.data() + offset);
+          resp->sync_flag_addresses[i] = (item->buffer_info_count == kBlocksPerKey) ? 0U : 1U;
+          offset += item->req_size;
+        }
+        resp->transfer_count = header->buffer_info_count;
+      } else {
+        resp->transfer_count = 1U;
+      }
+      handled = seq;
+      resp_seq_.store(seq, std::memory_order_release);
+    }
+  }
+
+  const double rtt_ns_;
+  std::vector<uint8_t> req_;
+  std::vector<uint8_t> resp_;
+  std::atomic<uint32_t> req_seq_{0U};
+  std::atomic<uint32_t> resp_seq_{0U};
+  std::atomic<bool> stopped_{false};
+  std::thread server_;
+};
+
+uint64_t ItemSize() {
+  return CalcMinRequestSize(kDstAddrCount, kBlocksPerKey, kBufferInfoMultiplierD2dH2d);
+}
+
+void FillItem(uint8_t *buffer, uint64_t key) {
+  auto *req = new (buffer) TransferCacheReq{};
+  req->is_pull_block = 1U;
+  req->cache_id = static_cast<int64_t>(key);
+  req->dst_addr_count = kDstAddrCount;
+  req->buffer_info_count = kBlocksPerKey;
+  req->req_size = ItemSize();
+  const uint32_t info_num = kDstAddrCount + kBlocksPerKey * kBufferInfoMultiplierD2dH2d;
+  for (uint32_t i = 0U; i < info_num; ++i) {
+    req->transfer_infos[i] = TransferInfo{};
+  }
+}
+
+double MeasureSequential(LoopbackPeer &peer, uint32_t key_num) {
+  uint64_t pulled = 0U;
+  const double start = NowNs();
+  for (uint32_t iter = 0U; iter < kIterations; ++iter) {
+    for (uint32_t key = 0U; key < key_num; ++key) {
+      FillItem(peer.RequestBuffer(), key);
+      pulled += peer.RoundTrip();
+    }
+  }
+  return static_cast<double>(pulled) / ((NowNs() - start) / kNsPerSecond);
+}
+
+double MeasureBatched(LoopbackPeer &peer, uint32_t key_num) {
+  uint64_t pulled = 0U;
+  const uint64_t item_size = ItemSize();
+  const double start = NowNs();
+  for (uint32_t iter = 0U; iter < kIterations; ++iter) {
+    uint32_t key = 0U;
+    while (key < key_num) {
+      uint8_t *buffer = peer.RequestBuffer();
+      uint64_t offset = sizeof(TransferCacheReq);
+      uint32_t item_num = 0U;
+      while ((key < key_num) && (item_num < kMaxBatchPullItemNum) && (offset + item_size <= kMaxRequestPayloadSize)) {
+        FillItem(buffer + offset, key);
+        offset += item_size;
+        ++item_num;
+        ++key;
+      }
+      auto *header = new (buffer) TransferCacheReq{};
+      header->is_pull_block = llm::kBatchPullFlag;
+      header->buffer_info_count = item_num;
+      header->req_size = offset;
+      pulled += peer.RoundTrip();
+    }
+  }
+  return static_cast<double>(pulled) / ((NowNs() - start) / kNsPerSecond);
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  double rtt_us = kDefaultRttUs;
+  if (argc > 1) {
+    rtt_us = std::strtod(argv[1], nullptr);
+    rtt_us = (rtt_us < 0.0) ? kDefaultRttUs : rtt_us;
+  }
+  LoopbackPeer peer(rtt_us * kNsPerUs);
+  std::printf("rtt=%.1fus item_size=%lu max_batch=%u resp_size=%lu\n", rtt_us, ItemSize(), kMaxBatchPullItemNum,
+              CalcResponseSize(kMaxBatchPullItemNum));
+  std::printf("%-10s %-20s %-20s %-8s\n", "keys", "sequential(keys/s)", "batched(keys/s)", "speedup");
+  for (const uint32_t key_num : kKeyNums) {
+    const double sequential_rate = MeasureSequential(peer, key_num);
+    const double batched_rate = MeasureBatched(peer, key_num);
+    std::printf("%-10u %-20.0f %-20.0f %-8.2f\n", key_num, sequential_rate, batched_rate,
+                batched_rate / sequential_rate);
+  }
+  return 0;
+}
@@ -216,6 +216,26 @@ HixlStatus HixlCSClientBatchGetSync(HixlClientHandle client_handle, uint32_t lis
 HixlStatus HixlCSClientQueryCompleteStatus(HixlClientHandle client_handle, CompleteHandle complete_handle,
                                            HixlCompleteStatus *complete_status);
 
+/**
+ * @brief 查询未完成的批量读写任务的传输进度
+ * @param [in] client_handle 客户端句柄
+ * @param [in] complete_handle 先前传输任务生成的句柄，需在查询到任务完成之前调用
+ * @param [out] completed_bytes 已确认完成的字节数
+ * @param [out] total_bytes 本次传输任务的总字节数
+ * @return 成功:HIXL_SUCCESS, 失败:其它.
+ */
+HixlStatus HixlCSClientQueryProgress(HixlClientHandle client_handle, CompleteHandle complete_handle,
+                                     uint64_t *completed_bytes, uint64_t *total_bytes);
+
+/**
+ * @brief 放弃等待未完成的批量读写任务，将句柄交还客户端回收
+ * @param [in] client_handle 客户端句柄
+ * @param [in] complete_handle 先前传输任务生成且尚未查询到终态的句柄，调用后不可再使用
+ * @return 成功:HIXL_SUCCESS, 失败:其它.
+ * @note 任务仍在途时句柄占用的完成标志在任务结束后的下一次读写或查询中回收，Destroy时一并释放
+ */
+HixlStatus HixlCSClientReleaseCompleteHandle(HixlClientHandle client_handle, CompleteHandle complete_handle);
+
 /**
  * @brief 销毁 Client 实例
  * @param [in] client_handle 客户端句柄
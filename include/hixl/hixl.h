@@ -144,6 +144,46 @@ class ASCEND_FUNC_VISIBILITY Hixl {
                        const std::vector<TransferOpDesc> &op_descs, const TransferArgs &optional_args,
                        TransferReq &req);
 
+  /**
+   * @brief 将远端Hixl解析为句柄，供高频小传输使用，开启自动建链时按需建链，否则要求已建链
+   * @param [in] remote_engine 远端Hixl的唯一标识，格式需与远端Hixl初始化时设置的local_engine一致
+   * @param [out] handle 解析得到的句柄，使用完毕后需调用ReleaseRemote释放，Finalize时统一释放
+   * @param [in] timeout_in_millis 自动建链的超时时间，单位ms
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status ResolveRemote(const AscendString &remote_engine, RemoteHandle &handle, int32_t timeout_in_millis = 1000);
+
+  /**
+   * @brief 释放ResolveRemote得到的句柄，不断开与远端的链路
+   * @param [in] handle 待释放的句柄
+   * @return 成功:SUCCESS, 句柄不存在:PARAM_INVALID.
+   */
+  Status ReleaseRemote(RemoteHandle handle);
+
+  /**
+   * @brief 经句柄与远端Hixl进行内存传输，跳过按名称查找链路与自动建链检查，且不打印INFO日志；
+   * 句柄对应链路被断开后返回NOT_CONNECTED，需释放并重新解析句柄
+   * @param [in] handle ResolveRemote得到的句柄
+   * @param [in] operation 将远端内存读到本地或者将本地内存写到远端
+   * @param [in] op_descs 批量操作的本地以及远端地址
+   * @param [in] timeout_in_millis 传输的超时时间，单位ms
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status TransferSync(RemoteHandle handle, TransferOp operation, const std::vector<TransferOpDesc> &op_descs,
+                      int32_t timeout_in_millis = 1000);
+
+  /**
+   * @brief 经句柄批量异步传输，下发传输请求，约束同经句柄的TransferSync
+   * @param [in] handle ResolveRemote得到的句柄
+   * @param [in] operation 将远端内存读到本地或者将本地内存写到远端
+   * @param [in] op_descs 批量操作的本地以及远端地址
+   * @param [in] optional_args 可选参数，预留
+   * @param [out] req 请求的handle，用于查询请求状态
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status TransferAsync(RemoteHandle handle, TransferOp operation, const std::vector<TransferOpDesc> &op_descs,
+                       const TransferArgs &optional_args, TransferReq &req);
+
   /**
    * @brief 获取请求状态
    * @param [in] req 请求handle，由TransferAsync API调用产生
@@ -160,6 +200,15 @@ class ASCEND_FUNC_VISIBILITY Hixl {
    */
   Status GetTransferStatus(const GetTransferStatusArgs &args, std::vector<TransferResult> &results);
 
+  /**
+   * @brief 查询与远端Hixl之间最近一个统计窗口内的传输带宽、操作速率与时延分位数，READ与WRITE分别统计；
+   * 同步传输按调用耗时计时，异步传输在查询到完成状态时计时，失败或超时的传输不计入
+   * @param [in] remote_engine 远端Hixl的唯一标识，格式需与远端Hixl初始化时设置的local_engine一致
+   * @param [out] statistics 统计结果，窗口内无传输时各项为0
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status GetTransferStatistics(const AscendString &remote_engine, PeerTransferStatistics &statistics);
+
   /**
    * @brief Client向Server发送Notify信息
    * @param [in] remote_engine 远端Hixl的唯一标识，格式需与远端Hixl初始化时设置的local_engine一致，
@@ -177,6 +226,25 @@ class ASCEND_FUNC_VISIBILITY Hixl {
    */
   Status GetNotifies(std::vector<NotifyDesc> &notifies);
 
+  /**
+   * @brief Client向Server批量发送Notify信息，多条notify合帧流水发送，按帧序号窗口确认，
+   * 适用于高频完成通知场景
+   * @param [in] remote_engine 远端Hixl的唯一标识，格式需与远端Hixl初始化时设置的local_engine一致，
+   * ipv4格式为host_ip:host_port或host_ip，ipv6格式为[host_ip]:host_port或[host_ip]
+   * @param [in] notifies 要发送的Notify列表，同一批量帧内保持列表顺序，帧间不保证到达顺序
+   * @param [in] timeout_in_millis 等待单个确认帧的超时时间，也是远端队列满时重发被拒帧的时间上限，单位ms
+   * @return 成功:SUCCESS, 远端队列持续已满:RESOURCE_EXHAUSTED(被拒帧均未投递), 失败:其它.
+   */
+  Status SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                      int32_t timeout_in_millis = 1000);
+
+  /**
+   * @brief 遍历并清空当前Hixl内Server收到的Notify信息，不为每条notify分配内存
+   * @param [in] visitor 逐条回调，NotifyView中的指针仅在回调期间有效
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status ConsumeNotifies(const NotifyVisitor &visitor);
+
   /**
    * @brief 查询库能力特性
    * @param [in] feature_type 特性类型
@@ -11,7 +11,9 @@
 #ifndef CANN_HIXL_INCLUDE_HIXL_HIXL_TYPES_H_
 #define CANN_HIXL_INCLUDE_HIXL_HIXL_TYPES_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include "external/ge_common/api_error_codes.h"
 
 #ifdef FUNC_VISIBILITY
@@ -25,6 +27,10 @@ using Status = uint32_t;
 using AscendString = ge::AscendString;
 using TransferReq = void *;
 
+// ResolveRemote返回的远端引擎句柄，由Hixl内部创建并持有
+struct RemoteHandleImpl;
+using RemoteHandle = RemoteHandleImpl *;
+
 // options
 constexpr const char OPTION_ENABLE_USE_FABRIC_MEM[] = "EnableUseFabricMem";
 constexpr const char OPTION_RDMA_TRAFFIC_CLASS[] = "RdmaTrafficClass";
@@ -33,6 +39,8 @@ constexpr const char OPTION_BUFFER_POOL[] = "BufferPool";
 constexpr const char OPTION_GLOBAL_RESOURCE_CONFIG[] = "GlobalResourceConfig";
 constexpr const char OPTION_AUTO_CONNECT[] = "AutoConnect";
 constexpr const char OPTION_LOCAL_COMM_RES[] = "LocalCommRes";
+constexpr const char OPTION_ENABLE_MEM_NOTIFY[] = "EnableMemNotify";
+constexpr const char OPTION_ENABLE_MULTI_RAIL[] = "EnableMultiRail";
 
 // status codes
 constexpr Status SUCCESS = 0U;
@@ -73,9 +81,13 @@ struct TransferOpDesc {
 };
 enum class TransferStatus { WAITING, COMPLETED, TIMEOUT, FAILED };
 
+// BULK请求按块拆分下发，存在未完成的LATENCY_CRITICAL请求时暂停下发后续块
+enum class TransferPriority : uint8_t { LATENCY_CRITICAL = 0, NORMAL = 1, BULK = 2 };
+
 struct TransferArgs {
   const void *user_data = nullptr;
-  uint8_t reserved[120] = {};
+  TransferPriority priority = TransferPriority::NORMAL;
+  uint8_t reserved[119] = {};
 };
 
 struct GetTransferStatusArgs {
@@ -91,11 +103,41 @@ struct TransferResult {
   uint8_t reserved[108] = {};
 };
 
+// 滑动时间窗口内单一方向(READ/WRITE)的传输统计，时延为按2的幂分桶估计的桶上界，单位us
+struct TransferStatistics {
+  double bytes_per_second = 0.0;
+  double ops_per_second = 0.0;
+  uint64_t total_bytes = 0U;
+  uint64_t total_ops = 0U;
+  uint64_t p50_latency_us = 0U;
+  uint64_t p90_latency_us = 0U;
+  uint64_t p99_latency_us = 0U;
+  uint64_t max_latency_us = 0U;
+  uint8_t reserved[64] = {};
+};
+
+struct PeerTransferStatistics {
+  uint32_t window_ms = 0U;
+  TransferStatistics read;
+  TransferStatistics write;
+  uint8_t reserved[64] = {};
+};
+
 struct NotifyDesc {
   AscendString name;
   AscendString notify_msg;
 };
 
+// 免拷贝的Notify视图，指针仅在NotifyVisitor回调期间有效
+struct NotifyView {
+  const char *name;
+  size_t name_len;
+  const char *notify_msg;
+  size_t notify_msg_len;
+};
+
+using NotifyVisitor = std::function<void(const NotifyView &)>;
+
 enum class AsyncConnectStatus {
   NOT_CONNECT,
   CONNECT_PENDING,
@@ -155,9 +155,41 @@ struct KvCacheExtParam {
   uint8_t reserved[127];
 };
 
+// PullKvCaches中的一项，src_blocks非空时按PullKvBlocks语义拉取blocks，否则按PullKvCache语义拉取连续cache
+struct PullKvTask {
+  CacheIndex src_cache_index{};
+  Cache dst_cache;
+  uint32_t batch_index = 0U;
+  int64_t size = -1;
+  std::vector<uint64_t> src_blocks;
+  std::vector<uint64_t> dst_blocks;
+  KvCacheExtParam ext_param;
+  uint8_t reserved[128] = {0};
+};
+
 struct RegisterCfg {
   uint8_t reserved[128] = {0};
 };
+
+// 滑动时间窗口内单一方向的传输统计，时延为按2的幂分桶估计的桶上界，单位us
+struct TransferStatistics {
+  double bytes_per_second = 0.0;
+  double ops_per_second = 0.0;
+  uint64_t total_bytes = 0U;
+  uint64_t total_ops = 0U;
+  uint64_t p50_latency_us = 0U;
+  uint64_t p90_latency_us = 0U;
+  uint64_t p99_latency_us = 0U;
+  uint64_t max_latency_us = 0U;
+  uint8_t reserved[64] = {0};
+};
+
+struct ClusterTransferStatistics {
+  uint32_t window_ms = 0U;
+  TransferStatistics pull;
+  TransferStatistics push;
+  uint8_t reserved[64] = {0};
+};
 class ASCEND_FUNC_VISIBILITY LlmDataDist {
  public:
   /**
@@ -253,6 +285,14 @@ class ASCEND_FUNC_VISIBILITY LlmDataDist {
                       const std::vector<uint64_t> &src_blocks, const std::vector<uint64_t> &dst_blocks,
                       const KvCacheExtParam &ext_param = {});
 
+  /**
+   * @brief 批量从远端拉取KV Cache或KV blocks，同一远端集群的多个任务合并为一次传输
+   * @param [in] tasks 拉取任务列表，可来自不同远端集群
+   * @param [out] rets 按tasks顺序返回的各任务结果，单个任务失败不影响其他任务
+   * @return 全部成功:LLM_SUCCESS, 否则返回首个失败任务的错误码
+   */
+  Status PullKvCaches(const std::vector<PullKvTask> &tasks, std::vector<Status> &rets);
+
   /**
    * @brief 拷贝连续Cache
    * @param src_cache 源Cache
@@ -320,6 +360,15 @@ class ASCEND_FUNC_VISIBILITY LlmDataDist {
    */
   Status UnregisterKvCache(int64_t cache_id);
 
+  /**
+   * @brief 查询与远端集群之间最近一个统计窗口内的传输带宽、操作速率与时延分位数，pull与push分别统计；
+   * 字节数按本端cache描述估算，失败的传输不计入
+   * @param [in] remote_cluster_id 远端集群ID
+   * @param [out] statistics 统计结果，窗口内无传输时各项为0
+   * @return 成功:LLM_SUCCESS, 失败:其它
+   */
+  Status GetTransferStatistics(uint64_t remote_cluster_id, ClusterTransferStatistics &statistics);
+
  private:
   class LlmDataDistImpl;
   std::unique_ptr<LlmDataDistImpl> impl_;
@@ -18,12 +18,56 @@ const uint32_t kMagicNumber = 0xA4B3C2D1;
 constexpr size_t kMaxNotifyNameLen = 1024;
 constexpr size_t kMaxNotifyMsgLen = 1024;
 constexpr size_t kMaxNotifyQueueSize = 4096;
+constexpr size_t kNotifyRingCapacity = 4U * 1024U * 1024U;  // server端notify接收环的字节上限
+constexpr size_t kMaxNotifiesPerBatch = 256U;                // 单个kNotifyBatch帧最多携带的notify条数
+constexpr size_t kMaxNotifyBatchBodySize = 1024U * 1024U;    // 单个kNotifyBatch帧体的字节上限
+constexpr size_t kNotifyBatchAckWindow = 8U;                 // 客户端允许未确认的kNotifyBatch帧数
 
 #pragma pack(push, 1)
 struct CtrlMsgHeader {
   uint32_t magic;
   uint64_t body_size;
 };
+
+// kNotifyBatch帧体: NotifyBatchHeader + count * (NotifyBatchEntry + name + notify_msg)
+struct NotifyBatchHeader {
+  uint64_t first_seq;
+  uint32_t count;
+  uint32_t reserved;
+};
+
+struct NotifyBatchEntry {
+  uint32_t name_len;
+  uint32_t msg_len;
+};
+
+// kNotifyBatchAck帧体，按first_seq确认对应帧
+struct NotifyBatchAck {
+  uint64_t first_seq;
+  uint32_t count;
+  uint32_t accepted;
+  uint32_t result;
+};
+
+// kNotifySlotAttachResp帧体，描述server为该对端分配的notify槽位环
+struct NotifySlotAttachResp {
+  uint32_t result;
+  uint32_t slot_count;
+  uint64_t slot_size;
+  uint64_t ring_addr;
+  uint64_t consumed;  // server已消费的最大seq，client从consumed + 1继续写入
+};
+
+// kMemDirSubscribeReq帧体，订阅server端内存目录变更，known_version为client当前持有的目录版本
+struct MemDirSubscribeReq {
+  uint64_t dst_ep_handle;
+  uint64_t known_version;
+};
+
+// kMemDirUpdateAck帧体，client已应用version及之前推送的注销，server据此放行DeregisterMem
+struct MemDirUpdateAck {
+  uint64_t version;
+};
 #pragma pack(pop)
 
 enum class CtrlMsgType : int32_t {
@@ -43,6 +87,13 @@ enum class CtrlMsgType : int32_t {
   kHeartBeat = 14,
   kGetMemInfoReq = 15,
   kGetMemInfoResp = 16,
+  kNotifyBatch = 17,
+  kNotifyBatchAck = 18,
+  kNotifySlotAttachReq = 19,
+  kNotifySlotAttachResp = 20,
+  kMemDirSubscribeReq = 21,
+  kMemDirUpdate = 22,
+  kMemDirUpdateAck = 23,
   kEnd
 };
 
@@ -94,6 +145,15 @@ struct HixlMemDesc {
 struct GetRemoteMemResp {
   Status result;
   std::vector<HixlMemDesc> mem_descs;
+  uint64_t version = 0UL;  // server端内存目录版本，每次注册/注销内存递增
+};
+
+// kMemDirUpdate帧体(JSON)，server向已订阅的client推送的内存目录增量
+struct MemDirUpdate {
+  uint64_t version = 0UL;
+  bool reset = false;  // true时added为全量目录，client以其替换本地目录
+  std::vector<HixlMemDesc> added;
+  std::vector<uint64_t> removed;  // 已注销内存的起始地址
 };
 
 struct DestroyChannelReq {
@@ -108,9 +168,12 @@ struct NotifyMsg {
 
 using CtrlMsgPtr = std::shared_ptr<CtrlMsg>;
 using MsgProcessor = std::function<Status(int32_t fd, const char *msg, uint64_t msg_len)>;
+// 控制面连接断开时回调，调用时fd尚未关闭
+using DisconnectProcessor = std::function<void(int32_t fd)>;
 }  // namespace hixl
 
 namespace hixl {
 HixlStatus HixlCSServerRegProc(HixlServerHandle server_handle, hixl::CtrlMsgType msg_type, hixl::MsgProcessor proc);
+HixlStatus HixlCSServerRegDisconnectProc(HixlServerHandle server_handle, hixl::DisconnectProcessor proc);
 }
 #endif  // CANN_HIXL_SRC_HIXL_CS_HIXL_CTRL_MSG_H_
@@ -26,7 +26,8 @@ struct HixlOneSideOpParam {
   uint64_t local_flag_addr;
   uint32_t notify_id;
   uint32_t use_notify_record;
-  uint32_t reserved[18] = {};
+  uint32_t ctx_id;  // kernel侧TransferContext槽位号，0表示未分配，按thread查找
+  uint32_t reserved[17] = {};
 };
 
 enum HixlTransferThreadState : uint32_t {
@@ -45,10 +46,13 @@ struct HixlTransferContextSyncEntry {
   uint32_t op;
   uint32_t notify_id;
   uint64_t err_flag_dev_va;
-  uint64_t reserved[13] = {};
+  uint32_t ctx_id;  // 与HixlOneSideOpParam::ctx_id对应，0表示不占用槽位
+  uint32_t reserved0;
+  uint64_t reserved[12] = {};
 };
 
 constexpr uint32_t kHixlSyncParamVersion = 1U;
+constexpr uint32_t kMaxTransferContextId = 4096U;  // ctx_id取值范围[1, kMaxTransferContextId]
 
 struct HixlTransferContextSyncParam {
   uint64_t entry_list_addr;
@@ -68,6 +72,8 @@ constexpr const char *kUboeProtocolDesc = "uboe:device";
 constexpr const char *kUbRtpProtocolDesc = "ub_rtp:device";
 constexpr const char *kPlacementDevice = "device";
 constexpr const char *kPlacementHost = "host";
+constexpr const char *kTransportHcomm = "hcomm";        // 默认传输后端，经libhcomm访问硬件
+constexpr const char *kTransportLoopback = "loopback";  // CPU回环后端，单边读写以内存拷贝完成
 constexpr uint8_t kRdmaTrafficClass = 132;  // RDMA网卡的traffic class 默认值
 constexpr uint8_t kRdmaServiceLevel = 4;    // RDMA网卡的service level 默认值
 constexpr uint32_t kRdmaRetryCntDefault = 7U;
@@ -109,6 +115,8 @@ struct EndpointConfig {
   std::string net_instance_id;
   std::string server_id;
   DeviceInfoConfig device_info{};
+  // 仅本端使用，不参与序列化：为true时该endpoint由CPU回环后端承载
+  bool loopback = false;
 
   std::string ToString() const {
     std::ostringstream oss;
@@ -142,6 +150,9 @@ struct TransferInfo {
   uint64_t start_time;
   TransferOp op_type;
   AscendString remote_engine;
+  TransferPriority priority = TransferPriority::NORMAL;
+  uint64_t bytes = 0U;     // 请求的总字节数，用于传输统计
+  uint64_t start_us = 0U;  // steady_clock微秒时间戳，用于传输统计
 };
 }  // namespace hixl
 #endif  // CANN_HIXL_SRC_HIXL_COMMON_HIXL_INNER_TYPES_H_
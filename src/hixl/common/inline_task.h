@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_COMMON_INLINE_TASK_H_
+#define CANN_HIXL_SRC_HIXL_COMMON_INLINE_TASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hixl {
+/**
+ * 只可移动的void()任务对象。不超过kInlineSize且可无异常移动的可调用对象就地存放，
+ * 不做堆分配；更大的可调用对象退化为堆上存放。可承载std::packaged_task等只可移动的类型。
+ */
+class InlineTask {
+ public:
+  static constexpr size_t kInlineSize = 56U;
+
+  InlineTask() = default;
+
+  template <typename Func, typename = typename std::enable_if<
+                               !std::is_same<typename std::decay<Func>::type, InlineTask>::value>::type>
+  InlineTask(Func &&func) {  // 与std::function一致，允许隐式转换
+    using Callable = typename std::decay<Func>::type;
+    if constexpr (IsInline<Callable>()) {
+      new (storage_) Callable(std::forward<Func>(func));
+      ops_ = &InlineOps<Callable>::kOps;
+    } else {
+      *reinterpret_cast<Callable **>(storage_) = new Callable(std::forward<Func>(func));
+      ops_ = &HeapOps<Callable>::kOps;
+    }
+  }
+
+  InlineTask(InlineTask &&other) noexcept {
+    MoveFrom(other);
+  }
+
+  InlineTask &operator=(InlineTask &&other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(other);
+    }
+    return *this;
+  }
+
+  InlineTask(const InlineTask &) = delete;
+  InlineTask &operator=(const InlineTask &) = delete;
+
+  ~InlineTask() {
+    Reset();
+  }
+
+  explicit operator bool() const {
+    return ops_ != nullptr;
+  }
+
+  void operator()() {
+    ops_->invoke(storage_);
+  }
+
+  template <typename Callable>
+  static constexpr bool IsInline() {
+    return (sizeof(Callable) <= kInlineSize) && (alignof(Callable) <= alignof(std::max_align_t)) &&
+           std::is_nothrow_move_constructible<Callable>::value;
+  }
+
+ private:
+  struct Ops {
+    void (*invoke)(void *storage);
+    void (*move)(void *dst, void *src);  // 移动后销毁src中的对象
+    void (*destroy)(void *storage);
+  };
+
+  template <typename Callable>
+  struct InlineOps {
+    static void Invoke(void *storage) {
+      (*static_cast<Callable *>(storage))();
+    }
+    static void Move(void *dst, void *src) {
+      auto *callable = static_cast<Callable *>(src);
+      new (dst) Callable(std::move(*callable));
+      callable->~Callable();
+    }
+    static void Destroy(void *storage) {
+      static_cast<Callable *>(storage)->~Callable();
+    }
+    static constexpr Ops kOps{&Invoke, &Move, &Destroy};
+  };
+
+  template <typename Callable>
+  struct HeapOps {
+    static void Invoke(void *storage) {
+      (**static_cast<Callable **>(storage))();
+    }
+    static void Move(void *dst, void *src) {
+      *static_cast<Callable **>(dst) = *static_cast<Callable **>(src);
+    }
+    static void Destroy(void *storage) {
+      delete *static_cast<Callable **>(storage);
+    }
+    static constexpr Ops kOps{&Invoke, &Move, &Destroy};
+  };
+
+  void MoveFrom(InlineTask &other) noexcept {
+    if (other.ops_ != nullptr) {
+      other.ops_->move(storage_, other.storage_);
+      ops_ = other.ops_;
+      other.ops_ = nullptr;
+    }
+  }
+
+  void Reset() noexcept {
+    if (ops_ != nullptr) {
+      ops_->destroy(storage_);
+      ops_ = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+  const Ops *ops_ = nullptr;
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_COMMON_INLINE_TASK_H_
@@ -0,0 +1,351 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_COMMON_MPMC_QUEUE_H_
+#define CANN_HIXL_SRC_HIXL_COMMON_MPMC_QUEUE_H_
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+// 仅头文件实现，adxl_static等不编译src/hixl/common/*.cc的目标也可直接使用
+namespace hixl {
+constexpr size_t kCacheLineSize = 64U;
+
+inline void CpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  __asm__ __volatile__("yield" ::: "memory");
+#else
+  std::this_thread::yield();
+#endif
+}
+
+/**
+ * 基于futex的事件计数，用于队列空/满时的阻塞等待。
+ * 等待方先PrepareWait登记并取得序号，再复查条件，条件仍不满足时Wait，条件已满足时CancelWait；
+ * 通知方在改变条件后调用Notify，仅当存在登记的等待方时才进入内核。
+ */
+class FutexEvent {
+ public:
+  uint32_t PrepareWait() {
+    (void)waiters_.fetch_add(1U, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return seq_.load(std::memory_order_relaxed);
+  }
+
+  void CancelWait() {
+    (void)waiters_.fetch_sub(1U, std::memory_order_relaxed);
+  }
+
+  // 序号已变化时futex立即返回，不会丢失PrepareWait之后的通知
+  void Wait(uint32_t key) {
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq_), FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0);
+    (void)waiters_.fetch_sub(1U, std::memory_order_relaxed);
+  }
+
+  // 每次通知都推进序号，不依赖某个等待方消费唤醒，登记后未睡眠即取消的等待方不会吞掉后续通知
+  void NotifyOne() {
+    if (HasWaiters()) {
+      Wake(1);
+    }
+  }
+
+  void NotifyAll() {
+    if (HasWaiters()) {
+      Wake(INT_MAX);
+    }
+  }
+
+ private:
+  bool HasWaiters() const {
+    // 与等待方登记后复查条件的顺序配对，二者至少有一方能观察到对方
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return waiters_.load(std::memory_order_relaxed) != 0U;
+  }
+
+  void Wake(int32_t count) {
+    (void)seq_.fetch_add(1U, std::memory_order_seq_cst);
+    (void)syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq_), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+  }
+
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be 32 bits");
+  std::atomic<uint32_t> seq_{0U};
+  std::atomic<uint32_t> waiters_{0U};
+};
+
+/**
+ * 有界多生产者多消费者环形队列(Vyukov算法)。每个槽位携带序号，生产者与消费者各自CAS推进位置后
+ * 独占该槽位读写，入队出队无锁且不做内存分配。容量向上取整为2的幂。
+ */
+template <typename T>
+class MpmcQueue {
+ public:
+  explicit MpmcQueue(size_t capacity) : capacity_(RoundUpPowerOfTwo(capacity)), mask_(capacity_ - 1U) {
+    cells_.reset(new Cell[capacity_]);
+    for (size_t i = 0U; i < capacity_; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  // 析构时已无并发访问，直接析构剩余元素
+  ~MpmcQueue() {
+    const size_t enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != enqueue_pos; ++pos) {
+      reinterpret_cast<T *>(cells_[pos & mask_].storage)->~T();
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  template <typename... Args>
+  bool TryEmplace(Args &&...args) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // 队列满
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->storage) T(std::forward<Args>(args)...);
+    cell->sequence.store(pos + 1U, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPush(T &&value) {
+    return TryEmplace(std::move(value));
+  }
+
+  bool TryPop(T &value) {
+    size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell *cell = nullptr;
+    while (true) {
+      cell = &cells_[pos & mask_];
+      const size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1U);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1U, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;  // 队列空
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    T *item = reinterpret_cast<T *>(cell->storage);
+    value = std::move(*item);
+    item->~T();
+    cell->sequence.store(pos + mask_ + 1U, std::memory_order_release);
+    return true;
+  }
+
+  // 并发修改时为近似值
+  size_t SizeApprox() const {
+    const size_t dequeue_pos = dequeue_pos_.load(std::memory_order_relaxed);
+    const size_t enqueue_pos = enqueue_pos_.load(std::memory_order_relaxed);
+    return (enqueue_pos > dequeue_pos) ? (enqueue_pos - dequeue_pos) : 0U;
+  }
+
+  size_t Capacity() const {
+    return capacity_;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  static size_t RoundUpPowerOfTwo(size_t value) {
+    size_t result = 2U;
+    while (result < value) {
+      result <<= 1U;
+    }
+    return result;
+  }
+
+  const size_t capacity_;
+  const size_t mask_;
+  std::unique_ptr<Cell[]> cells_;
+  // 生产者与消费者位置分占不同缓存行，避免相互失效
+  alignas(kCacheLineSize) std::atomic<size_t> enqueue_pos_{0U};
+  alignas(kCacheLineSize) std::atomic<size_t> dequeue_pos_{0U};
+};
+
+/**
+ * 在MpmcQueue之上提供阻塞语义：Pop在队列空时、Push在队列满时先自旋kSpinCount次，仍不满足再经futex睡眠。
+ * TryEmplace/TryPush不阻塞，队列满时直接失败。ForceEmplace/ForcePush不阻塞也不失败，环满时转入无界溢出链表，
+ * 供不能等待消费方的生产者使用。Close后入队失败，Pop取完剩余元素后返回false。
+ */
+template <typename T>
+class BlockingMpmcQueue {
+ public:
+  static constexpr uint32_t kSpinCount = 128U;
+
+  explicit BlockingMpmcQueue(size_t capacity) : queue_(capacity) {}
+  ~BlockingMpmcQueue() = default;
+  BlockingMpmcQueue(const BlockingMpmcQueue &) = delete;
+  BlockingMpmcQueue &operator=(const BlockingMpmcQueue &) = delete;
+
+  template <typename... Args>
+  bool Emplace(Args &&...args) {
+    uint32_t spin = 0U;
+    while (!closed_.load(std::memory_order_acquire)) {
+      if (queue_.TryEmplace(std::forward<Args>(args)...)) {
+        not_empty_.NotifyOne();
+        return true;
+      }
+      if (spin < kSpinCount) {
+        ++spin;
+        CpuRelax();
+        continue;
+      }
+      const uint32_t key = not_full_.PrepareWait();
+      if ((queue_.SizeApprox() < queue_.Capacity()) || closed_.load(std::memory_order_seq_cst)) {
+        not_full_.CancelWait();
+        continue;
+      }
+      not_full_.Wait(key);
+    }
+    return false;
+  }
+
+  bool Push(T &&value) {
+    return Emplace(std::move(value));
+  }
+
+  // 不阻塞，队列满或已Close时返回false
+  template <typename... Args>
+  bool TryEmplace(Args &&...args) {
+    if (closed_.load(std::memory_order_acquire) || !queue_.TryEmplace(std::forward<Args>(args)...)) {
+      return false;
+    }
+    not_empty_.NotifyOne();
+    return true;
+  }
+
+  bool TryPush(T &&value) {
+    return TryEmplace(std::move(value));
+  }
+
+  // 不阻塞，仅在已Close时返回false；溢出链表非空时后续元素也进入链表，单生产者下保持先进先出
+  template <typename... Args>
+  bool ForceEmplace(Args &&...args) {
+    if (closed_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    if ((overflow_size_.load(std::memory_order_acquire) != 0U) || !queue_.TryEmplace(std::forward<Args>(args)...)) {
+      std::lock_guard<std::mutex> lock(overflow_mutex_);
+      overflow_.emplace_back(std::forward<Args>(args)...);
+      (void)overflow_size_.fetch_add(1U, std::memory_order_release);
+    }
+    not_empty_.NotifyOne();
+    return true;
+  }
+
+  bool ForcePush(T &&value) {
+    return ForceEmplace(std::move(value));
+  }
+
+  bool Pop(T &value) {
+    uint32_t spin = 0U;
+    while (true) {
+      if (TryPopAny(value)) {
+        return true;
+      }
+      if (closed_.load(std::memory_order_acquire)) {
+        // Close之前完成的入队对此处可见，再取一次确认已取空
+        return TryPopAny(value);
+      }
+      if (spin < kSpinCount) {
+        ++spin;
+        CpuRelax();
+        continue;
+      }
+      const uint32_t key = not_empty_.PrepareWait();
+      if (TryPopAny(value)) {
+        not_empty_.CancelWait();
+        return true;
+      }
+      if (closed_.load(std::memory_order_seq_cst)) {
+        not_empty_.CancelWait();
+        continue;
+      }
+      not_empty_.Wait(key);
+    }
+  }
+
+  void Close() {
+    closed_.store(true, std::memory_order_seq_cst);
+    not_empty_.NotifyAll();
+    not_full_.NotifyAll();
+  }
+
+  bool IsClosed() const {
+    return closed_.load(std::memory_order_acquire);
+  }
+
+  size_t SizeApprox() const {
+    return queue_.SizeApprox() + overflow_size_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // 环中元素先于溢出链表中的元素入队，先取环再取链表
+  bool TryPopAny(T &value) {
+    if (queue_.TryPop(value)) {
+      not_full_.NotifyOne();
+      return true;
+    }
+    if (overflow_size_.load(std::memory_order_acquire) == 0U) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    if (overflow_.empty()) {
+      return false;
+    }
+    value = std::move(overflow_.front());
+    overflow_.pop_front();
+    (void)overflow_size_.fetch_sub(1U, std::memory_order_release);
+    return true;
+  }
+
+  MpmcQueue<T> queue_;
+  std::mutex overflow_mutex_;
+  std::deque<T> overflow_;
+  std::atomic<size_t> overflow_size_{0U};
+  std::atomic<bool> closed_{false};
+  alignas(kCacheLineSize) FutexEvent not_empty_;
+  alignas(kCacheLineSize) FutexEvent not_full_;
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_COMMON_MPMC_QUEUE_H_
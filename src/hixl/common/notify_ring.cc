@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "notify_ring.h"
+#include <algorithm>
+#include "securec.h"
+#include "common/ctrl_msg.h"
+
+namespace hixl {
+NotifyRing::NotifyRing(size_t max_entries, size_t capacity_bytes)
+    : buffer_((capacity_bytes + kRecordAlign - 1U) / kRecordAlign * kRecordAlign), max_entries_(max_entries) {}
+
+size_t NotifyRing::RecordSize(size_t name_len, size_t msg_len) {
+  const size_t raw = sizeof(RecordHeader) + name_len + msg_len;
+  return (raw + kRecordAlign - 1U) / kRecordAlign * kRecordAlign;
+}
+
+bool NotifyRing::ReserveLocked(size_t record_size, size_t &offset) {
+  const size_t capacity = buffer_.size();
+  if (count_ >= max_entries_ || record_size > capacity) {
+    return false;
+  }
+  if (count_ == 0U) {
+    head_ = 0U;
+    tail_ = 0U;
+    used_ = 0U;
+  }
+  if (tail_ > head_ || used_ == 0U) {
+    // 空闲区间为[tail_, capacity)与[0, head_)
+    if (capacity - tail_ >= record_size) {
+      offset = tail_;
+    } else if (head_ >= record_size) {
+      const size_t skipped = capacity - tail_;
+      if (skipped >= sizeof(RecordHeader)) {
+        RecordHeader marker{kWrapMarker, 0U};
+        (void)memcpy_s(buffer_.data() + tail_, skipped, &marker, sizeof(marker));
+      }
+      used_ += skipped;
+      offset = 0U;
+    } else {
+      return false;
+    }
+  } else if (head_ - tail_ >= record_size) {
+    offset = tail_;
+  } else {
+    return false;
+  }
+  tail_ = offset + record_size;
+  used_ += record_size;
+  ++count_;
+  return true;
+}
+
+void NotifyRing::WriteRecord(size_t offset, size_t record_size, const char *name, size_t name_len, const char *msg,
+                             size_t msg_len) {
+  char *dst = buffer_.data() + offset;
+  RecordHeader header{static_cast<uint32_t>(name_len), static_cast<uint32_t>(msg_len)};
+  (void)memcpy_s(dst, record_size, &header, sizeof(header));
+  if (name_len > 0U) {
+    (void)memcpy_s(dst + sizeof(header), record_size - sizeof(header), name, name_len);
+  }
+  if (msg_len > 0U) {
+    (void)memcpy_s(dst + sizeof(header) + name_len, record_size - sizeof(header) - name_len, msg, msg_len);
+  }
+}
+
+Status NotifyRing::Push(const char *name, size_t name_len, const char *msg, size_t msg_len) {
+  if (name_len > kMaxNotifyNameLen || msg_len > kMaxNotifyMsgLen) {
+    return PARAM_INVALID;
+  }
+  const size_t record_size = RecordSize(name_len, msg_len);
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t offset = 0U;
+  if (!ReserveLocked(record_size, offset)) {
+    return RESOURCE_EXHAUSTED;
+  }
+  WriteRecord(offset, record_size, name, name_len, msg, msg_len);
+  return SUCCESS;
+}
+
+Status NotifyRing::PushBatch(const NotifyView *notifies, size_t count) {
+  for (size_t i = 0U; i < count; ++i) {
+    if (notifies[i].name_len > kMaxNotifyNameLen || notifies[i].notify_msg_len > kMaxNotifyMsgLen) {
+      return PARAM_INVALID;
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  // 预留失败时恢复位置，已写入空闲区的回绕标记不会被消费者读到
+  const size_t head = head_;
+  const size_t tail = tail_;
+  const size_t used = used_;
+  const size_t record_count = count_;
+  std::vector<size_t> offsets(count);
+  for (size_t i = 0U; i < count; ++i) {
+    if (!ReserveLocked(RecordSize(notifies[i].name_len, notifies[i].notify_msg_len), offsets[i])) {
+      head_ = head;
+      tail_ = tail;
+      used_ = used;
+      count_ = record_count;
+      return RESOURCE_EXHAUSTED;
+    }
+  }
+  for (size_t i = 0U; i < count; ++i) {
+    const auto &notify = notifies[i];
+    WriteRecord(offsets[i], RecordSize(notify.name_len, notify.notify_msg_len), notify.name, notify.name_len,
+                notify.notify_msg, notify.notify_msg_len);
+  }
+  return SUCCESS;
+}
+
+size_t NotifyRing::Consume(const NotifyVisitor &visitor, size_t max_count) {
+  std::lock_guard<std::mutex> consume_lock(consume_mutex_);
+  size_t pos = 0U;
+  size_t count = 0U;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pos = head_;
+    count = std::min(count_, max_count);
+  }
+  if (count == 0U) {
+    return 0U;
+  }
+  // [head_, head_ + count条记录)已被计入used_，生产者不会覆盖，可在锁外读取
+  const size_t capacity = buffer_.size();
+  size_t freed = 0U;
+  size_t consumed = 0U;
+  while (consumed < count) {
+    if (pos == capacity) {
+      pos = 0U;
+    }
+    RecordHeader header{};
+    (void)memcpy_s(&header, sizeof(header), buffer_.data() + pos, sizeof(header));
+    if (header.name_len == kWrapMarker) {
+      freed += capacity - pos;
+      pos = 0U;
+      continue;
+    }
+    const char *payload = buffer_.data() + pos + sizeof(header);
+    if (visitor) {
+      visitor(NotifyView{payload, header.name_len, payload + header.name_len, header.msg_len});
+    }
+    const size_t record_size = RecordSize(header.name_len, header.msg_len);
+    freed += record_size;
+    pos += record_size;
+    ++consumed;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  head_ = (pos == capacity) ? 0U : pos;
+  used_ -= freed;
+  count_ -= consumed;
+  if (count_ == 0U) {
+    head_ = 0U;
+    tail_ = 0U;
+    used_ = 0U;
+  }
+  return consumed;
+}
+
+size_t NotifyRing::Size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return count_;
+}
+}  // namespace hixl
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_COMMON_NOTIFY_RING_H_
+#define CANN_HIXL_SRC_HIXL_COMMON_NOTIFY_RING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "hixl/hixl_types.h"
+
+namespace hixl {
+/**
+ * 有界的Notify接收队列。所有name/msg按变长记录连续存放在一块预分配的环形内存中，
+ * 入队与出队均不做逐条内存分配；Consume以NotifyView形式直接暴露环内数据，
+ * 视图仅在visitor回调期间有效。
+ * 支持多生产者并发Push，消费者之间串行；消费者遍历期间不阻塞生产者。
+ */
+class NotifyRing {
+ public:
+  /**
+   * @param [in] max_entries 最多缓存的notify条数
+   * @param [in] capacity_bytes 环形缓冲区字节数，向上对齐到记录对齐粒度
+   */
+  NotifyRing(size_t max_entries, size_t capacity_bytes);
+  ~NotifyRing() = default;
+  NotifyRing(const NotifyRing &) = delete;
+  NotifyRing &operator=(const NotifyRing &) = delete;
+
+  /**
+   * @brief 追加一条notify
+   * @return 成功:SUCCESS, 条数或字节数已满:RESOURCE_EXHAUSTED, 长度非法:PARAM_INVALID
+   */
+  Status Push(const char *name, size_t name_len, const char *msg, size_t msg_len);
+
+  /**
+   * @brief 整批追加notify，全部入队或全部不入队
+   * @return 成功:SUCCESS, 剩余条数或字节数不足以容纳整批:RESOURCE_EXHAUSTED, 任一条长度非法:PARAM_INVALID
+   */
+  Status PushBatch(const NotifyView *notifies, size_t count);
+
+  /**
+   * @brief 按入队顺序遍历并出队至多max_count条notify
+   * @param [in] visitor 逐条回调，NotifyView仅在回调期间有效
+   * @param [in] max_count 本次最多出队条数
+   * @return 实际出队条数
+   */
+  size_t Consume(const NotifyVisitor &visitor, size_t max_count = SIZE_MAX);
+
+  size_t Size() const;
+
+ private:
+  struct RecordHeader {
+    uint32_t name_len;
+    uint32_t msg_len;
+  };
+  static constexpr uint32_t kWrapMarker = UINT32_MAX;
+  static constexpr size_t kRecordAlign = 8U;
+
+  static size_t RecordSize(size_t name_len, size_t msg_len);
+  bool ReserveLocked(size_t record_size, size_t &offset);
+  void WriteRecord(size_t offset, size_t record_size, const char *name, size_t name_len, const char *msg,
+                   size_t msg_len);
+
+  std::vector<char> buffer_;
+  size_t max_entries_;
+  size_t head_ = 0U;   // 最早一条记录（或回绕标记）的偏移
+  size_t tail_ = 0U;   // 下一条记录的写入偏移
+  size_t used_ = 0U;   // 已占用字节数，包含回绕时跳过的尾部空间
+  size_t count_ = 0U;  // 已入队未出队的记录条数
+  mutable std::mutex mutex_;
+  std::mutex consume_mutex_;
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_COMMON_NOTIFY_RING_H_
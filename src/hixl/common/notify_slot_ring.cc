@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "notify_slot_ring.h"
+#include <atomic>
+#include "securec.h"
+
+namespace hixl {
+namespace {
+constexpr uint32_t kFnvOffsetBasis = 2166136261U;
+constexpr uint32_t kFnvPrime = 16777619U;
+
+uint32_t Fnv1a(uint32_t hash, const void *data, size_t len) {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0U; i < len; ++i) {
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  }
+  return hash;
+}
+
+uint32_t SlotChecksum(uint64_t seq, uint32_t name_len, uint32_t msg_len, const uint8_t *payload) {
+  uint32_t hash = Fnv1a(kFnvOffsetBasis, &seq, sizeof(seq));
+  hash = Fnv1a(hash, &name_len, sizeof(name_len));
+  hash = Fnv1a(hash, &msg_len, sizeof(msg_len));
+  return Fnv1a(hash, payload, static_cast<size_t>(name_len) + msg_len);
+}
+}  // namespace
+
+Status NotifySlotLayout::Encode(uint8_t *ring_base, uint64_t seq, const char *name, size_t name_len, const char *msg,
+                                size_t msg_len) {
+  if (seq == 0U || name_len > kMaxNotifyNameLen || msg_len > kMaxNotifyMsgLen) {
+    return PARAM_INVALID;
+  }
+  uint8_t *slot = ring_base + SlotOffset(seq);
+  uint8_t *payload = slot + sizeof(NotifySlotHeader);
+  const size_t payload_cap = SlotSize() - sizeof(NotifySlotHeader);
+  if (name_len > 0U) {
+    (void)memcpy_s(payload, payload_cap, name, name_len);
+  }
+  if (msg_len > 0U) {
+    (void)memcpy_s(payload + name_len, payload_cap - name_len, msg, msg_len);
+  }
+  NotifySlotHeader header{};
+  header.seq = seq;
+  header.name_len = static_cast<uint32_t>(name_len);
+  header.msg_len = static_cast<uint32_t>(msg_len);
+  header.checksum = SlotChecksum(seq, header.name_len, header.msg_len, payload);
+  (void)memcpy_s(slot, sizeof(header), &header, sizeof(header));
+  return SUCCESS;
+}
+
+bool NotifySlotLayout::Decode(const uint8_t *ring_base, uint64_t seq, NotifyView &view) {
+  const uint8_t *slot = ring_base + SlotOffset(seq);
+  const volatile uint64_t *seq_ptr = reinterpret_cast<const volatile uint64_t *>(slot);
+  if (*seq_ptr != seq) {
+    return false;
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  NotifySlotHeader header{};
+  (void)memcpy_s(&header, sizeof(header), slot, sizeof(header));
+  if (header.seq != seq || header.name_len > kMaxNotifyNameLen || header.msg_len > kMaxNotifyMsgLen) {
+    return false;
+  }
+  const uint8_t *payload = slot + sizeof(NotifySlotHeader);
+  // 同一次WRITE内部的字节可见顺序不保证，seq先到而载荷未完整时校验和不匹配，留待下次Poll
+  if (SlotChecksum(seq, header.name_len, header.msg_len, payload) != header.checksum) {
+    return false;
+  }
+  const auto *chars = reinterpret_cast<const char *>(payload);
+  view = NotifyView{chars, header.name_len, chars + header.name_len, header.msg_len};
+  return true;
+}
+
+void NotifySlotRing::Reset(uint8_t *ring_base) {
+  ring_base_ = ring_base;
+  consumed_ = 0U;
+  if (ring_base_ != nullptr) {
+    (void)memset_s(ring_base_, NotifySlotLayout::RingSize(), 0, NotifySlotLayout::RingSize());
+  }
+}
+
+void NotifySlotRing::Resync() {
+  if (ring_base_ != nullptr) {
+    const size_t slots_size = NotifySlotLayout::RingSize() - kNotifySlotCtrlSize;
+    (void)memset_s(ring_base_ + kNotifySlotCtrlSize, slots_size, 0, slots_size);
+  }
+}
+
+size_t NotifySlotRing::Poll(NotifyRing &sink) {
+  if (ring_base_ == nullptr) {
+    return 0U;
+  }
+  size_t count = 0U;
+  NotifyView view{};
+  while (NotifySlotLayout::Decode(ring_base_, consumed_ + 1U, view)) {
+    if (sink.Push(view.name, view.name_len, view.notify_msg, view.notify_msg_len) != SUCCESS) {
+      break;
+    }
+    ++consumed_;
+    ++count;
+  }
+  if (count > 0U) {
+    // 载荷已转存后才发布consumed，client读到新值后才会覆写对应slot
+    std::atomic_thread_fence(std::memory_order_release);
+    auto *ctrl = reinterpret_cast<volatile uint64_t *>(ring_base_);
+    *ctrl = consumed_;
+  }
+  return count;
+}
+}  // namespace hixl
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_COMMON_NOTIFY_SLOT_RING_H_
+#define CANN_HIXL_SRC_HIXL_COMMON_NOTIFY_SLOT_RING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "hixl/hixl_types.h"
+#include "common/ctrl_msg.h"
+#include "common/notify_ring.h"
+
+namespace hixl {
+constexpr uint32_t kNotifySlotsPerPeer = 64U;   // 每个对端独占的notify槽位数
+constexpr uint32_t kMaxNotifySlotPeers = 64U;   // server端最多同时服务的内存notify对端数
+constexpr size_t kNotifySlotAlign = 64U;
+constexpr size_t kNotifySlotCtrlSize = 64U;     // 环首部控制区，仅前8字节为server已消费的序号
+
+/**
+ * 单个对端的notify槽位环在注册内存中的布局:
+ *   [NotifySlotCtrl(kNotifySlotCtrlSize)][slot 0]...[slot kNotifySlotsPerPeer-1]
+ * 每个slot为 NotifySlotHeader + name + notify_msg，client以单边WRITE整体写入。
+ * seq从1开始单调递增，写入位置为 (seq - 1) % kNotifySlotsPerPeer；
+ * server仅在seq与期望值一致且校验和匹配时消费该slot，从而不依赖单次WRITE内部的字节可见顺序。
+ */
+struct NotifySlotHeader {
+  uint64_t seq;
+  uint32_t name_len;
+  uint32_t msg_len;
+  uint32_t checksum;
+  uint32_t reserved;
+};
+
+struct NotifySlotCtrl {
+  uint64_t consumed;  // server已消费的最大seq，client单边READ后用于计算可用槽位
+};
+
+class NotifySlotLayout {
+ public:
+  static constexpr size_t SlotSize() {
+    return (sizeof(NotifySlotHeader) + kMaxNotifyNameLen + kMaxNotifyMsgLen + kNotifySlotAlign - 1U) /
+           kNotifySlotAlign * kNotifySlotAlign;
+  }
+
+  static constexpr size_t RingSize() {
+    return kNotifySlotCtrlSize + SlotSize() * kNotifySlotsPerPeer;
+  }
+
+  static constexpr size_t SlotOffset(uint64_t seq) {
+    return kNotifySlotCtrlSize + static_cast<size_t>((seq - 1U) % kNotifySlotsPerPeer) * SlotSize();
+  }
+
+  /**
+   * @brief 将一条notify编码到ring_base对应seq的slot中
+   * @return 成功:SUCCESS, 长度非法:PARAM_INVALID
+   */
+  static Status Encode(uint8_t *ring_base, uint64_t seq, const char *name, size_t name_len, const char *msg,
+                       size_t msg_len);
+
+  /**
+   * @brief 解析ring_base中seq对应的slot
+   * @return slot已按seq完整写入时返回true，view指向slot内数据
+   */
+  static bool Decode(const uint8_t *ring_base, uint64_t seq, NotifyView &view);
+};
+
+/**
+ * server端单个对端槽位环的消费者。Poll按seq顺序把已完整写入的slot转存到NotifyRing，
+ * 并在转存后发布consumed，client据此复用槽位。
+ */
+class NotifySlotRing {
+ public:
+  NotifySlotRing() = default;
+  ~NotifySlotRing() = default;
+
+  /**
+   * @brief 绑定并清空一段RingSize()大小的内存，消费序号归零
+   */
+  void Reset(uint8_t *ring_base);
+
+  /**
+   * @brief 清空全部slot但保留消费序号，client写入失败后据此从consumed + 1重新写入
+   */
+  void Resync();
+
+  /**
+   * @brief 消费已到达的slot
+   * @param [in] sink 转存目标，已满时停止消费，剩余slot留待下次Poll
+   * @return 本次消费条数
+   */
+  size_t Poll(NotifyRing &sink);
+
+  uint64_t Consumed() const {
+    return consumed_;
+  }
+
+ private:
+  uint8_t *ring_base_ = nullptr;
+  uint64_t consumed_ = 0U;
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_COMMON_NOTIFY_SLOT_RING_H_
@@ -77,6 +77,17 @@ std::unique_ptr<TemporaryRtContext> OptionalAclrtContext::GetContextGuard() cons
   return MakeUnique<TemporaryRtContext>(ctx_);
 }
 
+std::unique_ptr<TemporaryRtContext> OptionalAclrtContext::GetContextGuardIfNeeded() const {
+  if (!has_context_) {
+    return nullptr;
+  }
+  aclrtContext current = nullptr;
+  if ((aclrtGetCurrentContext(&current) == ACL_SUCCESS) && (current == ctx_)) {
+    return nullptr;
+  }
+  return MakeUnique<TemporaryRtContext>(ctx_);
+}
+
 void OptionalAclrtContext::DestroyContext() {
   if (owns_context_ && ctx_ != nullptr) {
     HIXL_CHK_ACL(aclrtDestroyContext(ctx_), "aclrtDestroyContext failed");
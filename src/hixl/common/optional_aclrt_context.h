@@ -31,6 +31,8 @@ class OptionalAclrtContext {
   Status CreateContext();
   Status SetCurrentContext() const;
   std::unique_ptr<TemporaryRtContext> GetContextGuard() const;
+  // 当前线程已处于该context时返回空，省去guard的构造与切换/恢复
+  std::unique_ptr<TemporaryRtContext> GetContextGuardIfNeeded() const;
   void DestroyContext();
 
  private:
@@ -11,8 +11,10 @@
 #include "thread_pool.h"
 
 namespace hixl {
-ThreadPool::ThreadPool(std::string thread_name_prefix, const uint32_t min_size, const uint32_t max_size)
+ThreadPool::ThreadPool(std::string thread_name_prefix, const uint32_t min_size, const uint32_t max_size,
+                       const size_t queue_capacity)
     : thread_name_prefix_(std::move(thread_name_prefix)),
+      tasks_(queue_capacity),
       is_stopped_(false),
       min_thrd_num_(min_size < 1U ? 1U : min_size),
       max_thrd_num_(max_size < min_thrd_num_ ? min_thrd_num_ : max_size) {
@@ -35,18 +37,13 @@ void ThreadPool::Destroy() {
   if (is_stopped_.load() == true) {
     return;
   }
-  size_t pending_tasks = 0U;
-  {
-    const std::unique_lock<std::mutex> lock{m_lock_};
-    pending_tasks = tasks_.size();
-  }
   HIXL_LOGI("[ThreadPool] destroying, name:%s, total_threads:%u, pending_tasks:%zu", thread_name_prefix_.c_str(),
-            total_thrd_num_.load(), pending_tasks);
+            total_thrd_num_.load(), tasks_.SizeApprox());
   {
     const std::unique_lock<std::mutex> lock{m_lock_};
     is_stopped_.store(true);
-    cond_var_.notify_all();
   }
+  tasks_.Close();
 
   for (std::thread &thd : pool_) {
     if (thd.joinable()) {
@@ -99,15 +96,8 @@ void ThreadPool::LogTempThreadExit(const char *reason, uint32_t thread_idx) cons
             thread_idx, idle_thrd_num_.load(), busy_thrd_num_.load(), total_thrd_num_.load());
 }
 
-bool ThreadPool::PopTask(std::function<void()> &task) {
-  std::unique_lock<std::mutex> lock{m_lock_};
-  cond_var_.wait(lock, [this]() { return is_stopped_.load() || !tasks_.empty(); });
-  if (is_stopped_ && tasks_.empty()) {
-    return false;
-  }
-  task = std::move(tasks_.front());
-  tasks_.pop();
-  return true;
+bool ThreadPool::PopTask(ThreadTask &task) {
+  return tasks_.Pop(task);
 }
 
 void ThreadPool::CleanupFinishedTempThreads() {
@@ -135,7 +125,7 @@ void ThreadPool::ThreadFunc(ThreadPool *const thread_pool, uint32_t thread_idx,
             thread_type.c_str(), thread_idx);
 
   while (!thread_pool->is_stopped_) {
-    std::function<void()> task;
+    ThreadTask task;
     if (!thread_pool->PopTask(task)) {
       if (is_temporary) {
         --thread_pool->total_thrd_num_;
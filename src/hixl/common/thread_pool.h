@@ -12,24 +12,29 @@
 #define CANN_HIXL_SRC_HIXL_COMMON_THREAD_POOL_H_
 
 #include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <future>
 #include <list>
 #include <memory>
-#include <queue>
+#include <mutex>
 #include <thread>
 #include <vector>
 
 #include "common/hixl_log.h"
 #include "common/hixl_utils.h"
+#include "common/inline_task.h"
+#include "common/mpmc_queue.h"
 
 namespace hixl {
-using ThreadTask = std::function<void()>;
+using ThreadTask = InlineTask;
+
+// 任务环的容量；环满时commit不阻塞，任务转入溢出链表，池内任务提交任务也不会死锁
+constexpr size_t kDefaultTaskQueueCapacity = 4096U;
 
 class ThreadPool {
  public:
-  explicit ThreadPool(std::string thread_name_prefix, const uint32_t min_size = 4U, const uint32_t max_size = 4U);
+  explicit ThreadPool(std::string thread_name_prefix, const uint32_t min_size = 4U, const uint32_t max_size = 4U,
+                      const size_t queue_capacity = kDefaultTaskQueueCapacity);
   ~ThreadPool();
   void Destroy();
 
@@ -43,19 +48,14 @@ class ThreadPool {
       return fail_future;
     }
 
-    const auto bindFunc = std::bind(std::forward<Func>(func), std::forward<Args>(args)...);
-    const auto task = MakeShared<std::packaged_task<retType()>>(bindFunc);
-    if (task == nullptr) {
-      HIXL_LOGE(ge::FAILED, "[ThreadPool:%s] make shared failed", thread_name_prefix_.c_str());
+    // packaged_task只可移动，直接存入InlineTask，省去shared_ptr与std::function的分配
+    std::packaged_task<retType()> task(std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
+    std::future<retType> future = task.get_future();
+    if (!tasks_.ForceEmplace(std::move(task))) {
+      HIXL_LOGE(ge::FAILED, "[ThreadPool:%s] has been stopped", thread_name_prefix_.c_str());
       return fail_future;
     }
-    std::future<retType> future = task->get_future();
-    size_t task_queue_size = 0U;
-    {
-      const std::lock_guard<std::mutex> lock{m_lock_};
-      tasks_.emplace([task]() { (*task)(); });
-      task_queue_size = tasks_.size();
-    }
+    const size_t task_queue_size = tasks_.SizeApprox();
 
     uint32_t idle_num = idle_thrd_num_.load();
     uint32_t busy_num = busy_thrd_num_.load();
@@ -66,7 +66,6 @@ class ThreadPool {
       AddTemporaryThread();
     }
 
-    cond_var_.notify_one();
     HIXL_LOGD("[ThreadPool:%s] commit task end, idle:%u, busy:%u, total:%u, tasks:%zu", thread_name_prefix_.c_str(),
               idle_num, busy_num, total_num, task_queue_size);
     return future;
@@ -79,7 +78,7 @@ class ThreadPool {
   void AddTemporaryThread();
   void SetThreadName(const std::string &thread_type, uint32_t thread_idx) const;
   void LogTempThreadExit(const char *reason, uint32_t thread_idx) const;
-  bool PopTask(std::function<void()> &task);
+  bool PopTask(ThreadTask &task);
   void CleanupFinishedTempThreads();
 
   struct TempThreadEntry {
@@ -90,9 +89,8 @@ class ThreadPool {
   std::string thread_name_prefix_;
   std::vector<std::thread> pool_;
   std::list<TempThreadEntry> temp_threads_;
-  std::queue<ThreadTask> tasks_;
-  std::mutex m_lock_;
-  std::condition_variable cond_var_;
+  BlockingMpmcQueue<ThreadTask> tasks_;
+  std::mutex m_lock_;  // 保护temp_threads_
   std::atomic<bool> is_stopped_;
   std::atomic<uint32_t> idle_thrd_num_;
   std::atomic<uint32_t> busy_thrd_num_;
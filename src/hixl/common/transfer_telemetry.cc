@@ -0,0 +1,267 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "transfer_telemetry.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <thread>
+
+namespace hixl {
+namespace {
+constexpr uint64_t kInvalidEpoch = UINT64_MAX;
+constexpr uint64_t kResettingEpoch = UINT64_MAX - 1U;  // 某线程正在清零该槽
+constexpr double kMillisPerSecond = 1000.0;
+constexpr uint64_t kPercent = 100U;
+
+std::atomic<uint64_t> g_next_telemetry_id{0U};
+std::atomic<size_t> g_next_thread_index{0U};
+
+size_t LocalShardIndex() {
+  thread_local const size_t index =
+      g_next_thread_index.fetch_add(1U, std::memory_order_relaxed) % TransferTelemetry::kShardNum;
+  return index;
+}
+
+// 桶0为0us，桶i(i>=1)覆盖[2^(i-1), 2^i - 1]us，最后一个桶收纳更大的时延
+size_t LatencyBucket(uint64_t latency_us) {
+  if (latency_us == 0U) {
+    return 0U;
+  }
+  const auto bucket = static_cast<size_t>(64 - __builtin_clzll(latency_us));
+  return std::min(bucket, TransferTelemetry::kLatencyBuckets - 1U);
+}
+
+uint64_t BucketUpperBound(size_t bucket) {
+  return (bucket == 0U) ? 0U : ((1ULL << bucket) - 1U);
+}
+
+void StoreMax(std::atomic<uint64_t> &counter, uint64_t value) {
+  uint64_t current = counter.load(std::memory_order_relaxed);
+  while ((value > current) && !counter.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+}  // namespace
+
+TransferTelemetry::TransferTelemetry() : id_(g_next_telemetry_id.fetch_add(1U, std::memory_order_relaxed)) {}
+
+TransferTelemetry::~TransferTelemetry() {
+  // 线程本地缓存中残留的远端计数在各线程下次按名称查找未命中时释放
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &peer : peers_) {
+    peer.second->removed.store(true, std::memory_order_relaxed);
+  }
+}
+
+uint64_t TransferTelemetry::NowMillis() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+uint64_t TransferTelemetry::NowMicros() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+uint64_t TransferTelemetry::TotalBytes(const std::vector<TransferOpDesc> &op_descs) {
+  uint64_t total = 0U;
+  for (const auto &desc : op_descs) {
+    total += desc.len;
+  }
+  return total;
+}
+
+void TransferTelemetry::Record(const std::string &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us) {
+  Record(peer, operation, bytes, latency_us, NowMillis());
+}
+
+void TransferTelemetry::Record(const std::string &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us,
+                               uint64_t now_ms) {
+  Record(GetLocalPeer(peer, now_ms), operation, bytes, latency_us, now_ms);
+}
+
+void TransferTelemetry::Record(Peer &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us) {
+  Record(peer, operation, bytes, latency_us, NowMillis());
+}
+
+void TransferTelemetry::Record(Peer &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us,
+                               uint64_t now_ms) {
+  const uint64_t epoch = now_ms / kSlotMillis;
+  Slot &slot = peer.shards[LocalShardIndex()].directions[operation == READ ? 0U : 1U].slots[epoch % kWindowSlots];
+  uint64_t current = slot.epoch.load(std::memory_order_acquire);
+  if (current != epoch) {
+    if ((current != kResettingEpoch) &&
+        slot.epoch.compare_exchange_strong(current, kResettingEpoch, std::memory_order_relaxed)) {
+      // 先置为清零中再清零，读者据前后两次epoch是否一致丢弃清零过程中的槽
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.bytes.store(0U, std::memory_order_relaxed);
+      slot.ops.store(0U, std::memory_order_relaxed);
+      slot.max_latency_us.store(0U, std::memory_order_relaxed);
+      for (auto &bucket : slot.latency_buckets) {
+        bucket.store(0U, std::memory_order_relaxed);
+      }
+      slot.epoch.store(epoch, std::memory_order_release);
+    } else {
+      // 同分片的其他线程正在清零，清零很短，等其发布后再写
+      while ((current = slot.epoch.load(std::memory_order_acquire)) == kResettingEpoch) {
+        std::this_thread::yield();
+      }
+      if (current != epoch) {
+        return;  // 时钟跨越时间片边界时的个别样本直接丢弃
+      }
+    }
+  }
+  (void)slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+  (void)slot.ops.fetch_add(1U, std::memory_order_relaxed);
+  (void)slot.latency_buckets[LatencyBucket(latency_us)].fetch_add(1U, std::memory_order_relaxed);
+  StoreMax(slot.max_latency_us, latency_us);
+}
+
+TransferTelemetry::Peer &TransferTelemetry::GetLocalPeer(const std::string &peer, uint64_t now_ms) {
+  thread_local std::unordered_map<uint64_t, std::unordered_map<std::string, PeerPtr>> local_peers;
+  auto &refs = local_peers[id_];
+  const auto it = refs.find(peer);
+  if ((it != refs.cend()) && !it->second->removed.load(std::memory_order_relaxed)) {
+    return *it->second;
+  }
+  // 未命中时顺带释放本线程缓存的已删除远端，包括已析构实例的残留项
+  for (auto instance_it = local_peers.begin(); instance_it != local_peers.end();) {
+    auto &cached = instance_it->second;
+    for (auto cached_it = cached.begin(); cached_it != cached.end();) {
+      cached_it = cached_it->second->removed.load(std::memory_order_relaxed) ? cached.erase(cached_it)
+                                                                              : std::next(cached_it);
+    }
+    instance_it = (cached.empty() && (instance_it->first != id_)) ? local_peers.erase(instance_it)
+                                                                   : std::next(instance_it);
+  }
+  auto &peer_entry = refs[peer];
+  peer_entry = GetPeer(peer, now_ms);
+  return *peer_entry;
+}
+
+TransferTelemetry::PeerPtr TransferTelemetry::GetPeer(const std::string &peer) {
+  return GetPeer(peer, NowMillis());
+}
+
+TransferTelemetry::PeerPtr TransferTelemetry::GetPeer(const std::string &peer, uint64_t now_ms) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &entry = peers_[peer];
+  if (entry == nullptr) {
+    entry = std::make_shared<Peer>();
+    entry->created_ms = now_ms;
+  }
+  return entry;
+}
+
+void TransferTelemetry::Remove(const std::string &peer) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = peers_.find(peer);
+  if (it == peers_.end()) {
+    return;
+  }
+  it->second->removed.store(true, std::memory_order_relaxed);
+  peers_.erase(it);
+}
+
+void TransferTelemetry::Accumulate(const DirectionCounters &counters, uint64_t now_epoch, Aggregate &aggregate) {
+  for (const auto &slot : counters.slots) {
+    const uint64_t epoch = slot.epoch.load(std::memory_order_acquire);
+    if ((epoch == kInvalidEpoch) || (epoch > now_epoch) || (now_epoch - epoch >= kWindowSlots)) {
+      continue;
+    }
+    Aggregate current;
+    current.bytes = slot.bytes.load(std::memory_order_relaxed);
+    current.ops = slot.ops.load(std::memory_order_relaxed);
+    current.max_latency_us = slot.max_latency_us.load(std::memory_order_relaxed);
+    for (size_t i = 0U; i < kLatencyBuckets; ++i) {
+      current.latency_buckets[i] = slot.latency_buckets[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.epoch.load(std::memory_order_relaxed) != epoch) {
+      continue;
+    }
+    aggregate.bytes += current.bytes;
+    aggregate.ops += current.ops;
+    aggregate.max_latency_us = std::max(aggregate.max_latency_us, current.max_latency_us);
+    for (size_t i = 0U; i < kLatencyBuckets; ++i) {
+      aggregate.latency_buckets[i] += current.latency_buckets[i];
+    }
+  }
+}
+
+uint64_t TransferTelemetry::LatencyQuantile(const Aggregate &aggregate, uint64_t rank) {
+  uint64_t seen = 0U;
+  for (size_t i = 0U; i < kLatencyBuckets; ++i) {
+    seen += aggregate.latency_buckets[i];
+    if (seen > rank) {
+      return std::min(BucketUpperBound(i), aggregate.max_latency_us);
+    }
+  }
+  return aggregate.max_latency_us;
+}
+
+TransferStatistics TransferTelemetry::ToStatistics(const Aggregate &aggregate, uint64_t span_ms) {
+  TransferStatistics statistics;
+  statistics.total_bytes = aggregate.bytes;
+  statistics.total_ops = aggregate.ops;
+  statistics.max_latency_us = aggregate.max_latency_us;
+  if (aggregate.ops == 0U) {
+    return statistics;
+  }
+  const double span_seconds = static_cast<double>(span_ms) / kMillisPerSecond;
+  statistics.bytes_per_second = static_cast<double>(aggregate.bytes) / span_seconds;
+  statistics.ops_per_second = static_cast<double>(aggregate.ops) / span_seconds;
+  // 按直方图总次数计算秩，避免与ops读取时刻不同造成越界
+  uint64_t samples = 0U;
+  for (const auto count : aggregate.latency_buckets) {
+    samples += count;
+  }
+  if (samples == 0U) {
+    return statistics;
+  }
+  statistics.p50_latency_us = LatencyQuantile(aggregate, samples * 50U / kPercent);
+  statistics.p90_latency_us = LatencyQuantile(aggregate, samples * 90U / kPercent);
+  statistics.p99_latency_us = LatencyQuantile(aggregate, samples * 99U / kPercent);
+  return statistics;
+}
+
+PeerTransferStatistics TransferTelemetry::Query(const std::string &peer) const {
+  return Query(peer, NowMillis());
+}
+
+PeerTransferStatistics TransferTelemetry::Query(const std::string &peer, uint64_t now_ms) const {
+  PeerTransferStatistics statistics;
+  statistics.window_ms = static_cast<uint32_t>(kSlotMillis * kWindowSlots);
+  PeerPtr peer_entry;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = peers_.find(peer);
+    if (it == peers_.cend()) {
+      return statistics;
+    }
+    peer_entry = it->second;
+  }
+  const uint64_t now_epoch = now_ms / kSlotMillis;
+  std::array<Aggregate, 2U> aggregates{};
+  for (const auto &shard : peer_entry->shards) {
+    Accumulate(shard.directions[0U], now_epoch, aggregates[0U]);
+    Accumulate(shard.directions[1U], now_epoch, aggregates[1U]);
+  }
+  // 窗口为当前未满的时间片加之前的完整时间片，远端首次传输不足一个窗口时按实际时长计算速率
+  const uint64_t window_span = (kWindowSlots - 1U) * kSlotMillis + (now_ms % kSlotMillis) + 1U;
+  const uint64_t alive_span = (now_ms >= peer_entry->created_ms) ? (now_ms - peer_entry->created_ms + 1U) : 1U;
+  const uint64_t span_ms = std::min(window_span, alive_span);
+  statistics.read = ToStatistics(aggregates[0U], span_ms);
+  statistics.write = ToStatistics(aggregates[1U], span_ms);
+  return statistics;
+}
+}  // namespace hixl
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_COMMON_TRANSFER_TELEMETRY_H_
+#define CANN_HIXL_SRC_HIXL_COMMON_TRANSFER_TELEMETRY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "hixl/hixl_types.h"
+
+namespace hixl {
+/**
+ * 按远端、按方向统计滑动时间窗口内的传输字节数、次数与时延分布。
+ * 每个远端持有固定个数的计数分片，线程按线程序号选取分片，线程数不超过分片数时各线程写不同分片；
+ * Record不加锁，仅对本分片做relaxed原子累加。GetPeer取得的远端计数可由句柄或client缓存，
+ * 之后按远端计数Record不再按名称查找；Query汇总该远端的全部分片，结果为近似值，与并发Record之间不保证一致的快照。
+ */
+class TransferTelemetry {
+ public:
+  static constexpr uint64_t kSlotMillis = 1000U;
+  static constexpr size_t kWindowSlots = 10U;
+  static constexpr size_t kLatencyBuckets = 32U;
+  static constexpr size_t kShardNum = 8U;
+
+  struct Peer;
+  using PeerPtr = std::shared_ptr<Peer>;
+
+  TransferTelemetry();
+  ~TransferTelemetry();
+  TransferTelemetry(const TransferTelemetry &) = delete;
+  TransferTelemetry &operator=(const TransferTelemetry &) = delete;
+
+  // 取得远端计数，不存在时创建；仅在建链或解析远端时调用
+  PeerPtr GetPeer(const std::string &peer);
+
+  static void Record(Peer &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us);
+  static void Record(Peer &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us, uint64_t now_ms);
+
+  // 按名称记录，经线程本地缓存查找远端计数，供未缓存远端计数的调用方使用
+  void Record(const std::string &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us);
+  void Record(const std::string &peer, TransferOp operation, uint64_t bytes, uint64_t latency_us, uint64_t now_ms);
+
+  PeerTransferStatistics Query(const std::string &peer) const;
+  PeerTransferStatistics Query(const std::string &peer, uint64_t now_ms) const;
+
+  // 远端断链后丢弃其统计，仍持有旧远端计数的调用方写入的数据不再被查询到
+  void Remove(const std::string &peer);
+
+  static uint64_t NowMillis();
+  static uint64_t NowMicros();
+  static uint64_t TotalBytes(const std::vector<TransferOpDesc> &op_descs);
+
+ private:
+  // 单个时间片内的计数，epoch为时间片序号，进入新时间片的线程清零后发布
+  struct Slot {
+    std::atomic<uint64_t> epoch{UINT64_MAX};
+    std::atomic<uint64_t> bytes{0U};
+    std::atomic<uint64_t> ops{0U};
+    std::atomic<uint64_t> max_latency_us{0U};
+    std::array<std::atomic<uint64_t>, kLatencyBuckets> latency_buckets{};
+  };
+
+  struct DirectionCounters {
+    std::array<Slot, kWindowSlots> slots;
+  };
+
+  struct alignas(64) Shard {
+    std::array<DirectionCounters, 2U> directions;  // 下标为TransferOp
+  };
+
+  struct Aggregate {
+    uint64_t bytes = 0U;
+    uint64_t ops = 0U;
+    uint64_t max_latency_us = 0U;
+    std::array<uint64_t, kLatencyBuckets> latency_buckets{};
+  };
+
+  Peer &GetLocalPeer(const std::string &peer, uint64_t now_ms);
+  PeerPtr GetPeer(const std::string &peer, uint64_t now_ms);
+  static void Accumulate(const DirectionCounters &counters, uint64_t now_epoch, Aggregate &aggregate);
+  static TransferStatistics ToStatistics(const Aggregate &aggregate, uint64_t span_ms);
+  static uint64_t LatencyQuantile(const Aggregate &aggregate, uint64_t rank);
+
+  const uint64_t id_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, PeerPtr> peers_;
+};
+
+// 分片随远端计数一次分配，线程退出不遗留分片
+struct TransferTelemetry::Peer {
+  std::array<Shard, kShardNum> shards;
+  uint64_t created_ms = 0U;
+  std::atomic<bool> removed{false};
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_COMMON_TRANSFER_TELEMETRY_H_
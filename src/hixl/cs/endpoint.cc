@@ -126,6 +126,9 @@ Status Endpoint::Finalize() {
     }
   }
   reg_mems_.clear();
+  if (host_register_cache_capacity_ > 0U) {
+    HostRegisterProxy::ReleaseIdleCacheByDev(endpoint_.loc.device.devPhyId, this);
+  }
   auto hccl_ret = HcommProxy::EndpointDestroy(handle_);
   if (hccl_ret != HCCL_SUCCESS) {
     ret = hixl::ConvertHcommErrorToStatus(hccl_ret);
@@ -199,7 +202,10 @@ Status Endpoint::DeregisterMem(MemHandle mem_handle) {
   }
   HIXL_CHK_HCCL_RET(HcommProxy::MemUnreg(handle_, mem_handle));
   if (it->second.registered_dev_mem != nullptr) {
-    HIXL_CHK_STATUS_RET(HostRegisterProxy::UnregisterByDev(endpoint_.loc.device.devPhyId, it->second.mem.addr),
+    HostRegisterCachePolicy policy{};
+    policy.owner = this;
+    policy.capacity = host_register_cache_capacity_;
+    HIXL_CHK_STATUS_RET(HostRegisterProxy::UnregisterByDev(endpoint_.loc.device.devPhyId, it->second.mem.addr, policy),
                         "Deregister mem failed, as host mem unregister failed, host addr=%p, devPhyId=%d.",
                         it->second.mem.addr, endpoint_.loc.device.devPhyId);
   }
@@ -220,6 +226,18 @@ Status Endpoint::ExportMem(std::vector<HixlMemDesc> &mem_descs) {
   return SUCCESS;
 }
 
+Status Endpoint::ExportMem(MemHandle mem_handle, HixlMemDesc &mem_desc) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = reg_mems_.find(mem_handle);
+  HIXL_CHK_BOOL_RET_STATUS(it != reg_mems_.end(), PARAM_INVALID, "mem handle:%p is not registered", mem_handle);
+  auto &mem = it->second;
+  if (mem.export_desc == nullptr) {
+    HIXL_CHK_HCCL_RET(HcommProxy::MemExport(handle_, mem_handle, &mem.export_desc, &mem.export_len));
+  }
+  mem_desc = mem;
+  return SUCCESS;
+}
+
 Status Endpoint::CreateChannel(const ChannelDesc &channel_desc, ChannelHandle &channel_handle, uint32_t timeout_ms) {
   HIXL_CHK_BOOL_RET_STATUS(handle_ != nullptr, FAILED, "[channel] CreateChannel called before Initialize");
   CommEngine engine = CommEngine::COMM_ENGINE_RESERVED;
@@ -294,4 +312,9 @@ uint32_t Endpoint::GetPort() const {
   return port_;
 }
 
+void Endpoint::SetHostRegisterCacheCapacity(uint64_t capacity) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  host_register_cache_capacity_ = capacity;
+}
+
 }  // namespace hixl
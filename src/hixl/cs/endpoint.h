@@ -38,12 +38,15 @@ class Endpoint {
   Status RegisterMem(const char *mem_tag, const CommMem &mem, MemHandle &mem_handle);
   Status DeregisterMem(MemHandle mem_handle);
   Status ExportMem(std::vector<HixlMemDesc> &mem_descs);
+  Status ExportMem(MemHandle mem_handle, HixlMemDesc &mem_desc);
   Status CreateChannel(const ChannelDesc &channel_desc, ChannelHandle &channel_handle, uint32_t timeout_ms);
   Status DestroyChannel(ChannelHandle channel_handle);
   Status GetMemDesc(MemHandle mem_handle, HixlMemDesc &desc) const;
   Status MemImport(const void *mem_desc, uint32_t desc_len, CommMem &out_buf) const;
   void SetPort(uint32_t port);
   uint32_t GetPort() const;
+  // 注销host内存时保留aclrtHostRegister映射的空闲缓存字节数上限，默认0即注销时立即解除映射
+  void SetHostRegisterCacheCapacity(uint64_t capacity);
 
  private:
   mutable std::mutex mutex_;
@@ -53,6 +56,7 @@ class Endpoint {
   std::map<ChannelHandle, ChannelPtr> channels_;
   uint32_t port_ = 0;
   bool need_host_va_mapping_{false};
+  uint64_t host_register_cache_capacity_ = 0U;
 };
 
 using EndpointPtr = std::shared_ptr<Endpoint>;
@@ -25,6 +25,11 @@ constexpr const char *kMaxActiveChannels = "comm_resource_config.max_active_chan
 constexpr int64_t kMinListenPort = 1;
 constexpr int64_t kMaxListenPort = 65535;
 constexpr int64_t kMinActiveChannels = 1;
+constexpr const char *kDescChunkSize = "comm_resource_config.desc_chunk_size";
+constexpr int64_t kMinDescChunkSize = 4096;
+constexpr const char *kHostRegisterCacheSize = "comm_resource_config.host_register_cache_size";
+constexpr int64_t kMaxHostRegisterCacheSizeMB = 1024L * 1024L;
+constexpr uint64_t kBytesPerMB = 1024UL * 1024UL;
 
 Status ParseListenPort(const nlohmann::json &json, CommResourceConfig &config) {
   const auto it = json.find(kListenPort);
@@ -79,6 +84,42 @@ Status ParseMaxActiveChannels(const nlohmann::json &json, CommResourceConfig &co
   return SUCCESS;
 }
 
+Status ParseDescChunkSize(const nlohmann::json &json, CommResourceConfig &config) {
+  const auto it = json.find(kDescChunkSize);
+  if (it == json.end()) {
+    return SUCCESS;
+  }
+
+  const auto val = JsonToNumber<int64_t>(*it);
+  if (val < kMinDescChunkSize) {
+    HIXL_LOGE(PARAM_INVALID, "[GlobalConfig] desc_chunk_size out of range: %ld, must be >= %ld", val,
+              kMinDescChunkSize);
+    return PARAM_INVALID;
+  }
+
+  config.desc_chunk_size = static_cast<uint64_t>(val);
+  HIXL_LOGI("[GlobalConfig] desc_chunk_size=%lu", *config.desc_chunk_size);
+  return SUCCESS;
+}
+
+Status ParseHostRegisterCacheSize(const nlohmann::json &json, CommResourceConfig &config) {
+  const auto it = json.find(kHostRegisterCacheSize);
+  if (it == json.end()) {
+    return SUCCESS;
+  }
+
+  const auto val = JsonToNumber<int64_t>(*it);
+  if (val < 0 || val > kMaxHostRegisterCacheSizeMB) {
+    HIXL_LOGE(PARAM_INVALID, "[GlobalConfig] host_register_cache_size out of range: %ld, must be in [0, %ld] MB", val,
+              kMaxHostRegisterCacheSizeMB);
+    return PARAM_INVALID;
+  }
+
+  config.host_register_cache_size = static_cast<uint64_t>(val);
+  HIXL_LOGI("[GlobalConfig] host_register_cache_size=%lu MB", *config.host_register_cache_size);
+  return SUCCESS;
+}
+
 Status ParseCommResourceConfig(const nlohmann::json &json, CommResourceConfig &config,
                                GlobalConfig::ParseTarget target) {
   if (target == GlobalConfig::ParseTarget::kAll || target == GlobalConfig::ParseTarget::kServer) {
@@ -95,8 +136,11 @@ Status ParseCommResourceConfig(const nlohmann::json &json, CommResourceConfig &c
       HIXL_LOGE(ret, "[GlobalConfig] Failed to parse qos");
       return ret;
     }
+    HIXL_CHK_STATUS_RET(ParseDescChunkSize(json, config), "[GlobalConfig] Failed to parse desc_chunk_size");
   }
   HIXL_CHK_STATUS_RET(ParseMaxActiveChannels(json, config), "[GlobalConfig] Failed to parse max_active_channels");
+  HIXL_CHK_STATUS_RET(ParseHostRegisterCacheSize(json, config),
+                      "[GlobalConfig] Failed to parse host_register_cache_size");
   return SUCCESS;
 }
 }  // namespace
@@ -140,4 +184,15 @@ std::optional<uint8_t> GlobalConfig::Qos() const {
 std::optional<uint32_t> GlobalConfig::MaxActiveChannels() const {
   return comm_resource_config_.max_active_channels;
 }
+
+std::optional<uint64_t> GlobalConfig::DescChunkSize() const {
+  return comm_resource_config_.desc_chunk_size;
+}
+
+std::optional<uint64_t> GlobalConfig::HostRegisterCacheBytes() const {
+  if (!comm_resource_config_.host_register_cache_size.has_value()) {
+    return std::nullopt;
+  }
+  return *comm_resource_config_.host_register_cache_size * kBytesPerMB;
+}
 }  // namespace hixl
@@ -22,6 +22,8 @@ struct CommResourceConfig {
   std::optional<uint32_t> listen_port;
   std::optional<uint8_t> qos;
   std::optional<uint32_t> max_active_channels;
+  std::optional<uint64_t> desc_chunk_size;
+  std::optional<uint64_t> host_register_cache_size;  // MB
 };
 
 class GlobalConfig {
@@ -37,6 +39,9 @@ class GlobalConfig {
   std::optional<uint32_t> ListenPort() const;
   std::optional<uint8_t> Qos() const;
   std::optional<uint32_t> MaxActiveChannels() const;
+  std::optional<uint64_t> DescChunkSize() const;
+  // 返回字节数，未配置时为空
+  std::optional<uint64_t> HostRegisterCacheBytes() const;
 
  private:
   CommResourceConfig comm_resource_config_;
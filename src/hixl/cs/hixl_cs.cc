@@ -216,6 +216,25 @@ HixlStatus HixlCSClientQueryCompleteStatus(HixlClientHandle client_handle, Compl
   return HIXL_SUCCESS;
 }
 
+HixlStatus HixlCSClientQueryProgress(HixlClientHandle client_handle, CompleteHandle complete_handle,
+                                     uint64_t *completed_bytes, uint64_t *total_bytes) {
+  HIXL_CHECK_NOTNULL(client_handle);
+  HIXL_CHECK_NOTNULL(complete_handle);
+  auto client = static_cast<hixl::HixlCSClient *>(client_handle);
+  HIXL_CHK_STATUS_RET(client->QueryProgress(complete_handle, completed_bytes, total_bytes),
+                      "HixlCSClientQueryProgress failed, client_handle is %p.", client_handle);
+  return HIXL_SUCCESS;
+}
+
+HixlStatus HixlCSClientReleaseCompleteHandle(HixlClientHandle client_handle, CompleteHandle complete_handle) {
+  HIXL_CHECK_NOTNULL(client_handle);
+  HIXL_CHECK_NOTNULL(complete_handle);
+  auto client = static_cast<hixl::HixlCSClient *>(client_handle);
+  HIXL_CHK_STATUS_RET(client->ReleaseHandle(complete_handle),
+                      "HixlCSClientReleaseCompleteHandle failed, client_handle is %p.", client_handle);
+  return HIXL_SUCCESS;
+}
+
 HixlStatus HixlCSClientConnect(HixlClientHandle client_handle, uint32_t timeout_ms) {
   HIXL_CHECK_NOTNULL(client_handle);
   auto *client = static_cast<hixl::HixlCSClient *>(client_handle);
@@ -252,4 +271,11 @@ HixlStatus HixlCSServerRegProc(HixlServerHandle server_handle, hixl::CtrlMsgType
                       static_cast<int32_t>(msg_type));
   return HIXL_SUCCESS;
 }
+
+HixlStatus HixlCSServerRegDisconnectProc(HixlServerHandle server_handle, hixl::DisconnectProcessor proc) {
+  auto server = static_cast<hixl::HixlCSServer *>(server_handle);
+  HIXL_CHECK_NOTNULL(server, ", please use handle generated by HixlCSServerCreate");
+  HIXL_CHK_STATUS_RET(server->RegDisconnectProc(proc), "Failed to reg disconnect proc");
+  return HIXL_SUCCESS;
+}
 }  // namespace hixl
@@ -29,6 +29,7 @@
 #include "common/ctrl_msg_plugin.h"
 #include "conn_msg_handler.h"
 #include "host_register_proxy.h"
+#include "mem_dir_watcher.h"
 #include "mem_msg_handler.h"
 #include "proxy/hcomm_proxy.h"
 
@@ -49,6 +50,9 @@ constexpr uint64_t kFlagResetValue = 0ULL;
 constexpr uint32_t kCustomTimeoutMs = 1800;
 constexpr uint32_t kMaxKernelBatchSize = 128U;
 constexpr uint32_t kNotifyWaitTaskInterval = 1920U;
+// device侧未等待远端完成的字节数上限为kMaxInflightDescChunks个拆分块，超过后插入notify wait。
+// 各窗口在slot的同一条stream上依次执行，notify wait依赖stream内顺序，不跨stream并行
+constexpr uint64_t kMaxInflightDescChunks = 8ULL;
 // ACL_RT_LAUNCH_KERNEL_ATTR_TIMEOUT uses seconds. Async callers observe timeout by CheckStatus.
 constexpr uint16_t kNotifyDefaultWaitTimeS = 27 * 68;
 constexpr uint32_t kMinRdmaRetryCnt = 1U;
@@ -345,6 +349,7 @@ Status HixlCSClient::Create(const HixlClientDesc *client_desc, const HixlClientC
   HIXL_CHK_STATUS_RET(
       GlobalConfig::Parse(config->global_resource_config, global_config_, GlobalConfig::ParseTarget::kClient),
       "[HixlClient] Failed to parse global_resource_config");
+  desc_chunk_size_ = global_config_.DescChunkSize().value_or(kDefaultDescChunkSize);
   HIXL_EVENT(
       "[HixlClient] Create begin. Server=%s:%u. "
       "SrcEndpoint[Loc:%d, protocol:%s, commAddr.Type:%d, commAddr.id:0x%x], "
@@ -356,6 +361,7 @@ Status HixlCSClient::Create(const HixlClientDesc *client_desc, const HixlClientC
       client_desc->remote_endpoint->commAddr.id);
   local_endpoint_ = MakeShared<Endpoint>(*(client_desc->local_endpoint), *(client_desc->remote_endpoint));
   HIXL_CHECK_NOTNULL(local_endpoint_);
+  local_endpoint_->SetHostRegisterCacheCapacity(global_config_.HostRegisterCacheBytes().value_or(0U));
   HIXL_CHK_STATUS_RET(InitDeviceResource(*(client_desc->local_endpoint)), "[HixlClient] InitDeviceResource failed");
   HIXL_DISMISSABLE_GUARD(pool_rollback, ([this]() {
                            if (device_id_ >= 0) {
@@ -544,6 +550,10 @@ Status HixlCSClient::BatchTransferHostAsync(bool is_get, uint32_t list_num, cons
   query_mem_handle->magic = kRoceCompleteMagic;
   query_mem_handle->flag_index = flag_index;
   query_mem_handle->flag_address = flag_addr;
+  query_mem_handle->total_bytes = 0U;
+  for (uint32_t i = 0U; i < list_num; ++i) {
+    query_mem_handle->total_bytes += desc_list[i].len;
+  }
   // 需要先创建query_handle实体，之后再传给指针。
   *query_handle = query_mem_handle;
   live_handles_[flag_index] = query_mem_handle;
@@ -607,6 +617,11 @@ Status HixlCSClient::ReleaseDevCompleteHandle(DeviceCompleteHandle *handle) {
     handle->host_flag = nullptr;
   }
 
+  if (handle->progress_flags != nullptr) {
+    HIXL_CHK_ACL(aclrtFreeHost(handle->progress_flags));
+    handle->progress_flags = nullptr;
+  }
+
   // Free device op desc buffer
   if (handle->dev_op_desc_buf != nullptr) {
     HIXL_CHK_ACL(aclrtFree(handle->dev_op_desc_buf));
@@ -717,18 +732,79 @@ Status HixlCSClient::AllocateHostFlag(void *&host_flag) const {
   return SUCCESS;
 }
 
-Status HixlCSClient::LaunchDeviceChunkedKernels(bool is_get, DeviceCompleteHandle &handle, uint32_t list_num) const {
-  uint32_t num_chunks = (list_num + kMaxKernelBatchSize - 1U) / kMaxKernelBatchSize;
-  for (uint32_t chunk_idx = 0U; chunk_idx < num_chunks; ++chunk_idx) {
-    uint32_t chunk_offset = chunk_idx * kMaxKernelBatchSize;
-    uint32_t chunk_list_num = std::min(kMaxKernelBatchSize, list_num - chunk_offset);
-    uint32_t chunk_end = chunk_offset + chunk_list_num;
-    bool need_notify_wait = (chunk_end % kNotifyWaitTaskInterval == 0U) || (chunk_end == list_num);
+void HixlCSClient::PlanDeviceKernelGroups(uint32_t list_num, const HixlOneSideOpDesc *desc_list,
+                                          std::vector<DeviceKernelGroup> &groups) const {
+  const uint64_t inflight_window = desc_chunk_size_ * kMaxInflightDescChunks;
+  uint32_t offset = 0U;
+  uint32_t descs_since_wait = 0U;
+  uint64_t bytes_since_wait = 0U;
+  uint64_t done_bytes = 0U;
+  while (offset < list_num) {
+    DeviceKernelGroup group{offset, 0U, false, 0U};
+    // 单组最多kMaxKernelBatchSize个描述符，未等待字节数达到窗口时提前截断
+    while ((offset + group.list_num < list_num) && (group.list_num < kMaxKernelBatchSize) &&
+           (bytes_since_wait < inflight_window)) {
+      bytes_since_wait += desc_list[offset + group.list_num].len;
+      ++group.list_num;
+    }
+    offset += group.list_num;
+    descs_since_wait += group.list_num;
+    group.wait_notify = (descs_since_wait >= kNotifyWaitTaskInterval) || (bytes_since_wait >= inflight_window) ||
+                        (offset == list_num);
+    if (group.wait_notify) {
+      done_bytes += bytes_since_wait;
+      group.done_bytes = done_bytes;
+      descs_since_wait = 0U;
+      bytes_since_wait = 0U;
+    }
+    groups.emplace_back(group);
+  }
+}
+
+Status HixlCSClient::AllocateProgressFlags(DeviceCompleteHandle &handle,
+                                           const std::vector<DeviceKernelGroup> &groups) const {
+  for (size_t i = 0U; i + 1U < groups.size(); ++i) {
+    if (groups[i].wait_notify) {
+      handle.progress_bytes.emplace_back(groups[i].done_bytes);
+    }
+  }
+  if (handle.progress_bytes.empty()) {
+    return SUCCESS;
+  }
+  void *flags = nullptr;
+  const size_t flags_size = handle.progress_bytes.size() * sizeof(uint64_t);
+  HIXL_CHK_ACL_RET(aclrtMallocHost(&flags, flags_size), "[HixlClient] aclrtMallocHost progress_flags failed, size:%zu",
+                   flags_size);
+  handle.progress_flags = static_cast<uint64_t *>(flags);
+  for (size_t i = 0U; i < handle.progress_bytes.size(); ++i) {
+    handle.progress_flags[i] = kDeviceFlagInitValue;
+  }
+  return SUCCESS;
+}
+
+Status HixlCSClient::LaunchDeviceChunkedKernels(bool is_get, DeviceCompleteHandle &handle, uint32_t list_num,
+                                                const HixlOneSideOpDesc *desc_list) const {
+  std::vector<DeviceKernelGroup> groups;
+  PlanDeviceKernelGroups(list_num, desc_list, groups);
+  // 仅异步任务需要查询进度，同步任务由调用方等待stream完成
+  if (handle.host_flag != nullptr) {
+    HIXL_CHK_STATUS_RET(AllocateProgressFlags(handle, groups), "AllocateProgressFlags failed");
+  }
+  size_t progress_index = 0U;
+  for (size_t group_idx = 0U; group_idx < groups.size(); ++group_idx) {
+    const DeviceKernelGroup &group = groups[group_idx];
     HixlOneSideOpParam param{};
-    HIXL_CHK_STATUS_RET(BuildDeviceChunkParam(handle, chunk_offset, chunk_list_num, need_notify_wait, param),
-                        "BuildDeviceChunkParam failed for chunk %u/%u", chunk_idx, num_chunks);
-    HIXL_CHK_STATUS_RET(LaunchDeviceKernel(is_get, handle, param, need_notify_wait),
-                        "LaunchDeviceKernel failed for chunk %u/%u", chunk_idx, num_chunks);
+    HIXL_CHK_STATUS_RET(BuildDeviceChunkParam(handle, group.offset, group.list_num, group.wait_notify, param),
+                        "BuildDeviceChunkParam failed for chunk %zu/%zu", group_idx, groups.size());
+    HIXL_CHK_STATUS_RET(LaunchDeviceKernel(is_get, handle, param, group.wait_notify),
+                        "LaunchDeviceKernel failed for chunk %zu/%zu", group_idx, groups.size());
+    if (group.wait_notify && (progress_index < handle.progress_bytes.size())) {
+      HIXL_CHK_ACL_RET(aclrtMemcpyAsync(&handle.progress_flags[progress_index], sizeof(uint64_t),
+                                        handle.shared_slot->dev_const_one, sizeof(uint64_t),
+                                        ACL_MEMCPY_DEVICE_TO_HOST, handle.shared_slot->stream),
+                       "[HixlClient] aclrtMemcpyAsync (progress flag D2H) failed, index:%zu", progress_index);
+      ++progress_index;
+    }
   }
   return SUCCESS;
 }
@@ -767,6 +843,7 @@ Status HixlCSClient::AllocateDeviceDescBuf(DeviceCompleteHandle &handle, uint32_
 Status HixlCSClient::BuildDeviceChunkParam(DeviceCompleteHandle &handle, uint32_t chunk_offset, uint32_t chunk_list_num,
                                            bool need_notify_wait, HixlOneSideOpParam &param) const {
   param.thread = handle.shared_slot->thread;
+  param.ctx_id = TransferPool::SlotIndexToContextId(handle.shared_slot->slot_index);
   param.channel = static_cast<uint64_t>(client_channel_handle_);
   param.list_num = chunk_list_num;
   auto *chunk_base = static_cast<uint8_t *>(handle.dev_op_desc_buf) + chunk_offset * sizeof(HixlOneSideOpDesc);
@@ -878,6 +955,9 @@ Status HixlCSClient::BatchTransferDeviceAsync(bool is_get, uint32_t list_num, co
   handle->host_flag = host_flag;
   handle->dev_op_desc_buf = nullptr;
   HIXL_DISMISS_GUARD(flag_guard);
+  for (uint32_t i = 0U; i < list_num; ++i) {
+    handle->total_bytes += desc_list[i].len;
+  }
 
   HIXL_CHK_STATUS_RET(AllocateDeviceDescBuf(*handle, list_num, desc_list), "AllocateDeviceDescBuf failed");
 
@@ -886,7 +966,7 @@ Status HixlCSClient::BatchTransferDeviceAsync(bool is_get, uint32_t list_num, co
 
   {
     hixl::TemporaryRtContext ctx_guard(handle->shared_slot->ctx);
-    HIXL_CHK_STATUS_RET(LaunchDeviceChunkedKernels(is_get, *handle, list_num),
+    HIXL_CHK_STATUS_RET(LaunchDeviceChunkedKernels(is_get, *handle, list_num, desc_list),
                         "[HixlClient] LaunchDeviceChunkedKernels failed, is_get=%d, list_num=%u, slot=%u, thread=%lu",
                         static_cast<int32_t>(is_get), list_num, handle->shared_slot->slot_index,
                         static_cast<uint64_t>(handle->shared_slot->thread));
@@ -932,7 +1012,7 @@ Status HixlCSClient::BatchTransferDeviceSync(bool is_get, uint32_t list_num, con
 
   {
     hixl::TemporaryRtContext ctx_guard(handle->shared_slot->ctx);
-    HIXL_CHK_STATUS_RET(LaunchDeviceChunkedKernels(is_get, *handle, list_num),
+    HIXL_CHK_STATUS_RET(LaunchDeviceChunkedKernels(is_get, *handle, list_num, desc_list),
                         "[HixlClient] LaunchDeviceChunkedKernels failed, is_get=%d, list_num=%u, slot=%u, thread=%lu",
                         static_cast<int32_t>(is_get), list_num, handle->shared_slot->slot_index,
                         static_cast<uint64_t>(handle->shared_slot->thread));
@@ -958,13 +1038,14 @@ Status HixlCSClient::BatchTransferDeviceSync(bool is_get, uint32_t list_num, con
 Status HixlCSClient::BatchTransferHostSync(bool is_get, uint32_t list_num, const HixlOneSideOpDesc *desc_list,
                                            uint32_t timeout_ms) {
   void *raw_handle = nullptr;
-  HIXL_CHK_STATUS_RET(BatchTransferHostAsync(is_get, list_num, desc_list, &raw_handle),
+  HIXL_CHK_STATUS_RET(LatchTransferFailureIfNeeded(BatchTransferHostAsync(is_get, list_num, desc_list, &raw_handle)),
                       "[HixlClient] BatchTransferHostAsync failed");
   HIXL_CHECK_NOTNULL(raw_handle);
   const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
   while (true) {
     if (std::chrono::steady_clock::now() >= deadline) {
-      (void)ReleaseCompleteHandle(static_cast<CompleteHandleInfo *>(raw_handle));
+      // 完成标志可能仍在回写，句柄转入released_handles_，待任务结束后再回收标志位
+      released_handles_.push_back(raw_handle);
       HIXL_LOGE(TIMEOUT, "[HixlClient] BatchTransferHostSync timeout after %u ms", timeout_ms);
       return TIMEOUT;
     }
@@ -991,7 +1072,10 @@ Status HixlCSClient::BatchTransferSync(bool is_get, uint32_t list_num, const Hix
                            static_cast<uint32_t>(transfer_failure_status_), static_cast<int32_t>(is_get), list_num);
   auto ctx_guard = GetContextGuard();
   (void)ctx_guard;
+  ReapReleasedHandlesLocked();
   HIXL_CHK_STATUS_RET(ValidateAddress(list_num, desc_list), "[HixlClient] ValidateAddress failed.");
+  std::vector<HixlOneSideOpDesc> split_descs;
+  HIXL_CHK_STATUS_RET(SplitOversizedDescs(list_num, desc_list, split_descs), "[HixlClient] split descs failed.");
   HIXL_CHECK_NOTNULL(local_endpoint_);
   const EndpointDesc endpoint = local_endpoint_->GetEndpoint();
   Status ret = FAILED;
@@ -1006,6 +1090,10 @@ Status HixlCSClient::BatchTransferSync(bool is_get, uint32_t list_num, const Hix
     }
   } else if (endpoint.loc.locType == ENDPOINT_LOC_TYPE_HOST) {
     ret = BatchTransferHostSync(is_get, list_num, desc_list, timeout_ms);
+    // 等待超时只放弃本次请求，标志位不会被复用，链路可继续使用；下发阶段的失败已在BatchTransferHostSync中锁存
+    if (ret == TIMEOUT) {
+      return ret;
+    }
   } else {
     HIXL_LOGE(PARAM_INVALID, "[HixlClient] Invalid endpoint location: %d", endpoint.loc.locType);
     return PARAM_INVALID;
@@ -1022,6 +1110,38 @@ Status HixlCSClient::ConvertHostMappedDescs(uint32_t list_num, HixlOneSideOpDesc
   return mem_store_.BatchConvertHostAddr(list_num, desc_list);
 }
 
+// 超过desc_chunk_size_的描述符拆分为多个子描述符，使传输以块为单位流水下发并可按块统计进度
+Status HixlCSClient::SplitOversizedDescs(uint32_t &list_num, const HixlOneSideOpDesc *&desc_list,
+                                         std::vector<HixlOneSideOpDesc> &split_descs) const {
+  uint64_t split_num = 0U;
+  for (uint32_t i = 0U; i < list_num; ++i) {
+    const uint64_t len = desc_list[i].len;
+    split_num += (len <= desc_chunk_size_) ? 1U : (len + desc_chunk_size_ - 1U) / desc_chunk_size_;
+  }
+  if (split_num == list_num) {
+    return SUCCESS;
+  }
+  HIXL_CHK_BOOL_RET_STATUS(split_num <= std::numeric_limits<uint32_t>::max(), PARAM_INVALID,
+                           "[HixlClient] Too many descs after split, list_num:%u, split_num:%lu, chunk_size:%lu",
+                           list_num, split_num, desc_chunk_size_);
+  split_descs.reserve(static_cast<size_t>(split_num));
+  for (uint32_t i = 0U; i < list_num; ++i) {
+    const HixlOneSideOpDesc &desc = desc_list[i];
+    uint64_t offset = 0U;
+    do {
+      const uint64_t len = std::min(desc.len - offset, desc_chunk_size_);
+      split_descs.emplace_back(HixlOneSideOpDesc{static_cast<uint8_t *>(desc.remote_buf) + offset,
+                                                 static_cast<uint8_t *>(desc.local_buf) + offset, len});
+      offset += len;
+    } while (offset < desc.len);
+  }
+  HIXL_LOGI("[HixlClient] Split oversized descs, list_num:%u -> %zu, chunk_size:%lu", list_num, split_descs.size(),
+            desc_chunk_size_);
+  list_num = static_cast<uint32_t>(split_descs.size());
+  desc_list = split_descs.data();
+  return SUCCESS;
+}
+
 Status HixlCSClient::BatchTransferAsync(bool is_get, uint32_t list_num, const HixlOneSideOpDesc *desc_list,
                                         void **query_handle) {
   std::lock_guard<std::mutex> lock(mutex_);
@@ -1031,7 +1151,10 @@ Status HixlCSClient::BatchTransferAsync(bool is_get, uint32_t list_num, const Hi
                            static_cast<uint32_t>(transfer_failure_status_), static_cast<int32_t>(is_get), list_num);
   auto ctx_guard = GetContextGuard();
   (void)ctx_guard;
+  ReapReleasedHandlesLocked();
   HIXL_CHK_STATUS_RET(ValidateAddress(list_num, desc_list), "[HixlClient] ValidateAddress failed.");
+  std::vector<HixlOneSideOpDesc> split_descs;
+  HIXL_CHK_STATUS_RET(SplitOversizedDescs(list_num, desc_list, split_descs), "[HixlClient] split descs failed.");
   HIXL_CHECK_NOTNULL(local_endpoint_);
   const EndpointDesc ep = local_endpoint_->GetEndpoint();
   Status ret = FAILED;
@@ -1123,9 +1246,72 @@ Status HixlCSClient::CheckStatusDevice(DeviceCompleteHandle &query_handle, HixlC
 // 通过已经建立好的channel，检查批量读写的状态。
 Status HixlCSClient::CheckStatus(void *query_handle, HixlCompleteStatus *status) {
   std::lock_guard<std::mutex> lock(mutex_);
+  ReapReleasedHandlesLocked();
   return CheckStatusLocked(query_handle, status);
 }
 
+Status HixlCSClient::ReleaseHandle(void *query_handle) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  HIXL_CHECK_NOTNULL(query_handle);
+  HixlCompleteStatus status = HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING;
+  HIXL_CHK_STATUS_RET(CheckStatusLocked(query_handle, &status), "[HixlClient] ReleaseHandle check status failed.");
+  // 终态句柄已在查询时释放，仍在途的句柄不能立即回收标志位
+  if (status == HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING) {
+    released_handles_.push_back(query_handle);
+    HIXL_LOGI("[HixlClient] ReleaseHandle deferred, handle=%p, released=%zu", query_handle, released_handles_.size());
+  }
+  return SUCCESS;
+}
+
+void HixlCSClient::ReapReleasedHandlesLocked() {
+  auto it = released_handles_.begin();
+  while (it != released_handles_.end()) {
+    HixlCompleteStatus status = HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING;
+    const Status ret = CheckStatusLocked(*it, &status);
+    it = (ret != SUCCESS || status != HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING) ? released_handles_.erase(it)
+                                                                                         : std::next(it);
+  }
+}
+
+Status HixlCSClient::QueryProgress(void *query_handle, uint64_t *completed_bytes, uint64_t *total_bytes) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  HIXL_CHECK_NOTNULL(query_handle);
+  HIXL_CHECK_NOTNULL(completed_bytes);
+  HIXL_CHECK_NOTNULL(total_bytes);
+  uint32_t head = 0U;
+  errno_t rc = memcpy_s(&head, sizeof(head), query_handle, sizeof(head));
+  HIXL_CHK_BOOL_RET_STATUS(rc == EOK, FAILED, "[HixlClient] Call api:memcpy_s failed, ret:%d, src:%p",
+                           static_cast<int32_t>(rc), query_handle);
+  if (head == kDeviceCompleteMagic) {
+    const auto *handle = static_cast<const DeviceCompleteHandle *>(query_handle);
+    HIXL_CHECK_NOTNULL(handle->host_flag, "[HixlClient] QueryProgress host_flag is null");
+    *total_bytes = handle->total_bytes;
+    if (*static_cast<volatile uint64_t *>(handle->host_flag) == kDeviceFlagDoneValue) {
+      *completed_bytes = handle->total_bytes;
+      return SUCCESS;
+    }
+    *completed_bytes = 0U;
+    // 进度标志在同一stream上按序置位，取最后一个已置位的标志
+    for (size_t i = 0U; i < handle->progress_bytes.size(); ++i) {
+      if (static_cast<volatile uint64_t *>(handle->progress_flags)[i] != kDeviceFlagDoneValue) {
+        break;
+      }
+      *completed_bytes = handle->progress_bytes[i];
+    }
+    return SUCCESS;
+  }
+  if (head == kRoceCompleteMagic) {
+    const auto *handle = static_cast<const CompleteHandleInfo *>(query_handle);
+    HIXL_CHECK_NOTNULL(handle->flag_address);
+    *total_bytes = handle->total_bytes;
+    *completed_bytes = (*static_cast<volatile uint64_t *>(handle->flag_address) == kFlagDoneValue) ? handle->total_bytes
+                                                                                                   : 0U;
+    return SUCCESS;
+  }
+  HIXL_LOGE(PARAM_INVALID, "[HixlClient] QueryProgress bad magic=0x%X", head);
+  return PARAM_INVALID;
+}
+
 Status HixlCSClient::CheckStatusLocked(void *query_handle, HixlCompleteStatus *status) {
   auto ctx_guard = GetContextGuard();
   (void)ctx_guard;
@@ -1282,7 +1468,7 @@ Status HixlCSClient::GetRemoteMemImpl(uint32_t timeout_ms, CommMem **remote_mem_
                       "[HixlClient] SendGetRemoteMemRequest failed. fd=%d, remote_ep_handle=%" PRIu64, socket_,
                       remote_endpoint_handle_);
   std::vector<HixlMemDesc> mem_descs;
-  HIXL_CHK_STATUS_RET(MemMsgHandler::RecvGetRemoteMemResponse(socket_, mem_descs, timeout_ms),
+  HIXL_CHK_STATUS_RET(MemMsgHandler::RecvGetRemoteMemResponse(socket_, mem_descs, mem_dir_version_, timeout_ms),
                       "[HixlClient] RecvGetRemoteMemResponse failed. fd=%d, timeout=%u ms", socket_, timeout_ms);
   HIXL_LOGD("[HixlClient] Recv remote mem descs success. Count=%zu", mem_descs.size());
   HIXL_CHK_STATUS_RET(ImportRemoteMem(mem_descs, remote_mem_list, mem_tag_list, list_num),
@@ -1308,8 +1494,23 @@ Status HixlCSClient::GetRemoteMem(CommMem **remote_mem_list, char ***mem_tag_lis
   *remote_mem_list = nullptr;
   *mem_tag_list = nullptr;
   HIXL_CHECK_NOTNULL(local_endpoint_);
+  if (mem_dir_subscribed_) {
+    // 已订阅内存目录时，本地目录随server推送同步更新，且socket由监听线程读取，直接返回本地目录
+    HIXL_CHK_STATUS_RET(FillOutputFromDirectory(remote_mem_list, mem_tag_list, list_num),
+                        "[HixlClient] FillOutputFromDirectory failed");
+    HIXL_EVENT("[HixlClient] GetRemoteMem from local mem dir. fd=%d, version=%" PRIu64 ", imported=%u", socket_,
+               mem_dir_version_.value_or(0UL), *list_num);
+    return SUCCESS;
+  }
   HIXL_CHK_STATUS_RET(GetRemoteMemImpl(timeout_ms, remote_mem_list, mem_tag_list, list_num),
                       "[HixlClient] GetRemoteMemImpl failed");
+  // 首次取得目录快照后再订阅，server据快照版本判断是否需要补推全量目录；订阅失败仅退化为本次快照
+  Status sub_ret = SubscribeMemDir();
+  if (sub_ret != SUCCESS) {
+    HIXL_LOGW("[HixlClient] Subscribe remote mem dir failed, mem registered by server later is invisible until "
+              "reconnect. fd=%d, ret=%u",
+              socket_, static_cast<uint32_t>(sub_ret));
+  }
   HIXL_EVENT("[HixlClient] GetRemoteMem success. fd=%d, remote_ep_handle=%" PRIu64 ", imported=%u", socket_,
              remote_endpoint_handle_, *list_num);
   return SUCCESS;
@@ -1398,6 +1599,213 @@ Status HixlCSClient::ClearRemoteMemInfo() {
   return SUCCESS;
 }
 
+Status HixlCSClient::FillOutputFromDirectory(CommMem **remote_mem_list, char ***mem_tag_list, uint32_t *list_num) {
+  remote_mems_out_.clear();
+  remote_tag_ptrs_.clear();
+  remote_tag_storage_.clear();
+  remote_mems_out_.reserve(desc_list_.size());
+  for (const auto &desc : desc_list_) {
+    remote_mems_out_.emplace_back(desc.mem);
+    if (!desc.tag.empty()) {
+      HIXL_CHK_STATUS_RET(AppendTagStorage(remote_tag_storage_, desc.tag));
+    }
+  }
+  BuildTagPtrs(remote_tag_storage_, remote_tag_ptrs_);
+  *mem_tag_list = remote_tag_ptrs_.empty() ? nullptr : remote_tag_ptrs_.data();
+  *remote_mem_list = remote_mems_out_.empty() ? nullptr : remote_mems_out_.data();
+  *list_num = static_cast<uint32_t>(remote_mems_out_.size());
+  return SUCCESS;
+}
+
+Status HixlCSClient::SubscribeMemDir() {
+  if (!mem_dir_version_.has_value()) {
+    HIXL_LOGI("[HixlClient] Server does not support mem dir subscribe. fd=%d", socket_);
+    return SUCCESS;
+  }
+  const int32_t fd = socket_;
+  // 先开始监听再发送订阅，server在收到订阅前不会推送，因此此处失败回退时不会与回调竞争mutex_
+  HIXL_CHK_STATUS_RET(MemDirWatcher::GetInstance().Watch(fd, [this](const CtrlMsg &msg) { OnMemDirMsg(msg); }),
+                      "[HixlClient] Watch mem dir socket failed. fd=%d", fd);
+  mem_dir_watch_fd_ = fd;
+  Status ret = MemMsgHandler::SendMemDirSubscribeRequest(fd, remote_endpoint_handle_, mem_dir_version_.value());
+  if (ret != SUCCESS) {
+    StopMemDirWatch();
+    HIXL_LOGE(ret, "[HixlClient] SendMemDirSubscribeRequest failed. fd=%d", fd);
+    return ret;
+  }
+  mem_dir_subscribed_ = true;
+  mem_dir_resyncing_ = false;
+  HIXL_LOGI("[HixlClient] Mem dir subscribed. fd=%d, version=%" PRIu64, fd, mem_dir_version_.value());
+  return SUCCESS;
+}
+
+void HixlCSClient::StopMemDirWatch() {
+  const int32_t fd = mem_dir_watch_fd_.exchange(-1);
+  if (fd >= 0) {
+    MemDirWatcher::GetInstance().Unwatch(fd);
+  }
+}
+
+void HixlCSClient::OnMemDirMsg(const CtrlMsg &msg) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!mem_dir_subscribed_ || local_endpoint_ == nullptr) {
+    return;
+  }
+  if (msg.msg_type != CtrlMsgType::kMemDirUpdate) {
+    HIXL_LOGW("[HixlClient] Ignore unexpected msg on mem dir socket. fd=%d, msg_type=%d", socket_,
+              static_cast<int32_t>(msg.msg_type));
+    return;
+  }
+  auto ctx_guard = GetContextGuard();
+  (void)ctx_guard;
+  MemDirUpdate update{};
+  Status ret = MemMsgHandler::ParseMemDirUpdate(msg.msg, update);
+  const bool parsed = (ret == SUCCESS);
+  if (parsed) {
+    ret = ApplyMemDirUpdate(update);
+  }
+  // 成功导入的描述符已转移到desc_list_，此处释放其余描述符
+  FreeExportDesc(update.added);
+  // 注销与全量目录中的失效内存无论本次是否应用成功都已屏蔽，确认后server才会真正注销
+  if (parsed && (update.reset || !update.removed.empty())) {
+    Status ack_ret = MemMsgHandler::SendMemDirUpdateAck(socket_, update.version);
+    if (ack_ret != SUCCESS) {
+      HIXL_LOGW("[HixlClient] Ack mem dir update failed. fd=%d, version=%" PRIu64 ", ret=%u", socket_,
+                update.version, static_cast<uint32_t>(ack_ret));
+    }
+  }
+  if (ret != SUCCESS) {
+    RequestMemDirResync();
+  }
+}
+
+Status HixlCSClient::ApplyMemDirUpdate(MemDirUpdate &update) {
+  const uint64_t local_version = mem_dir_version_.value_or(0UL);
+  if (update.reset) {
+    mem_dir_resyncing_ = false;
+    HIXL_CHK_STATUS_RET(ResetRemoteMemDir(update.added), "[HixlClient] Reset remote mem dir failed. version=%" PRIu64,
+                        update.version);
+  } else {
+    // 注销须立即屏蔽，server等待确认后才注销内存，因此等待全量目录或版本缺失时也先应用注销
+    for (const uint64_t addr : update.removed) {
+      RemoveRemoteMemDesc(addr);
+    }
+    if (mem_dir_resyncing_) {
+      HIXL_LOGD("[HixlClient] Waiting for full mem dir, skip delta. version=%" PRIu64, update.version);
+      return SUCCESS;
+    }
+    if (update.version != local_version + 1UL) {
+      HIXL_LOGW("[HixlClient] Mem dir version gap, local=%" PRIu64 ", recv=%" PRIu64 ", request full mem dir.",
+                local_version, update.version);
+      return FAILED;
+    }
+    for (auto &desc : update.added) {
+      HIXL_CHK_STATUS_RET(AddRemoteMemDesc(desc), "[HixlClient] Import pushed mem failed. addr=%p", desc.mem.addr);
+    }
+  }
+  mem_dir_version_ = update.version;
+  HIXL_LOGI("[HixlClient] Mem dir updated. fd=%d, version=%" PRIu64 ", reset=%d, added=%zu, removed=%zu, total=%zu",
+            socket_, update.version, static_cast<int32_t>(update.reset), update.added.size(), update.removed.size(),
+            desc_list_.size());
+  return SUCCESS;
+}
+
+Status HixlCSClient::ResetRemoteMemDir(std::vector<HixlMemDesc> &latest_descs) {
+  // 与本地目录按地址和大小求差，已导入且未变化的内存保持不变，避免影响正在使用这些内存的传输
+  std::vector<uint64_t> stale_addrs;
+  for (const auto &local : desc_list_) {
+    const bool still_valid =
+        std::any_of(latest_descs.cbegin(), latest_descs.cend(), [&local](const HixlMemDesc &latest) {
+          return latest.mem.addr == local.mem.addr && latest.mem.size == local.mem.size;
+        });
+    if (!still_valid) {
+      stale_addrs.emplace_back(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(local.mem.addr)));
+    }
+  }
+  for (const uint64_t addr : stale_addrs) {
+    RemoveRemoteMemDesc(addr);
+  }
+  for (auto &desc : latest_descs) {
+    HIXL_CHK_STATUS_RET(AddRemoteMemDesc(desc), "[HixlClient] Import mem of full mem dir failed. addr=%p",
+                        desc.mem.addr);
+  }
+  return SUCCESS;
+}
+
+Status HixlCSClient::AddRemoteMemDesc(HixlMemDesc &desc) {
+  const auto exists = std::find_if(desc_list_.cbegin(), desc_list_.cend(),
+                                   [&desc](const HixlMemDesc &local) { return local.mem.addr == desc.mem.addr; });
+  if (exists != desc_list_.cend()) {
+    return SUCCESS;
+  }
+  HIXL_CHK_BOOL_RET_STATUS(desc.export_desc != nullptr && desc.export_len > 0U, PARAM_INVALID,
+                           "[HixlClient] Invalid export_desc of pushed mem. addr=%p", desc.mem.addr);
+  CommMem buf{};
+  HIXL_CHK_STATUS_RET(local_endpoint_->MemImport(desc.export_desc, desc.export_len, buf),
+                      "[HixlClient] MemImport failed. addr=%p, size=%" PRIu64, desc.mem.addr, desc.mem.size);
+  desc.is_imported = true;
+  const bool is_host_mem = desc.mem.type == COMM_MEM_TYPE_HOST;
+  Status ret = mem_store_.RecordMemory(true, desc.mem.addr, static_cast<size_t>(desc.mem.size), is_host_mem,
+                                       desc.registered_dev_mem);
+  if (ret != SUCCESS) {
+    std::vector<HixlMemDesc> rollback{desc};
+    CloseImportedBufs(local_endpoint_->GetHandle(), rollback);
+    desc.is_imported = false;
+    HIXL_LOGE(ret, "[HixlClient] RecordMemory(server) failed. addr=%p, size=%" PRIu64, desc.mem.addr, desc.mem.size);
+    return ret;
+  }
+  imported_remote_bufs_.emplace_back(buf);
+  recorded_remote_addrs_.emplace_back(desc.mem.addr);
+  if (!desc.tag.empty()) {
+    tag_mem_descs_[desc.tag] = desc.mem;
+  }
+  desc_list_.emplace_back(desc);
+  // export_desc所有权已转移到desc_list_
+  desc.export_desc = nullptr;
+  desc.export_len = 0U;
+  return SUCCESS;
+}
+
+void HixlCSClient::RemoveRemoteMemDesc(uint64_t addr) {
+  void *mem_addr = reinterpret_cast<void *>(static_cast<uintptr_t>(addr));
+  auto it = std::find_if(desc_list_.begin(), desc_list_.end(),
+                         [mem_addr](const HixlMemDesc &local) { return local.mem.addr == mem_addr; });
+  if (it == desc_list_.end()) {
+    HIXL_LOGW("[HixlClient] Removed mem is not in local mem dir. addr=%p", mem_addr);
+    return;
+  }
+  // 先删除地址记录，之后访问该内存的传输在地址校验阶段即被拒绝，再解除导入
+  auto recorded = std::find(recorded_remote_addrs_.begin(), recorded_remote_addrs_.end(), mem_addr);
+  if (recorded != recorded_remote_addrs_.end()) {
+    std::vector<void *> addrs{mem_addr};
+    UnrecordAddrs(mem_store_, addrs);
+    recorded_remote_addrs_.erase(recorded);
+  }
+  std::vector<HixlMemDesc> removed{*it};
+  CloseImportedBufs(local_endpoint_->GetHandle(), removed);
+  const auto idx = static_cast<size_t>(std::distance(desc_list_.begin(), it));
+  if (idx < imported_remote_bufs_.size()) {
+    imported_remote_bufs_.erase(imported_remote_bufs_.begin() + static_cast<std::ptrdiff_t>(idx));
+  }
+  for (auto tag_it = tag_mem_descs_.begin(); tag_it != tag_mem_descs_.end();) {
+    tag_it = (tag_it->second.addr == mem_addr) ? tag_mem_descs_.erase(tag_it) : std::next(tag_it);
+  }
+  std::free(it->export_desc);
+  desc_list_.erase(it);
+}
+
+void HixlCSClient::RequestMemDirResync() {
+  if (mem_dir_resyncing_) {
+    return;
+  }
+  mem_dir_resyncing_ = true;
+  Status ret =
+      MemMsgHandler::SendMemDirSubscribeRequest(socket_, remote_endpoint_handle_, mem_dir_version_.value_or(0UL));
+  if (ret != SUCCESS) {
+    HIXL_LOGW("[HixlClient] Request full mem dir failed. fd=%d, ret=%u", socket_, static_cast<uint32_t>(ret));
+  }
+}
+
 void HixlCSClient::ReleaseLegacyHandles() {
   uint32_t live_cnt = 0U;
   for (size_t i = 0U; i < kFlagQueueSize; ++i) {
@@ -1454,13 +1862,19 @@ void HixlCSClient::ReleaseDeviceResources() {
 }
 
 Status HixlCSClient::Destroy() {
+  // 监听回调会获取mutex_，须在加锁前停止监听
+  StopMemDirWatch();
   std::lock_guard<std::mutex> lock(mutex_);
+  mem_dir_subscribed_ = false;
+  mem_dir_version_.reset();
   Status first_error = SUCCESS;
   {
     auto ctx_guard = GetContextGuard();
     (void)ctx_guard;
     HIXL_EVENT("[HixlClient] Destroy start. fd=%d, imported_bufs=%zu, recorded_addrs=%zu", socket_,
                imported_remote_bufs_.size(), recorded_remote_addrs_.size());
+    // 已交还的句柄仍登记在live_handles_与pending_device_handles_中，由下面统一回收
+    released_handles_.clear();
     ReleaseLegacyHandles();
     AbortAllPendingDeviceHandles();
     ReleaseDeviceResources();
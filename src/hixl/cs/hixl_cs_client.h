@@ -11,9 +11,11 @@
 #ifndef CANN_HIXL_SRC_HIXL_CS_HIXL_CS_CLIENT_H_
 #define CANN_HIXL_SRC_HIXL_CS_HIXL_CS_CLIENT_H_
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <array>
 #include <unordered_set>
@@ -30,10 +32,13 @@
 #include "hcomm/hcomm_res_defs.h"
 
 namespace hixl {
+constexpr uint64_t kDefaultDescChunkSize = 64ULL * 1024ULL * 1024ULL;
+
 struct CompleteHandleInfo {
   uint32_t magic;
   int32_t flag_index;
   uint64_t *flag_address;
+  uint64_t total_bytes;
 };
 
 struct DeviceCompleteHandle {
@@ -42,6 +47,18 @@ struct DeviceCompleteHandle {
   std::shared_ptr<TransferPool::SlotHandle> shared_slot;
   void *host_flag;
   void *dev_op_desc_buf;
+  uint64_t total_bytes;
+  // 中间notify wait点完成后由stream置位的host侧标志，progress_bytes为对应的累计完成字节数
+  uint64_t *progress_flags;
+  std::vector<uint64_t> progress_bytes;
+};
+
+// 单次kernel下发的描述符分组，wait_notify为true时该组完成后等待远端完成
+struct DeviceKernelGroup {
+  uint32_t offset;
+  uint32_t list_num;
+  bool wait_notify;
+  uint64_t done_bytes;  // wait_notify时，该组及之前所有组的累计字节数
 };
 
 struct Buffers {
@@ -82,6 +99,12 @@ class HixlCSClient {
   // 通过已经建立好的channel，检查批量读写的状态。
   Status CheckStatus(void *query_handle, HixlCompleteStatus *status);
 
+  // 查询未完成的批量读写任务已完成的字节数，不释放query_handle
+  Status QueryProgress(void *query_handle, uint64_t *completed_bytes, uint64_t *total_bytes);
+
+  // 调用方不再查询的句柄交还client：已到终态立即释放，否则在后续调用或Destroy时回收
+  Status ReleaseHandle(void *query_handle);
+
   // 注销client的endpoint的内存信息。
   Status UnRegMem(MemHandle mem_handle);
 
@@ -104,6 +127,7 @@ class HixlCSClient {
   Status CheckStatusHost(CompleteHandleInfo &query_handle, HixlCompleteStatus &status);
   Status CheckStatusDevice(DeviceCompleteHandle &query_handle, HixlCompleteStatus &status);
   Status CheckStatusLocked(void *query_handle, HixlCompleteStatus *status);
+  void ReapReleasedHandlesLocked();
   Status BatchTransferHostAsync(bool is_get, uint32_t list_num, const HixlOneSideOpDesc *desc_list,
                                 void **query_handle);
   Status BatchTransferHostSync(bool is_get, uint32_t list_num, const HixlOneSideOpDesc *desc_list, uint32_t timeout_ms);
@@ -117,11 +141,22 @@ class HixlCSClient {
   Status ImportRemoteMem(std::vector<HixlMemDesc> &desc_list, CommMem **remote_mem_list, char ***mem_tag_list,
                          uint32_t *list_num);
   Status ValidateAddress(uint32_t list_num, const HixlOneSideOpDesc *desc_list) const;
+  Status SplitOversizedDescs(uint32_t &list_num, const HixlOneSideOpDesc *&desc_list,
+                             std::vector<HixlOneSideOpDesc> &split_descs) const;
   Status TransferWithRetry(bool is_get, uint64_t channel_handle, void *dst_buf, const void *src_buf,
                            uint64_t len) const;
   Status BatchTransferTask(bool is_get, uint32_t list_num, const HixlOneSideOpDesc *desc_list) const;
   void FillOutputParams(ImportCtx &ctx, CommMem **remote_mem_list, char ***mem_tag_list, uint32_t *list_num);
   Status ClearRemoteMemInfo();
+  Status SubscribeMemDir();
+  void StopMemDirWatch();
+  void OnMemDirMsg(const CtrlMsg &msg);
+  Status ApplyMemDirUpdate(MemDirUpdate &update);
+  Status ResetRemoteMemDir(std::vector<HixlMemDesc> &latest_descs);
+  Status AddRemoteMemDesc(HixlMemDesc &desc);
+  void RemoveRemoteMemDesc(uint64_t addr);
+  void RequestMemDirResync();
+  Status FillOutputFromDirectory(CommMem **remote_mem_list, char ***mem_tag_list, uint32_t *list_num);
   Status ValidateDeviceInputs(uint32_t list_num, const HixlOneSideOpDesc *desc_list, void *&query_handle) const;
   Status PrepareDeviceRemoteFlagAndKernel(void *&remote_flag) const;
   Status RegisterNotifyMemForAllSlots(const std::vector<TransferPool::SlotHandle> &slots);
@@ -138,7 +173,11 @@ class HixlCSClient {
                                const HixlOneSideOpDesc *desc_list) const;
   Status BuildDeviceChunkParam(DeviceCompleteHandle &handle, uint32_t chunk_offset, uint32_t chunk_list_num,
                                bool need_notify_wait, HixlOneSideOpParam &param) const;
-  Status LaunchDeviceChunkedKernels(bool is_get, DeviceCompleteHandle &handle, uint32_t list_num) const;
+  void PlanDeviceKernelGroups(uint32_t list_num, const HixlOneSideOpDesc *desc_list,
+                              std::vector<DeviceKernelGroup> &groups) const;
+  Status AllocateProgressFlags(DeviceCompleteHandle &handle, const std::vector<DeviceKernelGroup> &groups) const;
+  Status LaunchDeviceChunkedKernels(bool is_get, DeviceCompleteHandle &handle, uint32_t list_num,
+                                    const HixlOneSideOpDesc *desc_list) const;
   bool ShouldLatchTransferFailure(Status ret) const;
   Status LatchTransferFailureIfNeeded(Status ret);
   void LatchTransferFailure(Status ret);
@@ -159,6 +198,7 @@ class HixlCSClient {
   uint32_t retry_cnt_{kRdmaRetryCntDefault};
   uint32_t retry_interval_{kRdmaRetryIntervalDefault};
   GlobalConfig global_config_;
+  uint64_t desc_chunk_size_{kDefaultDescChunkSize};  // 超过该长度的单个描述符拆分为多个子描述符下发
   Channel client_channel_;
   ChannelHandle client_channel_handle_ = 0UL;
   uint64_t remote_endpoint_handle_{0U};
@@ -181,10 +221,17 @@ class HixlCSClient {
   uint64_t device_remote_flag_size_{0ULL};
   std::vector<MemHandle> notify_mem_handles_{};
   std::unordered_set<DeviceCompleteHandle *> pending_device_handles_{};
+  // 调用方已交还但传输仍在途的句柄，标志位须等到终态才能复用，避免迟到的完成写入误置新任务
+  std::vector<void *> released_handles_{};
   // Active slot shared by concurrent transfers - reference counted
   std::shared_ptr<TransferPool::SlotHandle> active_slot_;
   bool transfer_failure_latched_{false};
   Status transfer_failure_status_{SUCCESS};
+  // server端内存目录版本，旧版本server不携带时为空，此时不订阅目录变更
+  std::optional<uint64_t> mem_dir_version_;
+  bool mem_dir_subscribed_{false};
+  bool mem_dir_resyncing_{false};  // 已请求全量目录，等待期间忽略增量
+  std::atomic<int32_t> mem_dir_watch_fd_{-1};
 };
 }  // namespace hixl
 
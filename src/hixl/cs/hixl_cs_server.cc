@@ -9,7 +9,9 @@
  */
 
 #include "hixl_cs_server.h"
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cinttypes>
 #include <memory>
 #include <sys/epoll.h>
@@ -35,6 +37,7 @@ namespace {
 constexpr uint32_t kDefaultTransferPoolSize = 128U;  // 与 HixlCSClient 侧设备池大小一致
 constexpr int32_t kMaxEventsNum = 128;               // epoll_wait并发处理事件数量，减少epoll系统调用
 constexpr int32_t kEpollWaitTimeInMillis = 100;      // epoll_wait等待超时时间
+constexpr int64_t kMemDirAckTimeoutInMillis = 5000;  // 注销内存时等待订阅者确认屏蔽的超时时间
 constexpr const char *kTransFlagNameHost = "_hixl_builtin_host_trans_flag";   // client用于感知收发完成的标识
 constexpr const char *kTransFlagNameDevice = "_hixl_builtin_dev_trans_flag";  // client用于感知收发完成的标识
 // server端进程级channel索引计数器，用于两端构建一致的channelName
@@ -218,6 +221,11 @@ Status HixlCSServer::Initialize(const EndpointDesc *endpoint_list, uint32_t list
         endpoint_store_.CreateEndpoint(endpoint_list[i], handle,
                                        NeedServerHostVaMapping(endpoint_list[i], ub_ctp_endpoints_all_device)),
         "Failed to create endpoint, index:%u, %s", i, EndpointToString(endpoint_list[i]).c_str());
+    if (global_config_.HostRegisterCacheBytes().has_value()) {
+      auto endpoint = endpoint_store_.GetEndpoint(handle);
+      HIXL_CHECK_NOTNULL(endpoint);
+      endpoint->SetHostRegisterCacheCapacity(global_config_.HostRegisterCacheBytes().value());
+    }
   }
   msg_handler_.RegisterMsgProcessor(CtrlMsgType::kMatchEndpointReq,
                                     [this](int32_t fd, const char *msg, uint64_t msg_len) -> Status {
@@ -234,9 +242,22 @@ Status HixlCSServer::Initialize(const EndpointDesc *endpoint_list, uint32_t list
                                     [this](int32_t fd, const char *msg, uint64_t msg_len) -> Status {
                                       return this->DestroyChannel(fd, msg, msg_len);
                                     });
+  msg_handler_.RegisterMsgProcessor(CtrlMsgType::kMemDirSubscribeReq,
+                                    [this](int32_t fd, const char *msg, uint64_t msg_len) -> Status {
+                                      return this->SubscribeMemDir(fd, msg, msg_len);
+                                    });
+  msg_handler_.RegisterMsgProcessor(CtrlMsgType::kMemDirUpdateAck,
+                                    [this](int32_t fd, const char *msg, uint64_t msg_len) -> Status {
+                                      return this->AckMemDirUpdate(fd, msg, msg_len);
+                                    });
   CtrlMsgPlugin::Initialize();
   HIXL_CHK_STATUS_RET(msg_handler_.Initialize(), "Failed to initialize msg handler");
   HIXL_CHK_STATUS_RET(InitTransFinishedFlag(), "Failed to init trans finished flag");
+  {
+    std::lock_guard<std::mutex> lock(dir_mutex_);
+    mem_dir_pusher_running_ = true;
+  }
+  mem_dir_pusher_ = std::thread([this]() { PushMemDirUpdates(); });
   HIXL_EVENT("[HixlServer] init success, endpoint_list_num:%u", list_num);
   return SUCCESS;
 }
@@ -284,6 +305,7 @@ Status HixlCSServer::Finalize() {
         listener_.join();
       }
     }
+    StopMemDirPusher();
     msg_handler_.Finalize();
     ret = endpoint_store_.Finalize();
     HIXL_CHK_STATUS(ret, "Failed to finalize endpoint store.");
@@ -351,7 +373,10 @@ Status HixlCSServer::RegisterMem(const char *mem_tag, const CommMem *mem, MemHan
   HIXL_EVENT("[HixlServer] register mem success, addr:%p, size:%lu, type:%d, handle:%p", mem->addr, mem->size,
              static_cast<int32_t>(mem->type), *mem_handle);
   std::lock_guard<std::mutex> lock(reg_mutex_);
-  reg_mems_[ep_mem_infos[0].mem_handle] = std::move(ep_mem_infos);
+  auto &reg_infos = reg_mems_[ep_mem_infos[0].mem_handle];
+  reg_infos = std::move(ep_mem_infos);
+  std::vector<int32_t> fenced_fds;
+  (void)PublishMemDirUpdate(reg_infos, true, fenced_fds);
   return SUCCESS;
 }
 
@@ -362,6 +387,10 @@ Status HixlCSServer::DeregisterMem(MemHandle mem_handle) {
   std::lock_guard<std::mutex> lock(reg_mutex_);
   auto it = reg_mems_.find(mem_handle);
   HIXL_CHK_BOOL_RET_STATUS(it != reg_mems_.cend(), PARAM_INVALID, "mem_handle:%p is not registered", mem_handle);
+  // 先通知已订阅的client屏蔽该内存，待其确认后再注销，避免client仍在访问已注销的内存
+  std::vector<int32_t> fenced_fds;
+  const uint64_t version = PublishMemDirUpdate(it->second, false, fenced_fds);
+  WaitMemDirAcks(fenced_fds, version);
   for (const auto &ep_mem_info : it->second) {
     auto endpoint = endpoint_store_.GetEndpoint(ep_mem_info.endpoint_handle);
     HIXL_CHECK_NOTNULL(endpoint);
@@ -499,6 +528,15 @@ static inline void to_json(nlohmann::json &j, const GetRemoteMemResp &r) {
   j = nlohmann::json{};
   j["result"] = r.result;
   j["mem_descs"] = r.mem_descs;
+  j["version"] = r.version;
+}
+
+static inline void to_json(nlohmann::json &j, const MemDirUpdate &u) {
+  j = nlohmann::json{};
+  j["version"] = u.version;
+  j["reset"] = u.reset;
+  j["added"] = u.added;
+  j["removed"] = u.removed;
 }
 
 template <typename T>
@@ -527,7 +565,201 @@ Status HixlCSServer::SendRemoteMemResp(int32_t fd, const GetRemoteMemResp &resp)
   return SUCCESS;
 }
 
-Status HixlCSServer::ExportMem(int32_t fd, const char *msg, uint64_t msg_len) const {
+Status HixlCSServer::SendMemDirUpdate(const MemDirPush &push) {
+  CtrlMsgHeader header{};
+  header.magic = kMagicNumber;
+  header.body_size = static_cast<uint64_t>(sizeof(CtrlMsgType) + push.msg.size());
+  CtrlMsgType msg_type = CtrlMsgType::kMemDirUpdate;
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(push.fd, &header, static_cast<uint64_t>(sizeof(header))));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(push.fd, &msg_type, static_cast<uint64_t>(sizeof(msg_type))));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(push.fd, push.msg.c_str(), static_cast<uint64_t>(push.msg.size())));
+  HIXL_LOGI("[HixlServer] send mem dir update success, fd:%d, version:%" PRIu64 ", size:%zu", push.fd, push.version,
+            push.msg.size());
+  return SUCCESS;
+}
+
+Status HixlCSServer::FillMemDirDelta(EndpointHandle subscriber_ep, const std::vector<EndpointMemInfo> &ep_mem_infos,
+                                     bool is_register, MemDirUpdate &update) const {
+  for (const auto &ep_mem_info : ep_mem_infos) {
+    if (ep_mem_info.endpoint_handle != subscriber_ep) {
+      continue;
+    }
+    auto endpoint = endpoint_store_.GetEndpoint(subscriber_ep);
+    HIXL_CHECK_NOTNULL(endpoint);
+    HixlMemDesc desc{};
+    if (is_register) {
+      HIXL_CHK_STATUS_RET(endpoint->ExportMem(ep_mem_info.mem_handle, desc), "Failed to export mem, handle:%p",
+                          ep_mem_info.mem_handle);
+      update.added.emplace_back(desc);
+    } else {
+      HIXL_CHK_STATUS_RET(endpoint->GetMemDesc(ep_mem_info.mem_handle, desc), "Failed to get mem desc, handle:%p",
+                          ep_mem_info.mem_handle);
+      update.removed.emplace_back(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(desc.mem.addr)));
+    }
+    break;
+  }
+  return SUCCESS;
+}
+
+Status HixlCSServer::EnqueueMemDirUpdate(int32_t fd, const MemDirUpdate &update) {
+  MemDirPush push{};
+  push.fd = fd;
+  push.version = update.version;
+  HIXL_CHK_STATUS_RET(Serialize(update, push.msg), "Failed to serialize mem dir update, fd:%d", fd);
+  mem_dir_pushes_.emplace_back(std::move(push));
+  dir_cv_.notify_all();
+  return SUCCESS;
+}
+
+uint64_t HixlCSServer::PublishMemDirUpdate(const std::vector<EndpointMemInfo> &ep_mem_infos, bool is_register,
+                                           std::vector<int32_t> &fenced_fds) {
+  const uint64_t version = ++mem_dir_version_;
+  std::lock_guard<std::mutex> lock(dir_mutex_);
+  for (auto it = mem_dir_subscribers_.begin(); it != mem_dir_subscribers_.end();) {
+    // 内存未注册到该订阅者对应的endpoint时也推送空增量，保证client侧版本连续
+    MemDirUpdate update{};
+    update.version = version;
+    if (FillMemDirDelta(it->second, ep_mem_infos, is_register, update) != SUCCESS) {
+      // 不推送该版本，client在收到后续增量时感知版本缺失并重新订阅全量目录
+      HIXL_LOGW("[HixlServer] skip mem dir update, fd:%d, version:%" PRIu64, it->first, version);
+      ++it;
+      continue;
+    }
+    if (EnqueueMemDirUpdate(it->first, update) != SUCCESS) {
+      HIXL_LOGW("[HixlServer] enqueue mem dir update failed, drop subscriber fd:%d, version:%" PRIu64, it->first,
+                version);
+      it = mem_dir_subscribers_.erase(it);
+      continue;
+    }
+    if (!update.removed.empty()) {
+      fenced_fds.emplace_back(it->first);
+    }
+    ++it;
+  }
+  return version;
+}
+
+void HixlCSServer::WaitMemDirAcks(const std::vector<int32_t> &fds, uint64_t version) {
+  if (fds.empty()) {
+    return;
+  }
+  // 订阅者确认或断开(取消订阅)后即可放行；确认由消息线程池处理，不依赖本线程持有的reg_mutex_
+  std::unique_lock<std::mutex> lock(dir_mutex_);
+  const bool all_acked =
+      dir_cv_.wait_for(lock, std::chrono::milliseconds(kMemDirAckTimeoutInMillis), [this, &fds, version]() {
+        return std::all_of(fds.cbegin(), fds.cend(), [this, version](int32_t fd) {
+          if (mem_dir_subscribers_.find(fd) == mem_dir_subscribers_.cend()) {
+            return true;
+          }
+          const auto acked = mem_dir_acked_.find(fd);
+          return (acked != mem_dir_acked_.cend()) && (acked->second >= version);
+        });
+      });
+  if (!all_acked) {
+    HIXL_LOGW("[HixlServer] wait mem dir ack timeout, version:%" PRIu64 ", subscribers:%zu, timeout:%" PRId64 " ms",
+              version, fds.size(), kMemDirAckTimeoutInMillis);
+  }
+}
+
+void HixlCSServer::PushMemDirUpdates() {
+  std::unique_lock<std::mutex> lock(dir_mutex_);
+  while (true) {
+    dir_cv_.wait(lock, [this]() { return !mem_dir_pusher_running_ || !mem_dir_pushes_.empty(); });
+    if (!mem_dir_pusher_running_) {
+      break;
+    }
+    MemDirPush push = std::move(mem_dir_pushes_.front());
+    mem_dir_pushes_.pop_front();
+    if (mem_dir_subscribers_.find(push.fd) == mem_dir_subscribers_.cend()) {
+      continue;
+    }
+    // 发送期间释放锁，避免慢速client阻塞注册/注销内存及其他订阅者
+    mem_dir_sending_fd_ = push.fd;
+    lock.unlock();
+    const Status ret = SendMemDirUpdate(push);
+    lock.lock();
+    mem_dir_sending_fd_ = -1;
+    if (ret != SUCCESS) {
+      HIXL_LOGW("[HixlServer] send mem dir update failed, drop subscriber fd:%d, version:%" PRIu64, push.fd,
+                push.version);
+      (void)mem_dir_subscribers_.erase(push.fd);
+      (void)mem_dir_acked_.erase(push.fd);
+    }
+    dir_cv_.notify_all();
+  }
+}
+
+void HixlCSServer::StopMemDirPusher() {
+  {
+    std::lock_guard<std::mutex> lock(dir_mutex_);
+    mem_dir_pusher_running_ = false;
+    mem_dir_pushes_.clear();
+    // 停止推送后不再等待订阅者确认
+    mem_dir_subscribers_.clear();
+    mem_dir_acked_.clear();
+  }
+  dir_cv_.notify_all();
+  if (mem_dir_pusher_.joinable()) {
+    mem_dir_pusher_.join();
+  }
+}
+
+Status HixlCSServer::SubscribeMemDir(int32_t fd, const char *msg, uint64_t msg_len) {
+  HIXL_CHECK_NOTNULL(msg);
+  HIXL_CHK_BOOL_RET_STATUS(msg_len == sizeof(MemDirSubscribeReq), PARAM_INVALID,
+                           "invalid msg len:%lu of mem dir subscribe, must = %zu", msg_len, sizeof(MemDirSubscribeReq));
+  const auto &req = *reinterpret_cast<const MemDirSubscribeReq *>(msg);
+  EndpointHandle handle = reinterpret_cast<EndpointHandle>(static_cast<uintptr_t>(req.dst_ep_handle));
+  auto ep = endpoint_store_.GetEndpoint(handle);
+  HIXL_CHECK_NOTNULL(ep);
+  // reg_mutex_保证全量目录与版本一致；持有client_mutex_保证fd在登记订阅前不会被CleanupClient关闭
+  std::lock_guard<std::mutex> reg_lock(reg_mutex_);
+  std::lock_guard<std::mutex> client_lock(client_mutex_);
+  HIXL_CHK_BOOL_RET_STATUS(clients_.find(fd) != clients_.cend(), FAILED, "client fd:%d has disconnected", fd);
+  std::lock_guard<std::mutex> lock(dir_mutex_);
+  mem_dir_subscribers_[fd] = handle;
+  if (req.known_version == mem_dir_version_) {
+    HIXL_LOGI("[HixlServer] mem dir subscribed, fd:%d, version:%" PRIu64, fd, mem_dir_version_);
+    return SUCCESS;
+  }
+  // client持有的目录已过期(订阅前有注册/注销，或client感知到增量缺失)，推送全量目录
+  MemDirUpdate update{};
+  update.version = mem_dir_version_;
+  update.reset = true;
+  Status ret = ep->ExportMem(update.added);
+  if (ret == SUCCESS) {
+    ret = EnqueueMemDirUpdate(fd, update);
+  }
+  if (ret != SUCCESS) {
+    (void)mem_dir_subscribers_.erase(fd);
+    HIXL_LOGE(ret, "[HixlServer] push full mem dir failed, fd:%d, known_version:%" PRIu64 ", version:%" PRIu64, fd,
+              req.known_version, mem_dir_version_);
+    return ret;
+  }
+  HIXL_LOGI("[HixlServer] mem dir resubscribed, fd:%d, known_version:%" PRIu64 ", version:%" PRIu64, fd,
+            req.known_version, mem_dir_version_);
+  return SUCCESS;
+}
+
+Status HixlCSServer::AckMemDirUpdate(int32_t fd, const char *msg, uint64_t msg_len) {
+  HIXL_CHECK_NOTNULL(msg);
+  HIXL_CHK_BOOL_RET_STATUS(msg_len == sizeof(MemDirUpdateAck), PARAM_INVALID,
+                           "invalid msg len:%lu of mem dir update ack, must = %zu", msg_len, sizeof(MemDirUpdateAck));
+  const auto &ack = *reinterpret_cast<const MemDirUpdateAck *>(msg);
+  {
+    std::lock_guard<std::mutex> lock(dir_mutex_);
+    if (mem_dir_subscribers_.find(fd) == mem_dir_subscribers_.cend()) {
+      return SUCCESS;
+    }
+    auto &acked = mem_dir_acked_[fd];
+    acked = std::max(acked, ack.version);
+  }
+  dir_cv_.notify_all();
+  HIXL_LOGD("[HixlServer] mem dir update acked, fd:%d, version:%" PRIu64, fd, ack.version);
+  return SUCCESS;
+}
+
+Status HixlCSServer::ExportMem(int32_t fd, const char *msg, uint64_t msg_len) {
   HIXL_DISMISSABLE_GUARD(failed, ([fd, this]() {
                            GetRemoteMemResp resp{};
                            resp.result = FAILED;
@@ -542,7 +774,11 @@ Status HixlCSServer::ExportMem(int32_t fd, const char *msg, uint64_t msg_len) co
   auto ep = endpoint_store_.GetEndpoint(handle);
   HIXL_CHECK_NOTNULL(ep);
   GetRemoteMemResp resp{};
-  HIXL_CHK_STATUS_RET(ep->ExportMem(resp.mem_descs), "Failed to export mem");
+  {
+    std::lock_guard<std::mutex> lock(reg_mutex_);
+    HIXL_CHK_STATUS_RET(ep->ExportMem(resp.mem_descs), "Failed to export mem");
+    resp.version = mem_dir_version_;
+  }
   resp.result = SUCCESS;
   HIXL_DISMISS_GUARD(failed);
   HIXL_CHK_STATUS_RET(SendRemoteMemResp(fd, resp), "Failed to send remote mem resp.");
@@ -574,6 +810,13 @@ Status HixlCSServer::RegProc(CtrlMsgType msg_type, MsgProcessor proc) {
   return SUCCESS;
 }
 
+Status HixlCSServer::RegDisconnectProc(DisconnectProcessor proc) {
+  HIXL_CHK_BOOL_RET_STATUS(proc != nullptr, PARAM_INVALID, "Disconnect processor is null");
+  std::lock_guard<std::mutex> lock(client_mutex_);
+  disconnect_procs_.emplace_back(std::move(proc));
+  return SUCCESS;
+}
+
 void HixlCSServer::ProClientMsg(int32_t fd, std::shared_ptr<MsgReceiver> receiver) {
   std::vector<CtrlMsgPtr> msgs;
   (void)receiver->IRecv(msgs);
@@ -594,6 +837,23 @@ void HixlCSServer::CleanupClient(int32_t fd) {
     }
   }
 
+  // 通知上层释放该连接占用的资源，须在关闭 socket 前完成，避免误释放复用该 fd 的新连接的资源
+  for (const auto &proc : disconnect_procs_) {
+    proc(fd);
+  }
+
+  // 取消内存目录订阅并等待该 fd 上正在进行的推送结束，须在关闭 socket 前完成，避免向复用的 fd 推送
+  {
+    std::unique_lock<std::mutex> dir_lock(dir_mutex_);
+    (void)mem_dir_subscribers_.erase(fd);
+    (void)mem_dir_acked_.erase(fd);
+    for (auto push_it = mem_dir_pushes_.begin(); push_it != mem_dir_pushes_.end();) {
+      push_it = (push_it->fd == fd) ? mem_dir_pushes_.erase(push_it) : std::next(push_it);
+    }
+    dir_cv_.notify_all();
+    dir_cv_.wait(dir_lock, [this, fd]() { return mem_dir_sending_fd_ != fd; });
+  }
+
   // 清理 epoll
   epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
 
@@ -11,10 +11,14 @@
 #ifndef CANN_HIXL_SRC_HIXL_CS_HIXL_CS_SERVER_H_
 #define CANN_HIXL_SRC_HIXL_CS_HIXL_CS_SERVER_H_
 
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <vector>
 #include <mutex>
 #include <memory>
+#include <string>
+#include <thread>
 #include "hixl/hixl_types.h"
 #include "common/hixl_utils.h"
 #include "endpoint_store.h"
@@ -33,6 +37,13 @@ struct EndpointChannelInfo {
   ChannelHandle channel_handle;
 };
 
+// 待推送给订阅者的内存目录变更，入队时即序列化，不引用endpoint侧的导出描述
+struct MemDirPush {
+  int32_t fd;
+  uint64_t version;
+  std::string msg;
+};
+
 class HixlCSServer {
  public:
   HixlCSServer(const char *ip, uint32_t port, const GlobalConfig &global_config)
@@ -46,6 +57,7 @@ class HixlCSServer {
   Status DeregisterMem(MemHandle mem_handle);
   Status Listen(uint32_t backlog);
   Status RegProc(CtrlMsgType msg_type, MsgProcessor proc);
+  Status RegDisconnectProc(DisconnectProcessor proc);
 
  private:
   template <typename T>
@@ -53,7 +65,19 @@ class HixlCSServer {
   Status MatchEndpointMsg(int32_t fd, const char *msg, uint64_t msg_len) const;
   Status CreateChannel(int32_t fd, const char *msg, uint64_t msg_len);
   Status DestroyChannel(int32_t fd, const char *msg, uint64_t msg_len);
-  Status ExportMem(int32_t fd, const char *msg, uint64_t msg_len) const;
+  Status ExportMem(int32_t fd, const char *msg, uint64_t msg_len);
+  Status SubscribeMemDir(int32_t fd, const char *msg, uint64_t msg_len);
+  Status AckMemDirUpdate(int32_t fd, const char *msg, uint64_t msg_len);
+  Status FillMemDirDelta(EndpointHandle subscriber_ep, const std::vector<EndpointMemInfo> &ep_mem_infos,
+                         bool is_register, MemDirUpdate &update) const;
+  // 调用方持有reg_mutex_，fenced_fds返回收到非空注销增量、需等待其确认的订阅者
+  uint64_t PublishMemDirUpdate(const std::vector<EndpointMemInfo> &ep_mem_infos, bool is_register,
+                               std::vector<int32_t> &fenced_fds);
+  // 调用方持有dir_mutex_
+  Status EnqueueMemDirUpdate(int32_t fd, const MemDirUpdate &update);
+  void WaitMemDirAcks(const std::vector<int32_t> &fds, uint64_t version);
+  void PushMemDirUpdates();
+  void StopMemDirPusher();
   Status DoWait();
   void ProClientMsg(int32_t fd, std::shared_ptr<MsgReceiver> receiver);
   Status InitTransFinishedFlag();
@@ -62,6 +86,7 @@ class HixlCSServer {
   static Status SendCreateChannelResp(int32_t fd, const CreateChannelResp &resp);
   static Status SendMatchEndpointResp(int32_t fd, const MatchEndpointResp &resp);
   static Status SendRemoteMemResp(int32_t fd, const GetRemoteMemResp &resp);
+  static Status SendMemDirUpdate(const MemDirPush &push);
   static void FreeDeviceMem(void *&ptr);
   void CleanupClient(int32_t fd);
 
@@ -77,9 +102,22 @@ class HixlCSServer {
 
   std::mutex client_mutex_;
   std::map<int32_t, std::shared_ptr<MsgReceiver>> clients_;
+  std::vector<DisconnectProcessor> disconnect_procs_;  // 由client_mutex_保护
 
   std::mutex reg_mutex_;
   std::map<MemHandle, std::vector<EndpointMemInfo>> reg_mems_;
+  uint64_t mem_dir_version_ = 0UL;  // 由reg_mutex_保护，每次注册/注销内存递增
+
+  // 订阅者(fd -> 订阅的endpoint)、待推送队列及各订阅者已确认的版本均由dir_mutex_保护，
+  // 推送由mem_dir_pusher_线程按入队顺序完成，注册/注销内存时不在锁内阻塞发送。加锁顺序为reg -> client -> dir
+  std::mutex dir_mutex_;
+  std::condition_variable dir_cv_;
+  std::map<int32_t, EndpointHandle> mem_dir_subscribers_;
+  std::map<int32_t, uint64_t> mem_dir_acked_;
+  std::deque<MemDirPush> mem_dir_pushes_;
+  int32_t mem_dir_sending_fd_ = -1;  // 正在推送的fd，CleanupClient须等待其推送结束再关闭socket
+  bool mem_dir_pusher_running_ = false;
+  std::thread mem_dir_pusher_;
 
   std::mutex chn_mutex_;
   std::map<int32_t, EndpointChannelInfo> channels_;
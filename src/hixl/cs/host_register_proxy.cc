@@ -9,6 +9,9 @@
  */
 
 #include "host_register_proxy.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
 #include "acl/acl_rt.h"
 #include "common/hixl_checker.h"
 #include "common/hixl_log.h"
@@ -18,6 +21,10 @@ namespace hixl {
 namespace {
 std::map<int32_t, std::shared_ptr<HostRegisterProxy>> g_proxy_instances;
 std::mutex g_proxy_mutex;
+
+void *RegionDeviceAddr(uintptr_t region_start, const HostMemRegion &region, uintptr_t host_addr) {
+  return static_cast<uint8_t *>(region.device_addr) + (host_addr - region_start);
+}
 }  // namespace
 
 std::shared_ptr<HostRegisterProxy> HostRegisterProxy::GetOrCreateInstance(uint32_t dev_phy_id) {
@@ -58,15 +65,18 @@ HostRegisterProxy::HostRegisterProxy(int32_t dev_phy_id) : dev_phy_id_(dev_phy_i
 
 HostRegisterProxy::~HostRegisterProxy() {
   std::lock_guard<std::mutex> lock(mutex_);
-  for (auto &pair : registered_mems_) {
-    void *host_addr = pair.first;
+  for (auto &pair : regions_) {
+    void *host_addr = reinterpret_cast<void *>(pair.first);
     HIXL_LOGI("host_addr has not been unregistered. host_addr=%p, ref_cnt=%d.", host_addr, pair.second.ref_cnt);
     const aclError ret = aclrtHostUnregister(host_addr);
     if (ret != ACL_ERROR_NONE) {
       HIXL_LOGE(ret, "Failed to unregister host memory in destructor. host_addr=%p", host_addr);
     }
   }
-  registered_mems_.clear();
+  regions_.clear();
+  views_.clear();
+  idle_regions_.clear();
+  idle_bytes_.clear();
 }
 
 Status HostRegisterProxy::RegisterByDev(uint32_t dev_phy_id, void *host_addr, uint64_t size, void *&device_addr) {
@@ -75,10 +85,20 @@ Status HostRegisterProxy::RegisterByDev(uint32_t dev_phy_id, void *host_addr, ui
   return proxy->Register(host_addr, size, device_addr);
 }
 
-Status HostRegisterProxy::UnregisterByDev(uint32_t dev_phy_id, void *host_addr) {
+Status HostRegisterProxy::UnregisterByDev(uint32_t dev_phy_id, void *host_addr,
+                                          const HostRegisterCachePolicy &policy) {
   auto proxy = GetOrCreateInstance(dev_phy_id);
   HIXL_CHECK_NOTNULL(proxy);
-  return proxy->Unregister(host_addr);
+  return proxy->Unregister(host_addr, policy);
+}
+
+void HostRegisterProxy::ReleaseIdleCacheByDev(uint32_t dev_phy_id, const void *owner) {
+  auto proxy = GetInstance(dev_phy_id);
+  if (proxy == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(proxy->mutex_);
+  proxy->EvictIdleRegions(owner, 0U);
 }
 
 Status HostRegisterProxy::GetRegisteredDeviceAddrByDev(uint32_t dev_phy_id, void *host_addr, void *&device_addr) {
@@ -89,62 +109,202 @@ Status HostRegisterProxy::GetRegisteredDeviceAddrByDev(uint32_t dev_phy_id, void
 
 Status HostRegisterProxy::GetRegisteredDeviceAddr(void *host_addr, void *&device_addr) const {
   std::lock_guard<std::mutex> lock(mutex_);
-  auto it = registered_mems_.find(host_addr);
-  if (it != registered_mems_.end()) {
-    device_addr = it->second.device_addr;
+  const auto start = reinterpret_cast<uintptr_t>(host_addr);
+  auto it = regions_.upper_bound(start);
+  if (it == regions_.cbegin()) {
+    return FAILED;
+  }
+  --it;
+  if (it->second.ref_cnt > 0 && start - it->first < it->second.size) {
+    device_addr = RegionDeviceAddr(it->first, it->second, start);
     return SUCCESS;
   }
   return FAILED;
 }
 
+HostRegisterProxy::RegionIter HostRegisterProxy::FindContainingRegion(uintptr_t start, uint64_t size) {
+  // 区间之间一般不重叠，只检查起始地址不大于start的最后一个区间
+  auto it = regions_.upper_bound(start);
+  if (it == regions_.begin()) {
+    return regions_.end();
+  }
+  --it;
+  const uint64_t offset = start - it->first;
+  if (offset <= it->second.size && size <= it->second.size - offset) {
+    return it;
+  }
+  return regions_.end();
+}
+
+uint64_t HostRegisterProxy::IdleBytes(const void *owner) const {
+  const auto it = idle_bytes_.find(owner);
+  return (it == idle_bytes_.cend()) ? 0U : it->second;
+}
+
+void HostRegisterProxy::ReuseRegion(HostMemRegion &region) {
+  if (region.ref_cnt == 0) {
+    idle_regions_.erase(region.idle_it);
+    auto bytes_it = idle_bytes_.find(region.idle_owner);
+    bytes_it->second -= region.size;
+    if (bytes_it->second == 0U) {
+      idle_bytes_.erase(bytes_it);
+    }
+    region.idle_owner = nullptr;
+  }
+  region.ref_cnt++;
+}
+
+void HostRegisterProxy::ReleaseIdleRegion(RegionIter region_it) {
+  void *host_addr = reinterpret_cast<void *>(region_it->first);
+  const aclError ret = aclrtHostUnregister(host_addr);
+  if (ret != ACL_ERROR_NONE) {
+    HIXL_LOGE(ret, "Failed to unregister idle host memory. host_addr=%p, size=%lu", host_addr,
+              region_it->second.size);
+  } else {
+    HIXL_LOGI("Idle host memory unregistered. host_addr=%p, size=%lu", host_addr, region_it->second.size);
+  }
+  idle_regions_.erase(region_it->second.idle_it);
+  auto bytes_it = idle_bytes_.find(region_it->second.idle_owner);
+  bytes_it->second -= region_it->second.size;
+  if (bytes_it->second == 0U) {
+    idle_bytes_.erase(bytes_it);
+  }
+  regions_.erase(region_it);
+}
+
+void HostRegisterProxy::EvictIdleRegions(const void *owner, uint64_t capacity) {
+  // 从LRU尾部开始只淘汰该owner的区间，其他owner的缓存不受影响
+  auto it = idle_regions_.end();
+  while (IdleBytes(owner) > capacity && it != idle_regions_.begin()) {
+    const auto lru_it = std::prev(it);
+    const auto region_it = regions_.find(*lru_it);
+    if (region_it->second.idle_owner == owner) {
+      ReleaseIdleRegion(region_it);
+    } else {
+      it = lru_it;
+    }
+  }
+}
+
+Status HostRegisterProxy::RegisterRegion(uintptr_t start, uint64_t size, RegionIter &region_it) {
+  // 与请求区间重叠或相邻的空闲区间合并为一次注册，使后续注册其中任一段时可直接复用
+  uintptr_t merged_start = start;
+  uintptr_t merged_end = start + size;
+  std::vector<uintptr_t> merged_regions;
+  auto it = regions_.upper_bound(start);
+  if (it != regions_.begin()) {
+    --it;
+  }
+  for (; it != regions_.end() && it->first <= merged_end; ++it) {
+    const uintptr_t region_end = it->first + it->second.size;
+    if (it->second.ref_cnt == 0 && region_end >= start) {
+      merged_start = std::min(merged_start, it->first);
+      merged_end = std::max(merged_end, region_end);
+      merged_regions.emplace_back(it->first);
+    }
+  }
+  for (const auto region_start : merged_regions) {
+    ReleaseIdleRegion(regions_.find(region_start));
+  }
+  void *dev_ptr = nullptr;
+  aclError ret = ACL_ERROR_NONE;
+  if (!merged_regions.empty()) {
+    ret = aclrtHostRegister(reinterpret_cast<void *>(merged_start), merged_end - merged_start,
+                            ACL_HOST_REGISTER_MAPPED, &dev_ptr);
+    if (ret != ACL_ERROR_NONE) {
+      HIXL_LOGW("Failed to register merged host memory, fallback to requested range. merged_addr=%p, "
+                "merged_size=%lu, ret=%d", reinterpret_cast<void *>(merged_start), merged_end - merged_start, ret);
+    } else {
+      HIXL_LOGI("Merged %zu idle host regions into host_addr=%p, size=%lu, device_addr=%p", merged_regions.size(),
+                reinterpret_cast<void *>(merged_start), merged_end - merged_start, dev_ptr);
+    }
+  }
+  if (merged_regions.empty() || ret != ACL_ERROR_NONE) {
+    merged_start = start;
+    merged_end = start + size;
+    HIXL_CHK_ACL_RET(aclrtHostRegister(reinterpret_cast<void *>(start), size, ACL_HOST_REGISTER_MAPPED, &dev_ptr));
+  }
+  HostMemRegion region{};
+  region.size = merged_end - merged_start;
+  region.device_addr = dev_ptr;
+  region.ref_cnt = 1;
+  region_it = regions_.emplace(merged_start, region).first;
+  return SUCCESS;
+}
+
 Status HostRegisterProxy::Register(void *host_addr, uint64_t size, void *&device_addr) {
   HIXL_CHECK_NOTNULL(host_addr);
 
   std::lock_guard<std::mutex> lock(mutex_);
-  auto it = registered_mems_.find(host_addr);
-  if (it != registered_mems_.end()) {
-    if (it->second.size != size) {
+  const auto start = reinterpret_cast<uintptr_t>(host_addr);
+  // 按包含请求区间的已注册区间查找，起始地址相同的更短区间也直接复用
+  auto region_it = FindContainingRegion(start, size);
+  if (region_it != regions_.end()) {
+    ReuseRegion(region_it->second);
+    HIXL_LOGI("Host memory served by registered region, host_addr=%p, size=%lu, region_addr=%p, region_size=%lu, "
+              "ref_cnt=%d.", host_addr, size, reinterpret_cast<void *>(region_it->first), region_it->second.size,
+              region_it->second.ref_cnt);
+  } else {
+    auto same_start_it = regions_.find(start);
+    if (same_start_it != regions_.end() && same_start_it->second.ref_cnt > 0) {
       HIXL_LOGE(PARAM_INVALID,
-                "Host memory already registered with different size. host_addr=%p, cached_size=%lu, request_size=%lu",
-                host_addr, it->second.size, size);
+                "Host memory exceeds registered region with same start address. host_addr=%p, cached_size=%lu, "
+                "request_size=%lu", host_addr, same_start_it->second.size, size);
       return PARAM_INVALID;
     }
-    it->second.ref_cnt++;
-    device_addr = it->second.device_addr;
-    HIXL_LOGI("Host memory already registered, host_addr=%p, device_addr=%p, size=%lu, ref_cnt=%d.", host_addr,
-              device_addr, size, it->second.ref_cnt);
-    return SUCCESS;
+    HIXL_CHK_STATUS_RET(RegisterRegion(start, size, region_it), "Failed to register host memory, host_addr=%p",
+                        host_addr);
   }
-  void *dev_ptr = nullptr;
-  HIXL_CHK_ACL_RET(aclrtHostRegister(host_addr, size, ACL_HOST_REGISTER_MAPPED, &dev_ptr));
-  HostMemInfo info(host_addr, size, dev_ptr);
-  info.ref_cnt++;
-  registered_mems_[host_addr] = info;
+  views_[start].region_starts.emplace_back(region_it->first);
 
-  device_addr = dev_ptr;
-  HIXL_LOGI("Host memory registered successfully. host_addr=%p, device_addr=%p, size=%lu", host_addr, dev_ptr, size);
+  device_addr = RegionDeviceAddr(region_it->first, region_it->second, start);
+  HIXL_LOGI("Host memory registered successfully. host_addr=%p, device_addr=%p, size=%lu", host_addr, device_addr,
+            size);
   return SUCCESS;
 }
 
-Status HostRegisterProxy::Unregister(void *host_addr) {
+Status HostRegisterProxy::Unregister(void *host_addr, const HostRegisterCachePolicy &policy) {
   HIXL_CHECK_NOTNULL(host_addr);
 
   std::lock_guard<std::mutex> lock(mutex_);
-  auto it = registered_mems_.find(host_addr);
-  if (it == registered_mems_.end()) {
+  auto view_it = views_.find(reinterpret_cast<uintptr_t>(host_addr));
+  if (view_it == views_.end()) {
     HIXL_LOGI("Host memory not registered, returning success. host_addr=%p.", host_addr);
     return SUCCESS;
   }
-  auto &mem_info = it->second;
-  mem_info.ref_cnt--;
-  if (mem_info.ref_cnt > 0) {
-    HIXL_LOGI("Host mem has reference, no need call aclrtHostUnregister. host_addr=%p, ref_cnt=%d.", host_addr,
-              mem_info.ref_cnt);
+  auto &region_starts = view_it->second.region_starts;
+  const uintptr_t region_start = region_starts.back();
+  region_starts.pop_back();
+  if (!region_starts.empty()) {
+    HIXL_LOGI("Host mem has reference, no need call aclrtHostUnregister. host_addr=%p, ref_cnt=%zu.", host_addr,
+              region_starts.size());
+  } else {
+    views_.erase(view_it);
+  }
+  auto region_it = regions_.find(region_start);
+  auto &region = region_it->second;
+  region.ref_cnt--;
+  if (region.ref_cnt > 0) {
     return SUCCESS;
   }
-  HIXL_CHK_ACL_RET(aclrtHostUnregister(host_addr));
-
-  registered_mems_.erase(it);
+  if (region.size <= policy.capacity) {
+    region.idle_it = idle_regions_.insert(idle_regions_.begin(), region_start);
+    region.idle_owner = policy.owner;
+    idle_bytes_[policy.owner] += region.size;
+    EvictIdleRegions(policy.owner, policy.capacity);
+    HIXL_LOGI("Host memory moved to idle cache. host_addr=%p, owner=%p, idle_bytes=%lu", host_addr, policy.owner,
+              IdleBytes(policy.owner));
+    return SUCCESS;
+  }
+  const aclError ret = aclrtHostUnregister(reinterpret_cast<void *>(region_start));
+  if (ret != ACL_ERROR_NONE) {
+    // 保持区间注册状态，挂入空闲链表等待复用或后续淘汰
+    region.idle_it = idle_regions_.insert(idle_regions_.begin(), region_start);
+    region.idle_owner = policy.owner;
+    idle_bytes_[policy.owner] += region.size;
+  }
+  HIXL_CHK_ACL_RET(ret, "host_addr=%p", reinterpret_cast<void *>(region_start));
+  regions_.erase(region_it);
   HIXL_LOGI("Host memory unregistered successfully. host_addr=%p", host_addr);
   return SUCCESS;
 }
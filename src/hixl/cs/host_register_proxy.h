@@ -12,34 +12,70 @@
 #define CANN_HIXL_SRC_HIXL_CS_HOST_REGISTER_PROXY_H_
 
 #include <cstdint>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <map>
+#include <vector>
 #include "hixl/hixl_types.h"
 
 namespace hixl {
 
-struct HostMemInfo {
-  void *host_addr = nullptr;
+/**
+ * 一次aclrtHostRegister注册的host内存区间。
+ * ref_cnt为0时区间未被释放，而是挂在空闲LRU链表上等待复用或淘汰。
+ */
+struct HostMemRegion {
   uint64_t size = 0;
   void *device_addr = nullptr;
   int32_t ref_cnt = 0;
+  std::list<uintptr_t>::iterator idle_it;
+  const void *idle_owner = nullptr;  // 空闲时归属的缓存owner，按owner计入空闲字节数
+};
 
-  HostMemInfo() = default;
-  HostMemInfo(void *host, uint64_t host_size, void *device) : host_addr(host), size(host_size), device_addr(device) {}
+/**
+ * 调用方以同一起始地址注册的host内存。同一起始地址可多次注册不同长度，每次注册引用其所在的HostMemRegion，
+ * 注销时按后进先出释放对应区间的引用。
+ */
+struct HostMemView {
+  std::vector<uintptr_t> region_starts;
+};
+
+/**
+ * 注销时的空闲缓存策略。owner通常为发起注销的endpoint，capacity为其所属engine配置的空闲区间总字节数上限，
+ * 各owner的空闲区间分别计数与淘汰。capacity为0时注销即释放。
+ */
+struct HostRegisterCachePolicy {
+  const void *owner = nullptr;
+  uint64_t capacity = 0U;
 };
 
 class HostRegisterProxy {
  public:
   ~HostRegisterProxy();
 
+  /**
+   * 注册host内存并返回映射后的device地址。
+   * 请求区间落在已注册区间内(包括与已注册内存起始地址相同的更短区间)时直接复用并返回偏移后的device地址；
+   * 否则调用aclrtHostRegister注册，并将与请求区间重叠或相邻的空闲区间合并为一次注册。
+   */
   static Status RegisterByDev(uint32_t dev_phy_id, void *host_addr, uint64_t size, void *&device_addr);
 
-  static Status UnregisterByDev(uint32_t dev_phy_id, void *host_addr);
+  /**
+   * 按注册时的host_addr注销。引用计数归0的区间在policy的空闲缓存容量内延迟注销，超出容量时按LRU淘汰该owner的区间。
+   * 开启缓存后，调用方注销内存后仍会在缓存中保持注册状态，调用方释放该内存前须调用ReleaseIdleCacheByDev或确保已被淘汰，
+   * 典型场景为生命周期覆盖整个进程的KV缓存池。
+   */
+  static Status UnregisterByDev(uint32_t dev_phy_id, void *host_addr, const HostRegisterCachePolicy &policy = {});
+
+  /**
+   * 立即注销owner缓存中的全部空闲区间，owner销毁前调用。
+   */
+  static void ReleaseIdleCacheByDev(uint32_t dev_phy_id, const void *owner);
 
   /**
    * 获取host addr注册的device地址。
-   * 仅支持获取直接注册的，偏移后的以及远端的不支持获取。
+   * 支持获取已注册区间内的偏移地址，远端的以及已注销(包括仍在空闲缓存中)的不支持获取。
    * @param dev_phy_id device physical id
    * @param host_addr host内存地址
    * @param device_addr 调用HostRegister映射后的device地址。
@@ -51,14 +87,26 @@ class HostRegisterProxy {
   HostRegisterProxy &operator=(const HostRegisterProxy &) = delete;
 
  private:
+  using RegionIter = std::map<uintptr_t, HostMemRegion>::iterator;
+
   static std::shared_ptr<HostRegisterProxy> GetOrCreateInstance(uint32_t dev_phy_id);
   static std::shared_ptr<HostRegisterProxy> GetInstance(uint32_t dev_phy_id);
   explicit HostRegisterProxy(int32_t dev_phy_id);
   Status Register(void *host_addr, uint64_t size, void *&device_addr);
-  Status Unregister(void *host_addr);
+  Status Unregister(void *host_addr, const HostRegisterCachePolicy &policy);
   Status GetRegisteredDeviceAddr(void *host_addr, void *&device_addr) const;
 
-  std::map<void *, HostMemInfo> registered_mems_;
+  RegionIter FindContainingRegion(uintptr_t start, uint64_t size);
+  Status RegisterRegion(uintptr_t start, uint64_t size, RegionIter &region_it);
+  void ReuseRegion(HostMemRegion &region);
+  void ReleaseIdleRegion(RegionIter region_it);
+  void EvictIdleRegions(const void *owner, uint64_t capacity);
+  uint64_t IdleBytes(const void *owner) const;
+
+  std::map<uintptr_t, HostMemRegion> regions_;
+  std::map<uintptr_t, HostMemView> views_;
+  std::list<uintptr_t> idle_regions_;  // 头部为最近注销的区间
+  std::map<const void *, uint64_t> idle_bytes_;  // owner -> 空闲区间总字节数
   mutable std::mutex mutex_;
   int32_t dev_phy_id_;
 };
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "mem_dir_watcher.h"
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <unistd.h>
+#include <vector>
+#include "common/ctrl_msg_plugin.h"
+#include "common/hixl_checker.h"
+#include "common/hixl_log.h"
+#include "common/hixl_utils.h"
+
+namespace hixl {
+namespace {
+constexpr int32_t kMaxEventsNum = 64;           // epoll_wait单次处理的事件数量
+constexpr int32_t kEpollWaitTimeInMillis = 100;  // epoll_wait等待超时时间，用于感知退出
+}  // namespace
+
+MemDirWatcher &MemDirWatcher::GetInstance() {
+  static MemDirWatcher instance;
+  return instance;
+}
+
+MemDirWatcher::~MemDirWatcher() {
+  running_ = false;
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  if (epoll_fd_ != -1) {
+    (void)close(epoll_fd_);
+    epoll_fd_ = -1;
+  }
+}
+
+Status MemDirWatcher::StartLocked() {
+  if (running_.load()) {
+    return SUCCESS;
+  }
+  if (epoll_fd_ == -1) {
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    HIXL_CHK_BOOL_RET_STATUS(epoll_fd_ >= 0, FAILED, "Create epoll failed, errno:%d, msg:%s", errno, strerror(errno));
+  }
+  running_ = true;
+  thread_ = std::thread([this]() { Run(); });
+  HIXL_EVENT("[HixlClient] mem dir watcher started, epoll_fd:%d", epoll_fd_);
+  return SUCCESS;
+}
+
+Status MemDirWatcher::Watch(int32_t fd, MsgCallback callback) {
+  HIXL_CHK_BOOL_RET_STATUS(fd >= 0, PARAM_INVALID, "Invalid fd:%d", fd);
+  auto receiver = MakeShared<MsgReceiver>(fd);
+  HIXL_CHECK_NOTNULL(receiver);
+  std::lock_guard<std::mutex> lock(mutex_);
+  HIXL_CHK_STATUS_RET(StartLocked(), "Failed to start mem dir watcher");
+  HIXL_CHK_BOOL_RET_STATUS(entries_.find(fd) == entries_.cend(), PARAM_INVALID, "fd:%d is already watched", fd);
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::AddFdToEpoll(epoll_fd_, fd), "Failed to add fd:%d to mem dir watcher", fd);
+  WatchEntry entry{};
+  entry.receiver = std::move(receiver);
+  entry.callback = std::move(callback);
+  entries_[fd] = std::move(entry);
+  return SUCCESS;
+}
+
+void MemDirWatcher::Unwatch(int32_t fd) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  RemoveLocked(fd);
+}
+
+void MemDirWatcher::RemoveLocked(int32_t fd) {
+  auto it = entries_.find(fd);
+  if (it == entries_.end()) {
+    return;
+  }
+  (void)epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+  entries_.erase(it);
+}
+
+void MemDirWatcher::Run() {
+  (void)pthread_setname_np(pthread_self(), "hixl_mem_dir");
+  struct epoll_event event_infos[kMaxEventsNum];
+  while (running_.load()) {
+    int32_t event_num = epoll_wait(epoll_fd_, event_infos, kMaxEventsNum, kEpollWaitTimeInMillis);
+    for (int32_t i = 0; i < event_num; ++i) {
+      int32_t fd = event_infos[i].data.fd;
+      uint32_t revents = event_infos[i].events;
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(fd);
+      if (it == entries_.end()) {
+        continue;
+      }
+      if ((revents & EPOLLIN) != 0U) {
+        std::vector<CtrlMsgPtr> msgs;
+        Status ret = it->second.receiver->IRecv(msgs);
+        for (const auto &msg : msgs) {
+          it->second.callback(*msg);
+        }
+        if (ret != SUCCESS) {
+          HIXL_LOGW("[HixlClient] recv mem dir msg failed, stop watching fd:%d, ret:%u", fd, ret);
+          RemoveLocked(fd);
+          continue;
+        }
+      }
+      if ((revents & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) != 0U) {
+        HIXL_LOGW("[HixlClient] mem dir socket closed by peer, stop watching fd:%d, events:0x%x", fd, revents);
+        RemoveLocked(fd);
+      }
+    }
+  }
+}
+}  // namespace hixl
@@ -0,0 +1,58 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_CS_MEM_DIR_WATCHER_H_
+#define CANN_HIXL_SRC_HIXL_CS_MEM_DIR_WATCHER_H_
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include "hixl/hixl_types.h"
+#include "common/ctrl_msg.h"
+#include "msg_receiver.h"
+
+namespace hixl {
+/**
+ * @brief 进程级的内存目录推送监听器，由一个epoll线程接收所有已订阅client socket上server推送的消息。
+ *        回调在监听器锁内执行，Unwatch返回后不会再有该fd的回调，调用方须保证调用Unwatch时未持有回调中会获取的锁。
+ */
+class MemDirWatcher {
+ public:
+  using MsgCallback = std::function<void(const CtrlMsg &msg)>;
+
+  static MemDirWatcher &GetInstance();
+  ~MemDirWatcher();
+
+  Status Watch(int32_t fd, MsgCallback callback);
+  void Unwatch(int32_t fd);
+
+ private:
+  struct WatchEntry {
+    std::shared_ptr<MsgReceiver> receiver;
+    MsgCallback callback;
+  };
+
+  MemDirWatcher() = default;
+  Status StartLocked();
+  void Run();
+  void RemoveLocked(int32_t fd);
+
+  std::mutex mutex_;
+  std::map<int32_t, WatchEntry> entries_;
+  int32_t epoll_fd_ = -1;
+  std::atomic<bool> running_{false};
+  std::thread thread_;
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_CS_MEM_DIR_WATCHER_H_
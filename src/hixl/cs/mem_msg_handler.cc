@@ -221,7 +221,53 @@ hixl::Status ParseMemDescsArray(const nlohmann::json &arr, std::vector<hixl::Hix
   return hixl::SUCCESS;
 }
 
-hixl::Status ParseGetRemoteMemJson(const char *json_ptr, size_t json_len, std::vector<hixl::HixlMemDesc> &mem_descs) {
+hixl::Status ParseDirVersion(const nlohmann::json &j, std::optional<uint64_t> &dir_version) {
+  dir_version.reset();
+  try {
+    if (j.contains("version")) {
+      dir_version = j["version"].get<uint64_t>();
+    }
+    return hixl::SUCCESS;
+  } catch (const nlohmann::json::exception &e) {
+    HIXL_LOGE(hixl::PARAM_INVALID, "[HixlClient] JSON error in ParseDirVersion: %s", e.what());
+    return hixl::PARAM_INVALID;
+  }
+}
+
+hixl::Status ParseRemovedAddrs(const nlohmann::json &arr, std::vector<uint64_t> &removed) {
+  HIXL_CHK_BOOL_RET_STATUS(arr.is_array() && arr.size() <= kMaxGetRemoteMemNum, hixl::PARAM_INVALID,
+                           "[HixlClient] MemDirUpdate 'removed' is not array or too large");
+  try {
+    removed.clear();
+    removed.reserve(arr.size());
+    for (const auto &item : arr) {
+      removed.emplace_back(item.get<uint64_t>());
+    }
+    return hixl::SUCCESS;
+  } catch (const nlohmann::json::exception &e) {
+    HIXL_LOGE(hixl::PARAM_INVALID, "[HixlClient] JSON error in ParseRemovedAddrs: %s", e.what());
+    return hixl::PARAM_INVALID;
+  }
+}
+
+hixl::Status ParseMemDirUpdateJson(const nlohmann::json &j, hixl::MemDirUpdate &update) {
+  try {
+    HIXL_CHK_BOOL_RET_STATUS(j.contains("version") && j.contains("reset") && j.contains("added") &&
+                                 j.contains("removed") && j["added"].is_array(),
+                             hixl::PARAM_INVALID,
+                             "[HixlClient] MemDirUpdate json missing 'version' / 'reset' / 'added' / 'removed'");
+    update.version = j["version"].get<uint64_t>();
+    update.reset = j["reset"].get<bool>();
+  } catch (const nlohmann::json::exception &e) {
+    HIXL_LOGE(hixl::PARAM_INVALID, "[HixlClient] JSON error in ParseMemDirUpdateJson: %s", e.what());
+    return hixl::PARAM_INVALID;
+  }
+  HIXL_CHK_STATUS_RET(ParseRemovedAddrs(j["removed"], update.removed));
+  return ParseMemDescsArray(j["added"], update.added);
+}
+
+hixl::Status ParseGetRemoteMemJson(const char *json_ptr, size_t json_len, std::vector<hixl::HixlMemDesc> &mem_descs,
+                                   std::optional<uint64_t> &dir_version) {
   HIXL_LOGD("[HixlClient] Parsing JSON from memory address %p, len %zu", json_ptr, json_len);
   nlohmann::json j;
   try {
@@ -236,6 +282,7 @@ hixl::Status ParseGetRemoteMemJson(const char *json_ptr, size_t json_len, std::v
 
   const nlohmann::json *arr = nullptr;
   HIXL_CHK_STATUS_RET(ParseResultAndGetArray(j, arr));
+  HIXL_CHK_STATUS_RET(ParseDirVersion(j, dir_version));
 
   return ParseMemDescsArray(*arr, mem_descs);
 }
@@ -264,6 +311,12 @@ Status MemMsgHandler::SendGetRemoteMemRequest(int32_t socket, uint64_t endpoint_
 
 Status MemMsgHandler::RecvGetRemoteMemResponse(int32_t socket, std::vector<HixlMemDesc> &mem_descs,
                                                uint32_t timeout_ms) {
+  std::optional<uint64_t> dir_version;
+  return RecvGetRemoteMemResponse(socket, mem_descs, dir_version, timeout_ms);
+}
+
+Status MemMsgHandler::RecvGetRemoteMemResponse(int32_t socket, std::vector<HixlMemDesc> &mem_descs,
+                                               std::optional<uint64_t> &dir_version, uint32_t timeout_ms) {
   HIXL_EVENT("[HixlClient] RecvGetRemoteMemResponse start. socket: %d, timeout_ms: %u ms", socket, timeout_ms);
   uint64_t body_size = 0;
   HIXL_CHK_STATUS_RET(RecvAndCheckHeader(socket, body_size, timeout_ms));
@@ -273,7 +326,7 @@ Status MemMsgHandler::RecvGetRemoteMemResponse(int32_t socket, std::vector<HixlM
   const char *json_ptr = nullptr;
   size_t json_len = 0;
   HIXL_CHK_STATUS_RET(ExtractTypeAndJsonPtr(body, msg_type, json_ptr, json_len));
-  Status ret = ParseGetRemoteMemJson(json_ptr, json_len, mem_descs);
+  Status ret = ParseGetRemoteMemJson(json_ptr, json_len, mem_descs, dir_version);
   if (ret == SUCCESS) {
     HIXL_EVENT("[HixlClient] RecvGetRemoteMemResponse success. Parsed %zu mem descriptors.", mem_descs.size());
   } else {
@@ -281,4 +334,44 @@ Status MemMsgHandler::RecvGetRemoteMemResponse(int32_t socket, std::vector<HixlM
   }
   return ret;
 }
+
+Status MemMsgHandler::SendMemDirSubscribeRequest(int32_t socket, uint64_t endpoint_handle, uint64_t known_version) {
+  CtrlMsgHeader header{};
+  header.magic = kMagicNumber;
+  header.body_size = static_cast<uint64_t>(sizeof(CtrlMsgType) + sizeof(MemDirSubscribeReq));
+  CtrlMsgType msg_type = CtrlMsgType::kMemDirSubscribeReq;
+  MemDirSubscribeReq body{};
+  body.dst_ep_handle = endpoint_handle;
+  body.known_version = known_version;
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(socket, &header, static_cast<uint64_t>(sizeof(header))));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(socket, &msg_type, static_cast<uint64_t>(sizeof(msg_type))));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(socket, &body, static_cast<uint64_t>(sizeof(body))));
+  HIXL_LOGI("[HixlClient] SendMemDirSubscribeRequest success. fd=%d, known_version=%" PRIu64, socket, known_version);
+  return SUCCESS;
+}
+
+Status MemMsgHandler::SendMemDirUpdateAck(int32_t socket, uint64_t version) {
+  CtrlMsgHeader header{};
+  header.magic = kMagicNumber;
+  header.body_size = static_cast<uint64_t>(sizeof(CtrlMsgType) + sizeof(MemDirUpdateAck));
+  CtrlMsgType msg_type = CtrlMsgType::kMemDirUpdateAck;
+  MemDirUpdateAck body{};
+  body.version = version;
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(socket, &header, static_cast<uint64_t>(sizeof(header))));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(socket, &msg_type, static_cast<uint64_t>(sizeof(msg_type))));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(socket, &body, static_cast<uint64_t>(sizeof(body))));
+  HIXL_LOGD("[HixlClient] SendMemDirUpdateAck success. fd=%d, version=%" PRIu64, socket, version);
+  return SUCCESS;
+}
+
+Status MemMsgHandler::ParseMemDirUpdate(const std::string &msg, MemDirUpdate &update) {
+  nlohmann::json j;
+  try {
+    j = nlohmann::json::parse(msg);
+  } catch (const nlohmann::json::exception &e) {
+    HIXL_LOGE(PARAM_INVALID, "[HixlClient] Failed to parse MemDirUpdate json, exception:%s", e.what());
+    return PARAM_INVALID;
+  }
+  return ParseMemDirUpdateJson(j, update);
+}
 }  // namespace hixl
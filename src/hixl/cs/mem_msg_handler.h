@@ -12,6 +12,8 @@
 #define CANN_HIXL_SRC_HIXL_CS_HIXL_MEM_MSG_HANDLER_H_
 
 #include <cstdint>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "hixl/hixl_types.h"
@@ -23,6 +25,13 @@ class MemMsgHandler {
  public:
   static Status SendGetRemoteMemRequest(int32_t socket, uint64_t endpoint_handle, uint32_t timeout_ms = 0U);
   static Status RecvGetRemoteMemResponse(int32_t socket, std::vector<HixlMemDesc> &mem_descs, uint32_t timeout_ms = 0U);
+  // dir_version为server端内存目录版本，旧版本server不携带该字段时为空，表示不支持目录订阅
+  static Status RecvGetRemoteMemResponse(int32_t socket, std::vector<HixlMemDesc> &mem_descs,
+                                         std::optional<uint64_t> &dir_version, uint32_t timeout_ms);
+  static Status SendMemDirSubscribeRequest(int32_t socket, uint64_t endpoint_handle, uint64_t known_version);
+  static Status SendMemDirUpdateAck(int32_t socket, uint64_t version);
+  // 解析kMemDirUpdate帧体(不含CtrlMsgType)，失败时不残留已分配的export_desc
+  static Status ParseMemDirUpdate(const std::string &msg, MemDirUpdate &update);
 };
 
 }  // namespace hixl
@@ -818,6 +818,14 @@ Status TransferPool::DeleteTransferContextsLocked(const std::vector<HixlTransfer
   return SyncContextsLocked(entries, TRANSFER_CONTEXT_OP_DELETE, TRANSFER_THREAD_STATE_DELETED);
 }
 
+uint32_t TransferPool::SlotContextIdLocked(const Slot &slot) const {
+  const Slot *base = slots_.data();
+  if (slots_.empty() || &slot < base || &slot >= base + slots_.size()) {
+    return 0U;
+  }
+  return SlotIndexToContextId(static_cast<uint32_t>(&slot - base));
+}
+
 Status TransferPool::SyncOneTransferContextLocked(const Slot &slot, uint32_t op, uint32_t expect_state) const {
   if (slot.thread == 0U) {
     return SUCCESS;
@@ -827,6 +835,7 @@ Status TransferPool::SyncOneTransferContextLocked(const Slot &slot, uint32_t op,
   entry.op = op;
   entry.notify_id = slot.notify_id;
   entry.err_flag_dev_va = slot.err_flag_dev_addr;
+  entry.ctx_id = SlotContextIdLocked(slot);
   std::vector<HixlTransferContextSyncEntry> entries{entry};
   return SyncContextsLocked(entries, op, expect_state);
 }
@@ -835,7 +844,8 @@ std::vector<HixlTransferContextSyncEntry> TransferPool::BuildSyncEntriesFromSlot
                                                                                   uint32_t op) {
   std::vector<HixlTransferContextSyncEntry> entries;
   entries.reserve(slots.size());
-  for (const auto &slot : slots) {
+  for (size_t i = 0U; i < slots.size(); ++i) {
+    const Slot &slot = slots[i];
     if (slot.thread == 0U) {
       continue;
     }
@@ -844,6 +854,7 @@ std::vector<HixlTransferContextSyncEntry> TransferPool::BuildSyncEntriesFromSlot
     entry.op = op;
     entry.notify_id = slot.notify_id;
     entry.err_flag_dev_va = slot.err_flag_dev_addr;
+    entry.ctx_id = SlotIndexToContextId(static_cast<uint32_t>(i));
     entries.push_back(entry);
   }
   return entries;
@@ -26,8 +26,16 @@ namespace hixl {
 class TransferPool {
  public:
   static constexpr uint32_t kMaxPoolSize = 4096U;
+  static_assert(kMaxPoolSize <= kMaxTransferContextId, "every slot must map to a kernel transfer context id");
   static TransferPool *GetInstance(int32_t device_id);
 
+  /**
+   * @brief slot在kernel侧TransferContext槽位表中的编号，0保留为未分配
+   */
+  static constexpr uint32_t SlotIndexToContextId(uint32_t slot_index) {
+    return slot_index + 1U;
+  }
+
   struct SlotHandle {
     int32_t device_id;
     uint32_t slot_index;
@@ -123,6 +131,7 @@ class TransferPool {
   Status AddTransferContextsLocked() const;
   Status DeleteTransferContextsLocked(const std::vector<HixlTransferContextSyncEntry> &entries) const;
   Status SyncOneTransferContextLocked(const Slot &slot, uint32_t op, uint32_t expect_state) const;
+  uint32_t SlotContextIdLocked(const Slot &slot) const;
   Status LaunchSyncContextKernelLocked(const std::vector<HixlTransferContextSyncEntry> &entries,
                                        std::vector<uint32_t> &states) const;
   static std::vector<HixlTransferContextSyncEntry> BuildSyncEntriesFromSlots(const std::vector<Slot> &slots,
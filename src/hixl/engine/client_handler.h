@@ -76,6 +76,12 @@ class IClientHandler {
   virtual Status TransferSync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
                               uint32_t timeout_ms) = 0;
   virtual Status GetTransferStatus(const TransferReq &req, TransferStatus &status) = 0;
+  // req为本handler上未结束的异步请求；返回true表示此后以later_descs下发的传输与req同通道，必在req完成后才落到对端
+  virtual bool IsOrderedBefore(const TransferReq &req, const std::vector<TransferOpDesc> &later_descs) const {
+    (void)req;
+    (void)later_descs;
+    return false;
+  }
   virtual Status Finalize() = 0;
   virtual void Dump(const char *reason, DumpLogLevel level = DumpLogLevel::EVENT) const = 0;
 };
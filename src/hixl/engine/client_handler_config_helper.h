@@ -23,7 +23,7 @@ class ClientHandlerConfigHelper {
  public:
   static std::string BuildGlobalResourceConfig(const HandlerCreateArgs &args) {
     // force return "", default json construction will dump to "null" which not as expect
-    if (!args.qos.has_value() && !args.max_active_channels.has_value()) {
+    if (!args.qos.has_value() && !args.max_active_channels.has_value() && !args.host_register_cache_size.has_value()) {
       return "";
     }
     nlohmann::json json;
@@ -33,6 +33,9 @@ class ClientHandlerConfigHelper {
     if (args.max_active_channels.has_value()) {
       json["comm_resource_config.max_active_channels"] = args.max_active_channels.value();
     }
+    if (args.host_register_cache_size.has_value()) {
+      json["comm_resource_config.host_register_cache_size"] = args.host_register_cache_size.value();
+    }
     return json.dump();
   }
 };
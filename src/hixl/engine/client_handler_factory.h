@@ -42,6 +42,8 @@ struct HandlerCreateArgs {
   int32_t ctrl_socket = -1;
   std::string local_engine;
   std::string remote_engine;
+  std::vector<EndpointPair> rail_pairs;  // 多链路模式下与matched_pairs同类型的额外endpoint对
+  std::optional<uint64_t> host_register_cache_size;  // MB
 };
 
 class ClientHandlerFactory {
@@ -19,6 +19,27 @@
 namespace hixl {
 namespace {
 constexpr int64_t kHeartbeatIntervalMs = 10000;  // 10 seconds
+constexpr int32_t kRebuildWaitOnDestroyMs = 60000;
+constexpr uint32_t kMaxConsecutiveTimeouts = 3U;  // 同一远端连续超时达到该次数后重建链路
+}
+
+FailureScope ClassifyTransferFailure(Status ret, uint32_t consecutive_timeouts) {
+  // 参数错误、资源不足与不支持的操作在提交前即被拒绝，不会改变链路状态；
+  // 单次超时只说明该请求慢，连续超时才视为链路异常。HixlCSClient锁存失败后后续请求返回FAILED，按链路级处理
+  switch (ret) {
+    case PARAM_INVALID:
+    case RESOURCE_EXHAUSTED:
+    case UNSUPPORTED:
+      return FailureScope::kRequest;
+    case TIMEOUT:
+      return (consecutive_timeouts >= kMaxConsecutiveTimeouts) ? FailureScope::kChannel : FailureScope::kRequest;
+    default:
+      return FailureScope::kChannel;
+  }
+}
+
+ClientManager::~ClientManager() {
+  JoinRebuildThreads();
 }
 
 Status ClientManager::Initialize(bool auto_connect) {
@@ -61,6 +82,7 @@ Status ClientManager::CreateClient(const ClientConfig &config, ClientPtr &client
 
 Status ClientManager::GetOrCreateClient(const ClientConfig &config, const std::vector<MemHandleInfo> &mem_info_list,
                                         int32_t timeout_in_millis, ClientPtr &client_ptr) {
+  WaitRebuildDone(config.remote_engine, timeout_in_millis);
   auto client_mutex = GetClientMutex(config.remote_engine);
   std::lock_guard<std::mutex> client_lock(*client_mutex);
   {
@@ -71,7 +93,12 @@ Status ClientManager::GetOrCreateClient(const ClientConfig &config, const std::v
       return ALREADY_CONNECTED;
     }
   }
+  return CreateAndConnectClient(config, mem_info_list, timeout_in_millis, client_ptr);
+}
 
+Status ClientManager::CreateAndConnectClient(const ClientConfig &config,
+                                             const std::vector<MemHandleInfo> &mem_info_list,
+                                             int32_t timeout_in_millis, ClientPtr &client_ptr) {
   ClientPtr new_client = nullptr;
   HIXL_CHK_STATUS_RET(CreateClient(config, new_client), "Failed to create HixlClient, remote_engine:%s",
                       config.remote_engine.c_str());
@@ -100,6 +127,91 @@ ClientPtr ClientManager::GetClient(const std::string &remote_engine) const {
   return nullptr;
 }
 
+void ClientManager::WaitRebuildDone(const std::string &remote_engine, int32_t timeout_in_millis) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  (void)rebuild_cv_.wait_for(lock, std::chrono::milliseconds(timeout_in_millis),
+                             [this, &remote_engine] { return rebuilding_.count(remote_engine) == 0U; });
+}
+
+ClientPtr ClientManager::AwaitClient(const std::string &remote_engine, int32_t timeout_in_millis) {
+  WaitRebuildDone(remote_engine, timeout_in_millis);
+  return GetClient(remote_engine);
+}
+
+bool ClientManager::RebuildClientAsync(const ClientPtr &broken, std::vector<MemHandleInfo> mem_info_list,
+                                       RebuildPrepareFunc prepare) {
+  if (broken == nullptr) {
+    return false;
+  }
+  const std::string remote_engine = broken->GetRemoteEngine();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = clients_.find(remote_engine);
+    if (finalized_ || it == clients_.end() || it->second != broken || rebuilding_.count(remote_engine) != 0U) {
+      return false;
+    }
+    // 先摘除，保证重建期间不会再有新请求拿到损坏的client
+    clients_.erase(it);
+    (void)rebuilding_.insert(remote_engine);
+  }
+  HIXL_EVENT("[ClientManager] channel fault, start rebuilding client, remote_engine:%s", remote_engine.c_str());
+  std::lock_guard<std::mutex> threads_lock(rebuild_threads_mutex_);
+  auto &rebuild_thread = rebuild_threads_[remote_engine];
+  if (rebuild_thread.joinable()) {
+    // 同一远端的上一次重建已结束(rebuilding_中不存在)，这里只回收线程
+    rebuild_thread.join();
+  }
+  rebuild_thread = std::thread(
+      [this, broken, mem_info_list = std::move(mem_info_list), prepare = std::move(prepare)]() {
+        RebuildClient(broken, mem_info_list, prepare);
+      });
+  return true;
+}
+
+void ClientManager::RebuildClient(const ClientPtr &broken, const std::vector<MemHandleInfo> &mem_info_list,
+                                  const RebuildPrepareFunc &prepare) {
+  const std::string &remote_engine = broken->GetRemoteEngine();
+  auto client_mutex = GetClientMutex(remote_engine);
+  Status ret = SUCCESS;
+  {
+    std::lock_guard<std::mutex> client_lock(*client_mutex);
+    EraseReqIndexByClient(broken);
+    if (broken->Finalize() != SUCCESS) {
+      HIXL_LOGW("Failed to finalize broken client, remote_engine:%s", remote_engine.c_str());
+    }
+    const ClientConfig &config = broken->GetConfig();
+    ClientPtr new_client = nullptr;
+    ret = prepare();
+    if (ret == SUCCESS && GetClient(remote_engine) == nullptr) {
+      ret = CreateAndConnectClient(config, mem_info_list, static_cast<int32_t>(config.timeout_ms), new_client);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    (void)rebuilding_.erase(remote_engine);
+  }
+  rebuild_cv_.notify_all();
+  if (ret != SUCCESS) {
+    HIXL_LOGE(ret, "Failed to rebuild client, remote_engine:%s", remote_engine.c_str());
+    return;
+  }
+  HIXL_EVENT("[ClientManager] rebuild client end, remote_engine:%s", remote_engine.c_str());
+}
+
+void ClientManager::JoinRebuildThreads() {
+  std::map<std::string, std::thread> rebuild_threads;
+  {
+    std::lock_guard<std::mutex> threads_lock(rebuild_threads_mutex_);
+    rebuild_threads = std::move(rebuild_threads_);
+    rebuild_threads_.clear();
+  }
+  for (auto &it : rebuild_threads) {
+    if (it.second.joinable()) {
+      it.second.join();
+    }
+  }
+}
+
 ClientPtr ClientManager::GetClientByReq(const TransferReq &req) {
   std::lock_guard<std::mutex> lock(req_index_mutex_);
   auto it = req_to_client_.find(req);
@@ -181,6 +293,8 @@ void ClientManager::EraseReqIndexByClient(const ClientPtr &client) {
 Status ClientManager::DestroyClient(const std::string &remote_engine) {
   auto ret = NOT_CONNECTED;
   ClientPtr client = nullptr;
+  // 等待进行中的重建完成，避免重建出的client在断链之后才注册
+  WaitRebuildDone(remote_engine, kRebuildWaitOnDestroyMs);
   auto client_mutex = GetClientMutex(remote_engine);
   std::lock_guard<std::mutex> client_lock(*client_mutex);
   {
@@ -250,10 +364,15 @@ Status ClientManager::Finalize() {
   if (heartbeat_sender_.joinable()) {
     heartbeat_sender_.join();
   }
-  std::map<std::string, ClientPtr> clients;
   {
     std::lock_guard<std::mutex> lock(mutex_);
     finalized_ = true;
+  }
+  // finalized_置位后不再发起新的重建；进行中的重建若已建链成功，其client会在下面随其余client一起销毁
+  JoinRebuildThreads();
+  std::map<std::string, ClientPtr> clients;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
     clients = std::move(clients_);
   }
 
@@ -13,10 +13,12 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <thread>
 #include <unordered_map>
 #include <vector>
@@ -31,10 +33,16 @@ struct TransferReqInfo {
   const void *user_data = nullptr;
 };
 
+// 传输失败的影响范围：kRequest只影响本次请求，链路可继续使用；kChannel表示链路本身已不可信，需要重建
+enum class FailureScope : int32_t { kRequest = 0, kChannel };
+
+// consecutive_timeouts为该远端自上次成功以来的连续超时次数(含本次)
+FailureScope ClassifyTransferFailure(Status ret, uint32_t consecutive_timeouts = 0U);
+
 class ClientManager {
  public:
   ClientManager() = default;
-  ~ClientManager() = default;
+  ~ClientManager();
   Status Initialize(bool auto_connect);
   Status Finalize();
   Status GetOrCreateClient(const ClientConfig &config, const std::vector<MemHandleInfo> &mem_info_list,
@@ -47,6 +55,18 @@ class ClientManager {
   std::vector<TransferReqInfo> GetOrderedReqs(size_t max_count);
   bool IsEmpty() const;
 
+  // 在后台重建线程中建链前执行(如设置线程context)，不得再获取调用方的锁
+  using RebuildPrepareFunc = std::function<Status()>;
+  /**
+   * 摘除已损坏的client并在后台重建到同一远端的链路，重建期间该远端的新请求在AwaitClient/GetOrCreateClient处等待。
+   * 新链路沿用broken创建时的配置(超时、是否lazy)，本端内存信息由调用方在发起重建前准备好
+   * @return broken已不是当前注册的client或该远端正在重建时返回false，不做任何处理
+   */
+  bool RebuildClientAsync(const ClientPtr &broken, std::vector<MemHandleInfo> mem_info_list,
+                          RebuildPrepareFunc prepare);
+  // 获取client，远端正在重建时最多等待timeout_in_millis
+  ClientPtr AwaitClient(const std::string &remote_engine, int32_t timeout_in_millis);
+
  private:
   struct ReqOwner {
     std::weak_ptr<HixlClient> client;
@@ -56,6 +76,12 @@ class ClientManager {
 
   Status StartHeartbeat();
   Status CreateClient(const ClientConfig &config, ClientPtr &client_ptr) const;
+  Status CreateAndConnectClient(const ClientConfig &config, const std::vector<MemHandleInfo> &mem_info_list,
+                                int32_t timeout_in_millis, ClientPtr &client_ptr);
+  void RebuildClient(const ClientPtr &broken, const std::vector<MemHandleInfo> &mem_info_list,
+                     const RebuildPrepareFunc &prepare);
+  void WaitRebuildDone(const std::string &remote_engine, int32_t timeout_in_millis);
+  void JoinRebuildThreads();
   std::shared_ptr<std::mutex> GetClientMutex(const std::string &remote_engine);
   void DestroyClientMutex(const std::string &remote_engine);
   void SendHeartbeat();
@@ -67,6 +93,11 @@ class ClientManager {
   bool finalized_ = false;
   std::mutex client_mutexes_mutex_;
   std::unordered_map<std::string, std::shared_ptr<std::mutex>> client_mutexes_;
+  // 正在后台重建的远端，受mutex_保护
+  std::set<std::string> rebuilding_;
+  std::condition_variable rebuild_cv_;
+  std::mutex rebuild_threads_mutex_;
+  std::map<std::string, std::thread> rebuild_threads_;
 
   std::thread heartbeat_sender_;
   std::atomic<bool> stop_signal_{false};
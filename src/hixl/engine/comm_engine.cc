@@ -10,6 +10,7 @@
 
 #include "comm_engine.h"
 #include "common/hixl_checker.h"
+#include "common/transfer_telemetry.h"
 
 namespace hixl {
 const std::unordered_set<std::string> CommEngine::kSupportedOptions = {
@@ -63,7 +64,14 @@ Status CommEngine::TransferSync(const AscendString &remote_engine, TransferOp op
   for (const auto &op_desc : op_descs) {
     adxl_op_descs.emplace_back(adxl::TransferOpDesc{op_desc.local_addr, op_desc.remote_addr, op_desc.len});
   }
-  return adxl_inner_engine_.TransferSync(remote_engine, adxl_operation, adxl_op_descs, timeout_in_millis);
+  const uint64_t start_us = TransferTelemetry::NowMicros();
+  HIXL_CHK_STATUS_RET(adxl_inner_engine_.TransferSync(remote_engine, adxl_operation, adxl_op_descs, timeout_in_millis),
+                      "[CommEngine] TransferSync failed, remote_engine:%s", remote_engine.GetString());
+  if (telemetry_ != nullptr) {
+    telemetry_->Record(remote_engine.GetString(), operation, TransferTelemetry::TotalBytes(op_descs),
+                       TransferTelemetry::NowMicros() - start_us);
+  }
+  return SUCCESS;
 }
 
 Status CommEngine::TransferAsync(const AscendString &remote_engine, TransferOp operation,
@@ -82,8 +90,13 @@ Status CommEngine::TransferAsync(const AscendString &remote_engine, TransferOp o
 
 Status CommEngine::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
   adxl::TransferStatus adxl_status;
-  auto ret = adxl_inner_engine_.GetTransferStatus(req, adxl_status);
+  TransferInfo finished_info{};
+  auto ret = adxl_inner_engine_.GetTransferStatus(req, adxl_status, &finished_info);
   status = static_cast<hixl::TransferStatus>(adxl_status);
+  if ((ret == SUCCESS) && (status == TransferStatus::COMPLETED) && (telemetry_ != nullptr)) {
+    telemetry_->Record(finished_info.remote_engine.GetString(), finished_info.op_type, finished_info.bytes,
+                       TransferTelemetry::NowMicros() - finished_info.start_us);
+  }
   return ret;
 }
 
@@ -43,9 +43,25 @@ Status DirectClientHandler::Create(const HandlerCreateArgs &args, std::unique_pt
                       CommTypeToString(pair.type));
   out = MakeUnique<DirectClientHandler>(handle, args.local_engine, args.remote_engine, pair);
   HIXL_CHECK_NOTNULL(out, "DirectClientHandler create failed");
+  out->InitMultiRail(args);
   return SUCCESS;
 }
 
+void DirectClientHandler::InitMultiRail(const HandlerCreateArgs &args) {
+  if (args.rail_pairs.empty()) {
+    return;
+  }
+  auto multi_rail = MakeUnique<MultiRail>(pair_.type, handle_);
+  if (multi_rail == nullptr || multi_rail->Init(args) != SUCCESS) {
+    HIXL_LOGW("DirectClientHandler create extra rails failed, fall back to single rail, remote_engine:%s",
+              remote_engine_.c_str());
+    return;
+  }
+  if (multi_rail->RailNum() > 1U) {
+    multi_rail_ = std::move(multi_rail);
+  }
+}
+
 Status DirectClientHandler::Connect(uint32_t timeout_ms) {
   std::lock_guard<std::mutex> lock(mutex_);
   if (is_connected_) {
@@ -53,6 +69,9 @@ Status DirectClientHandler::Connect(uint32_t timeout_ms) {
     return ALREADY_CONNECTED;
   }
   Status ret = static_cast<Status>(HixlCSClientConnect(handle_, timeout_ms));
+  if (ret == SUCCESS && multi_rail_ != nullptr) {
+    ret = multi_rail_->Connect(timeout_ms);
+  }
   if (ret == SUCCESS) {
     is_connected_ = true;
   } else {
@@ -72,11 +91,26 @@ Status DirectClientHandler::RegisterMem(const MemHandleInfo &mem_info) {
   HIXL_CHK_STATUS_RET(HixlCSClientRegMem(handle_, nullptr, &hccl_mem, &mem_handle),
                       "DirectClientHandler register memory failed, addr: 0x%lx", mem_info.mem.addr);
   mem_handles_.push_back(mem_handle);
+  if (multi_rail_ != nullptr) {
+    HIXL_CHK_STATUS_RET(multi_rail_->RegisterMem(hccl_mem), "DirectClientHandler register memory on rails failed");
+  }
   return SUCCESS;
 }
 
 Status DirectClientHandler::TransferAsync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
                                           TransferReq &req) {
+  if (multi_rail_ != nullptr) {
+    StripedRequest striped{};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      HIXL_CHK_STATUS_RET(multi_rail_->TransferAsync(op_descs, operation, striped));
+    }
+    // 以首个分片的完成句柄作为请求标识，各链路句柄互不相同
+    req = static_cast<TransferReq>(striped.pending.front().handle);
+    std::lock_guard<std::mutex> ch_lock(complete_handles_mutex_);
+    striped_reqs_[req] = std::move(striped);
+    return SUCCESS;
+  }
   uint32_t list_num = static_cast<uint32_t>(op_descs.size());
   std::vector<HixlOneSideOpDesc> hixl_descs(list_num);
   for (size_t i = 0; i < list_num; i++) {
@@ -102,6 +136,9 @@ Status DirectClientHandler::TransferAsync(const std::vector<TransferOpDesc> &op_
 Status DirectClientHandler::TransferSync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
                                          uint32_t timeout_ms) {
   std::lock_guard<std::mutex> lock(mutex_);
+  if (multi_rail_ != nullptr) {
+    return multi_rail_->TransferSync(op_descs, operation, timeout_ms);
+  }
   uint32_t list_num = static_cast<uint32_t>(op_descs.size());
   std::vector<HixlOneSideOpDesc> hixl_descs(list_num);
   for (size_t i = 0; i < list_num; i++) {
@@ -117,6 +154,10 @@ Status DirectClientHandler::TransferSync(const std::vector<TransferOpDesc> &op_d
 
 Status DirectClientHandler::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
   std::scoped_lock lock(mutex_, complete_handles_mutex_);
+  auto striped_it = striped_reqs_.find(req);
+  if (striped_it != striped_reqs_.end()) {
+    return GetStripedStatus(striped_it, status);
+  }
   if (complete_handles_.empty()) {
     HIXL_LOGE(FAILED, "DirectClientHandler GetTransferStatus failed, no transfer tasks in progress, req:%p", req);
     status = TransferStatus::FAILED;
@@ -149,9 +190,39 @@ Status DirectClientHandler::GetTransferStatus(const TransferReq &req, TransferSt
   return SUCCESS;
 }
 
+bool DirectClientHandler::IsOrderedBefore(const TransferReq &req,
+                                          const std::vector<TransferOpDesc> &later_descs) const {
+  (void)later_descs;
+  // 单链路时所有请求经同一client下发，通道上保序；条带化请求分布在多条链路上，无法保证
+  std::lock_guard<std::mutex> ch_lock(complete_handles_mutex_);
+  return (multi_rail_ == nullptr) && (complete_handles_.find(req) != complete_handles_.end());
+}
+
+Status DirectClientHandler::GetStripedStatus(std::map<TransferReq, StripedRequest>::iterator it,
+                                             TransferStatus &status) {
+  HixlCompleteStatus cs = HIXL_COMPLETE_STATUS_WAITING;
+  Status ret = multi_rail_->Query(it->second, cs);
+  status = (ret == SUCCESS) ? ToTransferStatus(cs) : TransferStatus::FAILED;
+  if (status == TransferStatus::WAITING) {
+    return SUCCESS;
+  }
+  if (status == TransferStatus::FAILED) {
+    HIXL_LOGE(FAILED, "DirectClientHandler striped transfer failed, cs=%d, req:%p", static_cast<int32_t>(cs),
+              it->first);
+    multi_rail_->Dump("striped transfer failed", DumpLogLevel::ERROR);
+  }
+  striped_reqs_.erase(it);
+  return ret;
+}
+
 Status DirectClientHandler::Finalize() {
   std::scoped_lock lock(mutex_, complete_handles_mutex_);
   complete_handles_.clear();
+  striped_reqs_.clear();
+  if (multi_rail_ != nullptr) {
+    multi_rail_->Finalize();
+    multi_rail_.reset();
+  }
   for (auto &mh : mem_handles_) {
     if (mh != nullptr) {
       HixlCSClientUnregMem(handle_, mh);
@@ -176,6 +247,9 @@ void DirectClientHandler::Dump(const char *reason, DumpLogLevel level) const {
               reason, local_engine_.c_str(), remote_engine_.c_str(), handle_, static_cast<int32_t>(is_connected_),
               mem_handles_.size(), complete_handles_.size(), CommTypeToString(pair_.type),
               pair_.local.ToString().c_str(), pair_.remote.ToString().c_str());
+    if (multi_rail_ != nullptr) {
+      multi_rail_->Dump(reason, level);
+    }
     return;
   }
   HIXL_EVENT(
@@ -185,6 +259,9 @@ void DirectClientHandler::Dump(const char *reason, DumpLogLevel level) const {
       reason, local_engine_.c_str(), remote_engine_.c_str(), handle_, static_cast<int32_t>(is_connected_),
       mem_handles_.size(), complete_handles_.size(), CommTypeToString(pair_.type), pair_.local.ToString().c_str(),
       pair_.remote.ToString().c_str());
+  if (multi_rail_ != nullptr) {
+    multi_rail_->Dump(reason, level);
+  }
 }
 
 }  // namespace hixl
@@ -16,6 +16,7 @@
 #include <vector>
 #include "engine/client_handler.h"
 #include "engine/client_handler_factory.h"
+#include "engine/multi_rail.h"
 
 namespace hixl {
 
@@ -29,9 +30,14 @@ class DirectClientHandler : public IClientHandler {
   Status TransferAsync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, TransferReq &req) override;
   Status TransferSync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, uint32_t timeout_ms) override;
   Status GetTransferStatus(const TransferReq &req, TransferStatus &status) override;
+  bool IsOrderedBefore(const TransferReq &req, const std::vector<TransferOpDesc> &later_descs) const override;
   Status Finalize() override;
   void Dump(const char *reason, DumpLogLevel level = DumpLogLevel::EVENT) const override;
 
+ private:
+  void InitMultiRail(const HandlerCreateArgs &args);
+  Status GetStripedStatus(std::map<TransferReq, StripedRequest>::iterator it, TransferStatus &status);
+
  public:
   explicit DirectClientHandler(HixlClientHandle handle, const std::string &local_engine = "",
                                const std::string &remote_engine = "",
@@ -45,6 +51,8 @@ class DirectClientHandler : public IClientHandler {
   bool is_connected_{false};
   std::vector<MemHandle> mem_handles_;
   std::map<TransferReq, CompleteHandle> complete_handles_;
+  std::unique_ptr<MultiRail> multi_rail_;  // 仅在匹配到额外链路时创建
+  std::map<TransferReq, StripedRequest> striped_reqs_;
   mutable std::mutex mutex_;
   mutable std::mutex complete_handles_mutex_;
 };
@@ -33,6 +33,7 @@
 #include "common/hixl_utils.h"
 #include "common/json_utils.h"
 #include "engine/endpoint_generator/local_comm_res_generator_v1.h"
+#include "proxy/hcomm_proxy.h"
 
 namespace hixl {
 
@@ -713,6 +714,9 @@ Status EndpointGenerator::AutoGenEndpointList(const HixlOptions &options, const
 Status EndpointGenerator::ConvertToEndpointDesc(const EndpointConfig &endpoint_config, EndpointDesc &endpoint) {
   HIXL_CHK_STATUS_RET(ParseEndpointPlacement(endpoint_config, endpoint), "ParseEndpointPlacement failed");
   HIXL_CHK_STATUS_RET(ParseEndpointProtocol(endpoint_config, endpoint), "ParseEndpointProtocol failed");
+  if (endpoint_config.loopback) {
+    HcommProxy::MarkLoopbackEndpoint(endpoint);
+  }
   if (endpoint.loc.locType == ENDPOINT_LOC_TYPE_DEVICE) {
     HIXL_CHK_STATUS_RET(FillEndpointDeviceLocation(endpoint_config, endpoint), "FillEndpointDeviceLocation failed");
   }
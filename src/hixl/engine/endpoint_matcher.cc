@@ -10,6 +10,7 @@
 
 #include "engine/endpoint_matcher.h"
 #include <algorithm>
+#include <set>
 #include "common/hixl_checker.h"
 #include "common/hixl_log.h"
 #include "engine/client_handler_factory.h"
@@ -298,4 +299,49 @@ Status EndpointMatcher::MatchEndpoints(const std::vector<EndpointConfig> &local,
   return TryMatchByPriority(local, remote, cross_instance, matched_pairs, handler_type);
 }
 
+void EndpointMatcher::MatchRailPairs(const std::vector<EndpointConfig> &local,
+                                     const std::vector<EndpointConfig> &remote,
+                                     const std::vector<HandlerCreateArgs::EndpointPair> &primary_pairs,
+                                     uint32_t max_rails_per_type,
+                                     std::vector<HandlerCreateArgs::EndpointPair> &rail_pairs) {
+  std::set<std::string> used_local;
+  std::set<std::string> used_remote;
+  for (const auto &pair : primary_pairs) {
+    used_local.insert(pair.local.comm_id);
+    used_remote.insert(pair.remote.comm_id);
+  }
+  auto same_rail_class = [](const EndpointConfig &candidate, const EndpointConfig &primary) {
+    return candidate.protocol == primary.protocol && candidate.placement == primary.placement &&
+           candidate.plane == primary.plane;
+  };
+  for (const auto &primary : primary_pairs) {
+    uint32_t rail_num = 1U;
+    for (const auto &local_ep : local) {
+      if (rail_num >= max_rails_per_type) {
+        break;
+      }
+      if (!same_rail_class(local_ep, primary.local) || used_local.count(local_ep.comm_id) > 0U) {
+        continue;
+      }
+      auto is_peer = [&local_ep, &primary, &used_remote, &same_rail_class](const EndpointConfig &remote_ep) {
+        if (!same_rail_class(remote_ep, primary.remote) || used_remote.count(remote_ep.comm_id) > 0U) {
+          return false;
+        }
+        // UB链路需满足对端dst_eid约束，与TryMatchUb的匹配规则一致
+        return !IsUbProtocol(local_ep.protocol) || remote_ep.dst_eid.empty() || remote_ep.dst_eid == local_ep.comm_id;
+      };
+      auto remote_it = std::find_if(remote.begin(), remote.end(), is_peer);
+      if (remote_it == remote.end()) {
+        continue;
+      }
+      used_local.insert(local_ep.comm_id);
+      used_remote.insert(remote_it->comm_id);
+      rail_pairs.push_back({local_ep, *remote_it, primary.type});
+      ++rail_num;
+      HIXL_EVENT("EndpointMatcher rail pair, comm_type:%s, local_endpoint:{%s}, remote_endpoint:{%s}",
+                 CommTypeToString(primary.type), local_ep.ToString().c_str(), remote_it->ToString().c_str());
+    }
+  }
+}
+
 }  // namespace hixl
@@ -56,6 +56,16 @@ class EndpointMatcher {
                                std::vector<HandlerCreateArgs::EndpointPair> &matched_pairs,
                                HandlerCreateArgs::HandlerType &handler_type);
 
+  /**
+   * @brief 为已匹配的每个endpoint对查找同协议、同placement、同plane的额外endpoint对，用于多链路条带化传输
+   * @param [in] primary_pairs MatchEndpoints的结果，其中的endpoint不会被重复使用
+   * @param [in] max_rails_per_type 每个CommType的链路上限（含主链路）
+   * @param [out] rail_pairs 额外的endpoint对，未找到时为空
+   */
+  static void MatchRailPairs(const std::vector<EndpointConfig> &local, const std::vector<EndpointConfig> &remote,
+                             const std::vector<HandlerCreateArgs::EndpointPair> &primary_pairs,
+                             uint32_t max_rails_per_type, std::vector<HandlerCreateArgs::EndpointPair> &rail_pairs);
+
   // ---------- Type utility functions ----------
   static CommType ParseCommType(const std::string &local, const std::string &remote);
   static bool IsUbProtocol(const std::string &protocol);
@@ -11,12 +11,22 @@
 #ifndef HIXL_SRC_HIXL_ENGINE_ENGINE_H_
 #define HIXL_SRC_HIXL_ENGINE_ENGINE_H_
 
+#include <memory>
+#include <vector>
 #include "hixl/hixl_types.h"
 #include "hixl_options.h"
 
 namespace hixl {
+class TransferTelemetry;
 using CallbackProcessor = std::function<Status(int32_t fd, const char *msg, uint64_t msg_len, bool &keep_fd)>;
 
+// 远端引擎句柄，Engine可派生以缓存解析结果；基类仅记录远端名称
+struct RemoteHandleImpl {
+  explicit RemoteHandleImpl(const AscendString &remote) : remote_engine(remote) {}
+  virtual ~RemoteHandleImpl() = default;
+  AscendString remote_engine;
+};
+
 class Engine {
  public:
   explicit Engine(const AscendString &local_engine) : local_engine_(local_engine.GetString()) {};
@@ -55,10 +65,60 @@ class Engine {
 
   virtual Status GetNotifies(std::vector<NotifyDesc> &notifies) = 0;
 
+  // 未提供批量通道的引擎逐条发送
+  virtual Status SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                              int32_t timeout_in_millis = 1000) {
+    for (const auto &notify : notifies) {
+      const Status ret = SendNotify(remote_engine, notify, timeout_in_millis);
+      if (ret != SUCCESS) {
+        return ret;
+      }
+    }
+    return SUCCESS;
+  }
+
+  virtual Status ConsumeNotifies(const NotifyVisitor &visitor) {
+    std::vector<NotifyDesc> notifies;
+    const Status ret = GetNotifies(notifies);
+    if (ret != SUCCESS) {
+      return ret;
+    }
+    for (const auto &notify : notifies) {
+      visitor(NotifyView{notify.name.GetString(), notify.name.GetLength(), notify.notify_msg.GetString(),
+                         notify.notify_msg.GetLength()});
+    }
+    return SUCCESS;
+  }
+
+  // 未缓存建链资源的引擎仅记录远端名称，经句柄的传输仍按名称走常规路径
+  virtual Status ResolveRemote(const AscendString &remote_engine, int32_t timeout_in_millis,
+                               std::unique_ptr<RemoteHandleImpl> &handle) {
+    (void)timeout_in_millis;
+    handle = std::make_unique<RemoteHandleImpl>(remote_engine);
+    return SUCCESS;
+  }
+
+  virtual Status TransferSyncResolved(const RemoteHandleImpl &handle, TransferOp operation,
+                                      const std::vector<TransferOpDesc> &op_descs, int32_t timeout_in_millis) {
+    return TransferSync(handle.remote_engine, operation, op_descs, timeout_in_millis);
+  }
+
+  virtual Status TransferAsyncResolved(const RemoteHandleImpl &handle, TransferOp operation,
+                                       const std::vector<TransferOpDesc> &op_descs, const TransferArgs &optional_args,
+                                       TransferReq &req) {
+    return TransferAsync(handle.remote_engine, operation, op_descs, optional_args, req);
+  }
+
   virtual Status RegisterCallbackProcessor(int32_t msg_type, CallbackProcessor processor) = 0;
 
+  // 传输统计由各引擎在传输结束时计入，异步请求的起始时间与字节数保存在引擎自身的请求对象中
+  void SetTransferTelemetry(TransferTelemetry *telemetry) {
+    telemetry_ = telemetry;
+  }
+
  protected:
   std::string local_engine_;
+  TransferTelemetry *telemetry_ = nullptr;
 };
 }  // namespace hixl
 
@@ -44,6 +44,14 @@ std::unique_ptr<Engine> EngineFactory::CreateEngine(const std::string local_engi
     return nullptr;
   }
 
+  if (parsed_options.UseLoopbackTransport()) {
+    if (parsed_options.EnableFabricMem().value_or(false)) {
+      HIXL_LOGE(PARAM_INVALID, "[EngineFactory] loopback transport cannot be combined with EnableFabricMem");
+      return nullptr;
+    }
+    LogSelectedEngine("hixl_cs", "transport is loopback", local_engine);
+    return std::make_unique<HixlEngine>(AscendString(local_engine.c_str()));
+  }
   if (parsed_options.EnableFabricMem().value_or(false)) {
     LogSelectedEngine("fabric_mem", "EnableFabricMem is true", local_engine);
     return std::make_unique<FabricMemEngine>(AscendString(local_engine.c_str()));
@@ -20,7 +20,9 @@
 #include "common/hixl_log.h"
 #include "common/hixl_utils.h"
 #include "common/scope_guard.h"
+#include "common/transfer_telemetry.h"
 #include "fabric_mem/fabric_mem_aicpu_transfer_service.h"
+#include "fabric_mem/fabric_mem_allocator.h"
 #include "fabric_mem/fabric_mem_host_transfer_service.h"
 #include "fabric_mem/virtual_memory_manager.h"
 #include "profiling/prof_api_reg.h"
@@ -28,6 +30,7 @@
 namespace hixl {
 namespace {
 constexpr const char BUFFER_POOL_DISABLED[] = "0:0";
+constexpr size_t kBytesPerMB = 1024UL * 1024UL;
 
 Status CheckBufferPoolDisabled(const HixlOptions &options) {
   const auto &raw = options.RawOptions();
@@ -117,6 +120,13 @@ Status FabricMemEngine::InitFabricMem() {
   HIXL_CHK_STATUS_RET(ApplyVirtualMemoryConfig(), "[FabricMemEngine] Failed to apply virtual memory config.");
   HIXL_CHK_STATUS_RET(VirtualMemoryManager::GetInstance().Initialize(),
                       "[FabricMemEngine] Failed to initialize fabric virtual memory manager.");
+  FabricMemCacheConfig cache_config;
+  cache_config.cache_capacity = fabric_mem_config_.cache_capacity;
+  cache_config.reserve_block_size = fabric_mem_config_.reserve_block_size;
+  cache_config.reserve_block_num = fabric_mem_config_.reserve_block_num;
+  HIXL_CHK_STATUS_RET(FabricMemAllocator::Initialize(cache_config),
+                      "[FabricMemEngine] Failed to initialize fabric memory allocation cache.");
+  allocation_cache_config_ = cache_config;
   HIXL_CHK_STATUS_RET(fabric_mem_statistic_.StartPeriodicDump(),
                       "[FabricMemEngine] Failed to start fabric mem statistic dump.");
   HIXL_CHK_STATUS_RET(StartControlServer(), "[FabricMemEngine] Failed to start control server.");
@@ -177,6 +187,9 @@ Status FabricMemEngine::ApplyFabricMemoryOptions(const HixlOptions &options) {
     fabric_mem_config_.start_address_tb = *grc->fabric_memory.start_address;
     fabric_mem_config_.has_start_address_tb = true;
   }
+  fabric_mem_config_.cache_capacity = grc->fabric_memory.cache_capacity.value_or(0U) * kBytesPerMB;
+  fabric_mem_config_.reserve_block_size = grc->fabric_memory.reserve_block_size.value_or(0U) * kBytesPerMB;
+  fabric_mem_config_.reserve_block_num = grc->fabric_memory.reserve_block_num.value_or(0U);
   fabric_mem_config_.enable_aicpu_unfold = grc->fabric_memory.enable_aicpu_unfold.value_or(true);
   if (fabric_mem_config_.enable_aicpu_unfold) {
     // AICPU unfold only supports task_stream_num=1.
@@ -283,12 +296,17 @@ Status FabricMemEngine::TransferSync(const AscendString &remote_engine, Transfer
   HIXL_CHK_BOOL_RET_STATUS(!op_descs.empty(), PARAM_INVALID,
                            "[FabricMemEngine] TransferSync failed, op_descs is empty.");
   HIXL_CHK_STATUS_RET(EnsureAutoConnected(remote_engine), "[FabricMemEngine] Failed to prepare transfer.");
+  const uint64_t start_us = TransferTelemetry::NowMicros();
   const Status ret =
       fabric_mem_transfer_service_->TransferSync(remote_engine.GetString(), operation, op_descs, timeout_in_millis);
   if (ret != SUCCESS) {
     DisconnectOnTransferError(remote_engine);
     return ret;
   }
+  if (telemetry_ != nullptr) {
+    telemetry_->Record(remote_engine.GetString(), operation, TransferTelemetry::TotalBytes(op_descs),
+                       TransferTelemetry::NowMicros() - start_us);
+  }
   return SUCCESS;
 }
 
@@ -331,6 +349,12 @@ Status FabricMemEngine::GetTransferStatus(const TransferReq &req, TransferStatus
       const auto prof_type =
           (poll_info.op_type == READ ? HixlProfType::HixlOpBatchRead : HixlProfType::HixlOpBatchWrite);
       HIXL_API_PROFILING_WITH_TIME(prof_type, poll_info.prof_start_time);
+      if (telemetry_ != nullptr) {
+        const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                   poll_info.transfer_start);
+        telemetry_->Record(poll_info.channel_id, poll_info.op_type, poll_info.transfer_bytes,
+                           static_cast<uint64_t>(latency.count()));
+      }
     }
     if (status == TransferStatus::FAILED) {
       DisconnectOnTransferError(AscendString(poll_info.channel_id.c_str()));
@@ -360,6 +384,9 @@ void FabricMemEngine::CleanupFabricMemLocked() {
       fabric_mem_control_server_.reset();
     }
     local_memory_.Finalize();
+    // Only drops this engine's share of the process-wide cache; other engines keep theirs.
+    FabricMemAllocator::Finalize(allocation_cache_config_);
+    allocation_cache_config_ = FabricMemCacheConfig{};
     fabric_mem_statistic_.StopPeriodicDump();
   }
   if (aclrt_context_ != nullptr) {
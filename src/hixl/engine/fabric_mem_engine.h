@@ -18,6 +18,7 @@
 #include <unordered_set>
 
 #include "engine.h"
+#include "fabric_mem/fabric_mem_allocator.h"
 #include "fabric_mem/fabric_mem_config.h"
 #include "fabric_mem/fabric_mem_control.h"
 #include "fabric_mem/fabric_mem_memory.h"
@@ -79,6 +80,8 @@ class FabricMemEngine : public hixl::Engine {
   std::atomic<bool> is_initialized_{false};
 
   FabricMemConfig fabric_mem_config_;
+  // Cache share acquired from FabricMemAllocator, returned on cleanup.
+  FabricMemCacheConfig allocation_cache_config_;
   FabricMemStatistic fabric_mem_statistic_;
   FabricMemLocalMemory local_memory_;
   std::shared_ptr<FabricMemTransferService> fabric_mem_transfer_service_;
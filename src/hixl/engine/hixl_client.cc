@@ -9,9 +9,12 @@
  */
 
 #include "hixl_client.h"
+#include <algorithm>
 #include <array>
 #include <cerrno>
+#include <chrono>
 #include <cstring>
+#include <thread>
 #include <unistd.h>
 #include "securec.h"
 #include "common/hixl_checker.h"
@@ -19,10 +22,12 @@
 #include "common/hixl_utils.h"
 #include "common/ctrl_msg.h"
 #include "common/ctrl_msg_plugin.h"
+#include "common/notify_slot_ring.h"
 #include "common/scope_guard.h"
 #include "engine/client_handler_factory.h"
 #include "engine/endpoint_generator/endpoint_generator.h"
 #include "engine/endpoint_matcher.h"
+#include "engine/multi_rail.h"
 #include "profiling/prof_api_reg.h"
 #include "nlohmann/json.hpp"
 
@@ -44,10 +49,41 @@ Status ParseNotifyAckResult(const std::string &json_str) {
   return result;
 }
 
+constexpr size_t kNotifyFramePrefixSize = sizeof(CtrlMsgHeader) + sizeof(CtrlMsgType) + sizeof(NotifyBatchHeader);
+constexpr int64_t kNotifySlotCreditPollIntervalUs = 100;
+
 bool IsSocketDisconnectedErrno(int32_t err_no) {
   return err_no == EPIPE || err_no == EBADF || err_no == ECONNRESET || err_no == ENOTCONN || err_no == ESHUTDOWN ||
          err_no == ETIMEDOUT;
 }
+
+// 按字节数将op_descs切分为不超过chunk_size的块，超长的单个op_desc会被拆到多个块中
+void SplitBulkChunks(const std::vector<TransferOpDesc> &op_descs, uint64_t chunk_size,
+                     std::vector<std::vector<TransferOpDesc>> &chunks) {
+  std::vector<TransferOpDesc> chunk;
+  uint64_t chunk_len = 0U;
+  for (const auto &op_desc : op_descs) {
+    if (op_desc.len == 0U) {
+      chunk.emplace_back(op_desc);
+      continue;
+    }
+    size_t offset = 0U;
+    while (offset < op_desc.len) {
+      const size_t len = static_cast<size_t>(std::min<uint64_t>(op_desc.len - offset, chunk_size - chunk_len));
+      chunk.emplace_back(TransferOpDesc{op_desc.local_addr + offset, op_desc.remote_addr + offset, len});
+      offset += len;
+      chunk_len += len;
+      if (chunk_len == chunk_size) {
+        chunks.emplace_back(std::move(chunk));
+        chunk.clear();
+        chunk_len = 0U;
+      }
+    }
+  }
+  if (!chunk.empty()) {
+    chunks.emplace_back(std::move(chunk));
+  }
+}
 }  // namespace
 
 Status HixlClient::Initialize(const std::vector<EndpointConfig> &local_endpoint_list, uint32_t timeout_ms,
@@ -81,16 +117,47 @@ Status HixlClient::Initialize(const std::vector<EndpointConfig> &local_endpoint_
         i, local_engine_.c_str(), remote_engine_.c_str(), CommTypeToString(pair.type), pair.local.ToString().c_str(),
         pair.remote.ToString().c_str());
   }
+  std::vector<HandlerCreateArgs::EndpointPair> rail_pairs;
+  if (enable_multi_rail_) {
+    EndpointMatcher::MatchRailPairs(local_endpoint_list, remote_endpoint_list, matched_pairs, kMaxRailNum,
+                                    rail_pairs);
+    HIXL_EVENT("[HixlClient] multi rail enabled, local_engine:%s, remote_engine:%s, extra_rail_count:%zu",
+               local_engine_.c_str(), remote_engine_.c_str(), rail_pairs.size());
+  }
   HandlerCreateArgs args{
       server_ip_,    server_port_,         rdma_tc_, rdma_sl_,   handler_type, std::move(matched_pairs),
       qos_,          max_active_channels_, is_lazy,  timeout_ms, ctrl_socket_, local_engine_,
-      remote_engine_};
+      remote_engine_, std::move(rail_pairs), host_register_cache_size_};
   client_handler_ = ClientHandlerFactory::Create(args);
   HIXL_CHECK_NOTNULL(client_handler_, "ClientHandlerFactory create handler failed");
+  if (enable_mem_notify_ && InitNotifySlotStaging() != SUCCESS) {
+    HIXL_LOGW("HixlClient init notify slot staging failed, notify falls back to ctrl socket, remote_engine:%s",
+              remote_engine_.c_str());
+    enable_mem_notify_ = false;
+  }
   HIXL_DISMISS_GUARD(close_ctrl_socket);
   return SUCCESS;
 }
 
+Status HixlClient::InitNotifySlotStaging() {
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  HIXL_CHK_BOOL_RET_STATUS(page_size > 0, FAILED, "sysconf(_SC_PAGESIZE) failed, errno=%d", errno);
+  void *staging = nullptr;
+  // Register host mem addr need aligned by page size.
+  int32_t ret = posix_memalign(&staging, static_cast<size_t>(page_size), NotifySlotLayout::RingSize());
+  HIXL_CHK_BOOL_RET_STATUS(ret == 0 && staging != nullptr, FAILED, "Notify slot staging posix_memalign failed, ret:%d",
+                           ret);
+  notify_slot_staging_.reset(static_cast<uint8_t *>(staging));
+  (void)memset_s(staging, NotifySlotLayout::RingSize(), 0, NotifySlotLayout::RingSize());
+  MemHandleInfo mem_info{};
+  mem_info.mem.addr = PtrToValue(staging);
+  mem_info.mem.len = NotifySlotLayout::RingSize();
+  mem_info.type = MEM_HOST;
+  HIXL_CHK_STATUS_RET(client_handler_->RegisterMem(mem_info), "Failed to register notify slot staging, addr:%p",
+                      staging);
+  return SUCCESS;
+}
+
 Status HixlClient::SendEndpointInfoReq(int32_t fd, CtrlMsgType msg_type) const {
   CtrlMsgHeader header{};
   header.magic = kMagicNumber;
@@ -164,6 +231,47 @@ Status HixlClient::Connect(uint32_t timeout_ms) {
   HIXL_EVENT("[HixlClient] connect link success, local_engine:%s, remote_engine:%s, timeout_ms:%u",
              local_engine_.c_str(), remote_engine_.c_str(), timeout_ms);
   LogLinkPairs("connect link success");
+  if (enable_mem_notify_ && AttachNotifySlots(timeout_ms) != SUCCESS) {
+    HIXL_LOGW("[HixlClient] notify slots unavailable, notify falls back to ctrl socket, remote_engine:%s",
+              remote_engine_.c_str());
+    remote_notify_ring_ = 0U;
+  }
+  return SUCCESS;
+}
+
+Status HixlClient::AttachNotifySlots(uint32_t timeout_ms) {
+  CtrlMsgHeader header{kMagicNumber, static_cast<uint64_t>(sizeof(CtrlMsgType) + local_engine_.size())};
+  CtrlMsgType msg_type = CtrlMsgType::kNotifySlotAttachReq;
+  std::vector<uint8_t> req(sizeof(header) + sizeof(msg_type) + local_engine_.size());
+  (void)memcpy_s(req.data(), req.size(), &header, sizeof(header));
+  (void)memcpy_s(req.data() + sizeof(header), req.size() - sizeof(header), &msg_type, sizeof(msg_type));
+  if (!local_engine_.empty()) {
+    (void)memcpy_s(req.data() + sizeof(header) + sizeof(msg_type), req.size() - sizeof(header) - sizeof(msg_type),
+                   local_engine_.data(), local_engine_.size());
+  }
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(ctrl_socket_, req.data(), req.size()),
+                      "HixlClient send NotifySlotAttachReq failed, socket:%d", ctrl_socket_);
+  std::array<uint8_t, sizeof(CtrlMsgHeader) + sizeof(CtrlMsgType) + sizeof(NotifySlotAttachResp)> resp_frame{};
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Recv(ctrl_socket_, resp_frame.data(), resp_frame.size(), timeout_ms),
+                      "HixlClient receive NotifySlotAttachResp failed, socket:%d", ctrl_socket_);
+  NotifySlotAttachResp resp{};
+  (void)memcpy_s(&header, sizeof(header), resp_frame.data(), sizeof(header));
+  (void)memcpy_s(&msg_type, sizeof(msg_type), resp_frame.data() + sizeof(header), sizeof(msg_type));
+  (void)memcpy_s(&resp, sizeof(resp), resp_frame.data() + sizeof(header) + sizeof(msg_type), sizeof(resp));
+  HIXL_CHK_BOOL_RET_STATUS(header.magic == kMagicNumber && msg_type == CtrlMsgType::kNotifySlotAttachResp,
+                           PARAM_INVALID, "Unexpected NotifySlotAttachResp, magic:0x%X, msg_type:%d", header.magic,
+                           static_cast<int32_t>(msg_type));
+  HIXL_CHK_BOOL_RET_STATUS(resp.result == SUCCESS, resp.result, "Remote refused notify slot attach, result:%u",
+                           resp.result);
+  HIXL_CHK_BOOL_RET_STATUS(resp.slot_count == kNotifySlotsPerPeer && resp.slot_size == NotifySlotLayout::SlotSize() &&
+                               resp.ring_addr != 0U,
+                           UNSUPPORTED, "Notify slot layout mismatch, slot_count:%u, slot_size:%" PRIu64,
+                           resp.slot_count, resp.slot_size);
+  remote_notify_ring_ = resp.ring_addr;
+  notify_slot_seq_ = resp.consumed;
+  notify_slot_consumed_ = resp.consumed;
+  HIXL_EVENT("[HixlClient] notify slots attached, remote_engine:%s, ring_addr:0x%lx, seq:%" PRIu64,
+             remote_engine_.c_str(), remote_notify_ring_, notify_slot_seq_);
   return SUCCESS;
 }
 
@@ -175,27 +283,120 @@ Status HixlClient::TransferSync(const std::vector<TransferOpDesc> &op_descs, Tra
   HIXL_CHK_BOOL_RET_STATUS(is_connected_, NOT_CONNECTED, "HixlClient is not connected");
   HIXL_CHK_BOOL_RET_STATUS(!is_finalized_, FAILED, "HixlClient TransferSync rejected, client is finalized");
   HIXL_DISMISSABLE_GUARD(dump_guard, [this]() { client_handler_->Dump("transfer sync failed", DumpLogLevel::ERROR); });
+  const uint64_t start_us = (config_.telemetry_peer != nullptr) ? TransferTelemetry::NowMicros() : 0U;
   Status ret = client_handler_->TransferSync(op_descs, operation, timeout_ms);
   if (ret == SUCCESS) {
     HIXL_DISMISS_GUARD(dump_guard);
+    RecordTransfer(operation, TransferTelemetry::TotalBytes(op_descs), start_us);
+  } else if (ret == TIMEOUT) {
+    ++consecutive_timeouts_;
   }
   return ret;
 }
 
 Status HixlClient::TransferAsync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
-                                 const TransferArgs &, TransferReq &req) {
+                                 const TransferArgs &optional_args, TransferReq &req) {
   std::lock_guard<std::mutex> lock(mutex_);
   HIXL_CHK_BOOL_RET_STATUS(!op_descs.empty(), PARAM_INVALID, "HixlClient TransferAsync failed, op_descs is empty");
   HIXL_CHK_BOOL_RET_STATUS(is_connected_, NOT_CONNECTED, "HixlClient is not connected");
   HIXL_CHK_BOOL_RET_STATUS(client_handler_ != nullptr, FAILED, "HixlClient is not initialized");
-  HIXL_DISMISSABLE_GUARD(dump_guard, [this]() { client_handler_->Dump("transfer async failed", DumpLogLevel::ERROR); });
-  HIXL_CHK_STATUS_RET(client_handler_->TransferAsync(op_descs, operation, req), "HixlClient TransferAsync failed");
-  HIXL_DISMISS_GUARD(dump_guard);
+  const uint64_t start_us = (config_.telemetry_peer != nullptr) ? TransferTelemetry::NowMicros() : 0U;
+  if (optional_args.priority == TransferPriority::BULK) {
+    HIXL_CHK_STATUS_RET(SubmitBulkTransfer(op_descs, operation, req), "HixlClient TransferAsync failed");
+  } else {
+    HIXL_DISMISSABLE_GUARD(dump_guard,
+                           [this]() { client_handler_->Dump("transfer async failed", DumpLogLevel::ERROR); });
+    HIXL_CHK_STATUS_RET(client_handler_->TransferAsync(op_descs, operation, req), "HixlClient TransferAsync failed");
+    HIXL_DISMISS_GUARD(dump_guard);
+  }
   TransferInfo transfer_info = {HixlProfilingReporter::GetSysCycleTime(), operation, AscendString()};
+  transfer_info.priority = optional_args.priority;
+  if (config_.telemetry_peer != nullptr) {
+    transfer_info.bytes = TransferTelemetry::TotalBytes(op_descs);
+    transfer_info.start_us = start_us;
+  }
+  if (transfer_info.priority == TransferPriority::LATENCY_CRITICAL) {
+    ++critical_inflight_;
+  }
   req_map_[req] = transfer_info;
   return SUCCESS;
 }
 
+Status HixlClient::SubmitBulkTransfer(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
+                                      TransferReq &req) {
+  auto bulk = MakeUnique<BulkTransfer>();
+  HIXL_CHECK_NOTNULL(bulk);
+  bulk->operation = operation;
+  SplitBulkChunks(op_descs, bulk_chunk_size_, bulk->chunks);
+  bulk->inflight.reserve(std::min(kBulkInflightChunks, bulk->chunks.size()));
+  // 有时延敏感请求未完成时首批块推迟到其结束后下发
+  HIXL_CHK_STATUS_RET(SubmitBulkChunks(*bulk), "HixlClient submit first bulk chunks failed");
+  req = bulk.get();
+  HIXL_LOGD("HixlClient bulk transfer submitted, req:%p, chunk_num:%zu, chunk_size:%lu", req, bulk->chunks.size(),
+            bulk_chunk_size_);
+  bulk_transfers_[req] = std::move(bulk);
+  return SUCCESS;
+}
+
+// 窗口内保持至多kBulkInflightChunks个块在途，块间不等待调用方查询；flush时下发全部剩余块
+Status HixlClient::SubmitBulkChunks(BulkTransfer &bulk, bool flush) {
+  while ((flush || ((critical_inflight_ == 0U) && (bulk.inflight.size() < kBulkInflightChunks))) &&
+         (bulk.next_chunk < bulk.chunks.size())) {
+    HIXL_DISMISSABLE_GUARD(dump_guard,
+                           [this]() { client_handler_->Dump("transfer bulk chunk failed", DumpLogLevel::ERROR); });
+    TransferReq chunk_req = nullptr;
+    HIXL_CHK_STATUS_RET(client_handler_->TransferAsync(bulk.chunks[bulk.next_chunk], bulk.operation, chunk_req),
+                        "HixlClient transfer bulk chunk failed, chunk:%zu/%zu", bulk.next_chunk, bulk.chunks.size());
+    HIXL_DISMISS_GUARD(dump_guard);
+    bulk.inflight.emplace_back(chunk_req);
+    ++bulk.next_chunk;
+  }
+  return SUCCESS;
+}
+
+Status HixlClient::QueryBulkTransfer(BulkTransfer &bulk, TransferStatus &status) {
+  auto it = bulk.inflight.begin();
+  while (it != bulk.inflight.end()) {
+    TransferStatus chunk_status = TransferStatus::WAITING;
+    const Status ret = client_handler_->GetTransferStatus(*it, chunk_status);
+    if ((ret == SUCCESS) && (chunk_status == TransferStatus::WAITING)) {
+      ++it;
+      continue;
+    }
+    // 查询出错或块结束后client_handler_已释放其请求；失败时不再下发后续块，其余在途块转入回收
+    it = bulk.inflight.erase(it);
+    if ((ret != SUCCESS) || (chunk_status != TransferStatus::COMPLETED)) {
+      ReleaseBulkInflight(bulk);
+      status = chunk_status;
+      HIXL_CHK_STATUS_RET(ret, "HixlClient get bulk chunk status failed, submitted:%zu/%zu", bulk.next_chunk,
+                          bulk.chunks.size());
+      return SUCCESS;
+    }
+  }
+  if ((bulk.next_chunk == bulk.chunks.size()) && bulk.inflight.empty()) {
+    status = TransferStatus::COMPLETED;
+    return SUCCESS;
+  }
+  status = TransferStatus::WAITING;
+  HIXL_CHK_STATUS_RET(SubmitBulkChunks(bulk), "HixlClient submit next bulk chunks failed");
+  return SUCCESS;
+}
+
+// 时延敏感请求全部结束时补齐各BULK请求的在途窗口，不依赖调用方逐个查询BULK请求
+void HixlClient::PumpBulkTransfers() {
+  if ((critical_inflight_ != 0U) || (client_handler_ == nullptr)) {
+    return;
+  }
+  for (auto &kv : bulk_transfers_) {
+    if (fenced_reqs_.find(kv.first) != fenced_reqs_.end()) {
+      continue;
+    }
+    if (SubmitBulkChunks(*kv.second) != SUCCESS) {
+      HIXL_LOGW("HixlClient resume bulk transfer failed, req:%p, reported on its next query", kv.first);
+    }
+  }
+}
+
 Status HixlClient::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
   std::lock_guard<std::mutex> lock(mutex_);
   if (client_handler_ == nullptr) {
@@ -211,11 +412,32 @@ Status HixlClient::GetTransferStatus(const TransferReq &req, TransferStatus &sta
     return PARAM_INVALID;
   }
   transfer_info = it->second;
+  if (!abandoned_chunks_.empty()) {
+    ReapAbandonedChunks();
+  }
+  if (!notify_writes_.empty()) {
+    (void)ReapNotifyWrites();
+  }
+  const auto fenced_it = fenced_reqs_.find(req);
+  if (fenced_it != fenced_reqs_.end()) {
+    status = fenced_it->second;
+    if (status == TransferStatus::COMPLETED) {
+      HixlProfType type =
+          (transfer_info.op_type == READ ? HixlProfType::HixlOpBatchRead : HixlProfType::HixlOpBatchWrite);
+      HIXL_API_PROFILING_WITH_TIME(type, transfer_info.start_time);
+      RecordTransfer(transfer_info.op_type, transfer_info.bytes, transfer_info.start_us);
+    }
+    RemoveTransferReq(req);
+    return SUCCESS;
+  }
 
   HIXL_DISMISSABLE_GUARD(dump_guard,
                          [this]() { client_handler_->Dump("get transfer status failed", DumpLogLevel::ERROR); });
-  Status ret = client_handler_->GetTransferStatus(req, status);
+  auto bulk_it = bulk_transfers_.find(req);
+  Status ret = (bulk_it != bulk_transfers_.end()) ? QueryBulkTransfer(*bulk_it->second, status)
+                                                   : client_handler_->GetTransferStatus(req, status);
   if (ret != SUCCESS) {
+    consecutive_timeouts_ += (ret == TIMEOUT) ? 1U : 0U;
     RemoveTransferReq(req);
     return ret;
   }
@@ -223,6 +445,7 @@ Status HixlClient::GetTransferStatus(const TransferReq &req, TransferStatus &sta
     HixlProfType type =
         (transfer_info.op_type == READ ? HixlProfType::HixlOpBatchRead : HixlProfType::HixlOpBatchWrite);
     HIXL_API_PROFILING_WITH_TIME(type, transfer_info.start_time);
+    RecordTransfer(transfer_info.op_type, transfer_info.bytes, transfer_info.start_us);
     RemoveTransferReq(req);
   } else if (status == TransferStatus::FAILED) {
     RemoveTransferReq(req);
@@ -232,22 +455,103 @@ Status HixlClient::GetTransferStatus(const TransferReq &req, TransferStatus &sta
   return SUCCESS;
 }
 
+// 仅成功的请求计入带宽与时延并清零连续超时计数，失败与超时的请求不计入
+void HixlClient::RecordTransfer(TransferOp operation, uint64_t bytes, uint64_t start_us) {
+  consecutive_timeouts_ = 0U;
+  if (config_.telemetry_peer != nullptr) {
+    TransferTelemetry::Record(*config_.telemetry_peer, operation, bytes, TransferTelemetry::NowMicros() - start_us);
+  }
+}
+
 bool HixlClient::HasTransferReq(const TransferReq &req) const {
   return req_map_.find(req) != req_map_.end();
 }
 
 void HixlClient::ClearTransferReqs() {
+  for (auto &kv : bulk_transfers_) {
+    ReleaseBulkInflight(*kv.second);
+  }
+  abandoned_chunks_.insert(abandoned_chunks_.end(), notify_writes_.begin(), notify_writes_.end());
+  notify_writes_.clear();
+  notify_resync_pending_ = false;
+  ReapAbandonedChunks();
+  if (!abandoned_chunks_.empty()) {
+    HIXL_LOGW("HixlClient %zu bulk chunks or notify writes are still in flight, released when client handler "
+              "finalizes, remote_engine:%s",
+              abandoned_chunks_.size(), remote_engine_.c_str());
+    abandoned_chunks_.clear();
+  }
   req_map_.clear();
+  bulk_transfers_.clear();
+  fenced_reqs_.clear();
+  critical_inflight_ = 0U;
 }
 
 void HixlClient::RemoveTransferReq(const TransferReq &req) {
-  req_map_.erase(req);
+  auto it = req_map_.find(req);
+  if (it == req_map_.end()) {
+    return;
+  }
+  // 已被notify fence收尾的请求在fence时已扣减critical_inflight_
+  bool critical_done = false;
+  if (fenced_reqs_.erase(req) == 0U && it->second.priority == TransferPriority::LATENCY_CRITICAL &&
+      critical_inflight_ > 0U) {
+    --critical_inflight_;
+    critical_done = true;
+  }
+  req_map_.erase(it);
+  const auto bulk_it = bulk_transfers_.find(req);
+  if (bulk_it != bulk_transfers_.end()) {
+    ReleaseBulkInflight(*bulk_it->second);
+    bulk_transfers_.erase(bulk_it);
+  }
+  if (critical_done) {
+    PumpBulkTransfers();
+  }
+}
+
+void HixlClient::ReleaseBulkInflight(BulkTransfer &bulk) {
+  if (client_handler_ == nullptr) {
+    bulk.inflight.clear();
+    return;
+  }
+  // 查询到结束状态时client_handler_随即释放该块，仍未结束的块不能直接丢弃，留待后续查询时回收
+  for (const TransferReq chunk_req : bulk.inflight) {
+    TransferStatus status = TransferStatus::WAITING;
+    if ((client_handler_->GetTransferStatus(chunk_req, status) == SUCCESS) && (status == TransferStatus::WAITING)) {
+      abandoned_chunks_.emplace_back(chunk_req);
+    }
+  }
+  bulk.inflight.clear();
+}
+
+void HixlClient::ReapAbandonedChunks() {
+  if (client_handler_ == nullptr) {
+    return;
+  }
+  auto it = abandoned_chunks_.begin();
+  while (it != abandoned_chunks_.end()) {
+    TransferStatus status = TransferStatus::WAITING;
+    if ((client_handler_->GetTransferStatus(*it, status) == SUCCESS) && (status == TransferStatus::WAITING)) {
+      ++it;
+      continue;
+    }
+    it = abandoned_chunks_.erase(it);
+  }
 }
 
 const std::string &HixlClient::GetRemoteEngine() const {
   return remote_engine_;
 }
 
+uint32_t HixlClient::GetConsecutiveTimeouts() const {
+  return consecutive_timeouts_.load();
+}
+
+const ClientConfig &HixlClient::GetConfig() const {
+  return config_;
+}
+
 void HixlClient::CloseCtrlSocket() {
   if (ctrl_socket_ >= 0) {
     HIXL_LOGI("HixlClient close ctrl socket start, socket:%d", ctrl_socket_);
@@ -263,6 +567,7 @@ Status HixlClient::Finalize() {
     return SUCCESS;
   }
   is_finalized_ = true;
+  remote_notify_ring_ = 0U;
   ClearTransferReqs();
   HIXL_EVENT("[HixlClient] disconnect link start, local_engine:%s, remote_engine:%s", local_engine_.c_str(),
              remote_engine_.c_str());
@@ -366,8 +671,12 @@ Status HixlClient::CheckAlive() {
   return SUCCESS;
 }
 
-Status HixlClient::SendNotify(const NotifyDesc &notify, int32_t timeout_ms) const {
+Status HixlClient::SendNotify(const NotifyDesc &notify, int32_t timeout_ms) {
   std::lock_guard<std::mutex> lock(mutex_);
+  HIXL_CHK_STATUS_RET(PrepareNotifySlots(timeout_ms), "HixlClient prepare notify slots failed");
+  if (remote_notify_ring_ != 0U) {
+    return SendNotifiesBySlots(&notify, 1U, timeout_ms);
+  }
   NotifyMsg notify_msg{notify.name.GetString(), notify.notify_msg.GetString()};
 
   HIXL_CHK_BOOL_RET_STATUS(notify_msg.name.size() <= kMaxNotifyNameLen, PARAM_INVALID,
@@ -404,4 +713,321 @@ Status HixlClient::SendNotify(const NotifyDesc &notify, int32_t timeout_ms) cons
                       "HixlClient receive NotifyAck failed, timeout:%d ms, socket:%d", timeout_ms, ctrl_socket_);
   return SUCCESS;
 }
+
+Status HixlClient::SendNotifyBatchFrame(std::vector<uint8_t> &frame, uint64_t first_seq, uint32_t count) const {
+  CtrlMsgHeader header{kMagicNumber, static_cast<uint64_t>(frame.size() - sizeof(CtrlMsgHeader))};
+  CtrlMsgType msg_type = CtrlMsgType::kNotifyBatch;
+  NotifyBatchHeader batch{first_seq, count, 0U};
+  uint8_t *dst = frame.data();
+  (void)memcpy_s(dst, frame.size(), &header, sizeof(header));
+  (void)memcpy_s(dst + sizeof(header), frame.size() - sizeof(header), &msg_type, sizeof(msg_type));
+  (void)memcpy_s(dst + sizeof(header) + sizeof(msg_type), frame.size() - sizeof(header) - sizeof(msg_type), &batch,
+                 sizeof(batch));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(ctrl_socket_, frame.data(), frame.size()),
+                      "HixlClient send NotifyBatch failed, first_seq:%" PRIu64 ", count:%u, socket:%d", first_seq,
+                      count, ctrl_socket_);
+  return SUCCESS;
+}
+
+Status HixlClient::RecvNotifyBatchAck(int32_t fd, int32_t timeout_ms, std::vector<NotifyRange> &inflight,
+                                      std::vector<NotifyRange> &rejected) const {
+  std::array<uint8_t, sizeof(CtrlMsgHeader) + sizeof(CtrlMsgType) + sizeof(NotifyBatchAck)> ack_frame{};
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Recv(fd, ack_frame.data(), ack_frame.size(), static_cast<uint32_t>(timeout_ms)),
+                      "HixlClient receive NotifyBatchAck failed, fd:%d", fd);
+  CtrlMsgHeader header{};
+  CtrlMsgType msg_type{};
+  NotifyBatchAck ack{};
+  (void)memcpy_s(&header, sizeof(header), ack_frame.data(), sizeof(header));
+  (void)memcpy_s(&msg_type, sizeof(msg_type), ack_frame.data() + sizeof(header), sizeof(msg_type));
+  (void)memcpy_s(&ack, sizeof(ack), ack_frame.data() + sizeof(header) + sizeof(msg_type), sizeof(ack));
+  HIXL_CHK_BOOL_RET_STATUS(header.magic == kMagicNumber, PARAM_INVALID,
+                           "Invalid magic for NotifyBatchAck, expect:0x%X, actual:0x%X", kMagicNumber, header.magic);
+  HIXL_CHK_BOOL_RET_STATUS(msg_type == CtrlMsgType::kNotifyBatchAck &&
+                               header.body_size == sizeof(CtrlMsgType) + sizeof(NotifyBatchAck),
+                           PARAM_INVALID, "Unexpected NotifyBatchAck, msg_type:%d, body_size:%" PRIu64,
+                           static_cast<int32_t>(msg_type), header.body_size);
+  // 服务端并发处理帧，确认可能乱序到达，按first_seq匹配在途帧
+  const auto it = std::find_if(inflight.begin(), inflight.end(),
+                               [&ack](const NotifyRange &range) { return range.first_seq == ack.first_seq; });
+  HIXL_CHK_BOOL_RET_STATUS(it != inflight.end(), PARAM_INVALID, "NotifyBatchAck for unknown first_seq:%" PRIu64,
+                           ack.first_seq);
+  const NotifyRange range = *it;
+  (void)inflight.erase(it);
+  // 服务端整帧入队或整帧拒绝，队列满被拒的帧中没有notify被投递，记录下来只重发这些帧
+  if (ack.result == RESOURCE_EXHAUSTED && ack.accepted == 0U) {
+    HIXL_LOGW("NotifyBatch rejected by server, queue is full, first_seq:%" PRIu64 ", count:%u", ack.first_seq,
+              ack.count);
+    rejected.emplace_back(range);
+    return SUCCESS;
+  }
+  if (ack.result != SUCCESS || ack.accepted != ack.count) {
+    HIXL_LOGE(ack.result, "NotifyBatch rejected by server, first_seq:%" PRIu64 ", count:%u, accepted:%u",
+              ack.first_seq, ack.count, ack.accepted);
+    return (ack.result != SUCCESS) ? ack.result : static_cast<Status>(FAILED);
+  }
+  return SUCCESS;
+}
+
+Status HixlClient::WaitNotifySlotCredit(int32_t timeout_ms, uint32_t &free_slots) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  const std::vector<TransferOpDesc> read_ctrl{
+      {PtrToValue(notify_slot_staging_.get()), remote_notify_ring_, sizeof(NotifySlotCtrl)}};
+  while (notify_slot_seq_ - notify_slot_consumed_ >= kNotifySlotsPerPeer) {
+    // 槽位用尽时单边READ对端已消费序号，不经过控制面
+    HIXL_CHK_STATUS_RET(client_handler_->TransferSync(read_ctrl, READ, static_cast<uint32_t>(timeout_ms)),
+                        "HixlClient read notify slot ctrl failed, remote_engine:%s", remote_engine_.c_str());
+    NotifySlotCtrl ctrl{};
+    (void)memcpy_s(&ctrl, sizeof(ctrl), notify_slot_staging_.get(), sizeof(ctrl));
+    notify_slot_consumed_ = std::max(notify_slot_consumed_, std::min(ctrl.consumed, notify_slot_seq_));
+    if (notify_slot_seq_ - notify_slot_consumed_ < kNotifySlotsPerPeer) {
+      break;
+    }
+    HIXL_CHK_BOOL_RET_STATUS(std::chrono::steady_clock::now() < deadline, TIMEOUT,
+                             "Wait notify slot timeout, remote_engine:%s, seq:%" PRIu64 ", consumed:%" PRIu64
+                             ", timeout:%d ms",
+                             remote_engine_.c_str(), notify_slot_seq_, notify_slot_consumed_, timeout_ms);
+    std::this_thread::sleep_for(std::chrono::microseconds(kNotifySlotCreditPollIntervalUs));
+  }
+  free_slots = static_cast<uint32_t>(kNotifySlotsPerPeer - (notify_slot_seq_ - notify_slot_consumed_));
+  return SUCCESS;
+}
+
+// notify只覆盖此前下发的WRITE请求；与notify同通道保序的请求无需等待，其余须等其结束后notify才能下发
+Status HixlClient::FenceCoveredWrites(const std::vector<TransferOpDesc> &notify_descs, int32_t timeout_ms) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  const auto ordered = [this, &notify_descs](const TransferReq chunk_req) {
+    return client_handler_->IsOrderedBefore(chunk_req, notify_descs);
+  };
+  size_t pending = 0U;
+  do {
+    pending = 0U;
+    for (const auto &kv : req_map_) {
+      const TransferReq req = kv.first;
+      if ((kv.second.op_type != WRITE) || (fenced_reqs_.find(req) != fenced_reqs_.end())) {
+        continue;
+      }
+      TransferStatus status = TransferStatus::WAITING;
+      Status ret = SUCCESS;
+      const auto bulk_it = bulk_transfers_.find(req);
+      if (bulk_it != bulk_transfers_.end()) {
+        // BULK请求未下发的块须先于notify下发，不再受时延敏感请求节流
+        BulkTransfer &bulk = *bulk_it->second;
+        ret = SubmitBulkChunks(bulk, true);
+        if ((ret == SUCCESS) && std::all_of(bulk.inflight.begin(), bulk.inflight.end(), ordered)) {
+          continue;
+        }
+        ret = (ret == SUCCESS) ? QueryBulkTransfer(bulk, status) : ret;
+      } else {
+        if (ordered(req)) {
+          continue;
+        }
+        ret = client_handler_->GetTransferStatus(req, status);
+      }
+      status = (ret == SUCCESS) ? status : TransferStatus::FAILED;
+      if (status == TransferStatus::WAITING) {
+        ++pending;
+        continue;
+      }
+      fenced_reqs_[req] = status;
+      if (kv.second.priority == TransferPriority::LATENCY_CRITICAL && critical_inflight_ > 0U) {
+        --critical_inflight_;
+      }
+    }
+    if (pending > 0U) {
+      HIXL_CHK_BOOL_RET_STATUS(std::chrono::steady_clock::now() < deadline, TIMEOUT,
+                               "Wait covered writes before notify timeout, remote_engine:%s, pending:%zu, "
+                               "timeout:%d ms",
+                               remote_engine_.c_str(), pending, timeout_ms);
+      std::this_thread::sleep_for(std::chrono::microseconds(kNotifySlotCreditPollIntervalUs));
+    }
+  } while (pending > 0U);
+  PumpBulkTransfers();
+  return SUCCESS;
+}
+
+// 回收已结束的notify槽位写，返回是否已全部结束
+bool HixlClient::ReapNotifyWrites() {
+  auto it = notify_writes_.begin();
+  while (it != notify_writes_.end()) {
+    TransferStatus status = TransferStatus::WAITING;
+    const Status ret = client_handler_->GetTransferStatus(*it, status);
+    if ((ret == SUCCESS) && (status == TransferStatus::WAITING)) {
+      ++it;
+      continue;
+    }
+    if ((ret != SUCCESS) || (status != TransferStatus::COMPLETED)) {
+      HIXL_LOGE(FAILED, "HixlClient write notify slots failed, remote_engine:%s, ret:%u, status:%d",
+                remote_engine_.c_str(), ret, static_cast<int32_t>(status));
+      notify_resync_pending_ = true;
+    }
+    it = notify_writes_.erase(it);
+  }
+  return notify_writes_.empty();
+}
+
+// 有槽位写失败时须等其余在途槽位写结束后再重新同步，避免新写入与其落在同一slot
+Status HixlClient::PrepareNotifySlots(int32_t timeout_ms) {
+  if ((remote_notify_ring_ == 0U) || (client_handler_ == nullptr)) {
+    return SUCCESS;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  while (!ReapNotifyWrites() && notify_resync_pending_) {
+    HIXL_CHK_BOOL_RET_STATUS(std::chrono::steady_clock::now() < deadline, TIMEOUT,
+                             "Wait notify slot writes before resync timeout, remote_engine:%s, inflight:%zu, "
+                             "timeout:%d ms",
+                             remote_engine_.c_str(), notify_writes_.size(), timeout_ms);
+    std::this_thread::sleep_for(std::chrono::microseconds(kNotifySlotCreditPollIntervalUs));
+  }
+  if (notify_resync_pending_) {
+    notify_resync_pending_ = false;
+    ResyncNotifySlots(timeout_ms);
+  }
+  return SUCCESS;
+}
+
+void HixlClient::ResyncNotifySlots(int32_t timeout_ms) {
+  // 部分slot可能已写入对端，重新attach后由server转存完整slot并返回消费序号，本端从其后继续写入
+  if (AttachNotifySlots(static_cast<uint32_t>(timeout_ms)) != SUCCESS) {
+    HIXL_LOGW("HixlClient resync notify slots failed, notify falls back to ctrl socket, remote_engine:%s",
+              remote_engine_.c_str());
+    remote_notify_ring_ = 0U;
+  }
+}
+
+Status HixlClient::SendNotifiesBySlots(const NotifyDesc *notifies, size_t count, int32_t timeout_ms) {
+  HIXL_CHK_BOOL_RET_STATUS(client_handler_ != nullptr && is_connected_, NOT_CONNECTED, "HixlClient is not connected");
+  std::vector<TransferOpDesc> op_descs;
+  op_descs.reserve(std::min<size_t>(count, kNotifySlotsPerPeer));
+  uint8_t *staging = notify_slot_staging_.get();
+  size_t index = 0U;
+  bool fenced = false;
+  while (index < count) {
+    uint32_t free_slots = 0U;
+    HIXL_CHK_STATUS_RET(WaitNotifySlotCredit(timeout_ms, free_slots), "HixlClient wait notify slot credit failed");
+    op_descs.clear();
+    for (uint32_t i = 0U; i < free_slots && index < count; ++i, ++index) {
+      const auto &notify = notifies[index];
+      const uint64_t seq = notify_slot_seq_ + op_descs.size() + 1U;
+      const size_t name_len = notify.name.GetLength();
+      const size_t msg_len = notify.notify_msg.GetLength();
+      HIXL_CHK_STATUS_RET(NotifySlotLayout::Encode(staging, seq, notify.name.GetString(), name_len,
+                                                   notify.notify_msg.GetString(), msg_len),
+                          "Notify length invalid, name size:%zu, msg size:%zu", name_len, msg_len);
+      const size_t offset = NotifySlotLayout::SlotOffset(seq);
+      op_descs.emplace_back(TransferOpDesc{PtrToValue(staging + offset), remote_notify_ring_ + offset,
+                                           sizeof(NotifySlotHeader) + name_len + msg_len});
+    }
+    if (!fenced) {
+      HIXL_CHK_STATUS_RET(FenceCoveredWrites(op_descs, timeout_ms), "HixlClient fence writes before notify failed");
+      fenced = true;
+    }
+    // 槽位写排在所覆盖的WRITE之后异步下发，notify不会先于数据可见；staging上的slot在对端消费前不会被复用
+    TransferReq write_req = nullptr;
+    const Status ret = client_handler_->TransferAsync(op_descs, WRITE, write_req);
+    if (ret != SUCCESS) {
+      HIXL_LOGE(ret, "HixlClient write notify slots failed, remote_engine:%s, seq:%" PRIu64 ", count:%zu",
+                remote_engine_.c_str(), notify_slot_seq_, op_descs.size());
+      notify_resync_pending_ = true;
+      return ret;
+    }
+    notify_writes_.emplace_back(write_req);
+    notify_slot_seq_ += op_descs.size();
+  }
+  HIXL_LOGI("HixlClient posted %zu notifies to slots, seq:%" PRIu64 ", remote_engine:%s", count, notify_slot_seq_,
+            remote_engine_.c_str());
+  return SUCCESS;
+}
+
+Status HixlClient::SendNotifyRanges(const std::vector<NotifyDesc> &notifies, const std::vector<NotifyRange> &ranges,
+                                    int32_t timeout_ms, std::vector<NotifyRange> &rejected) {
+  std::vector<NotifyRange> inflight;
+  inflight.reserve(kNotifyBatchAckWindow);
+  Status ret = SUCCESS;
+  for (auto range_it = ranges.begin(); range_it != ranges.end() && ret == SUCCESS; ++range_it) {
+    size_t index = range_it->begin;
+    while (index < range_it->end && ret == SUCCESS) {
+      notify_frame_.resize(kNotifyFramePrefixSize);
+      const NotifyRange frame{index, index, next_notify_seq_};
+      uint32_t count = 0U;
+      while (index < range_it->end && count < kMaxNotifiesPerBatch) {
+        const auto &notify = notifies[index];
+        NotifyBatchEntry entry{static_cast<uint32_t>(notify.name.GetLength()),
+                               static_cast<uint32_t>(notify.notify_msg.GetLength())};
+        const size_t entry_size = sizeof(entry) + entry.name_len + entry.msg_len;
+        if (count > 0U && notify_frame_.size() - sizeof(CtrlMsgHeader) + entry_size > kMaxNotifyBatchBodySize) {
+          break;
+        }
+        const auto *entry_bytes = reinterpret_cast<const uint8_t *>(&entry);
+        const auto *name = reinterpret_cast<const uint8_t *>(notify.name.GetString());
+        const auto *msg = reinterpret_cast<const uint8_t *>(notify.notify_msg.GetString());
+        notify_frame_.insert(notify_frame_.end(), entry_bytes, entry_bytes + sizeof(entry));
+        notify_frame_.insert(notify_frame_.end(), name, name + entry.name_len);
+        notify_frame_.insert(notify_frame_.end(), msg, msg + entry.msg_len);
+        ++count;
+        ++index;
+      }
+      ret = SendNotifyBatchFrame(notify_frame_, frame.first_seq, count);
+      if (ret != SUCCESS) {
+        // 发送失败时不直接返回，先收齐此前已发出帧的确认
+        HIXL_LOGE(ret, "Failed to send NotifyBatch frame, first_seq:%" PRIu64 ", inflight:%zu", frame.first_seq,
+                  inflight.size());
+        break;
+      }
+      next_notify_seq_ += count;
+      inflight.emplace_back(NotifyRange{frame.begin, index, frame.first_seq});
+      if (inflight.size() >= kNotifyBatchAckWindow) {
+        ret = RecvNotifyBatchAck(ctrl_socket_, timeout_ms, inflight, rejected);
+      }
+    }
+  }
+  // 出错后仍收齐在途确认，避免残留的确认帧污染后续控制消息
+  while (!inflight.empty()) {
+    const size_t pending = inflight.size();
+    const Status ack_ret = RecvNotifyBatchAck(ctrl_socket_, timeout_ms, inflight, rejected);
+    ret = (ret == SUCCESS) ? ack_ret : ret;
+    if (inflight.size() == pending) {
+      break;
+    }
+  }
+  return ret;
+}
+
+Status HixlClient::SendNotifies(const std::vector<NotifyDesc> &notifies, int32_t timeout_ms) {
+  // 发送前整体校验，避免部分notify已投递后才因长度非法失败
+  for (const auto &notify : notifies) {
+    HIXL_CHK_BOOL_RET_STATUS(notify.name.GetLength() <= kMaxNotifyNameLen, PARAM_INVALID,
+                             "Notify name length invalid, size:%zu, max:%zu", notify.name.GetLength(),
+                             kMaxNotifyNameLen);
+    HIXL_CHK_BOOL_RET_STATUS(notify.notify_msg.GetLength() <= kMaxNotifyMsgLen, PARAM_INVALID,
+                             "Notify message too long, size:%zu, max:%zu", notify.notify_msg.GetLength(),
+                             kMaxNotifyMsgLen);
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  HIXL_CHK_STATUS_RET(PrepareNotifySlots(timeout_ms), "HixlClient prepare notify slots failed");
+  if (remote_notify_ring_ != 0U) {
+    return SendNotifiesBySlots(notifies.data(), notifies.size(), timeout_ms);
+  }
+  HIXL_CHK_BOOL_RET_STATUS(ctrl_socket_ >= 0, FAILED, "HixlClient SendNotifies failed, ctrl socket is invalid, fd:%d",
+                           ctrl_socket_);
+  // 对端队列满时只重发被整帧拒绝的区间，已接收的notify不会重复投递
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+  std::vector<NotifyRange> ranges{NotifyRange{0U, notifies.size(), 0U}};
+  std::vector<NotifyRange> rejected;
+  while (!ranges.empty()) {
+    rejected.clear();
+    HIXL_CHK_STATUS_RET(SendNotifyRanges(notifies, ranges, timeout_ms, rejected),
+                        "HixlClient SendNotifies failed, timeout:%d ms, socket:%d", timeout_ms, ctrl_socket_);
+    if (!rejected.empty()) {
+      HIXL_CHK_BOOL_RET_STATUS(std::chrono::steady_clock::now() < deadline, RESOURCE_EXHAUSTED,
+                               "HixlClient SendNotifies failed, remote notify queue stays full, rejected frames:%zu, "
+                               "timeout:%d ms",
+                               rejected.size(), timeout_ms);
+      std::this_thread::sleep_for(std::chrono::microseconds(kNotifySlotCreditPollIntervalUs));
+    }
+    ranges.swap(rejected);
+  }
+  HIXL_LOGI("HixlClient sent %zu notifies, next_seq:%" PRIu64 ", socket:%d", notifies.size(), next_notify_seq_,
+            ctrl_socket_);
+  return SUCCESS;
+}
 }  // namespace hixl
@@ -11,8 +11,11 @@
 #ifndef CANN_HIXL_SRC_HIXL_ENGINE_HIXL_CLIENT_H_
 #define CANN_HIXL_SRC_HIXL_ENGINE_HIXL_CLIENT_H_
 
+#include <atomic>
 #include <cstdint>
+#include <cstdlib>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -20,10 +23,13 @@
 #include "cs/hixl_cs.h"
 #include "common/hixl_inner_types.h"
 #include "common/ctrl_msg.h"
+#include "common/transfer_telemetry.h"
 #include "engine/client_handler.h"
 #include "engine/client_handler_factory.h"
 
 namespace hixl {
+constexpr uint64_t kDefaultBulkChunkSize = 4ULL * 1024ULL * 1024ULL;
+constexpr size_t kBulkInflightChunks = 4U;  // 单个BULK请求同时在途的块数
 
 struct ClientConfig {
   std::vector<EndpointConfig> endpoint_list;
@@ -34,7 +40,12 @@ struct ClientConfig {
   uint32_t timeout_ms;
   std::optional<uint8_t> qos;
   std::optional<uint32_t> max_active_channels;
+  std::optional<uint64_t> host_register_cache_size;  // MB
   bool is_lazy = false;
+  bool enable_mem_notify = false;
+  bool enable_multi_rail = false;
+  uint64_t bulk_chunk_size = kDefaultBulkChunkSize;  // BULK请求单块下发的字节数
+  TransferTelemetry::PeerPtr telemetry_peer;         // 该远端的传输统计，为空时不统计
 };
 
 class HixlClient {
@@ -45,14 +56,19 @@ class HixlClient {
    * @param [in] server_port  服务端监听端口号
    */
   HixlClient(const std::string &server_ip, uint32_t server_port, const ClientConfig &config)
-      : server_ip_(server_ip),
+      : config_(config),
+        server_ip_(server_ip),
         server_port_(server_port),
         local_engine_(config.local_engine),
         remote_engine_(config.remote_engine),
         rdma_tc_(config.rdma_tc),
         rdma_sl_(config.rdma_sl),
         qos_(config.qos),
-        max_active_channels_(config.max_active_channels) {}
+        max_active_channels_(config.max_active_channels),
+        host_register_cache_size_(config.host_register_cache_size),
+        enable_mem_notify_(config.enable_mem_notify),
+        enable_multi_rail_(config.enable_multi_rail),
+        bulk_chunk_size_(config.bulk_chunk_size == 0U ? kDefaultBulkChunkSize : config.bulk_chunk_size) {}
   ~HixlClient() = default;
 
   /**
@@ -97,6 +113,7 @@ class HixlClient {
    * @brief 异步传输
    * @param [in] op_descs         批量操作的本地以及远端地址以及写入内存大小，批量操作的个数
    * @param [in] operation        读操作/写操作
+   * @param [in] optional_args    可选参数，BULK优先级的请求按块拆分，随状态查询逐块下发
    * @param [out] req             请求的handle，用于查询请求状态
    * @return 操作结果状态码
    */
@@ -111,22 +128,79 @@ class HixlClient {
    */
   Status GetTransferStatus(const TransferReq &req, TransferStatus &status);
 
-  Status SendNotify(const NotifyDesc &notify, int32_t timeout_ms) const;
+  /**
+   * @brief 发送Notify；服务端开放了notify槽位时以单边WRITE写入对端槽位环，否则经控制面socket发送。
+   *        槽位写与此前下发的WRITE请求同通道时直接排在其后异步下发，不等待完成
+   * @param [in] notify           待发送的Notify
+   * @param [in] timeout_ms       超时时间
+   * @return 操作结果状态码
+   */
+  Status SendNotify(const NotifyDesc &notify, int32_t timeout_ms);
+
+  /**
+   * @brief 批量发送Notify，多个notify打包为kNotifyBatch帧流水发送，按帧序号窗口确认
+   * @param [in] notifies         待发送的Notify列表
+   * @param [in] timeout_ms       等待单个确认帧的超时时间，也是对端队列满时重发被拒帧的时间上限
+   * @return 操作结果状态码
+   */
+  Status SendNotifies(const std::vector<NotifyDesc> &notifies, int32_t timeout_ms);
 
   Status CheckAlive();
 
   const std::string &GetRemoteEngine() const;
 
+  // 创建时的配置，链路重建时沿用其超时与建链方式
+  const ClientConfig &GetConfig() const;
+
+  // 自上次传输成功以来连续超时的次数，用于判断超时是否已升级为链路故障
+  uint32_t GetConsecutiveTimeouts() const;
+
  private:
+  // BULK请求拆分后的下发状态，inflight为已下发未结束的块在client_handler_中的请求，至多kBulkInflightChunks个
+  struct BulkTransfer {
+    TransferOp operation = READ;
+    std::vector<std::vector<TransferOpDesc>> chunks;
+    size_t next_chunk = 0U;
+    std::vector<TransferReq> inflight;
+  };
+
+  // notify列表中[begin, end)区间，已发出时first_seq为所在kNotifyBatch帧的序号
+  struct NotifyRange {
+    size_t begin = 0U;
+    size_t end = 0U;
+    uint64_t first_seq = 0U;
+  };
+
+  Status SubmitBulkTransfer(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, TransferReq &req);
+  Status SubmitBulkChunks(BulkTransfer &bulk, bool flush = false);
+  void PumpBulkTransfers();
+  Status QueryBulkTransfer(BulkTransfer &bulk, TransferStatus &status);
   Status SendEndpointInfoReq(int32_t fd, CtrlMsgType msg_type) const;
   Status RecvEndpointInfoResp(int32_t fd, std::vector<EndpointConfig> &remote_endpoint_list, uint32_t timeout_ms) const;
   Status RecvNotifyAck(int32_t fd, int32_t timeout_ms) const;
+  Status RecvNotifyBatchAck(int32_t fd, int32_t timeout_ms, std::vector<NotifyRange> &inflight,
+                            std::vector<NotifyRange> &rejected) const;
+  Status SendNotifyRanges(const std::vector<NotifyDesc> &notifies, const std::vector<NotifyRange> &ranges,
+                          int32_t timeout_ms, std::vector<NotifyRange> &rejected);
+  Status SendNotifyBatchFrame(std::vector<uint8_t> &frame, uint64_t first_seq, uint32_t count) const;
+  Status InitNotifySlotStaging();
+  Status AttachNotifySlots(uint32_t timeout_ms);
+  Status WaitNotifySlotCredit(int32_t timeout_ms, uint32_t &free_slots);
+  Status FenceCoveredWrites(const std::vector<TransferOpDesc> &notify_descs, int32_t timeout_ms);
+  bool ReapNotifyWrites();
+  Status PrepareNotifySlots(int32_t timeout_ms);
+  void ResyncNotifySlots(int32_t timeout_ms);
+  Status SendNotifiesBySlots(const NotifyDesc *notifies, size_t count, int32_t timeout_ms);
   void CloseCtrlSocket();
   bool HasTransferReq(const TransferReq &req) const;
   void ClearTransferReqs();
   void RemoveTransferReq(const TransferReq &req);
+  void ReleaseBulkInflight(BulkTransfer &bulk);
+  void ReapAbandonedChunks();
   void LogLinkPairs(const char *phase) const;
+  void RecordTransfer(TransferOp operation, uint64_t bytes, uint64_t start_us);
 
+  const ClientConfig config_;
   std::string server_ip_;
   uint32_t server_port_;
   std::string local_engine_;
@@ -136,12 +210,33 @@ class HixlClient {
   bool is_connected_{false};  // true为已建链；false未建链
   bool is_finalized_{false};
   int32_t ctrl_socket_{-1};
+  // 与对端notify槽位环同布局的本地发送缓冲区，需晚于client_handler_析构
+  std::unique_ptr<uint8_t, void (*)(void *)> notify_slot_staging_{nullptr, free};
   std::unique_ptr<IClientHandler> client_handler_;
   std::vector<HandlerCreateArgs::EndpointPair> link_pairs_;
   mutable std::mutex mutex_;  // 所有方法串行执行，不支持并发调用
   std::map<TransferReq, TransferInfo> req_map_;
+  std::map<TransferReq, std::unique_ptr<BulkTransfer>> bulk_transfers_;  // key为返回给调用方的请求handle
+  // 写notify槽位前已等到结束的异步请求及其最终状态，调用方查询时直接返回
+  std::map<TransferReq, TransferStatus> fenced_reqs_;
+  // 所属BULK请求已移除但仍在client_handler_中未结束的块，查询状态时继续回收
+  std::vector<TransferReq> abandoned_chunks_;
+  // 已下发未确认完成的notify槽位写请求，下次发送notify时回收
+  std::vector<TransferReq> notify_writes_;
+  bool notify_resync_pending_{false};  // 有notify槽位写失败，待在途写结束后重新同步槽位
+  uint32_t critical_inflight_{0U};  // 未完成的LATENCY_CRITICAL请求数，非0时BULK请求不下发新块，已在途的块不受影响
+  std::atomic<uint32_t> consecutive_timeouts_{0U};  // 传输成功时清零，链路重建判断时不持mutex_读取
   std::optional<uint8_t> qos_;
   std::optional<uint32_t> max_active_channels_;
+  std::optional<uint64_t> host_register_cache_size_;
+  uint64_t next_notify_seq_{0U};
+  std::vector<uint8_t> notify_frame_;  // kNotifyBatch帧复用缓冲区，受mutex_保护
+  bool enable_mem_notify_{false};
+  bool enable_multi_rail_{false};
+  uint64_t bulk_chunk_size_{kDefaultBulkChunkSize};
+  uint64_t remote_notify_ring_{0U};    // 对端为本端分配的槽位环地址，0表示走控制面socket
+  uint64_t notify_slot_seq_{0U};       // 已写入对端的最大slot seq
+  uint64_t notify_slot_consumed_{0U};  // 最近一次读到的对端已消费slot seq
 };
 
 }  // namespace hixl
@@ -26,6 +26,13 @@ namespace hixl {
 namespace {
 constexpr int32_t kAutoConnectTimeout = 3000;
 constexpr const char BUFFER_POOL_DISABLED[] = "0:0";
+
+// 句柄持有解析时的client，该client被断链或心跳销毁后，经句柄的传输返回NOT_CONNECTED，需重新解析
+struct HixlRemoteHandle : public RemoteHandleImpl {
+  HixlRemoteHandle(const AscendString &remote, ClientPtr client_ptr)
+      : RemoteHandleImpl(remote), client(std::move(client_ptr)) {}
+  ClientPtr client;
+};
 }  // namespace
 
 const std::unordered_set<std::string> HixlEngine::kSupportedOptions = {
@@ -34,7 +41,8 @@ const std::unordered_set<std::string> HixlEngine::kSupportedOptions = {
     OPTION_LOCAL_COMM_RES,        adxl::OPTION_LOCAL_COMM_RES,
     OPTION_BUFFER_POOL,           adxl::OPTION_BUFFER_POOL,
     OPTION_AUTO_CONNECT,          adxl::OPTION_AUTO_CONNECT,
-    OPTION_GLOBAL_RESOURCE_CONFIG};
+    OPTION_GLOBAL_RESOURCE_CONFIG, OPTION_ENABLE_MEM_NOTIFY,
+    OPTION_ENABLE_MULTI_RAIL};
 
 bool HixlEngine::IsInitialized() const {
   return is_initialized_.load(std::memory_order::memory_order_relaxed);
@@ -49,8 +57,10 @@ Status HixlEngine::InitServer(std::optional<uint32_t> listen_port, std::optional
                       "ipv6 should be '[host_ip]:host_port' or '[host_ip]' "
                       "current local_engine:%s",
                       local_engine_.c_str());
-  HIXL_CHK_STATUS_RET(server_.Initialize(ip, port, endpoint_list_, listen_port, max_active_channels),
-                      "[HixlEngine] Failed to initialize HixlEngine, local_engine:%s", local_engine_.c_str());
+  HIXL_CHK_STATUS_RET(
+      server_.Initialize(ip, port, endpoint_list_, listen_port, max_active_channels, enable_mem_notify_,
+                         host_register_cache_size_),
+      "[HixlEngine] Failed to initialize HixlEngine, local_engine:%s", local_engine_.c_str());
   return SUCCESS;
 }
 
@@ -70,17 +80,30 @@ Status HixlEngine::Initialize(const HixlOptions &options) {
   std::string local_comm_res;
   HIXL_CHK_STATUS_RET(EndpointGenerator::BuildEndpointList(options, local_engine_, local_comm_res, endpoint_list_),
                       "[HixlEngine] Failed to build endpoint list from options");
+  if (options.UseLoopbackTransport()) {
+    // 回环后端只做CPU拷贝，device侧endpoint依赖的kernel下发与notify无法模拟；仅本engine的endpoint走回环
+    for (auto &endpoint : endpoint_list_) {
+      HIXL_CHK_BOOL_RET_STATUS(endpoint.placement == kPlacementHost, PARAM_INVALID,
+                               "[HixlEngine] loopback transport only supports host endpoints, got %s:%s",
+                               endpoint.protocol.c_str(), endpoint.placement.c_str());
+      endpoint.loopback = true;
+    }
+  }
   auto global_resource_config = options.GlobalResourceCfg();
   std::optional<uint32_t> listen_port;
   if (global_resource_config.has_value()) {
     listen_port = global_resource_config->comm_resource_config.listen_port;
     qos_ = global_resource_config->comm_resource_config.qos;
     max_active_channels_ = global_resource_config->comm_resource_config.max_active_channels;
+    host_register_cache_size_ = global_resource_config->comm_resource_config.host_register_cache_size;
   } else {
     listen_port.reset();
     qos_.reset();
     max_active_channels_.reset();
+    host_register_cache_size_.reset();
   }
+  enable_mem_notify_ = options.EnableMemNotify().value_or(false);
+  enable_multi_rail_ = options.EnableMultiRail().value_or(false);
   HIXL_CHK_STATUS_RET(aclrt_context_.CreateContext(), "[HixlEngine] Failed to create optional aclrt context");
   HIXL_DISMISSABLE_GUARD(ctx_fail_guard, ([this]() { aclrt_context_.DestroyContext(); }));
   {
@@ -205,8 +228,7 @@ Status HixlEngine::TransferSync(const AscendString &remote_engine, TransferOp op
   if (ret != SUCCESS) {
     HIXL_LOGE(ret, "[HixlEngine] Failed to TransferSync, local_engine:%s, remote_engine:%s, timeout:%d ms",
               local_engine_.c_str(), remote_engine.GetString(), timeout_in_millis);
-    HIXL_CHK_STATUS_RET(AutoDisconnect(remote_engine.GetString(), timeout_in_millis),
-                        "[HixlEngine] Failed to disconnect on error.");
+    HandleTransferFailure(client_ptr, ret);
     return ret;
   }
   HIXL_LOGI("[HixlEngine] Synchronous transmission succeeded, local_engine:%s, remote_engine:%s, timeout:%d ms",
@@ -228,8 +250,7 @@ Status HixlEngine::TransferAsync(const AscendString &remote_engine, TransferOp o
   if (trans_status != SUCCESS) {
     HIXL_LOGE(trans_status, "[HixlEngine] Failed to TransferAsync, local_engine:%s, remote_engine:%s",
               local_engine_.c_str(), remote_engine.GetString());
-    HIXL_CHK_STATUS_RET(AutoDisconnect(remote_engine, kAutoConnectTimeout),
-                        "[HixlEngine] Failed to disconnect on error.");
+    HandleTransferFailure(client_ptr, trans_status);
     return trans_status;
   }
   client_manager_.RegisterTransferReq(req, client_ptr, optional_args.user_data);
@@ -238,6 +259,54 @@ Status HixlEngine::TransferAsync(const AscendString &remote_engine, TransferOp o
   return SUCCESS;
 }
 
+Status HixlEngine::ResolveRemote(const AscendString &remote_engine, int32_t timeout_in_millis,
+                                 std::unique_ptr<RemoteHandleImpl> &handle) {
+  auto with_context = aclrt_context_.GetContextGuard();
+  ClientPtr client_ptr;
+  HIXL_CHK_STATUS_RET(AutoConnect(remote_engine, timeout_in_millis, client_ptr),
+                      "[HixlEngine] Failed to resolve remote, local_engine:%s, remote_engine:%s",
+                      local_engine_.c_str(), remote_engine.GetString());
+  handle = MakeUnique<HixlRemoteHandle>(remote_engine, client_ptr);
+  HIXL_CHECK_NOTNULL(handle, "[HixlEngine] Failed to alloc remote handle, remote_engine:%s", remote_engine.GetString());
+  HIXL_EVENT("[HixlEngine] resolve remote success, local_engine:%s, remote_engine:%s", local_engine_.c_str(),
+             remote_engine.GetString());
+  return SUCCESS;
+}
+
+Status HixlEngine::TransferSyncResolved(const RemoteHandleImpl &handle, TransferOp operation,
+                                        const std::vector<TransferOpDesc> &op_descs, int32_t timeout_in_millis) {
+  HIXL_CHK_STATUS_RET(CheckInitialized(), "[HixlEngine] Failed to TransferSync, engine is not initialized");
+  const auto &resolved = static_cast<const HixlRemoteHandle &>(handle);
+  auto with_context = aclrt_context_.GetContextGuardIfNeeded();
+  HixlProfType type = (operation == READ ? HixlProfType::HixlOpBatchRead : HixlProfType::HixlOpBatchWrite);
+  HIXL_API_PROFILING(type);
+  const Status ret = resolved.client->TransferSync(op_descs, operation, timeout_in_millis);
+  if (ret != SUCCESS) {
+    HIXL_LOGE(ret,
+              "[HixlEngine] Failed to TransferSync through handle, local_engine:%s, remote_engine:%s, timeout:%d ms",
+              local_engine_.c_str(), resolved.remote_engine.GetString(), timeout_in_millis);
+    HandleTransferFailure(resolved.client, ret);
+  }
+  return ret;
+}
+
+Status HixlEngine::TransferAsyncResolved(const RemoteHandleImpl &handle, TransferOp operation,
+                                         const std::vector<TransferOpDesc> &op_descs,
+                                         const TransferArgs &optional_args, TransferReq &req) {
+  HIXL_CHK_STATUS_RET(CheckInitialized(), "[HixlEngine] Failed to TransferAsync, engine is not initialized");
+  const auto &resolved = static_cast<const HixlRemoteHandle &>(handle);
+  auto with_context = aclrt_context_.GetContextGuardIfNeeded();
+  const Status ret = resolved.client->TransferAsync(op_descs, operation, optional_args, req);
+  if (ret != SUCCESS) {
+    HIXL_LOGE(ret, "[HixlEngine] Failed to TransferAsync through handle, local_engine:%s, remote_engine:%s",
+              local_engine_.c_str(), resolved.remote_engine.GetString());
+    HandleTransferFailure(resolved.client, ret);
+    return ret;
+  }
+  client_manager_.RegisterTransferReq(req, resolved.client, optional_args.user_data);
+  return SUCCESS;
+}
+
 Status HixlEngine::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
   ClientPtr client = client_manager_.GetClientByReq(req);
   if (client == nullptr) {
@@ -250,8 +319,7 @@ Status HixlEngine::GetTransferStatus(const TransferReq &req, TransferStatus &sta
     HIXL_LOGE(ret, "[HixlEngine] Failed to get status through client, local_engine:%s, req:%p, status:%d",
               local_engine_.c_str(), req, static_cast<int32_t>(status));
     client_manager_.EraseTransferReq(req);
-    HIXL_CHK_STATUS_RET(AutoDisconnect(AscendString(client->GetRemoteEngine().c_str()), kAutoConnectTimeout),
-                        "[HixlEngine] Failed to disconnect on error.");
+    HandleTransferFailure(client, ret);
     return ret;
   }
   if (status != TransferStatus::WAITING) {
@@ -267,7 +335,8 @@ Status HixlEngine::GetTransferStatus(const GetTransferStatusArgs &args, std::vec
   }
   auto reqs = client_manager_.GetOrderedReqs(0);
   results.reserve(reqs.size());
-  std::unordered_set<std::string> disconnected_engines;
+  // 已判定链路故障的远端，其余请求直接置为FAILED，不再逐个查询
+  std::unordered_set<std::string> faulted_engines;
   for (const auto &it : reqs) {
     TransferReq req = it.req;
     ClientPtr client = it.client;
@@ -276,7 +345,7 @@ Status HixlEngine::GetTransferStatus(const GetTransferStatusArgs &args, std::vec
       continue;
     }
     const std::string remote_engine = client->GetRemoteEngine();
-    if (disconnected_engines.count(remote_engine) != 0U) {
+    if (faulted_engines.count(remote_engine) != 0U) {
       client_manager_.EraseTransferReq(req);
       results.emplace_back(TransferResult{req, it.user_data, TransferStatus::FAILED});
       if (results.size() >= static_cast<size_t>(args.max_query_count)) {
@@ -290,8 +359,9 @@ Status HixlEngine::GetTransferStatus(const GetTransferStatusArgs &args, std::vec
     if (ret != SUCCESS) {
       HIXL_LOGE(ret, "[HixlEngine] Failed to get status through client, local_engine:%s, req:%p, status:%d",
                 local_engine_.c_str(), req, static_cast<int32_t>(status));
-      if (disconnected_engines.insert(remote_engine).second) {
-        (void)AutoDisconnect(AscendString(remote_engine.c_str()), kAutoConnectTimeout);
+      const FailureScope scope = ClassifyTransferFailure(ret, client->GetConsecutiveTimeouts());
+      if ((scope == FailureScope::kChannel) && faulted_engines.insert(remote_engine).second) {
+        HandleTransferFailure(client, ret);
       }
     }
     if (status != TransferStatus::WAITING) {
@@ -348,6 +418,27 @@ Status HixlEngine::GetNotifies(std::vector<NotifyDesc> &notifies) {
   return SUCCESS;
 }
 
+Status HixlEngine::SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                                int32_t timeout_in_millis) {
+  HIXL_LOGI("[HixlEngine] SendNotifies started, local_engine:%s, remote_engine:%s, count:%zu, timeout:%d ms",
+            local_engine_.c_str(), remote_engine.GetString(), notifies.size(), timeout_in_millis);
+  auto with_context = aclrt_context_.GetContextGuard();
+  ClientPtr client_ptr = client_manager_.GetClient(remote_engine.GetString());
+  HIXL_CHK_BOOL_RET_STATUS(client_ptr != nullptr, NOT_CONNECTED,
+                           "[HixlEngine] Failed to get client, remote_engine:%s is not connected",
+                           remote_engine.GetString());
+  HIXL_CHK_STATUS_RET(client_ptr->SendNotifies(notifies, timeout_in_millis),
+                      "[HixlEngine] Failed to SendNotifies, local_engine:%s, remote_engine:%s, count:%zu",
+                      local_engine_.c_str(), remote_engine.GetString(), notifies.size());
+  return SUCCESS;
+}
+
+Status HixlEngine::ConsumeNotifies(const NotifyVisitor &visitor) {
+  HIXL_CHK_STATUS_RET(server_.ConsumeNotifies(visitor),
+                      "[HixlEngine] Failed to consume notifies from server, local_engine:%s", local_engine_.c_str());
+  return SUCCESS;
+}
+
 Status HixlEngine::RegisterCallbackProcessor(int32_t msg_type, CallbackProcessor processor) {
   auto with_context = aclrt_context_.GetContextGuard();
   HIXL_CHK_STATUS_RET(server_.RegisterCallbackProcessor(msg_type, processor),
@@ -371,7 +462,10 @@ void HixlEngine::FillClientConfigFields(const AscendString &remote_engine, Clien
   config.timeout_ms = static_cast<uint32_t>(timeout_in_millis);
   config.qos = qos_;
   config.max_active_channels = max_active_channels_;
+  config.host_register_cache_size = host_register_cache_size_;
   config.is_lazy = is_lazy;
+  config.enable_mem_notify = enable_mem_notify_;
+  config.enable_multi_rail = enable_multi_rail_;
 }
 
 void HixlEngine::CopyMemInfoListLocked(std::vector<MemHandleInfo> &mem_info_list) const {
@@ -384,6 +478,9 @@ Status HixlEngine::AutoConnect(const AscendString &remote_engine, int32_t timeou
   HIXL_CHK_STATUS_RET(CheckInitialized(), "[HixlEngine] Failed to auto connect, engine is not initialized");
   if (!auto_connect_) {
     client_ptr = client_manager_.GetClient(remote_engine.GetString());
+    // 链路故障后正在后台重建时，等待重建完成后再发起请求
+    client_ptr = (client_ptr != nullptr) ? client_ptr
+                                         : client_manager_.AwaitClient(remote_engine.GetString(), timeout_in_millis);
     HIXL_CHK_BOOL_RET_STATUS(client_ptr != nullptr, NOT_CONNECTED,
                              "[HixlEngine] Failed to get client through remote engine, please check connection. "
                              "local_engine:%s, remote_engine:%s",
@@ -415,19 +512,36 @@ Status HixlEngine::AutoConnect(const AscendString &remote_engine, int32_t timeou
 void HixlEngine::BuildClientConfig(const AscendString &remote_engine, ClientConfig &config,
                                    std::vector<MemHandleInfo> &mem_info_list, int32_t timeout_in_millis) const {
   FillClientConfigFields(remote_engine, config, timeout_in_millis, auto_connect_);
+  // 远端计数随client缓存，传输路径不再按名称查找
+  if (telemetry_ != nullptr) {
+    config.telemetry_peer = telemetry_->GetPeer(remote_engine.GetString());
+  }
   std::lock_guard<std::mutex> lock(mutex_);
   CopyMemInfoListLocked(mem_info_list);
 }
 
-Status HixlEngine::AutoDisconnect(const AscendString &remote_engine, int32_t timeout_in_millis) {
-  if (auto_connect_) {
-    if (client_manager_.GetClient(remote_engine.GetString()) == nullptr) {
-      return SUCCESS;
-    }
-    HIXL_CHK_STATUS_RET(Disconnect(remote_engine, timeout_in_millis),
-                        "[HixlEngine] Failed to disconnect on error, remote_engine:%s, timeout:%d ms",
-                        remote_engine.GetString(), timeout_in_millis);
+void HixlEngine::HandleTransferFailure(const ClientPtr &client_ptr, Status ret) {
+  const std::string &remote_engine = client_ptr->GetRemoteEngine();
+  if (ClassifyTransferFailure(ret, client_ptr->GetConsecutiveTimeouts()) == FailureScope::kRequest) {
+    HIXL_LOGW("[HixlEngine] request level failure, keep connection, local_engine:%s, remote_engine:%s, ret:%u",
+              local_engine_.c_str(), remote_engine.c_str(), static_cast<uint32_t>(ret));
+    return;
+  }
+  // 内存信息在当前线程准备好，重建线程不再获取mutex_，Finalize持锁等待重建线程退出时不会死锁
+  std::vector<MemHandleInfo> mem_info_list;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CopyMemInfoListLocked(mem_info_list);
+  }
+  auto prepare = [this]() -> Status {
+    HIXL_CHK_STATUS_RET(aclrt_context_.SetCurrentContext(), "[HixlEngine] Failed to set context before rebuild");
+    return SUCCESS;
+  };
+  // 重建只替换仍在使用的client，过期句柄或已被断开的链路不会触发重建
+  const bool started = client_manager_.RebuildClientAsync(client_ptr, std::move(mem_info_list), std::move(prepare));
+  if (started) {
+    HIXL_LOGW("[HixlEngine] channel level failure, rebuild connection, local_engine:%s, remote_engine:%s, ret:%u",
+              local_engine_.c_str(), remote_engine.c_str(), static_cast<uint32_t>(ret));
   }
-  return SUCCESS;
 }
 }  // namespace hixl
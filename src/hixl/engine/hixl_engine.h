@@ -151,8 +151,59 @@ class HixlEngine : public hixl::Engine {
    */
   Status GetNotifies(std::vector<NotifyDesc> &notifies) override;
 
+  /**
+   * @brief Client向Server批量发送Notify信息，多条notify合帧流水发送，不逐条等待确认
+   * @param [in] remote_engine 远端HixlEngine的唯一标识
+   * @param [in] notifies 要发送的Notify列表
+   * @param [in] timeout_in_millis 等待单个确认帧的超时时间，单位ms
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                      int32_t timeout_in_millis = 1000) override;
+
+  /**
+   * @brief 免拷贝地遍历并清空当前HixlServer收到的Notify信息
+   * @param [in] visitor 逐条回调，NotifyView仅在回调期间有效
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status ConsumeNotifies(const NotifyVisitor &visitor) override;
+
   Status RegisterCallbackProcessor(int32_t msg_type, CallbackProcessor processor) override;
 
+  /**
+   * @brief 将远端HixlEngine解析为句柄，句柄持有已建链的client，开启自动建链时按需建链
+   * @param [in] remote_engine 远端HixlEngine的唯一标识
+   * @param [in] timeout_in_millis 自动建链的超时时间，单位ms
+   * @param [out] handle 解析得到的句柄
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status ResolveRemote(const AscendString &remote_engine, int32_t timeout_in_millis,
+                       std::unique_ptr<RemoteHandleImpl> &handle) override;
+
+  /**
+   * @brief 经句柄同步传输，直接使用句柄持有的client，不查找client、不自动建链、不打印INFO日志
+   * @param [in] handle ResolveRemote得到的句柄
+   * @param [in] operation 将远端内存读到本地或者将本地内存写到远端
+   * @param [in] op_descs 批量操作的本地以及远端地址
+   * @param [in] timeout_in_millis 传输的超时时间，单位ms
+   * @return 成功:SUCCESS, 链路已断开:NOT_CONNECTED, 失败:其它.
+   */
+  Status TransferSyncResolved(const RemoteHandleImpl &handle, TransferOp operation,
+                              const std::vector<TransferOpDesc> &op_descs, int32_t timeout_in_millis) override;
+
+  /**
+   * @brief 经句柄异步传输，下发传输请求，约束同TransferSyncResolved
+   * @param [in] handle ResolveRemote得到的句柄
+   * @param [in] operation 将远端内存读到本地或者将本地内存写到远端
+   * @param [in] op_descs 批量操作的本地以及远端地址
+   * @param [in] optional_args 可选参数
+   * @param [out] req 请求的handle，用于查询请求状态
+   * @return 成功:SUCCESS, 链路已断开:NOT_CONNECTED, 失败:其它.
+   */
+  Status TransferAsyncResolved(const RemoteHandleImpl &handle, TransferOp operation,
+                               const std::vector<TransferOpDesc> &op_descs, const TransferArgs &optional_args,
+                               TransferReq &req) override;
+
   /**
    * @brief Hixl资源清理函数
    */
@@ -162,13 +213,14 @@ class HixlEngine : public hixl::Engine {
   static const std::unordered_set<std::string> kSupportedOptions;
   Status InitServer(std::optional<uint32_t> listen_port, std::optional<uint32_t> max_active_channels);
   Status CheckInitialized() const;
-  Status AutoDisconnect(const AscendString &remote_engine, int32_t timeout_in_millis);
   void BuildClientConfig(const AscendString &remote_engine, ClientConfig &config,
                          std::vector<MemHandleInfo> &mem_info_list, int32_t timeout_in_millis) const;
   void FillClientConfigFields(const AscendString &remote_engine, ClientConfig &config, int32_t timeout_in_millis,
                               bool is_lazy) const;
   void CopyMemInfoListLocked(std::vector<MemHandleInfo> &mem_info_list) const;
   Status AutoConnect(const AscendString &remote_engine, int32_t timeout_in_millis, ClientPtr &client_ptr);
+  // 按失败范围处理：请求级错误保留链路，链路级故障在后台重建链路
+  void HandleTransferFailure(const ClientPtr &client_ptr, Status ret);
   mutable std::mutex mutex_;
 
   std::atomic<bool> is_initialized_;
@@ -180,8 +232,11 @@ class HixlEngine : public hixl::Engine {
   uint8_t rdma_traffic_class_{kRdmaTrafficClass};
   uint8_t rdma_service_level_{kRdmaServiceLevel};
   std::atomic<bool> auto_connect_{false};
+  bool enable_mem_notify_ = false;
+  bool enable_multi_rail_ = false;
   std::optional<uint8_t> qos_;
   std::optional<uint32_t> max_active_channels_;
+  std::optional<uint64_t> host_register_cache_size_;  // MB，仅作用于本engine的server与client endpoint
   OptionalAclrtContext aclrt_context_;
 };
 }  // namespace hixl
@@ -9,9 +9,11 @@
  */
 
 #include <mutex>
+#include <unordered_map>
 #include "hixl/hixl.h"
 #include "common/hixl_checker.h"
 #include "common/hixl_utils.h"
+#include "common/transfer_telemetry.h"
 #include "comm_engine.h"
 #include "base/err_msg.h"
 #include "connect_pool_executor.h"
@@ -64,6 +66,16 @@ class Hixl::HixlImpl {
                        const std::vector<TransferOpDesc> &op_descs, const TransferArgs &optional_args,
                        TransferReq &req);
 
+  Status ResolveRemote(const AscendString &remote_engine, RemoteHandle &handle, int32_t timeout_in_millis);
+
+  Status ReleaseRemote(RemoteHandle handle);
+
+  Status TransferSync(RemoteHandle handle, TransferOp operation, const std::vector<TransferOpDesc> &op_descs,
+                      int32_t timeout_in_millis);
+
+  Status TransferAsync(RemoteHandle handle, TransferOp operation, const std::vector<TransferOpDesc> &op_descs,
+                       const TransferArgs &optional_args, TransferReq &req);
+
   Status GetTransferStatus(const TransferReq &req, TransferStatus &status);
 
   Status GetTransferStatus(const GetTransferStatusArgs &args, std::vector<TransferResult> &results);
@@ -72,11 +84,23 @@ class Hixl::HixlImpl {
 
   Status GetNotifies(std::vector<NotifyDesc> &notifies);
 
+  Status SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                      uint32_t timeout_in_millis);
+
+  Status ConsumeNotifies(const NotifyVisitor &visitor);
+
+  Status GetTransferStatistics(const AscendString &remote_engine, PeerTransferStatistics &statistics) const;
+
  private:
   std::mutex mutex_;
   std::string local_engine_;
+  // 声明在engine_之前，引擎析构时统计仍有效
+  TransferTelemetry telemetry_;
   std::unique_ptr<Engine> engine_ = nullptr;
   ConnectPoolExecutor connect_pool_executor_;
+  // ResolveRemote创建的句柄，仅在解析/释放时加锁，传输路径不查表
+  std::mutex remote_handles_mutex_;
+  std::unordered_map<RemoteHandle, std::unique_ptr<RemoteHandleImpl>> remote_handles_;
 };
 
 Status Hixl::HixlImpl::Initialize(const std::map<AscendString, AscendString> &options) {
@@ -88,6 +112,7 @@ Status Hixl::HixlImpl::Initialize(const std::map<AscendString, AscendString> &op
   engine_ = hixl::EngineFactory::CreateEngine(local_engine_, options, parsed_options);
   HIXL_CHECK_NOTNULL(engine_, "[HixlEngine] Created engine is null, please check your parameters! local_engine:%s",
                      local_engine_.c_str());
+  engine_->SetTransferTelemetry(&telemetry_);
   HIXL_CHK_STATUS_RET(engine_->Initialize(parsed_options), "Failed to initialize Hixl.");
   Status ret = connect_pool_executor_.Initialize(parsed_options);
   if (ret != SUCCESS) {
@@ -107,6 +132,8 @@ void Hixl::HixlImpl::Finalize() {
   connect_pool_executor_.Shutdown();
   engine_->Finalize();
   engine_.reset();
+  std::lock_guard<std::mutex> lock(remote_handles_mutex_);
+  remote_handles_.clear();
 }
 
 Status Hixl::HixlImpl::RegisterMem(const MemDesc &mem, MemType type, MemHandle &mem_handle) {
@@ -141,6 +168,7 @@ Status Hixl::HixlImpl::Disconnect(const AscendString &remote_engine, int32_t tim
   HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
   HIXL_CHK_BOOL_RET_STATUS(engine_->IsInitialized(), FAILED, "Hixl is not initialized");
   HIXL_CHK_STATUS_RET(engine_->Disconnect(remote_engine, timeout_in_millis), "Failed to disconnect");
+  telemetry_.Remove(remote_engine.GetString());
   return SUCCESS;
 }
 
@@ -202,6 +230,48 @@ Status Hixl::HixlImpl::TransferAsync(const AscendString &remote_engine, Transfer
   return SUCCESS;
 }
 
+Status Hixl::HixlImpl::ResolveRemote(const AscendString &remote_engine, RemoteHandle &handle,
+                                     int32_t timeout_in_millis) {
+  HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
+  HIXL_CHK_BOOL_RET_STATUS(engine_->IsInitialized(), FAILED, "Hixl is not initialized");
+  std::unique_ptr<RemoteHandleImpl> handle_impl;
+  HIXL_CHK_STATUS_RET(engine_->ResolveRemote(remote_engine, timeout_in_millis, handle_impl),
+                      "Failed to resolve remote engine:%s", remote_engine.GetString());
+  HIXL_CHECK_NOTNULL(handle_impl, "Resolved handle is null, remote engine:%s", remote_engine.GetString());
+  handle = handle_impl.get();
+  std::lock_guard<std::mutex> lock(remote_handles_mutex_);
+  remote_handles_[handle] = std::move(handle_impl);
+  return SUCCESS;
+}
+
+Status Hixl::HixlImpl::ReleaseRemote(RemoteHandle handle) {
+  std::lock_guard<std::mutex> lock(remote_handles_mutex_);
+  HIXL_CHK_BOOL_RET_STATUS(remote_handles_.erase(handle) != 0U, PARAM_INVALID,
+                           "Remote handle:%p is not found, it may have been released", handle);
+  return SUCCESS;
+}
+
+Status Hixl::HixlImpl::TransferSync(RemoteHandle handle, TransferOp operation,
+                                    const std::vector<TransferOpDesc> &op_descs, int32_t timeout_in_millis) {
+  HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
+  HIXL_CHK_BOOL_RET_STATUS(handle != nullptr, PARAM_INVALID, "remote handle can not be null");
+  HIXL_CHK_STATUS_RET(CheckTransferOpDescs(op_descs), "Failed to check transfer op descs");
+  HIXL_CHK_STATUS_RET(engine_->TransferSyncResolved(*handle, operation, op_descs, timeout_in_millis),
+                      "Failed to transfer sync, remote_engine:%s", handle->remote_engine.GetString());
+  return SUCCESS;
+}
+
+Status Hixl::HixlImpl::TransferAsync(RemoteHandle handle, TransferOp operation,
+                                     const std::vector<TransferOpDesc> &op_descs, const TransferArgs &optional_args,
+                                     TransferReq &req) {
+  HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
+  HIXL_CHK_BOOL_RET_STATUS(handle != nullptr, PARAM_INVALID, "remote handle can not be null");
+  HIXL_CHK_STATUS_RET(CheckTransferOpDescs(op_descs), "Failed to check transfer op descs.");
+  HIXL_CHK_STATUS_RET(engine_->TransferAsyncResolved(*handle, operation, op_descs, optional_args, req),
+                      "Failed to transfer request async, remote_engine:%s", handle->remote_engine.GetString());
+  return SUCCESS;
+}
+
 Status Hixl::HixlImpl::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
   HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
   TransferStatus transfer_status = TransferStatus::WAITING;
@@ -221,6 +291,13 @@ Status Hixl::HixlImpl::GetTransferStatus(const GetTransferStatusArgs &args, std:
   return SUCCESS;
 }
 
+Status Hixl::HixlImpl::GetTransferStatistics(const AscendString &remote_engine,
+                                             PeerTransferStatistics &statistics) const {
+  HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
+  statistics = telemetry_.Query(remote_engine.GetString());
+  return SUCCESS;
+}
+
 Status Hixl::HixlImpl::SendNotify(const AscendString &remote_engine, const NotifyDesc &notify,
                                   uint32_t timeout_in_millis) {
   HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
@@ -237,6 +314,22 @@ Status Hixl::HixlImpl::GetNotifies(std::vector<NotifyDesc> &notifies) {
   return SUCCESS;
 }
 
+Status Hixl::HixlImpl::SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                                    uint32_t timeout_in_millis) {
+  HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
+  HIXL_CHK_BOOL_RET_STATUS(engine_->IsInitialized(), FAILED, "Hixl is not initialized");
+  HIXL_CHK_STATUS_RET(engine_->SendNotifies(remote_engine, notifies, static_cast<int32_t>(timeout_in_millis)),
+                      "Failed to send notifies to remote engine:%s", remote_engine.GetString());
+  return SUCCESS;
+}
+
+Status Hixl::HixlImpl::ConsumeNotifies(const NotifyVisitor &visitor) {
+  HIXL_CHK_BOOL_RET_STATUS(engine_ != nullptr, FAILED, "engine is nullptr, check engine init");
+  HIXL_CHK_BOOL_RET_STATUS(engine_->IsInitialized(), FAILED, "Hixl is not initialized");
+  HIXL_CHK_STATUS_RET(engine_->ConsumeNotifies(visitor), "Failed to consume notifies");
+  return SUCCESS;
+}
+
 Hixl::Hixl() {}
 
 Hixl::~Hixl() {
@@ -383,6 +476,44 @@ Status Hixl::TransferAsync(const AscendString &remote_engine, TransferOp operati
   return SUCCESS;
 }
 
+Status Hixl::ResolveRemote(const AscendString &remote_engine, RemoteHandle &handle, int32_t timeout_in_millis) {
+  HIXL_LOGI("ResolveRemote start, remote engine:%s, timeout:%d ms", remote_engine.GetString(), timeout_in_millis);
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
+  HIXL_CHK_BOOL_RET_STATUS(timeout_in_millis > 0, PARAM_INVALID, "timeout_in_millis:%d must > 0", timeout_in_millis);
+  HIXL_CHK_STATUS_RET(impl_->ResolveRemote(remote_engine, handle, timeout_in_millis),
+                      "Failed to resolve remote, remote engine:%s, timeout:%d ms", remote_engine.GetString(),
+                      timeout_in_millis);
+  HIXL_LOGI("ResolveRemote success, remote engine:%s, handle:%p", remote_engine.GetString(), handle);
+  return SUCCESS;
+}
+
+Status Hixl::ReleaseRemote(RemoteHandle handle) {
+  HIXL_LOGI("ReleaseRemote start, handle:%p", handle);
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
+  HIXL_CHK_STATUS_RET(impl_->ReleaseRemote(handle), "Failed to release remote, handle:%p", handle);
+  HIXL_LOGI("ReleaseRemote success, handle:%p", handle);
+  return SUCCESS;
+}
+
+Status Hixl::TransferSync(RemoteHandle handle, TransferOp operation, const std::vector<TransferOpDesc> &op_descs,
+                          int32_t timeout_in_millis) {
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
+  HIXL_CHK_BOOL_RET_STATUS(timeout_in_millis > 0, PARAM_INVALID, "timeout_in_millis:%d must > 0", timeout_in_millis);
+  HIXL_CHK_STATUS_RET(impl_->TransferSync(handle, operation, op_descs, timeout_in_millis),
+                      "Failed to TransferSync, handle:%p, operation:%s, op_descs size:%zu, timeout:%d ms", handle,
+                      TransferOpToString(operation).c_str(), op_descs.size(), timeout_in_millis);
+  return SUCCESS;
+}
+
+Status Hixl::TransferAsync(RemoteHandle handle, TransferOp operation, const std::vector<TransferOpDesc> &op_descs,
+                           const TransferArgs &optional_args, TransferReq &req) {
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "HixlImpl is nullptr, check Hixl init.");
+  HIXL_CHK_STATUS_RET(impl_->TransferAsync(handle, operation, op_descs, optional_args, req),
+                      "Failed to transfer async, handle:%p, operation:%s, op_descs size:%zu.", handle,
+                      TransferOpToString(operation).c_str(), op_descs.size());
+  return SUCCESS;
+}
+
 Status Hixl::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
   HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "Impl is nullptr, check Hixl init.");
   HIXL_CHK_BOOL_RET_STATUS(req != nullptr, FAILED, "Req is nullptr, check req.");
@@ -396,6 +527,13 @@ Status Hixl::GetTransferStatus(const GetTransferStatusArgs &args, std::vector<Tr
   return SUCCESS;
 }
 
+Status Hixl::GetTransferStatistics(const AscendString &remote_engine, PeerTransferStatistics &statistics) {
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
+  HIXL_CHK_STATUS_RET(impl_->GetTransferStatistics(remote_engine, statistics),
+                      "Failed to get transfer statistics, remote engine:%s", remote_engine.GetString());
+  return SUCCESS;
+}
+
 Status Hixl::SendNotify(const AscendString &remote_engine, const NotifyDesc &notify, int32_t timeout_in_millis) {
   HIXL_LOGI("SendNotify start, remote engine:%s, notify name:%s", remote_engine.GetString(), notify.name.GetString());
   HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
@@ -422,6 +560,25 @@ Status Hixl::GetNotifies(std::vector<NotifyDesc> &notifies) {
   return SUCCESS;
 }
 
+Status Hixl::SendNotifies(const AscendString &remote_engine, const std::vector<NotifyDesc> &notifies,
+                          int32_t timeout_in_millis) {
+  HIXL_LOGI("SendNotifies start, remote engine:%s, count:%zu", remote_engine.GetString(), notifies.size());
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
+  HIXL_CHK_BOOL_RET_STATUS(timeout_in_millis > 0, PARAM_INVALID, "timeout_in_millis:%d must > 0", timeout_in_millis);
+  HIXL_CHK_STATUS_RET(impl_->SendNotifies(remote_engine, notifies, timeout_in_millis),
+                      "Failed to send notifies, remote engine:%s, count:%zu", remote_engine.GetString(),
+                      notifies.size());
+  HIXL_LOGI("SendNotifies success, remote engine:%s, count:%zu", remote_engine.GetString(), notifies.size());
+  return SUCCESS;
+}
+
+Status Hixl::ConsumeNotifies(const NotifyVisitor &visitor) {
+  HIXL_CHK_BOOL_RET_STATUS(impl_ != nullptr, FAILED, "impl is nullptr, check Hixl init");
+  HIXL_CHK_BOOL_RET_STATUS(visitor != nullptr, PARAM_INVALID, "visitor is empty");
+  HIXL_CHK_STATUS_RET(impl_->ConsumeNotifies(visitor), "Failed to consume notifies");
+  return SUCCESS;
+}
+
 Status Hixl::GetCapability(FeatureType feature_type, int32_t &value) {
   if (static_cast<int32_t>(feature_type) < 0) {
     return PARAM_INVALID;
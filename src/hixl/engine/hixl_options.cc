@@ -33,9 +33,12 @@ namespace {
 constexpr size_t kMaxCapacityTB = 1024UL;
 constexpr size_t kMinTaskStreamNum = 1U;
 constexpr size_t kMaxTaskStreamNum = 8U;
+constexpr size_t kMaxFabricMemCacheCapacityMB = 1024UL * 1024UL;
+constexpr size_t kMaxFabricMemReserveBlockNum = 65535UL;
 constexpr uint32_t kMinListenPort = 1U;
 constexpr uint32_t kMaxListenPort = 65535U;
 constexpr uint32_t kMinActiveChannels = 1U;
+constexpr size_t kMaxHostRegisterCacheSizeMB = 1024UL * 1024UL;
 constexpr int32_t kMinConnectPoolThreadNum = 1;
 constexpr int32_t kMaxConnectPoolThreadNum = 64;
 constexpr int32_t kMinConnectPoolTaskQueueCapacity = 1;
@@ -128,6 +131,18 @@ Status ParseFabricMemoryFields(const nlohmann::json &json, FabricMemoryConfig &c
   if (json.contains("enable_aicpu_unfold")) {
     cfg.enable_aicpu_unfold = json.at("enable_aicpu_unfold").get<bool>();
   }
+  IntegerFieldRange cache_capacity_range = {"cache_capacity", 0,
+                                            static_cast<int64_t>(kMaxFabricMemCacheCapacityMB), " MB"};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, cache_capacity_range, cfg.cache_capacity),
+                      "Failed to parse fabric_memory.cache_capacity");
+  IntegerFieldRange reserve_size_range = {"reserve_block_size", 1,
+                                          static_cast<int64_t>(kMaxFabricMemCacheCapacityMB), " MB"};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, reserve_size_range, cfg.reserve_block_size),
+                      "Failed to parse fabric_memory.reserve_block_size");
+  IntegerFieldRange reserve_num_range = {"reserve_block_num", 0,
+                                         static_cast<int64_t>(kMaxFabricMemReserveBlockNum), ""};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, reserve_num_range, cfg.reserve_block_num),
+                      "Failed to parse fabric_memory.reserve_block_num");
   return SUCCESS;
 }
 
@@ -150,6 +165,18 @@ Status ParseFabricMemoryConfig(const nlohmann::json &json, FabricMemoryConfig &c
   if (json.contains("fabric_memory.enable_aicpu_unfold")) {
     cfg.enable_aicpu_unfold = json.at("fabric_memory.enable_aicpu_unfold").get<bool>();
   }
+  IntegerFieldRange cache_capacity_range = {"fabric_memory.cache_capacity", 0,
+                                            static_cast<int64_t>(kMaxFabricMemCacheCapacityMB), " MB"};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, cache_capacity_range, cfg.cache_capacity),
+                      "Failed to parse fabric_memory.cache_capacity");
+  IntegerFieldRange reserve_size_range = {"fabric_memory.reserve_block_size", 1,
+                                          static_cast<int64_t>(kMaxFabricMemCacheCapacityMB), " MB"};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, reserve_size_range, cfg.reserve_block_size),
+                      "Failed to parse fabric_memory.reserve_block_size");
+  IntegerFieldRange reserve_num_range = {"fabric_memory.reserve_block_num", 0,
+                                         static_cast<int64_t>(kMaxFabricMemReserveBlockNum), ""};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, reserve_num_range, cfg.reserve_block_num),
+                      "Failed to parse fabric_memory.reserve_block_num");
   if (cfg.enable_aicpu_unfold.value_or(true) && cfg.task_stream_num.has_value()) {
     HIXL_CHK_BOOL_RET_STATUS(*cfg.task_stream_num == 1U, PARAM_INVALID,
                              "aicpu_unfold mode only supports fabric_memory.task_stream_num=1, got %zu",
@@ -185,6 +212,18 @@ Status ParseCommResourceConfig(const nlohmann::json &json, CommResourceConfigDes
                                                  std::numeric_limits<uint32_t>::max(), ""};
   HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, max_active_channels_range, cfg.max_active_channels),
                       "Failed to parse comm_resource_config.max_active_channels");
+  if (json.contains("comm_resource_config.transport")) {
+    const auto &transport = json.at("comm_resource_config.transport");
+    HIXL_CHK_BOOL_RET_STATUS(transport.is_string(), PARAM_INVALID, "comm_resource_config.transport must be a string");
+    cfg.transport = transport.get<std::string>();
+    HIXL_CHK_BOOL_RET_STATUS(*cfg.transport == kTransportHcomm || *cfg.transport == kTransportLoopback, PARAM_INVALID,
+                             "comm_resource_config.transport:%s is invalid, expect %s or %s", cfg.transport->c_str(),
+                             kTransportHcomm, kTransportLoopback);
+  }
+  IntegerFieldRange host_register_cache_range = {"comm_resource_config.host_register_cache_size", 0,
+                                                 static_cast<int64_t>(kMaxHostRegisterCacheSizeMB), " MB"};
+  HIXL_CHK_STATUS_RET(ParseIntegerFieldInRange(json, host_register_cache_range, cfg.host_register_cache_size),
+                      "Failed to parse comm_resource_config.host_register_cache_size");
   return SUCCESS;
 }
 
@@ -222,6 +261,8 @@ Status HixlOptions::Parse(const std::map<AscendString, AscendString> &options, H
   HIXL_CHK_STATUS_RET(result.ParseEndpointOptions(options), "Failed to parse endpoint options.");
   HIXL_CHK_STATUS_RET(result.ParseFabricMemOptions(options), "Failed to parse FabricMem options.");
   HIXL_CHK_STATUS_RET(result.ParseAutoConnectOptions(options), "Failed to parse AutoConnect options.");
+  HIXL_CHK_STATUS_RET(result.ParseMemNotifyOptions(options), "Failed to parse EnableMemNotify options.");
+  HIXL_CHK_STATUS_RET(result.ParseMultiRailOptions(options), "Failed to parse EnableMultiRail options.");
   HIXL_CHK_STATUS_RET(result.ParseGlobalResourceConfig(options), "Failed to parse GlobalResourceConfig.");
   HIXL_CHK_STATUS_RET(result.ResolveLocalCommResFromFile(), "Failed to resolve LocalCommRes from file.");
   return SUCCESS;
@@ -243,6 +284,11 @@ std::vector<std::string> HixlOptions::GetProtocolDesc() const {
   return *global_resource_config_->comm_resource_config.protocol_desc;
 }
 
+bool HixlOptions::UseLoopbackTransport() const {
+  return global_resource_config_.has_value() &&
+         global_resource_config_->comm_resource_config.transport.value_or(kTransportHcomm) == kTransportLoopback;
+}
+
 Status HixlOptions::ParseRdmaOptions(const std::map<AscendString, AscendString> &options) {
   std::string traffic_class_str;
   const auto &hixl_tc_it = options.find(hixl::OPTION_RDMA_TRAFFIC_CLASS);
@@ -339,6 +385,42 @@ Status HixlOptions::ParseAutoConnectOptions(const std::map<AscendString, AscendS
   return SUCCESS;
 }
 
+Status HixlOptions::ParseMemNotifyOptions(const std::map<AscendString, AscendString> &options) {
+  const auto &it = options.find(hixl::OPTION_ENABLE_MEM_NOTIFY);
+  if (it == options.end()) {
+    return SUCCESS;
+  }
+  std::string enabled_str = it->second.GetString();
+  HIXL_CHK_BOOL_RET_STATUS(!enabled_str.empty(), PARAM_INVALID, "%s value is empty, should be zero or one.",
+                           hixl::OPTION_ENABLE_MEM_NOTIFY);
+  uint32_t enabled = 0U;
+  HIXL_CHK_STATUS_RET(ToNumber(enabled_str, enabled), "%s is invalid, value = %s", hixl::OPTION_ENABLE_MEM_NOTIFY,
+                      enabled_str.c_str());
+  HIXL_CHK_BOOL_RET_STATUS(enabled == 0U || enabled == 1U, PARAM_INVALID, "%s is invalid, should be zero or one.",
+                           hixl::OPTION_ENABLE_MEM_NOTIFY);
+  enable_mem_notify_ = (enabled == 1U);
+  HIXL_EVENT("ParseMemNotifyOptions success: enable_mem_notify=%d", enable_mem_notify_.value());
+  return SUCCESS;
+}
+
+Status HixlOptions::ParseMultiRailOptions(const std::map<AscendString, AscendString> &options) {
+  const auto &it = options.find(hixl::OPTION_ENABLE_MULTI_RAIL);
+  if (it == options.end()) {
+    return SUCCESS;
+  }
+  std::string enabled_str = it->second.GetString();
+  HIXL_CHK_BOOL_RET_STATUS(!enabled_str.empty(), PARAM_INVALID, "%s value is empty, should be zero or one.",
+                           hixl::OPTION_ENABLE_MULTI_RAIL);
+  uint32_t enabled = 0U;
+  HIXL_CHK_STATUS_RET(ToNumber(enabled_str, enabled), "%s is invalid, value = %s", hixl::OPTION_ENABLE_MULTI_RAIL,
+                      enabled_str.c_str());
+  HIXL_CHK_BOOL_RET_STATUS(enabled == 0U || enabled == 1U, PARAM_INVALID, "%s is invalid, should be zero or one.",
+                           hixl::OPTION_ENABLE_MULTI_RAIL);
+  enable_multi_rail_ = (enabled == 1U);
+  HIXL_EVENT("ParseMultiRailOptions success: enable_multi_rail=%d", enable_multi_rail_.value());
+  return SUCCESS;
+}
+
 Status HixlOptions::ParseGlobalResourceConfig(const std::string &config_str) {
   try {
     auto json = nlohmann::json::parse(config_str);
@@ -29,6 +29,9 @@ struct FabricMemoryConfig {
   std::optional<size_t> start_address;
   std::optional<size_t> task_stream_num;
   std::optional<bool> enable_aicpu_unfold;
+  std::optional<size_t> cache_capacity;
+  std::optional<size_t> reserve_block_size;
+  std::optional<size_t> reserve_block_num;
 };
 
 struct ConnectPoolConfig {
@@ -41,6 +44,8 @@ struct CommResourceConfigDesc {
   std::optional<uint32_t> listen_port;
   std::optional<uint8_t> qos;
   std::optional<uint32_t> max_active_channels;
+  std::optional<std::string> transport;  // "hcomm" (default) or "loopback"
+  std::optional<size_t> host_register_cache_size;  // MB
 };
 
 struct GlobalResourceConfig {
@@ -74,11 +79,18 @@ class HixlOptions {
   std::optional<bool> AutoConnect() const {
     return auto_connect_;
   }
+  std::optional<bool> EnableMemNotify() const {
+    return enable_mem_notify_;
+  }
+  std::optional<bool> EnableMultiRail() const {
+    return enable_multi_rail_;
+  }
 
   std::optional<GlobalResourceConfig> GlobalResourceCfg() const {
     return global_resource_config_;
   }
   std::vector<std::string> GetProtocolDesc() const;
+  bool UseLoopbackTransport() const;
 
  private:
   std::map<AscendString, AscendString> raw_options_;
@@ -89,12 +101,16 @@ class HixlOptions {
   std::optional<std::string> local_comm_res_;
   std::optional<bool> enable_fabric_mem_;
   std::optional<bool> auto_connect_;
+  std::optional<bool> enable_mem_notify_;
+  std::optional<bool> enable_multi_rail_;
   std::optional<GlobalResourceConfig> global_resource_config_;
 
   Status ParseRdmaOptions(const std::map<AscendString, AscendString> &options);
   Status ParseEndpointOptions(const std::map<AscendString, AscendString> &options);
   Status ParseFabricMemOptions(const std::map<AscendString, AscendString> &options);
   Status ParseAutoConnectOptions(const std::map<AscendString, AscendString> &options);
+  Status ParseMemNotifyOptions(const std::map<AscendString, AscendString> &options);
+  Status ParseMultiRailOptions(const std::map<AscendString, AscendString> &options);
   Status ParseGlobalResourceConfig(const std::map<AscendString, AscendString> &options);
   Status ParseGlobalResourceConfig(const std::string &config_str);
   Status ResolveLocalCommResFromFile();
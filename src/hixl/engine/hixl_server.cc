@@ -10,6 +10,14 @@
 
 #include "hixl_server.h"
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <iterator>
+#include <unistd.h>
+#include "securec.h"
+
 #include "utils/extern_math_util.h"
 
 #include "cs/hixl_cs.h"
@@ -18,6 +26,7 @@
 #include "common/hixl_checker.h"
 #include "common/ctrl_msg.h"
 #include "common/ctrl_msg_plugin.h"
+#include "common/scope_guard.h"
 #include "engine/endpoint_generator/endpoint_generator.h"
 #include "common/hixl_inner_types.h"
 #include "common/hixl_utils.h"
@@ -60,7 +69,8 @@ std::string SerializeNotifyAck(Status result) {
 
 Status HixlServer::Initialize(const std::string &ip, int32_t port,
                               const std::vector<EndpointConfig> &data_endpoint_config_list,
-                              std::optional<uint32_t> listen_port, std::optional<uint32_t> max_active_channels) {
+                              std::optional<uint32_t> listen_port, std::optional<uint32_t> max_active_channels,
+                              bool enable_mem_notify, std::optional<uint64_t> host_register_cache_size) {
   data_endpoint_config_list_ = data_endpoint_config_list;
   std::vector<EndpointDesc> data_end_point_list;
   for (const auto &it : data_endpoint_config_list) {
@@ -75,7 +85,7 @@ Status HixlServer::Initialize(const std::string &ip, int32_t port,
   }
   HixlServerConfig config{};
   std::string global_resource_config;
-  if (listen_port.has_value() || max_active_channels.has_value()) {
+  if (listen_port.has_value() || max_active_channels.has_value() || host_register_cache_size.has_value()) {
     nlohmann::json json;
     if (listen_port.has_value()) {
       json["comm_resource_config.listen_port"] = listen_port.value();
@@ -83,6 +93,9 @@ Status HixlServer::Initialize(const std::string &ip, int32_t port,
     if (max_active_channels.has_value()) {
       json["comm_resource_config.max_active_channels"] = max_active_channels.value();
     }
+    if (host_register_cache_size.has_value()) {
+      json["comm_resource_config.host_register_cache_size"] = host_register_cache_size.value();
+    }
     global_resource_config = json.dump();
     config.global_resource_config = global_resource_config.c_str();
   }
@@ -94,11 +107,89 @@ Status HixlServer::Initialize(const std::string &ip, int32_t port,
   HIXL_CHK_STATUS_RET(HixlCSServerCreate(&server_desc, &config, &server_handle_),
                       "Failed to create hixl server, ip:%s, port:%d.", ip.c_str(), port);
   if (port > 0) {
+    if (enable_mem_notify) {
+      Status ret = InitNotifySlots();
+      if (ret != SUCCESS) {
+        HIXL_LOGW("Failed to init notify slots, ret:%u, notify falls back to ctrl socket.", ret);
+      }
+    }
     HIXL_CHK_STATUS_RET(RegisterProcessors(), "Failed to register processors.");
   }
   return SUCCESS;
 }
 
+Status HixlServer::InitNotifySlots() {
+  const int64_t page_size = sysconf(_SC_PAGESIZE);
+  HIXL_CHK_BOOL_RET_STATUS(page_size > 0, FAILED, "sysconf(_SC_PAGESIZE) failed, errno=%d", errno);
+  const size_t total_size = NotifySlotLayout::RingSize() * kMaxNotifySlotPeers;
+  void *base = nullptr;
+  // Register host mem addr need aligned by page size.
+  int32_t ret = posix_memalign(&base, static_cast<size_t>(page_size), total_size);
+  HIXL_CHK_BOOL_RET_STATUS(ret == 0 && base != nullptr, FAILED, "Notify slots posix_memalign failed, ret:%d, size:%zu",
+                           ret, total_size);
+  HIXL_DISMISSABLE_GUARD(base_guard, ([base]() { free(base); }));
+  (void)memset_s(base, total_size, 0, total_size);
+  CommMem mem{};
+  mem.type = COMM_MEM_TYPE_HOST;
+  mem.addr = base;
+  mem.size = total_size;
+  MemHandle mem_handle = nullptr;
+  HIXL_CHK_STATUS_RET(HixlCSServerRegMem(server_handle_, nullptr, &mem, &mem_handle),
+                      "Failed to register notify slots, addr:%p, size:%zu", base, total_size);
+  HIXL_DISMISS_GUARD(base_guard);
+  std::lock_guard<std::mutex> lock(notify_slot_mutex_);
+  notify_slot_base_ = static_cast<uint8_t *>(base);
+  notify_slot_handle_ = mem_handle;
+  HIXL_EVENT("HixlServer notify slots registered, addr:%p, peers:%u, slots_per_peer:%u, slot_size:%zu", base,
+             kMaxNotifySlotPeers, kNotifySlotsPerPeer, NotifySlotLayout::SlotSize());
+  return SUCCESS;
+}
+
+void HixlServer::FinalizeNotifySlots() {
+  std::lock_guard<std::mutex> lock(notify_slot_mutex_);
+  if (notify_slot_base_ == nullptr) {
+    return;
+  }
+  Status ret = HixlCSServerUnregMem(server_handle_, notify_slot_handle_);
+  if (ret != SUCCESS) {
+    HIXL_LOGE(ret, "Failed to deregister notify slots, handle:%p.", notify_slot_handle_);
+  }
+  for (const auto &peer : notify_slot_peers_) {
+    notify_slot_rings_[peer.second].Reset(nullptr);
+  }
+  notify_slot_peers_.clear();
+  notify_slot_fds_.clear();
+  free(notify_slot_base_);
+  notify_slot_base_ = nullptr;
+  notify_slot_handle_ = nullptr;
+}
+
+void HixlServer::PollNotifySlots() {
+  std::lock_guard<std::mutex> lock(notify_slot_mutex_);
+  for (const auto &peer : notify_slot_peers_) {
+    (void)notify_slot_rings_[peer.second].Poll(notify_ring_);
+  }
+}
+
+void HixlServer::ReleaseNotifySlot(int32_t fd) {
+  std::lock_guard<std::mutex> lock(notify_slot_mutex_);
+  const auto fd_it = notify_slot_fds_.find(fd);
+  if (fd_it == notify_slot_fds_.end()) {
+    return;
+  }
+  const auto peer_it = notify_slot_peers_.find(fd_it->second);
+  if (peer_it != notify_slot_peers_.end()) {
+    // 断开前已完整写入的notify先转存，再把槽位环归还给后续对端
+    NotifySlotRing &ring = notify_slot_rings_[peer_it->second];
+    (void)ring.Poll(notify_ring_);
+    ring.Reset(nullptr);
+    HIXL_EVENT("HixlServer notify slot released, peer:%s, index:%u, fd:%d", peer_it->first.c_str(), peer_it->second,
+               fd);
+    (void)notify_slot_peers_.erase(peer_it);
+  }
+  (void)notify_slot_fds_.erase(fd_it);
+}
+
 Status HixlServer::RegisterMem(const MemDesc &mem, MemType type, MemHandle &mem_handle) {
   HIXL_CHECK_NOTNULL(server_handle_);
   AddrInfo cur_info{};
@@ -158,6 +249,7 @@ Status HixlServer::Finalize() {
     }
   }
   handle_to_addr_.clear();
+  FinalizeNotifySlots();
   HIXL_CHK_STATUS_RET(HixlCSServerDestroy(server_handle_), "Failed to destroy hixl server.");
   server_handle_ = nullptr;
   return SUCCESS;
@@ -175,9 +267,21 @@ Status HixlServer::RegisterCallbackProcessor(int32_t msg_type, CallbackProcessor
 }
 
 Status HixlServer::GetNotifies(std::vector<NotifyDesc> &notifies) {
-  std::lock_guard<std::mutex> lock(notify_mutex_);
-  HIXL_EVENT("HixlServer GetNotifies, count:%zu", notify_messages_.size());
-  notifies = std::move(notify_messages_);
+  PollNotifySlots();
+  notifies.clear();
+  notifies.reserve(notify_ring_.Size());
+  (void)notify_ring_.Consume([&notifies](const NotifyView &view) {
+    notifies.emplace_back(
+        NotifyDesc{AscendString(view.name, view.name_len), AscendString(view.notify_msg, view.notify_msg_len)});
+  });
+  HIXL_EVENT("HixlServer GetNotifies, count:%zu", notifies.size());
+  return SUCCESS;
+}
+
+Status HixlServer::ConsumeNotifies(const NotifyVisitor &visitor) {
+  PollNotifySlots();
+  const size_t count = notify_ring_.Consume(visitor);
+  HIXL_EVENT("HixlServer ConsumeNotifies, count:%zu", count);
   return SUCCESS;
 }
 
@@ -187,6 +291,19 @@ Status HixlServer::RegisterNotifyHandlers() {
   };
   HIXL_CHK_STATUS_RET(HixlCSServerRegProc(server_handle_, CtrlMsgType::kNotify, notify_processor),
                       "Failed to register kNotify processor.");
+  MsgProcessor notify_batch_processor = [this](int32_t fd, const char *msg, uint64_t msg_len) -> Status {
+    return ProcessNotifyBatchMsg(fd, msg, msg_len);
+  };
+  HIXL_CHK_STATUS_RET(HixlCSServerRegProc(server_handle_, CtrlMsgType::kNotifyBatch, notify_batch_processor),
+                      "Failed to register kNotifyBatch processor.");
+  MsgProcessor notify_slot_attach_processor = [this](int32_t fd, const char *msg, uint64_t msg_len) -> Status {
+    return ProcessNotifySlotAttachMsg(fd, msg, msg_len);
+  };
+  HIXL_CHK_STATUS_RET(
+      HixlCSServerRegProc(server_handle_, CtrlMsgType::kNotifySlotAttachReq, notify_slot_attach_processor),
+      "Failed to register kNotifySlotAttachReq processor.");
+  HIXL_CHK_STATUS_RET(HixlCSServerRegDisconnectProc(server_handle_, [this](int32_t fd) { ReleaseNotifySlot(fd); }),
+                      "Failed to register notify slot disconnect processor.");
   return SUCCESS;
 }
 
@@ -198,27 +315,13 @@ Status HixlServer::ProcessNotifyMsg(int32_t fd, const char *msg, uint64_t msg_le
     HIXL_LOGE(PARAM_INVALID, "Failed to parse NotifyMsg, exception:%s", e.what());
     return PARAM_INVALID;
   }
-  Status result = SUCCESS;
-  {
-    std::lock_guard<std::mutex> lock(notify_mutex_);
-    if (notify_messages_.size() >= kMaxNotifyQueueSize) {
-      HIXL_LOGE(RESOURCE_EXHAUSTED, "Notify queue is full, size:%zu, max:%zu", notify_messages_.size(),
-                kMaxNotifyQueueSize);
-      result = RESOURCE_EXHAUSTED;
-    } else if (notify_msg.name.size() > kMaxNotifyNameLen) {
-      HIXL_LOGE(PARAM_INVALID, "Notify name length invalid, size:%zu, max:%zu", notify_msg.name.size(),
-                kMaxNotifyNameLen);
-      result = PARAM_INVALID;
-    } else if (notify_msg.notify_msg.size() > kMaxNotifyMsgLen) {
-      HIXL_LOGE(PARAM_INVALID, "Notify message too long, size:%zu, max:%zu", notify_msg.notify_msg.size(),
-                kMaxNotifyMsgLen);
-      result = PARAM_INVALID;
-    } else {
-      NotifyDesc notify_desc;
-      notify_desc.name = AscendString(notify_msg.name.c_str());
-      notify_desc.notify_msg = AscendString(notify_msg.notify_msg.c_str());
-      notify_messages_.push_back(notify_desc);
-    }
+  Status result = notify_ring_.Push(notify_msg.name.data(), notify_msg.name.size(), notify_msg.notify_msg.data(),
+                                    notify_msg.notify_msg.size());
+  if (result == RESOURCE_EXHAUSTED) {
+    HIXL_LOGE(RESOURCE_EXHAUSTED, "Notify queue is full, size:%zu, max:%zu", notify_ring_.Size(), kMaxNotifyQueueSize);
+  } else if (result != SUCCESS) {
+    HIXL_LOGE(PARAM_INVALID, "Notify length invalid, name size:%zu, msg size:%zu, max:%zu", notify_msg.name.size(),
+              notify_msg.notify_msg.size(), kMaxNotifyMsgLen);
   }
   std::string ack_str;
   try {
@@ -238,6 +341,106 @@ Status HixlServer::ProcessNotifyMsg(int32_t fd, const char *msg, uint64_t msg_le
   return result;
 }
 
+Status HixlServer::ProcessNotifyBatchMsg(int32_t fd, const char *msg, uint64_t msg_len) {
+  NotifyBatchHeader batch{};
+  HIXL_CHK_BOOL_RET_STATUS(msg_len >= sizeof(batch), PARAM_INVALID, "Invalid NotifyBatch size:%" PRIu64, msg_len);
+  HIXL_CHK_BOOL_RET_STATUS(memcpy_s(&batch, sizeof(batch), msg, sizeof(batch)) == EOK, FAILED,
+                           "memcpy_s NotifyBatch header failed");
+  Status result = (batch.count <= kMaxNotifiesPerBatch) ? SUCCESS : PARAM_INVALID;
+  std::vector<NotifyView> notifies;
+  notifies.reserve((result == SUCCESS) ? batch.count : 0U);
+  uint64_t offset = sizeof(batch);
+  for (uint32_t i = 0U; (i < batch.count) && (result == SUCCESS); ++i) {
+    NotifyBatchEntry entry{};
+    if (msg_len - offset < sizeof(entry)) {
+      result = PARAM_INVALID;
+      break;
+    }
+    (void)memcpy_s(&entry, sizeof(entry), msg + offset, sizeof(entry));
+    offset += sizeof(entry);
+    const uint64_t payload_len = static_cast<uint64_t>(entry.name_len) + entry.msg_len;
+    if (msg_len - offset < payload_len) {
+      result = PARAM_INVALID;
+      break;
+    }
+    const char *name = msg + offset;
+    notifies.emplace_back(NotifyView{name, entry.name_len, name + entry.name_len, entry.msg_len});
+    offset += payload_len;
+  }
+  // 整帧入队或整帧拒绝，客户端重发被拒的帧不会产生重复notify
+  result = (result == SUCCESS) ? notify_ring_.PushBatch(notifies.data(), notifies.size()) : result;
+  const uint32_t accepted = (result == SUCCESS) ? batch.count : 0U;
+  if (result != SUCCESS) {
+    HIXL_LOGE(result, "NotifyBatch rejected, first_seq:%" PRIu64 ", count:%u, queued:%zu", batch.first_seq,
+              batch.count, notify_ring_.Size());
+  }
+  // header、msg_type与ack一次性发送，避免线程池并发回包时在同一fd上交错
+  std::array<uint8_t, sizeof(CtrlMsgHeader) + sizeof(CtrlMsgType) + sizeof(NotifyBatchAck)> ack_frame{};
+  CtrlMsgHeader header{kMagicNumber, static_cast<uint64_t>(sizeof(CtrlMsgType) + sizeof(NotifyBatchAck))};
+  CtrlMsgType msg_type = CtrlMsgType::kNotifyBatchAck;
+  NotifyBatchAck ack{batch.first_seq, batch.count, accepted, result};
+  (void)memcpy_s(ack_frame.data(), ack_frame.size(), &header, sizeof(header));
+  (void)memcpy_s(ack_frame.data() + sizeof(header), ack_frame.size() - sizeof(header), &msg_type, sizeof(msg_type));
+  (void)memcpy_s(ack_frame.data() + sizeof(header) + sizeof(msg_type),
+                 ack_frame.size() - sizeof(header) - sizeof(msg_type), &ack, sizeof(ack));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(fd, ack_frame.data(), ack_frame.size()),
+                      "Failed to send NotifyBatchAck, fd:%d", fd);
+  HIXL_LOGD("Received NotifyBatch, first_seq:%" PRIu64 ", count:%u, accepted:%u", batch.first_seq, batch.count,
+            accepted);
+  return result;
+}
+
+Status HixlServer::ProcessNotifySlotAttachMsg(int32_t fd, const char *msg, uint64_t msg_len) {
+  const std::string peer(msg, msg_len);
+  NotifySlotAttachResp resp{UNSUPPORTED, kNotifySlotsPerPeer, NotifySlotLayout::SlotSize(), 0U, 0U};
+  {
+    std::lock_guard<std::mutex> lock(notify_slot_mutex_);
+    if (notify_slot_base_ != nullptr) {
+      auto it = notify_slot_peers_.find(peer);
+      if (it != notify_slot_peers_.end()) {
+        // 同一对端重连或写入失败后重新对齐: 先转存已完整写入的slot，再清空其余slot，消费序号保持不变
+        NotifySlotRing &ring = notify_slot_rings_[it->second];
+        (void)ring.Poll(notify_ring_);
+        ring.Resync();
+      } else if (notify_slot_peers_.size() < kMaxNotifySlotPeers) {
+        std::array<bool, kMaxNotifySlotPeers> used{};
+        for (const auto &kv : notify_slot_peers_) {
+          used[kv.second] = true;
+        }
+        const auto free_it = std::find(used.begin(), used.end(), false);
+        it = notify_slot_peers_.emplace(peer, static_cast<uint32_t>(free_it - used.begin())).first;
+        notify_slot_rings_[it->second].Reset(notify_slot_base_ +
+                                             static_cast<size_t>(it->second) * NotifySlotLayout::RingSize());
+      }
+      if (it != notify_slot_peers_.end()) {
+        // 槽位环归属最近一次attach的连接，旧连接随后断开时不再释放
+        for (auto fd_it = notify_slot_fds_.begin(); fd_it != notify_slot_fds_.end();) {
+          fd_it = (fd_it->second == peer) ? notify_slot_fds_.erase(fd_it) : std::next(fd_it);
+        }
+        notify_slot_fds_[fd] = peer;
+        resp.result = SUCCESS;
+        resp.ring_addr =
+            PtrToValue(notify_slot_base_ + static_cast<size_t>(it->second) * NotifySlotLayout::RingSize());
+        resp.consumed = notify_slot_rings_[it->second].Consumed();
+      } else {
+        resp.result = RESOURCE_EXHAUSTED;
+      }
+    }
+  }
+  std::array<uint8_t, sizeof(CtrlMsgHeader) + sizeof(CtrlMsgType) + sizeof(NotifySlotAttachResp)> resp_frame{};
+  CtrlMsgHeader header{kMagicNumber, static_cast<uint64_t>(sizeof(CtrlMsgType) + sizeof(NotifySlotAttachResp))};
+  CtrlMsgType msg_type = CtrlMsgType::kNotifySlotAttachResp;
+  (void)memcpy_s(resp_frame.data(), resp_frame.size(), &header, sizeof(header));
+  (void)memcpy_s(resp_frame.data() + sizeof(header), resp_frame.size() - sizeof(header), &msg_type, sizeof(msg_type));
+  (void)memcpy_s(resp_frame.data() + sizeof(header) + sizeof(msg_type),
+                 resp_frame.size() - sizeof(header) - sizeof(msg_type), &resp, sizeof(resp));
+  HIXL_CHK_STATUS_RET(CtrlMsgPlugin::Send(fd, resp_frame.data(), resp_frame.size()),
+                      "Failed to send NotifySlotAttachResp, fd:%d", fd);
+  HIXL_EVENT("HixlServer notify slot attach, peer:%s, fd:%d, result:%u, ring_addr:0x%lx, consumed:%" PRIu64,
+             peer.c_str(), fd, resp.result, resp.ring_addr, resp.consumed);
+  return SUCCESS;
+}
+
 std::vector<MemInfo> HixlServer::GetRegisteredMemInfo() const {
   std::lock_guard<std::mutex> lk(mtx_);
   std::vector<MemInfo> result;
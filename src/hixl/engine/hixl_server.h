@@ -11,12 +11,17 @@
 #ifndef CANN_HIXL_SRC_HIXL_ENGINE_HIXL_SERVER_H
 #define CANN_HIXL_SRC_HIXL_ENGINE_HIXL_SERVER_H
 
+#include <array>
 #include <optional>
+#include <string>
 #include <vector>
 #include <mutex>
 #include <map>
 #include "hixl/hixl_types.h"
 #include "common/hixl_inner_types.h"
+#include "common/ctrl_msg.h"
+#include "common/notify_ring.h"
+#include "common/notify_slot_ring.h"
 #include "engine.h"
 
 namespace hixl {
@@ -30,11 +35,14 @@ class HixlServer {
    * @param [in] ip 服务端ip
    * @param [in] port 服务端监听的端口
    * @param [in] data_endpoint_config_list 服务端支持的传输协议
+   * @param [in] enable_mem_notify 是否开放注册内存notify槽位，供对端以单边WRITE投递notify
+   * @param [in] host_register_cache_size Host内存注册缓存容量(MB)，仅作用于本服务端的endpoint
    * @return 成功:SUCCESS, 失败:其它.
    */
   Status Initialize(const std::string &ip, int32_t port, const std::vector<EndpointConfig> &data_endpoint_config_list,
                     std::optional<uint32_t> listen_port = std::nullopt,
-                    std::optional<uint32_t> max_active_channels = std::nullopt);
+                    std::optional<uint32_t> max_active_channels = std::nullopt, bool enable_mem_notify = false,
+                    std::optional<uint64_t> host_register_cache_size = std::nullopt);
 
   /**
    * @brief 注册内存
@@ -64,6 +72,13 @@ class HixlServer {
    */
   Status GetNotifies(std::vector<NotifyDesc> &notifies);
 
+  /**
+   * @brief 免拷贝地遍历并清空接收到的通知消息
+   * @param [in] visitor 逐条回调，NotifyView仅在回调期间有效
+   * @return 成功:SUCCESS, 失败:其它.
+   */
+  Status ConsumeNotifies(const NotifyVisitor &visitor);
+
   /**
    * @brief 注册回调处理函数
    * @param [in] msg_type 消息类型
@@ -81,14 +96,26 @@ class HixlServer {
  private:
   Status RegisterNotifyHandlers();
   Status ProcessNotifyMsg(int32_t fd, const char *msg, uint64_t msg_len);
+  Status ProcessNotifyBatchMsg(int32_t fd, const char *msg, uint64_t msg_len);
+  Status ProcessNotifySlotAttachMsg(int32_t fd, const char *msg, uint64_t msg_len);
   Status RegisterProcessors();
+  Status InitNotifySlots();
+  void FinalizeNotifySlots();
+  void PollNotifySlots();
+  void ReleaseNotifySlot(int32_t fd);
 
   void *server_handle_ = nullptr;
   std::vector<EndpointConfig> data_endpoint_config_list_;
   mutable std::mutex mtx_;
   std::map<MemHandle, AddrInfo> handle_to_addr_;
-  std::vector<NotifyDesc> notify_messages_;
-  std::mutex notify_mutex_;
+  NotifyRing notify_ring_{kMaxNotifyQueueSize, kNotifyRingCapacity};
+  // 注册内存notify通道: 每个对端独占一个槽位环，GetNotifies时轮询内存转存到notify_ring_
+  std::mutex notify_slot_mutex_;
+  uint8_t *notify_slot_base_ = nullptr;
+  MemHandle notify_slot_handle_ = nullptr;
+  std::map<std::string, uint32_t> notify_slot_peers_;
+  std::map<int32_t, std::string> notify_slot_fds_;  // 控制面fd -> 对端，连接断开时据此释放槽位环
+  std::array<NotifySlotRing, kMaxNotifySlotPeers> notify_slot_rings_{};
 };
 }  // namespace hixl
 #endif  // #ifndef CANN_HIXL_SRC_HIXL_ENGINE_HIXL_SERVER_H
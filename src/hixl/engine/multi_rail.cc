@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "engine/multi_rail.h"
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include "common/hixl_checker.h"
+#include "common/hixl_log.h"
+#include "common/hixl_utils.h"
+#include "common/optional_aclrt_context.h"
+#include "engine/client_handler_config_helper.h"
+#include "engine/endpoint_generator/endpoint_generator.h"
+
+namespace hixl {
+namespace {
+constexpr double kInitialRailBandwidth = 1.0;
+constexpr double kRailBandwidthEwmaAlpha = 0.25;
+
+Status CreateRailClient(const HandlerCreateArgs &args, const HandlerCreateArgs::EndpointPair &pair,
+                        HixlClientHandle &handle) {
+  EndpointDesc local_endpoint{};
+  EndpointDesc remote_endpoint{};
+  HIXL_CHK_STATUS_RET(EndpointGenerator::ConvertToEndpointDesc(pair.local, local_endpoint));
+  HIXL_CHK_STATUS_RET(EndpointGenerator::ConvertToEndpointDesc(pair.remote, remote_endpoint));
+  HixlClientDesc desc{};
+  desc.server_ip = args.server_ip.c_str();
+  desc.server_port = args.server_port;
+  desc.local_endpoint = &local_endpoint;
+  desc.remote_endpoint = &remote_endpoint;
+  desc.tc = args.rdma_tc;
+  desc.sl = args.rdma_sl;
+  HixlClientConfig config{};
+  const std::string global_resource_config = ClientHandlerConfigHelper::BuildGlobalResourceConfig(args);
+  if (!global_resource_config.empty()) {
+    config.global_resource_config = global_resource_config.c_str();
+  }
+  HIXL_CHK_STATUS_RET(HixlCSClientCreate(&desc, &config, &handle), "HixlCSClientCreate failed for rail, type %s",
+                      CommTypeToString(pair.type));
+  return SUCCESS;
+}
+
+uint64_t AlignDown(uint64_t value, uint64_t align) {
+  return value / align * align;
+}
+}  // namespace
+
+MultiRail::MultiRail(CommType type, HixlClientHandle primary) : type_(type) {
+  rails_.push_back(Rail{primary, HandlerCreateArgs::EndpointPair{}, {}});
+  bandwidth_.push_back(kInitialRailBandwidth);
+  samples_.push_back(0U);
+}
+
+Status MultiRail::Init(const HandlerCreateArgs &args) {
+  for (const auto &pair : args.rail_pairs) {
+    if (pair.type != type_ || rails_.size() >= kMaxRailNum) {
+      continue;
+    }
+    HixlClientHandle handle = nullptr;
+    Status ret = CreateRailClient(args, pair, handle);
+    if (ret != SUCCESS) {
+      Finalize();
+      return ret;
+    }
+    rails_.push_back(Rail{handle, pair, {}});
+    {
+      std::lock_guard<std::mutex> lock(bw_mutex_);
+      bandwidth_.push_back(kInitialRailBandwidth);
+      samples_.push_back(0U);
+    }
+    HIXL_EVENT("[MultiRail] rail[%zu] created, comm_type:%s, local_endpoint:{%s}, remote_endpoint:{%s}",
+               rails_.size() - 1U, CommTypeToString(type_), pair.local.ToString().c_str(),
+               pair.remote.ToString().c_str());
+  }
+  if (rails_.size() > 1U) {
+    const auto extra_rail_num = static_cast<uint32_t>(rails_.size() - 1U);
+    sync_pool_ = MakeUnique<ThreadPool>("multi_rail", extra_rail_num, extra_rail_num);
+    if (sync_pool_ == nullptr) {
+      Finalize();
+      HIXL_LOGE(FAILED, "[MultiRail] create thread pool failed, comm_type:%s", CommTypeToString(type_));
+      return FAILED;
+    }
+  }
+  return SUCCESS;
+}
+
+size_t MultiRail::RailNum() const {
+  return rails_.size();
+}
+
+Status MultiRail::Connect(uint32_t timeout_ms) {
+  for (size_t i = 1U; i < rails_.size(); ++i) {
+    HIXL_CHK_STATUS_RET(HixlCSClientConnect(rails_[i].handle, timeout_ms), "[MultiRail] connect rail[%zu] failed, %s",
+                        i, CommTypeToString(type_));
+  }
+  return SUCCESS;
+}
+
+Status MultiRail::RegisterMem(const CommMem &mem) {
+  for (size_t i = 1U; i < rails_.size(); ++i) {
+    MemHandle mem_handle = nullptr;
+    HIXL_CHK_STATUS_RET(HixlCSClientRegMem(rails_[i].handle, nullptr, &mem, &mem_handle),
+                        "[MultiRail] register mem on rail[%zu] failed, addr:%p", i, mem.addr);
+    rails_[i].mem_handles.push_back(mem_handle);
+  }
+  return SUCCESS;
+}
+
+std::vector<double> MultiRail::SnapshotWeights() const {
+  std::lock_guard<std::mutex> lock(bw_mutex_);
+  // 尚未测量的链路取已测链路的均值，避免其长期分不到数据而无法获得样本
+  double measured_sum = 0.0;
+  size_t measured_num = 0U;
+  for (size_t r = 0U; r < bandwidth_.size(); ++r) {
+    if (samples_[r] > 0U) {
+      measured_sum += bandwidth_[r];
+      ++measured_num;
+    }
+  }
+  const double fallback =
+      (measured_num == 0U) ? kInitialRailBandwidth : measured_sum / static_cast<double>(measured_num);
+  std::vector<double> weights(bandwidth_.size(), fallback);
+  for (size_t r = 0U; r < bandwidth_.size(); ++r) {
+    if (samples_[r] > 0U) {
+      weights[r] = bandwidth_[r];
+    }
+  }
+  return weights;
+}
+
+void MultiRail::Split(const std::vector<TransferOpDesc> &op_descs,
+                      std::vector<std::vector<HixlOneSideOpDesc>> &per_rail) const {
+  const size_t rail_num = rails_.size();
+  per_rail.assign(rail_num, {});
+  const std::vector<double> weights = SnapshotWeights();
+  double total_weight = 0.0;
+  size_t fastest = 0U;
+  for (size_t r = 0U; r < rail_num; ++r) {
+    total_weight += weights[r];
+    fastest = (weights[r] > weights[fastest]) ? r : fastest;
+  }
+  std::vector<double> load(rail_num, 0.0);
+  auto append = [&per_rail, &load](size_t rail, uint64_t local, uint64_t remote, uint64_t len) {
+    per_rail[rail].push_back(
+        HixlOneSideOpDesc{reinterpret_cast<void *>(remote), reinterpret_cast<void *>(local), len});
+    load[rail] += static_cast<double>(len);
+  };
+  for (const auto &op : op_descs) {
+    if (rail_num == 1U || op.len < 2U * kMinRailStripeSize) {
+      // 小描述符不切分，放到加入后完成时间最早的链路
+      size_t best = 0U;
+      double best_cost = (load[0] + static_cast<double>(op.len)) / weights[0];
+      for (size_t r = 1U; r < rail_num; ++r) {
+        const double cost = (load[r] + static_cast<double>(op.len)) / weights[r];
+        if (cost < best_cost) {
+          best = r;
+          best_cost = cost;
+        }
+      }
+      append(best, op.local_addr, op.remote_addr, op.len);
+      continue;
+    }
+    uint64_t offset = 0U;
+    for (size_t r = 0U; r < rail_num; ++r) {
+      if (r == fastest) {
+        continue;
+      }
+      const uint64_t share =
+          AlignDown(static_cast<uint64_t>(static_cast<double>(op.len) * weights[r] / total_weight), kRailStripeAlign);
+      if (share < kMinRailStripeSize) {
+        continue;
+      }
+      append(r, op.local_addr + offset, op.remote_addr + offset, share);
+      offset += share;
+    }
+    // 余量（含对齐尾部与过小分片）交给最快链路
+    append(fastest, op.local_addr + offset, op.remote_addr + offset, op.len - offset);
+  }
+}
+
+void MultiRail::RecordCompletion(uint32_t rail, uint64_t bytes, uint64_t elapsed_us) {
+  if (rail >= rails_.size() || bytes == 0U) {
+    return;
+  }
+  const double sample = static_cast<double>(bytes) / static_cast<double>(std::max<uint64_t>(elapsed_us, 1U));
+  std::lock_guard<std::mutex> lock(bw_mutex_);
+  double &bw = bandwidth_[rail];
+  // 首个样本直接替换初始值，之后按EWMA平滑
+  bw = (samples_[rail] == 0U) ? sample : (1.0 - kRailBandwidthEwmaAlpha) * bw + kRailBandwidthEwmaAlpha * sample;
+  ++samples_[rail];
+}
+
+double MultiRail::GetBandwidth(uint32_t rail) const {
+  std::lock_guard<std::mutex> lock(bw_mutex_);
+  return rail < bandwidth_.size() ? bandwidth_[rail] : 0.0;
+}
+
+Status MultiRail::TransferSync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
+                               uint32_t timeout_ms) {
+  std::vector<std::vector<HixlOneSideOpDesc>> per_rail;
+  Split(op_descs, per_rail);
+  const bool is_get = (operation != WRITE);
+  auto run_rail = [this, is_get, timeout_ms, &per_rail](size_t rail) -> Status {
+    const auto &descs = per_rail[rail];
+    uint64_t bytes = 0U;
+    for (const auto &desc : descs) {
+      bytes += desc.len;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const uint32_t list_num = static_cast<uint32_t>(descs.size());
+    Status ret = is_get ? static_cast<Status>(
+                              HixlCSClientBatchGetSync(rails_[rail].handle, list_num, descs.data(), timeout_ms))
+                        : static_cast<Status>(
+                              HixlCSClientBatchPutSync(rails_[rail].handle, list_num, descs.data(), timeout_ms));
+    HIXL_CHK_STATUS_RET(ret, "[MultiRail] rail[%zu] transfer failed, comm_type:%s, list_num:%u", rail,
+                        CommTypeToString(type_), list_num);
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    RecordCompletion(static_cast<uint32_t>(rail), bytes, static_cast<uint64_t>(elapsed));
+    return SUCCESS;
+  };
+
+  std::vector<size_t> busy_rails;
+  for (size_t r = 0U; r < per_rail.size(); ++r) {
+    if (!per_rail[r].empty()) {
+      busy_rails.push_back(r);
+    }
+  }
+  if (busy_rails.size() <= 1U || sync_pool_ == nullptr) {
+    Status ret = SUCCESS;
+    for (const size_t rail : busy_rails) {
+      const Status rail_ret = run_rail(rail);
+      ret = (ret == SUCCESS) ? rail_ret : ret;
+    }
+    return ret;
+  }
+  OptionalAclrtContext context;
+  HIXL_CHK_STATUS_RET(context.GetCurrentContext(), "GetCurrentContext failed");
+  std::vector<std::future<Status>> futures;
+  for (size_t i = 1U; i < busy_rails.size(); ++i) {
+    const size_t rail = busy_rails[i];
+    futures.emplace_back(sync_pool_->commit([&run_rail, &context, rail]() -> Status {
+      HIXL_CHK_STATUS_RET(context.SetCurrentContext(), "SetCurrentContext failed");
+      return run_rail(rail);
+    }));
+  }
+  // 首条链路在调用线程上执行，全部链路完成后才返回
+  Status ret = run_rail(busy_rails[0]);
+  for (auto &future : futures) {
+    const Status rail_ret = future.valid() ? future.get() : FAILED;
+    ret = (ret == SUCCESS) ? rail_ret : ret;
+  }
+  return ret;
+}
+
+Status MultiRail::Submit(const std::vector<std::vector<HixlOneSideOpDesc>> &per_rail, bool is_get,
+                         StripedRequest &req) {
+  req.pending.clear();
+  req.start = std::chrono::steady_clock::now();
+  for (size_t r = 0U; r < per_rail.size(); ++r) {
+    const auto &descs = per_rail[r];
+    if (descs.empty()) {
+      continue;
+    }
+    uint64_t bytes = 0U;
+    for (const auto &desc : descs) {
+      bytes += desc.len;
+    }
+    const uint32_t list_num = static_cast<uint32_t>(descs.size());
+    CompleteHandle complete_handle = nullptr;
+    Status ret = is_get ? static_cast<Status>(HixlCSClientBatchGetAsync(rails_[r].handle, list_num, descs.data(),
+                                                                        &complete_handle))
+                        : static_cast<Status>(HixlCSClientBatchPutAsync(rails_[r].handle, list_num, descs.data(),
+                                                                        &complete_handle));
+    if (ret != SUCCESS) {
+      HIXL_LOGE(ret, "[MultiRail] submit on rail[%zu] failed, comm_type:%s, list_num:%u", r, CommTypeToString(type_),
+                list_num);
+      ReleasePending(req);
+      return ret;
+    }
+    req.pending.push_back(StripedRequest::RailHandle{static_cast<uint32_t>(r), complete_handle, bytes});
+  }
+  return SUCCESS;
+}
+
+void MultiRail::ReleasePending(StripedRequest &req) {
+  // 已下发的分片不在调用线程上等待，逐个交还对应链路的client，由其在分片结束后回收完成句柄与标志位
+  for (const auto &rail_handle : req.pending) {
+    const Status ret =
+        static_cast<Status>(HixlCSClientReleaseCompleteHandle(rails_[rail_handle.rail].handle, rail_handle.handle));
+    if (ret != SUCCESS) {
+      HIXL_LOGW("[MultiRail] release rail[%u] handle failed, comm_type:%s, ret:%u", rail_handle.rail,
+                CommTypeToString(type_), ret);
+    }
+  }
+  req.pending.clear();
+}
+
+Status MultiRail::TransferAsync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation,
+                                StripedRequest &req) {
+  std::vector<std::vector<HixlOneSideOpDesc>> per_rail;
+  Split(op_descs, per_rail);
+  HIXL_CHK_STATUS_RET(Submit(per_rail, operation != WRITE, req), "[MultiRail] submit striped request failed");
+  HIXL_CHK_BOOL_RET_STATUS(!req.pending.empty(), PARAM_INVALID, "[MultiRail] no descriptor to transfer");
+  return SUCCESS;
+}
+
+Status MultiRail::Query(StripedRequest &req, HixlCompleteStatus &status) {
+  auto it = req.pending.begin();
+  while (it != req.pending.end()) {
+    HixlCompleteStatus rail_status = HIXL_COMPLETE_STATUS_WAITING;
+    Status ret =
+        static_cast<Status>(HixlCSClientQueryCompleteStatus(rails_[it->rail].handle, it->handle, &rail_status));
+    if (ret != SUCCESS || (rail_status != HIXL_COMPLETE_STATUS_WAITING &&
+                           rail_status != HIXL_COMPLETE_STATUS_COMPLETED)) {
+      HIXL_LOGE(FAILED, "[MultiRail] rail[%u] failed, comm_type:%s, ret:%u, status:%d", it->rail,
+                CommTypeToString(type_), ret, static_cast<int32_t>(rail_status));
+      // 调用方收到失败后即丢弃该请求，须先回收其余链路上仍在途的分片
+      (void)req.pending.erase(it);
+      ReleasePending(req);
+      status = (ret != SUCCESS) ? HIXL_COMPLETE_STATUS_FAILED : rail_status;
+      return ret;
+    }
+    if (rail_status == HIXL_COMPLETE_STATUS_WAITING) {
+      ++it;
+      continue;
+    }
+    // 异步请求的完成时刻以查询为准，带宽估计偏保守，由EWMA平滑
+    const auto elapsed =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - req.start).count();
+    RecordCompletion(it->rail, it->bytes, static_cast<uint64_t>(elapsed));
+    it = req.pending.erase(it);
+  }
+  status = req.pending.empty() ? HIXL_COMPLETE_STATUS_COMPLETED : HIXL_COMPLETE_STATUS_WAITING;
+  return SUCCESS;
+}
+
+void MultiRail::Finalize() {
+  sync_pool_.reset();
+  for (size_t i = 1U; i < rails_.size(); ++i) {
+    for (auto &mem_handle : rails_[i].mem_handles) {
+      if (mem_handle != nullptr) {
+        HixlCSClientUnregMem(rails_[i].handle, mem_handle);
+      }
+    }
+    if (rails_[i].handle != nullptr) {
+      HixlCSClientDestroy(rails_[i].handle);
+    }
+  }
+  rails_.resize(std::min<size_t>(rails_.size(), 1U));
+  std::lock_guard<std::mutex> lock(bw_mutex_);
+  bandwidth_.resize(rails_.size());
+  samples_.resize(rails_.size());
+}
+
+void MultiRail::Dump(const char *reason, DumpLogLevel level) const {
+  for (size_t i = 0U; i < rails_.size(); ++i) {
+    const double bw = GetBandwidth(static_cast<uint32_t>(i));
+    if (level == DumpLogLevel::ERROR) {
+      HIXL_LOGE(FAILED, "[MultiRail] dump rail[%zu], reason:%s, comm_type:%s, handle:%p, bandwidth:%.3f bytes/us", i,
+                reason, CommTypeToString(type_), rails_[i].handle, bw);
+    } else {
+      HIXL_EVENT("[MultiRail] dump rail[%zu], reason:%s, comm_type:%s, handle:%p, bandwidth:%.3f bytes/us", i, reason,
+                 CommTypeToString(type_), rails_[i].handle, bw);
+    }
+  }
+}
+}  // namespace hixl
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_HIXL_ENGINE_MULTI_RAIL_H_
+#define CANN_HIXL_SRC_HIXL_ENGINE_MULTI_RAIL_H_
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "cs/hixl_cs.h"
+#include "common/thread_pool.h"
+#include "engine/client_handler.h"
+#include "engine/client_handler_factory.h"
+
+namespace hixl {
+constexpr uint32_t kMaxRailNum = 8U;                                  // 单个CommType最多使用的链路数
+constexpr uint64_t kMinRailStripeSize = 1ULL * 1024ULL * 1024ULL;     // 单个分片的最小字节数
+constexpr uint64_t kRailStripeAlign = 4096U;                          // 分片边界对齐粒度
+
+/**
+ * 多链路条带化传输中一次请求在各链路上的完成句柄，全部完成后请求才算完成
+ */
+struct StripedRequest {
+  struct RailHandle {
+    uint32_t rail;
+    CompleteHandle handle;
+    uint64_t bytes;
+  };
+  std::vector<RailHandle> pending;
+  std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * 同一CommType下的多条链路。rail 0为所属handler已有的主链路，生命周期由handler管理；
+ * 其余链路由MultiRail按HandlerCreateArgs::rail_pairs创建，Finalize时释放。
+ * 大描述符按各链路实测带宽的比例切分为多个分片，小描述符整体分配给当前负载最轻的链路。
+ */
+class MultiRail {
+ public:
+  MultiRail(CommType type, HixlClientHandle primary);
+  ~MultiRail() = default;
+  MultiRail(const MultiRail &) = delete;
+  MultiRail &operator=(const MultiRail &) = delete;
+
+  /**
+   * @brief 为rail_pairs中与type一致的endpoint对创建额外链路
+   * @return 成功:SUCCESS；额外链路创建失败时已创建的链路会被释放
+   */
+  Status Init(const HandlerCreateArgs &args);
+
+  size_t RailNum() const;
+
+  /**
+   * @brief 连接全部额外链路
+   */
+  Status Connect(uint32_t timeout_ms);
+
+  /**
+   * @brief 在全部额外链路上注册本地内存，主链路由handler自行注册
+   */
+  Status RegisterMem(const CommMem &mem);
+
+  Status TransferSync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, uint32_t timeout_ms);
+  Status TransferAsync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, StripedRequest &req);
+
+  /**
+   * @brief 查询条带化请求，已完成的分片从pending中移除并计入对应链路的带宽统计
+   * @param [out] status 任一分片失败即为失败，全部完成时为COMPLETED；失败时其余分片已交还对应链路client，pending为空
+   */
+  Status Query(StripedRequest &req, HixlCompleteStatus &status);
+
+  /**
+   * @brief 解注册并销毁额外链路
+   */
+  void Finalize();
+
+  /**
+   * @brief 将描述符按链路权重切分
+   * @param [out] per_rail 大小为RailNum()，per_rail[i]为第i条链路上的描述符
+   */
+  void Split(const std::vector<TransferOpDesc> &op_descs, std::vector<std::vector<HixlOneSideOpDesc>> &per_rail) const;
+
+  /**
+   * @brief 记录一次分片完成，按EWMA更新该链路带宽
+   */
+  void RecordCompletion(uint32_t rail, uint64_t bytes, uint64_t elapsed_us);
+
+  /**
+   * @brief 链路当前带宽估计，单位 bytes/us，未测量前所有链路相同
+   */
+  double GetBandwidth(uint32_t rail) const;
+
+  void Dump(const char *reason, DumpLogLevel level) const;
+
+ private:
+  struct Rail {
+    HixlClientHandle handle;
+    HandlerCreateArgs::EndpointPair pair;
+    std::vector<MemHandle> mem_handles;
+  };
+
+  std::vector<double> SnapshotWeights() const;
+  Status Submit(const std::vector<std::vector<HixlOneSideOpDesc>> &per_rail, bool is_get, StripedRequest &req);
+  void ReleasePending(StripedRequest &req);
+
+  CommType type_;
+  std::vector<Rail> rails_;  // rails_[0]为主链路
+  mutable std::mutex bw_mutex_;
+  std::vector<double> bandwidth_;
+  std::vector<uint64_t> samples_;  // 各链路已记录的样本数
+  std::unique_ptr<ThreadPool> sync_pool_;  // TransferSync并发执行额外链路分片，随额外链路创建与释放
+};
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_HIXL_ENGINE_MULTI_RAIL_H_
@@ -176,6 +176,7 @@ Status UbClientHandler::Create(const HandlerCreateArgs &args, std::unique_ptr<Ub
   }
   out = MakeUnique<UbClientHandler>(std::move(handles), args.local_engine, args.remote_engine, std::move(link_pairs));
   HIXL_CHECK_NOTNULL(out, "UbClientHandler create failed");
+  out->InitMultiRails(args);
 
   // 若后续步骤失败，确保已创建的 handles 通过 Finalize 释放，避免资源泄漏
   HIXL_DISMISSABLE_GUARD(finalize_guard, [&out]() {
@@ -197,6 +198,29 @@ Status UbClientHandler::Create(const HandlerCreateArgs &args, std::unique_ptr<Ub
   return SUCCESS;
 }
 
+void UbClientHandler::InitMultiRails(const HandlerCreateArgs &args) {
+  if (args.rail_pairs.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  for (const auto &[type, handle] : handles_) {
+    auto multi_rail = MakeUnique<MultiRail>(type, handle);
+    if (multi_rail == nullptr || multi_rail->Init(args) != SUCCESS) {
+      HIXL_LOGW("[UbClientHandler] create extra rails failed, type:%s falls back to single rail",
+                CommTypeToString(type));
+      continue;
+    }
+    if (multi_rail->RailNum() > 1U) {
+      multi_rails_[type] = std::move(multi_rail);
+    }
+  }
+}
+
+MultiRail *UbClientHandler::FindMultiRailLocked(CommType type) const {
+  auto it = multi_rails_.find(type);
+  return it == multi_rails_.end() ? nullptr : it->second.get();
+}
+
 Status UbClientHandler::Connect(uint32_t timeout_ms) {
   std::lock_guard<std::mutex> lock(handle_mutex_);
   if (handles_.empty()) {
@@ -249,10 +273,15 @@ Status UbClientHandler::ConnectHandles(const std::map<CommType, HixlClientHandle
   ThreadPool thread_pool("ub_connect", handles.size());
   for (const auto &[type, handle] : handles) {
     type_order.push_back(type);
-    futures.emplace_back(thread_pool.commit([handle, timeout_ms, type, &context]() -> Status {
+    MultiRail *multi_rail = FindMultiRailLocked(type);
+    futures.emplace_back(thread_pool.commit([handle, multi_rail, timeout_ms, type, &context]() -> Status {
       HIXL_CHK_STATUS_RET(context.SetCurrentContext(), "SetCurrentContext failed");
       HIXL_CHK_STATUS_RET(HixlCSClientConnect(handle, timeout_ms), "UbClientHandler Connect failed for type:%s",
                           CommTypeToString(type));
+      if (multi_rail != nullptr) {
+        HIXL_CHK_STATUS_RET(multi_rail->Connect(timeout_ms), "UbClientHandler connect rails failed for type:%s",
+                            CommTypeToString(type));
+      }
       HIXL_LOGI("[UbClientHandler] Connected type:%s successfully", CommTypeToString(type));
       return SUCCESS;
     }));
@@ -328,6 +357,10 @@ Status UbClientHandler::RegisterMem(const MemHandleInfo &mem_info) {
     MemHandle mh = nullptr;
     HIXL_CHK_STATUS_RET(HixlCSClientRegMem(h_it->second, nullptr, &hccl_mem, &mh));
     mem_handles_[ct].push_back(mh);
+    MultiRail *multi_rail = FindMultiRailLocked(ct);
+    if (multi_rail != nullptr) {
+      HIXL_CHK_STATUS_RET(multi_rail->RegisterMem(hccl_mem));
+    }
   }
   return SUCCESS;
 }
@@ -354,6 +387,14 @@ Status UbClientHandler::TransferAsync(const std::vector<TransferOpDesc> &op_desc
         return FAILED;
       }
       auto handle = it->second;
+      MultiRail *multi_rail = FindMultiRailLocked(type);
+      if (multi_rail != nullptr) {
+        auto striped = MakeShared<StripedRequest>();
+        HIXL_CHECK_NOTNULL(striped);
+        HIXL_CHK_STATUS_RET(multi_rail->TransferAsync(descs, operation, *striped));
+        batch_handles.push_back({type, striped->pending.front().handle, striped});
+        continue;
+      }
 
       uint32_t list_num = static_cast<uint32_t>(descs.size());
       std::vector<HixlOneSideOpDesc> hixl_descs(list_num);
@@ -368,7 +409,7 @@ Status UbClientHandler::TransferAsync(const std::vector<TransferOpDesc> &op_desc
       } else {
         HIXL_CHK_STATUS_RET(HixlCSClientBatchGetAsync(handle, list_num, hixl_descs.data(), &complete_handle));
       }
-      batch_handles.push_back({type, complete_handle});
+      batch_handles.push_back({type, complete_handle, nullptr});
     }
   }
   req = static_cast<TransferReq>(batch_handles[0].handle);
@@ -399,6 +440,7 @@ Status UbClientHandler::TransferSync(const std::vector<TransferOpDesc> &op_descs
     HIXL_CHK_STATUS_RET(ComputeRemainingMs(sync_start, timeout_ms, remaining_ms));
 
     HixlClientHandle handle = nullptr;
+    MultiRail *multi_rail = nullptr;
     {
       std::lock_guard<std::mutex> lock(handle_mutex_);
       auto it = handles_.find(type);
@@ -406,6 +448,11 @@ Status UbClientHandler::TransferSync(const std::vector<TransferOpDesc> &op_descs
         return FAILED;
       }
       handle = it->second;
+      multi_rail = FindMultiRailLocked(type);
+    }
+    if (multi_rail != nullptr) {
+      HIXL_CHK_STATUS_RET(multi_rail->TransferSync(descs, operation, remaining_ms));
+      continue;
     }
 
     uint32_t list_num = static_cast<uint32_t>(descs.size());
@@ -446,7 +493,10 @@ Status UbClientHandler::GetTransferStatus(const TransferReq &req, TransferStatus
       return FAILED;
     }
     HixlCompleteStatus cs = HIXL_COMPLETE_STATUS_WAITING;
-    Status ret = static_cast<Status>(HixlCSClientQueryCompleteStatus(h_it->second, bh.handle, &cs));
+    MultiRail *multi_rail = (bh.striped != nullptr) ? FindMultiRailLocked(bh.type) : nullptr;
+    Status ret = (multi_rail != nullptr)
+                     ? multi_rail->Query(*bh.striped, cs)
+                     : static_cast<Status>(HixlCSClientQueryCompleteStatus(h_it->second, bh.handle, &cs));
     if (ret != SUCCESS) {
       status = TransferStatus::FAILED;
       complete_handles_.erase(req);
@@ -474,6 +524,28 @@ Status UbClientHandler::GetTransferStatus(const TransferReq &req, TransferStatus
   return SUCCESS;
 }
 
+bool UbClientHandler::IsOrderedBefore(const TransferReq &req, const std::vector<TransferOpDesc> &later_descs) const {
+  // 不同CommType走不同链路，仅当req与later_descs都只落在同一条未条带化的链路上时保序
+  std::map<CommType, std::vector<TransferOpDesc>> table;
+  if ((ClassifyTransfers(later_descs, table) != SUCCESS) || (table.size() != 1U)) {
+    return false;
+  }
+  const CommType type = table.begin()->first;
+  {
+    std::lock_guard<std::mutex> lock(handle_mutex_);
+    if (FindMultiRailLocked(type) != nullptr) {
+      return false;
+    }
+  }
+  std::lock_guard<std::mutex> ch_lock(complete_handles_mutex_);
+  const auto it = complete_handles_.find(req);
+  if (it == complete_handles_.end()) {
+    return false;
+  }
+  return std::all_of(it->second.begin(), it->second.end(),
+                     [type](const BatchHandle &bh) { return (bh.type == type) && (bh.striped == nullptr); });
+}
+
 Status UbClientHandler::Finalize() {
   {
     std::lock_guard<std::mutex> lock(complete_handles_mutex_);
@@ -481,6 +553,10 @@ Status UbClientHandler::Finalize() {
   }
   {
     std::scoped_lock lock(mem_handle_mutex_, handle_mutex_);
+    for (auto &[type, multi_rail] : multi_rails_) {
+      multi_rail->Finalize();
+    }
+    multi_rails_.clear();
     for (auto &[type, mem_list] : mem_handles_) {
       auto it = handles_.find(type);
       if (it == handles_.end()) {
@@ -558,6 +634,10 @@ void UbClientHandler::Dump(const char *reason, DumpLogLevel level) const {
     LogUbDumpLink(level, reason, local_engine_, remote_engine_, link.type, link.handle, link.connected,
                   link.local_endpoint, link.remote_endpoint);
   }
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  for (const auto &[type, multi_rail] : multi_rails_) {
+    multi_rail->Dump(reason, level);
+  }
 }
 
 Status UbClientHandler::ClassifyTransfers(const std::vector<TransferOpDesc> &op_descs,
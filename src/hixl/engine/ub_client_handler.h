@@ -12,12 +12,14 @@
 #define CANN_HIXL_SRC_HIXL_ENGINE_UB_CLIENT_HANDLER_H_
 
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
 #include <vector>
 #include "engine/client_handler.h"
 #include "engine/client_handler_factory.h"
+#include "engine/multi_rail.h"
 #include "common/segment.h"
 
 namespace hixl {
@@ -34,6 +36,7 @@ class UbClientHandler : public IClientHandler {
   Status TransferAsync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, TransferReq &req) override;
   Status TransferSync(const std::vector<TransferOpDesc> &op_descs, TransferOp operation, uint32_t timeout_ms) override;
   Status GetTransferStatus(const TransferReq &req, TransferStatus &status) override;
+  bool IsOrderedBefore(const TransferReq &req, const std::vector<TransferOpDesc> &later_descs) const override;
   Status Finalize() override;
   void Dump(const char *reason, DumpLogLevel level = DumpLogLevel::EVENT) const override;
 
@@ -58,9 +61,17 @@ class UbClientHandler : public IClientHandler {
    */
   Status BuildRemoteSegmentsFromMemInfo(const std::vector<MemInfo> &mem_info_list);
 
+  /**
+   * @brief 为rail_pairs中存在额外endpoint对的CommType创建多链路，创建失败时该类型退化为单链路
+   */
+  void InitMultiRails(const HandlerCreateArgs &args);
+
+  MultiRail *FindMultiRailLocked(CommType type) const;
+
   struct BatchHandle {
     CommType type;
     CompleteHandle handle;
+    std::shared_ptr<StripedRequest> striped;  // 多链路条带化请求，单链路时为空
   };
 
   std::map<CommType, HixlClientHandle> handles_;
@@ -68,6 +79,7 @@ class UbClientHandler : public IClientHandler {
   std::string remote_engine_;
   std::map<CommType, HandlerCreateArgs::EndpointPair> link_pairs_;
   std::map<CommType, std::vector<MemHandle>> mem_handles_;
+  std::map<CommType, std::unique_ptr<MultiRail>> multi_rails_;  // 受handle_mutex_保护
   std::vector<SegmentPtr> local_segments_;
   std::vector<SegmentPtr> remote_segments_;
   std::map<TransferReq, std::vector<BatchHandle>> complete_handles_;
@@ -10,8 +10,13 @@
 
 #include "fabric_mem/fabric_mem_allocator.h"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <mutex>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "common/hixl_checker.h"
 #include "common/hixl_log.h"
@@ -25,26 +30,123 @@ constexpr int32_t kNumaNodeStep = 2;
 // aclrtMemSetAccess count: number of aclrtMemAccessDesc entries.
 constexpr size_t kMemAccessDescCount = 1U;
 
+// Size classes and registry shards follow the 2 MB huge-page granularity used by VMM mappings.
+constexpr size_t kSizeClassGranularity = 2UL * 1024UL * 1024UL;
+constexpr uint32_t kRegistryShardShift = 21U;
+constexpr size_t kRegistryShardNum = 16U;
+
 // ACL fabric export may be performed only once per physical allocation. MallocMem records va→pa
 // without exporting; the first ExportToShareableHandle (from the caller or from RegisterMem) does
-// the ACL export and caches the handle for later reuse.
+// the ACL export and caches the handle for later reuse. The record travels with the allocation
+// into the idle cache, so a reused allocation keeps its exported handle.
 struct AllocationRecord {
   aclrtDrvMemHandle pa_handle = nullptr;
   aclrtMemFabricHandle share_handle{};
   bool exported = false;
+  MemType type = MemType::MEM_DEVICE;
+  int32_t logic_device_id = 0;
+  size_t size = 0U;
+  // Size was rounded to a size class, so the allocation may be parked in the idle cache on free.
+  bool cacheable = false;
+};
+
+struct RegistryShard {
+  std::mutex mutex;
+  std::unordered_map<uintptr_t, AllocationRecord> allocations;
 };
 
-std::mutex g_allocation_mutex;
-std::unordered_map<uintptr_t, AllocationRecord> g_allocations;
+struct CachedAllocation {
+  uintptr_t va_addr = 0U;
+  AllocationRecord record;
+};
+
+// (type, logic device id, size class)
+using SizeClassKey = std::tuple<MemType, int32_t, size_t>;
+
+// MallocMem/FreeMem are process-wide, so the cache is shared by all engines. Each engine that
+// enables it holds a reference and adds its capacity to the budget; the last one disables it.
+struct AllocationCache {
+  std::mutex mutex;
+  size_t ref_count = 0U;
+  size_t capacity = 0U;
+  size_t cached_bytes = 0U;
+  std::map<SizeClassKey, std::vector<CachedAllocation>> idle;
+};
+
+RegistryShard g_registry[kRegistryShardNum];
+AllocationCache g_cache;
+
+RegistryShard &GetShard(uintptr_t va_addr) {
+  return g_registry[(va_addr >> kRegistryShardShift) % kRegistryShardNum];
+}
+
+void AddAllocation(uintptr_t va_addr, const AllocationRecord &record) {
+  auto &shard = GetShard(va_addr);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  shard.allocations[va_addr] = record;
+}
+
+Status TakeAllocation(uintptr_t va_addr, AllocationRecord &record) {
+  auto &shard = GetShard(va_addr);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto it = shard.allocations.find(va_addr);
+  if (it == shard.allocations.end()) {
+    return FAILED;
+  }
+  record = it->second;
+  shard.allocations.erase(it);
+  return SUCCESS;
+}
+
+size_t RoundUpToSizeClass(size_t size) {
+  return (size + kSizeClassGranularity - 1U) / kSizeClassGranularity * kSizeClassGranularity;
+}
+
+bool IsCacheEnabled() {
+  std::lock_guard<std::mutex> lock(g_cache.mutex);
+  return g_cache.ref_count > 0U;
+}
+
+bool PopCachedAllocation(const SizeClassKey &key, CachedAllocation &cached) {
+  std::lock_guard<std::mutex> lock(g_cache.mutex);
+  const auto it = g_cache.idle.find(key);
+  if (it == g_cache.idle.end() || it->second.empty()) {
+    return false;
+  }
+  cached = it->second.back();
+  it->second.pop_back();
+  g_cache.cached_bytes -= cached.record.size;
+  return true;
+}
+
+bool PushCachedAllocation(uintptr_t va_addr, const AllocationRecord &record) {
+  std::lock_guard<std::mutex> lock(g_cache.mutex);
+  if (g_cache.ref_count == 0U || g_cache.cached_bytes + record.size > g_cache.capacity) {
+    return false;
+  }
+  g_cache.idle[SizeClassKey{record.type, record.logic_device_id, record.size}].push_back(
+      CachedAllocation{va_addr, record});
+  g_cache.cached_bytes += record.size;
+  return true;
+}
 
-void AddAllocation(uintptr_t va_addr, aclrtDrvMemHandle pa_handle) {
-  std::lock_guard<std::mutex> lock(g_allocation_mutex);
-  g_allocations[va_addr] = AllocationRecord{pa_handle, {}, false};
+void ReleaseAllocation(uintptr_t va_addr, aclrtDrvMemHandle pa_handle) {
+  HIXL_CHK_ACL(aclrtUnmapMem(reinterpret_cast<void *>(va_addr)), "Unmap fabric memory failed.");
+  (void)VirtualMemoryManager::GetInstance().ReleaseMemory(va_addr);
+  HIXL_CHK_ACL(aclrtFreePhysical(pa_handle), "Free physical memory failed.");
 }
 
-void RemoveAllocation(uintptr_t va_addr) {
-  std::lock_guard<std::mutex> lock(g_allocation_mutex);
-  g_allocations.erase(va_addr);
+// Caller holds g_cache.mutex. Evicts idle allocations until cached bytes fit in the budget.
+void TrimIdleLocked(std::vector<CachedAllocation> &evicted) {
+  for (auto it = g_cache.idle.begin(); it != g_cache.idle.end() && g_cache.cached_bytes > g_cache.capacity;) {
+    auto &allocations = it->second;
+    while (!allocations.empty() && g_cache.cached_bytes > g_cache.capacity) {
+      g_cache.cached_bytes -= allocations.back().record.size;
+      evicted.emplace_back(allocations.back());
+      allocations.pop_back();
+    }
+    it = allocations.empty() ? g_cache.idle.erase(it) : std::next(it);
+  }
 }
 
 aclrtPhysicalMemProp BuildDefaultPhysicalMemProp() {
@@ -83,6 +185,18 @@ Status FabricMemAllocator::MallocMem(MemType type, size_t size, void **ptr) {
   int32_t logic_device_id = 0;
   HIXL_CHK_ACL_RET(aclrtGetDevice(&logic_device_id), "Get current device failed.");
 
+  const bool cacheable = IsCacheEnabled();
+  if (cacheable) {
+    size = RoundUpToSizeClass(size);
+    CachedAllocation cached;
+    if (PopCachedAllocation(SizeClassKey{type, logic_device_id, size}, cached)) {
+      AddAllocation(cached.va_addr, cached.record);
+      *ptr = reinterpret_cast<void *>(cached.va_addr);
+      HIXL_LOGD("MallocFabricMemory reused cached allocation, va:%lu, size:%zu.", cached.va_addr, size);
+      return SUCCESS;
+    }
+  }
+
   aclrtDrvMemHandle pa_handle = nullptr;
   uintptr_t virtual_addr = 0;
   HIXL_CHK_STATUS_RET(AllocatePhysicalMemory(type, size, logic_device_id, pa_handle),
@@ -102,7 +216,13 @@ Status FabricMemAllocator::MallocMem(MemType type, size_t size, void **ptr) {
                         "Failed to set device access for host fabric memory.");
   }
 
-  AddAllocation(virtual_addr, pa_handle);
+  AllocationRecord record;
+  record.pa_handle = pa_handle;
+  record.type = type;
+  record.logic_device_id = logic_device_id;
+  record.size = size;
+  record.cacheable = cacheable;
+  AddAllocation(virtual_addr, record);
   *ptr = va_ptr;
   HIXL_DISMISS_GUARD(unmap_guard);
   HIXL_DISMISS_GUARD(release_va_guard);
@@ -114,17 +234,83 @@ Status FabricMemAllocator::MallocMem(MemType type, size_t size, void **ptr) {
 Status FabricMemAllocator::FreeMem(void *ptr) {
   HIXL_CHK_BOOL_RET_STATUS(ptr != nullptr, PARAM_INVALID, "Fabric memory address cannot be nullptr.");
   const auto va_addr = reinterpret_cast<uintptr_t>(ptr);
-  aclrtDrvMemHandle pa_handle = nullptr;
-  HIXL_CHK_STATUS_RET(GetPaHandleFromVa(va_addr, pa_handle), "Failed to get physical memory handle.");
+  AllocationRecord record;
+  HIXL_CHK_STATUS_RET(TakeAllocation(va_addr, record), "Failed to get physical memory handle.");
 
-  RemoveAllocation(va_addr);
-  HIXL_CHK_ACL(aclrtUnmapMem(ptr), "Unmap fabric memory failed.");
-  (void)VirtualMemoryManager::GetInstance().ReleaseMemory(va_addr);
-  HIXL_CHK_ACL(aclrtFreePhysical(pa_handle), "Free physical memory failed.");
+  // An exported share handle may still be held by peers and ACL cannot revoke or re-export it,
+  // so exported allocations are always released instead of being handed to a later caller.
+  if (record.cacheable && !record.exported && PushCachedAllocation(va_addr, record)) {
+    HIXL_LOGD("FreeFabricMemory cached allocation, va:%lu, size:%zu.", va_addr, record.size);
+    return SUCCESS;
+  }
+  ReleaseAllocation(va_addr, record.pa_handle);
   HIXL_LOGI("FreeFabricMemory success, va:%lu.", va_addr);
   return SUCCESS;
 }
 
+Status FabricMemAllocator::Initialize(const FabricMemCacheConfig &config) {
+  if (config.cache_capacity == 0U) {
+    return SUCCESS;
+  }
+  HIXL_CHK_BOOL_RET_STATUS(config.reserve_block_num == 0U || config.reserve_block_size > 0U, PARAM_INVALID,
+                           "Fabric memory reserve_block_size must be set when reserve_block_num:%zu > 0.",
+                           config.reserve_block_num);
+  const size_t reserve_block_size = RoundUpToSizeClass(config.reserve_block_size);
+  HIXL_CHK_BOOL_RET_STATUS(
+      config.reserve_block_num == 0U || reserve_block_size <= config.cache_capacity / config.reserve_block_num,
+      PARAM_INVALID, "Fabric memory reserve %zu x %zu bytes exceeds cache capacity:%zu.", config.reserve_block_num,
+      reserve_block_size, config.cache_capacity);
+  {
+    std::lock_guard<std::mutex> lock(g_cache.mutex);
+    ++g_cache.ref_count;
+    g_cache.capacity += config.cache_capacity;
+  }
+  HIXL_DISMISSABLE_GUARD(finalize_guard, ([&config]() { Finalize(config); }));
+  std::vector<void *> reserved;
+  reserved.reserve(config.reserve_block_num);
+  // Freeing parks the blocks in the cache; on failure finalize_guard then releases them.
+  HIXL_MAKE_GUARD(park_reserved_guard, ([&reserved]() {
+                    for (void *ptr : reserved) {
+                      (void)FreeMem(ptr);
+                    }
+                  }));
+  // Allocate every block before parking any, so the reserve holds distinct allocations.
+  for (size_t i = 0U; i < config.reserve_block_num; ++i) {
+    void *ptr = nullptr;
+    HIXL_CHK_STATUS_RET(MallocMem(MemType::MEM_DEVICE, reserve_block_size, &ptr),
+                        "Failed to reserve fabric memory block:%zu.", i);
+    reserved.emplace_back(ptr);
+  }
+  HIXL_DISMISS_GUARD(finalize_guard);
+  HIXL_LOGI("Fabric memory cache initialized, capacity:%zu, reserved:%zu x %zu bytes.", config.cache_capacity,
+            config.reserve_block_num, reserve_block_size);
+  return SUCCESS;
+}
+
+void FabricMemAllocator::Finalize(const FabricMemCacheConfig &config) {
+  if (config.cache_capacity == 0U) {
+    return;
+  }
+  std::vector<CachedAllocation> evicted;
+  {
+    std::lock_guard<std::mutex> lock(g_cache.mutex);
+    if (g_cache.ref_count == 0U) {
+      return;
+    }
+    --g_cache.ref_count;
+    g_cache.capacity -= std::min(g_cache.capacity, config.cache_capacity);
+    TrimIdleLocked(evicted);
+  }
+  for (const auto &cached : evicted) {
+    ReleaseAllocation(cached.va_addr, cached.record.pa_handle);
+  }
+}
+
+size_t FabricMemAllocator::GetCachedBytes() {
+  std::lock_guard<std::mutex> lock(g_cache.mutex);
+  return g_cache.cached_bytes;
+}
+
 Status FabricMemAllocator::AllocatePhysicalMemory(MemType type, size_t total_size, int32_t logic_device_id,
                                                   aclrtDrvMemHandle &handle) {
   HIXL_CHK_BOOL_RET_STATUS(type == MemType::MEM_HOST || type == MemType::MEM_DEVICE, PARAM_INVALID,
@@ -163,9 +349,10 @@ Status FabricMemAllocator::AllocatePhysicalMemory(MemType type, size_t total_siz
 }
 
 Status FabricMemAllocator::GetPaHandleFromVa(uintptr_t va_addr, aclrtDrvMemHandle &pa_handle) {
-  std::lock_guard<std::mutex> lock(g_allocation_mutex);
-  const auto it = g_allocations.find(va_addr);
-  if (it == g_allocations.end()) {
+  auto &shard = GetShard(va_addr);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto it = shard.allocations.find(va_addr);
+  if (it == shard.allocations.end()) {
     return FAILED;
   }
   pa_handle = it->second.pa_handle;
@@ -173,9 +360,10 @@ Status FabricMemAllocator::GetPaHandleFromVa(uintptr_t va_addr, aclrtDrvMemHandl
 }
 
 Status FabricMemAllocator::ExportToShareableHandle(uintptr_t va_addr, aclrtMemFabricHandle &share_handle) {
-  std::lock_guard<std::mutex> lock(g_allocation_mutex);
-  const auto it = g_allocations.find(va_addr);
-  HIXL_CHK_BOOL_RET_STATUS(it != g_allocations.end(), PARAM_INVALID,
+  auto &shard = GetShard(va_addr);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto it = shard.allocations.find(va_addr);
+  HIXL_CHK_BOOL_RET_STATUS(it != shard.allocations.end(), PARAM_INVALID,
                            "Address:%lu was not allocated by fabric MallocMem or is already freed.", va_addr);
   if (it->second.exported) {
     share_handle = it->second.share_handle;
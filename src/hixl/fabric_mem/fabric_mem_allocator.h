@@ -18,8 +18,24 @@
 #include "hixl/hixl_types.h"
 
 namespace hixl {
+// Idle-allocation cache for MallocMem. Freed allocations whose size class fits in cache_capacity keep
+// their physical handle and VA mapping, so a later MallocMem of the same (type, size class) is served
+// without driver calls. Exported allocations are never cached. cache_capacity == 0 disables the cache.
+struct FabricMemCacheConfig {
+  size_t cache_capacity = 0U;
+  // Device allocations pre-created at Initialize and parked in the cache.
+  size_t reserve_block_size = 0U;
+  size_t reserve_block_num = 0U;
+};
+
 class FabricMemAllocator {
  public:
+  // Takes a reference on the shared idle cache, adds config.cache_capacity to its budget and
+  // pre-reserves config.reserve_block_num device blocks. The reserved bytes must fit in cache_capacity.
+  static Status Initialize(const FabricMemCacheConfig &config);
+  // Drops the reference taken by Initialize with the same config and trims idle allocations to the
+  // remaining budget; the last reference releases every cached allocation. Live allocations are untouched.
+  static void Finalize(const FabricMemCacheConfig &config);
   // Allocates VMM memory without exporting. ExportToShareableHandle performs ACL export at most
   // once per allocation and caches the handle for later callers (including RegisterMem).
   static Status MallocMem(MemType type, size_t size, void **ptr);
@@ -29,6 +45,7 @@ class FabricMemAllocator {
   static Status GetPaHandleFromVa(uintptr_t va_addr, aclrtDrvMemHandle &pa_handle);
   static Status AllocatePhysicalMemory(MemType type, size_t total_size, int32_t logic_device_id,
                                        aclrtDrvMemHandle &handle);
+  static size_t GetCachedBytes();
 };
 }  // namespace hixl
 
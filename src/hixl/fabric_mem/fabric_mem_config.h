@@ -27,6 +27,10 @@ struct FabricMemConfig {
   size_t task_stream_num = 1U;
   size_t max_stream_num = 512U;
   bool enable_aicpu_unfold = true;
+  // Idle-allocation cache of FabricMemAllocator, in bytes; 0 disables it.
+  size_t cache_capacity = 0U;
+  size_t reserve_block_size = 0U;
+  size_t reserve_block_num = 0U;
 };
 }  // namespace hixl
 
@@ -287,6 +287,8 @@ void FabricMemTransferService::FillPollInfo(const AsyncRecord &record, AsyncTran
   info->op_type = record.op_type;
   info->prof_start_time = record.prof_start_time;
   info->channel_id = record.channel_id;
+  info->transfer_start = record.transfer_start;
+  info->transfer_bytes = record.transfer_bytes;
 }
 
 Status FabricMemTransferService::ResolveTransferAddrs(std::vector<TransferOpDesc> &op_descs,
@@ -87,6 +87,8 @@ struct AsyncTransferPollInfo {
   TransferOp op_type = READ;
   uint64_t prof_start_time{0U};
   std::string channel_id;
+  std::chrono::steady_clock::time_point transfer_start;
+  uint64_t transfer_bytes = 0UL;
 };
 
 struct FabricMemTransferContext {
@@ -0,0 +1,447 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "hcomm_loopback.h"
+
+#include <sys/uio.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include "hccl/hccl_types.h"
+#include "common/hixl_log.h"
+#include "hixl/hixl_types.h"
+
+namespace hixl {
+namespace {
+constexpr uint32_t kLoopbackMagic = 0x4C4F4F50U;  // "LOOP"
+// Channel handles carry the magic in the upper 32 bits, above any user-space address or hcomm handle index.
+constexpr uint64_t kLoopbackHandleTag = static_cast<uint64_t>(kLoopbackMagic) << 32U;
+constexpr uint64_t kLoopbackHandleTagMask = 0xFFFFFFFF00000000ULL;
+// Same status codes as HcommChannelGetStatus: 0 = connected, 2 = failed.
+constexpr int32_t kChannelConnectedStatus = 0;
+constexpr int32_t kChannelFailedStatus = 2;
+
+/**
+ * Exported form of a registered memory region. The owner pid lets an importer in another process reach the region
+ * through process_vm_*.
+ */
+struct LoopbackMemDesc {
+  uint32_t magic;
+  int32_t type;
+  uint64_t addr;
+  uint64_t size;
+  int32_t pid;
+  uint32_t reserved;
+};
+
+struct LoopbackMem {
+  EndpointHandle endpoint;
+  LoopbackMemDesc desc;
+};
+
+/**
+ * Remote region made reachable by MemImport. Only addresses inside an imported host range are ever copied; the
+ * importers map keeps the range alive until every importing endpoint unimports it or is destroyed.
+ */
+struct ImportedRange {
+  uint64_t size;
+  int32_t pid;
+  std::unordered_map<EndpointHandle, uint32_t> importers;
+};
+
+// Control calls take the lock exclusively; the data path only looks up imported ranges and shares it.
+std::shared_mutex g_mutex;
+std::unordered_map<EndpointHandle, std::unique_ptr<EndpointDesc>> g_endpoints;
+std::unordered_map<HcommMemHandle, std::unique_ptr<LoopbackMem>> g_mems;
+std::map<uint64_t, ImportedRange> g_imported_ranges;  // keyed by start address in the owner process
+std::unordered_set<ChannelHandle> g_channels;
+std::atomic<uint64_t> g_next_channel_id{1U};
+
+int32_t SelfPid() {
+  static const int32_t pid = static_cast<int32_t>(getpid());
+  return pid;
+}
+
+bool RangeCovers(uint64_t start, uint64_t size, uint64_t addr, uint64_t len) {
+  return addr >= start && addr - start <= size && len <= size - (addr - start);
+}
+
+// Returns the owner pid of an imported range covering [remote, remote + len), or -1 if nothing imported covers it.
+int32_t FindOwnerPid(const void *remote, uint64_t len) {
+  const auto addr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(remote));
+  std::shared_lock<std::shared_mutex> lock(g_mutex);
+  auto it = g_imported_ranges.upper_bound(addr);
+  if (it == g_imported_ranges.begin()) {
+    return -1;
+  }
+  --it;
+  return RangeCovers(it->first, it->second.size, addr, len) ? it->second.pid : -1;
+}
+
+bool ReadMemDesc(const void *mem_desc, uint32_t desc_len, LoopbackMemDesc &desc) {
+  if (desc_len != sizeof(desc)) {
+    return false;
+  }
+  (void)memcpy(&desc, mem_desc, sizeof(desc));
+  if (desc.magic != kLoopbackMagic) {
+    HIXL_LOGE(PARAM_INVALID, "[HcommLoopback] mem desc is not exported by a loopback endpoint, magic:0x%X", desc.magic);
+    return false;
+  }
+  return true;
+}
+
+// A local descriptor must match a live registration exactly; a foreign one can only be checked for sanity here.
+bool IsRegisteredLocked(const LoopbackMemDesc &desc) {
+  if (desc.pid != SelfPid()) {
+    return desc.pid > 0;
+  }
+  for (const auto &it : g_mems) {
+    const auto &mem = it.second->desc;
+    if (mem.addr == desc.addr && mem.size == desc.size && mem.type == desc.type) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ReleaseImportLocked(std::map<uint64_t, ImportedRange>::iterator it, EndpointHandle endpoint_handle) {
+  auto importer = it->second.importers.find(endpoint_handle);
+  if (importer == it->second.importers.end()) {
+    return;
+  }
+  if (--importer->second == 0U) {
+    it->second.importers.erase(importer);
+  }
+  if (it->second.importers.empty()) {
+    g_imported_ranges.erase(it);
+  }
+}
+
+int32_t CopyFromPeer(int32_t pid, void *local, const void *remote, uint64_t len) {
+  uint64_t done = 0U;
+  while (done < len) {
+    iovec local_iov{static_cast<uint8_t *>(local) + done, static_cast<size_t>(len - done)};
+    iovec remote_iov{const_cast<uint8_t *>(static_cast<const uint8_t *>(remote)) + done, static_cast<size_t>(len - done)};
+    const ssize_t copied = process_vm_readv(pid, &local_iov, 1UL, &remote_iov, 1UL, 0UL);
+    if (copied <= 0) {
+      HIXL_LOGE(FAILED, "[HcommLoopback] process_vm_readv failed, pid:%d, remote:%p, len:%lu, errno:%d(%s)", pid,
+                remote, len, errno, strerror(errno));
+      return HCCL_E_INTERNAL;
+    }
+    done += static_cast<uint64_t>(copied);
+  }
+  return HCCL_SUCCESS;
+}
+
+int32_t CopyToPeer(int32_t pid, void *remote, const void *local, uint64_t len) {
+  uint64_t done = 0U;
+  while (done < len) {
+    iovec local_iov{const_cast<uint8_t *>(static_cast<const uint8_t *>(local)) + done, static_cast<size_t>(len - done)};
+    iovec remote_iov{static_cast<uint8_t *>(remote) + done, static_cast<size_t>(len - done)};
+    const ssize_t copied = process_vm_writev(pid, &local_iov, 1UL, &remote_iov, 1UL, 0UL);
+    if (copied <= 0) {
+      HIXL_LOGE(FAILED, "[HcommLoopback] process_vm_writev failed, pid:%d, remote:%p, len:%lu, errno:%d(%s)", pid,
+                remote, len, errno, strerror(errno));
+      return HCCL_E_INTERNAL;
+    }
+    done += static_cast<uint64_t>(copied);
+  }
+  return HCCL_SUCCESS;
+}
+
+int32_t CopyOneSided(void *dst, const void *src, uint64_t len, bool remote_is_src) {
+  if (len == 0U) {
+    return HCCL_SUCCESS;
+  }
+  if (dst == nullptr || src == nullptr) {
+    return HCCL_E_PTR;
+  }
+  const void *remote = remote_is_src ? src : dst;
+  const int32_t pid = FindOwnerPid(remote, len);
+  if (pid < 0) {
+    HIXL_LOGE(PARAM_INVALID, "[HcommLoopback] remote range is not covered by any imported host memory, "
+              "remote:%p, len:%lu", remote, len);
+    return HCCL_E_PARA;
+  }
+  if (pid == SelfPid()) {
+    (void)memmove(dst, src, static_cast<size_t>(len));
+    return HCCL_SUCCESS;
+  }
+  return remote_is_src ? CopyFromPeer(pid, dst, src, len) : CopyToPeer(pid, dst, src, len);
+}
+}  // namespace
+
+void HcommLoopback::MarkEndpoint(EndpointDesc &endpoint) {
+  (void)memcpy(endpoint.raws, &kLoopbackMagic, sizeof(kLoopbackMagic));
+}
+
+bool HcommLoopback::IsMarkedEndpoint(const EndpointDesc &endpoint) {
+  uint32_t magic = 0U;
+  (void)memcpy(&magic, endpoint.raws, sizeof(magic));
+  return magic == kLoopbackMagic;
+}
+
+bool HcommLoopback::OwnsEndpoint(EndpointHandle endpoint_handle) {
+  std::shared_lock<std::shared_mutex> lock(g_mutex);
+  return g_endpoints.count(endpoint_handle) != 0U;
+}
+
+bool HcommLoopback::OwnsChannel(ChannelHandle channel) {
+  return (channel & kLoopbackHandleTagMask) == kLoopbackHandleTag;
+}
+
+HcommResult HcommLoopback::EndpointCreate(const EndpointDesc *endpoint, EndpointHandle *endpoint_handle) {
+  if (endpoint == nullptr || endpoint_handle == nullptr) {
+    return HCCL_E_PTR;
+  }
+  auto desc = std::make_unique<EndpointDesc>(*endpoint);
+  EndpointHandle handle = desc.get();
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  g_endpoints.emplace(handle, std::move(desc));
+  *endpoint_handle = handle;
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::EndpointDestroy(EndpointHandle endpoint_handle) {
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  for (auto it = g_mems.begin(); it != g_mems.end();) {
+    it = (it->second->endpoint == endpoint_handle) ? g_mems.erase(it) : std::next(it);
+  }
+  for (auto it = g_imported_ranges.begin(); it != g_imported_ranges.end();) {
+    (void)it->second.importers.erase(endpoint_handle);
+    it = it->second.importers.empty() ? g_imported_ranges.erase(it) : std::next(it);
+  }
+  return g_endpoints.erase(endpoint_handle) != 0U ? HCCL_SUCCESS : HCCL_E_PARA;
+}
+
+HcommResult HcommLoopback::EndpointGetListenPort(EndpointHandle endpoint_handle, uint32_t *port) {
+  (void)endpoint_handle;
+  if (port == nullptr) {
+    return HCCL_E_PTR;
+  }
+  // Channels are matched by name only, no listening socket is opened.
+  *port = 0U;
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::MemReg(EndpointHandle endpoint_handle, const char *mem_tag, const CommMem *mem,
+                                  HcommMemHandle *mem_handle) {
+  (void)mem_tag;
+  if (mem == nullptr || mem_handle == nullptr) {
+    return HCCL_E_PTR;
+  }
+  auto record = std::make_unique<LoopbackMem>();
+  record->endpoint = endpoint_handle;
+  record->desc.magic = kLoopbackMagic;
+  record->desc.type = static_cast<int32_t>(mem->type);
+  record->desc.addr = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(mem->addr));
+  record->desc.size = mem->size;
+  record->desc.pid = SelfPid();
+  record->desc.reserved = 0U;
+  HcommMemHandle handle = record.get();
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  if (g_endpoints.count(endpoint_handle) == 0U) {
+    return HCCL_E_PARA;
+  }
+  g_mems.emplace(handle, std::move(record));
+  *mem_handle = handle;
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::MemUnreg(EndpointHandle endpoint_handle, HcommMemHandle mem_handle) {
+  (void)endpoint_handle;
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  const auto it = g_mems.find(mem_handle);
+  if (it == g_mems.end()) {
+    return HCCL_E_PARA;
+  }
+  // Imports of the region in this process become unreachable together with the registration.
+  const auto range = g_imported_ranges.find(it->second->desc.addr);
+  if (range != g_imported_ranges.end() && range->second.pid == SelfPid()) {
+    g_imported_ranges.erase(range);
+  }
+  g_mems.erase(it);
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::MemExport(EndpointHandle endpoint_handle, HcommMemHandle mem_handle, void **mem_desc,
+                                     uint32_t *mem_desc_len) {
+  (void)endpoint_handle;
+  if (mem_desc == nullptr || mem_desc_len == nullptr) {
+    return HCCL_E_PTR;
+  }
+  std::shared_lock<std::shared_mutex> lock(g_mutex);
+  const auto it = g_mems.find(mem_handle);
+  if (it == g_mems.end()) {
+    return HCCL_E_PARA;
+  }
+  // The descriptor stays owned by the registration and is valid until MemUnreg.
+  *mem_desc = &it->second->desc;
+  *mem_desc_len = static_cast<uint32_t>(sizeof(LoopbackMemDesc));
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::MemImport(EndpointHandle endpoint_handle, const void *mem_desc, uint32_t desc_len,
+                                     CommMem *out_mem) {
+  if (mem_desc == nullptr || out_mem == nullptr) {
+    return HCCL_E_PTR;
+  }
+  LoopbackMemDesc desc{};
+  if (!ReadMemDesc(mem_desc, desc_len, desc)) {
+    return HCCL_E_PARA;
+  }
+  if (desc.addr == 0U || desc.size == 0U || desc.size > UINT64_MAX - desc.addr) {
+    HIXL_LOGE(PARAM_INVALID, "[HcommLoopback] invalid mem desc range, addr:0x%lx, size:%lu", desc.addr, desc.size);
+    return HCCL_E_PARA;
+  }
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  if (g_endpoints.count(endpoint_handle) == 0U) {
+    return HCCL_E_PARA;
+  }
+  if (!IsRegisteredLocked(desc)) {
+    HIXL_LOGE(PARAM_INVALID, "[HcommLoopback] mem desc does not match a registered region, addr:0x%lx, size:%lu, "
+              "pid:%d", desc.addr, desc.size, desc.pid);
+    return HCCL_E_PARA;
+  }
+  // Device memory is never addressable by CPU copies, so it is imported without becoming a copy target.
+  if (desc.type == static_cast<int32_t>(COMM_MEM_TYPE_HOST)) {
+    auto &range = g_imported_ranges[desc.addr];
+    if (range.importers.empty()) {
+      range.size = desc.size;
+      range.pid = desc.pid;
+    } else if (range.size != desc.size || range.pid != desc.pid) {
+      HIXL_LOGE(PARAM_INVALID, "[HcommLoopback] mem desc conflicts with an imported region, addr:0x%lx, "
+                "size:%lu/%lu, pid:%d/%d", desc.addr, desc.size, range.size, desc.pid, range.pid);
+      return HCCL_E_PARA;
+    }
+    ++range.importers[endpoint_handle];
+  }
+  out_mem->type = static_cast<CommMemType>(desc.type);
+  out_mem->addr = reinterpret_cast<void *>(static_cast<uintptr_t>(desc.addr));
+  out_mem->size = desc.size;
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::MemUnimport(EndpointHandle endpoint_handle, const void *mem_desc, uint32_t desc_len) {
+  if (mem_desc == nullptr) {
+    return HCCL_E_PTR;
+  }
+  LoopbackMemDesc desc{};
+  if (!ReadMemDesc(mem_desc, desc_len, desc)) {
+    return HCCL_E_PARA;
+  }
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  auto it = g_imported_ranges.find(desc.addr);
+  if (it != g_imported_ranges.end() && it->second.pid == desc.pid) {
+    ReleaseImportLocked(it, endpoint_handle);
+  }
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::ChannelCreate(EndpointHandle endpoint_handle, CommEngine engine,
+                                         HcommChannelDesc *channel_descs, uint32_t channel_num,
+                                         ChannelHandle *channels) {
+  (void)engine;
+  if (channel_descs == nullptr || channels == nullptr) {
+    return HCCL_E_PTR;
+  }
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  if (g_endpoints.count(endpoint_handle) == 0U) {
+    return HCCL_E_PARA;
+  }
+  for (uint32_t i = 0U; i < channel_num; ++i) {
+    channels[i] = kLoopbackHandleTag | g_next_channel_id.fetch_add(1U, std::memory_order_relaxed);
+    (void)g_channels.insert(channels[i]);
+  }
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::ChannelDestroy(const ChannelHandle *channels, uint32_t channel_num) {
+  if (channels == nullptr) {
+    return HCCL_E_PTR;
+  }
+  std::lock_guard<std::shared_mutex> lock(g_mutex);
+  for (uint32_t i = 0U; i < channel_num; ++i) {
+    (void)g_channels.erase(channels[i]);
+  }
+  return HCCL_SUCCESS;
+}
+
+HcommResult HcommLoopback::ChannelGetStatus(const ChannelHandle *channel_list, uint32_t list_num,
+                                            int32_t *status_list) {
+  if (channel_list == nullptr || status_list == nullptr) {
+    return HCCL_E_PTR;
+  }
+  std::shared_lock<std::shared_mutex> lock(g_mutex);
+  for (uint32_t i = 0U; i < list_num; ++i) {
+    status_list[i] = (g_channels.count(channel_list[i]) != 0U) ? kChannelConnectedStatus : kChannelFailedStatus;
+  }
+  return HCCL_SUCCESS;
+}
+
+int32_t HcommLoopback::Write(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src, uint64_t len) {
+  (void)thread;
+  (void)channel;
+  return CopyOneSided(dst, src, len, false);
+}
+
+int32_t HcommLoopback::Read(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src, uint64_t len) {
+  (void)thread;
+  (void)channel;
+  return CopyOneSided(dst, src, len, true);
+}
+
+int32_t HcommLoopback::ChannelFence(ThreadHandle thread, ChannelHandle channel) {
+  (void)thread;
+  (void)channel;
+  // Every copy has already completed when Read/Write returns.
+  return HCCL_SUCCESS;
+}
+
+int32_t HcommLoopback::BatchTransfer(ThreadHandle thread, ChannelHandle channel,
+                                     const HcommBatchTransferDesc *transfer_descs, uint32_t transfer_desc_num) {
+  if (transfer_descs == nullptr) {
+    return HCCL_E_PTR;
+  }
+  for (uint32_t i = 0U; i < transfer_desc_num; ++i) {
+    const auto &desc = transfer_descs[i];
+    int32_t ret = HCCL_SUCCESS;
+    switch (desc.transType) {
+      case HCOMM_TRANSFER_TYPE_WRITE:
+        ret = Write(thread, channel, desc.transferInfo.write.dst, desc.transferInfo.write.src,
+                    desc.transferInfo.write.len);
+        break;
+      case HCOMM_TRANSFER_TYPE_READ:
+        ret = Read(thread, channel, desc.transferInfo.read.dst, desc.transferInfo.read.src, desc.transferInfo.read.len);
+        break;
+      case HCOMM_TRANSFER_TYPE_NOTIFY_RECORD:
+      case HCOMM_TRANSFER_TYPE_NOTIFY_WAIT:
+        break;
+      default:
+        HIXL_LOGE(UNSUPPORTED, "[HcommLoopback] transfer type:%d is not supported",
+                  static_cast<int32_t>(desc.transType));
+        return HCCL_E_NOT_SUPPORT;
+    }
+    if (ret != HCCL_SUCCESS) {
+      return ret;
+    }
+  }
+  return HCCL_SUCCESS;
+}
+
+}  // namespace hixl
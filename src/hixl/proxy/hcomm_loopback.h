@@ -0,0 +1,63 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_HIXL_SRC_PROXY_HCOMM_LOOPBACK_H_
+#define CANN_HIXL_SRC_PROXY_HCOMM_LOOPBACK_H_
+
+#include "hcomm/hcomm_res_defs.h"
+#include "hcomm/hcomm_exception.h"
+
+namespace hixl {
+
+/**
+ * @brief CPU-only implementation of the Hcomm API, used by HcommProxy for endpoints marked with MarkEndpoint and for
+ *        everything created from them. Endpoints and channels are bookkeeping records; one-sided reads and writes
+ *        are executed as memcpy when the remote memory lives in this process and as process_vm_readv/
+ *        process_vm_writev when it was exported by another process on the same host. Fences complete immediately.
+ * @note Only host memory imported through MemImport can be moved; any other remote address is rejected.
+ *       Cross-process copies need ptrace permission over the peer (same user and a suitable
+ *       kernel.yama.ptrace_scope), which is left to the deployment.
+ */
+class HcommLoopback {
+ public:
+  /**
+   * @brief Tag an endpoint description so that HcommProxy::EndpointCreate serves it from this backend.
+   */
+  static void MarkEndpoint(EndpointDesc &endpoint);
+  static bool IsMarkedEndpoint(const EndpointDesc &endpoint);
+  static bool OwnsEndpoint(EndpointHandle endpoint_handle);
+  static bool OwnsChannel(ChannelHandle channel);
+
+  static HcommResult EndpointCreate(const EndpointDesc *endpoint, EndpointHandle *endpoint_handle);
+  static HcommResult EndpointDestroy(EndpointHandle endpoint_handle);
+  static HcommResult EndpointGetListenPort(EndpointHandle endpoint_handle, uint32_t *port);
+  static HcommResult MemReg(EndpointHandle endpoint_handle, const char *mem_tag, const CommMem *mem,
+                            HcommMemHandle *mem_handle);
+  static HcommResult MemUnreg(EndpointHandle endpoint_handle, HcommMemHandle mem_handle);
+  static HcommResult MemExport(EndpointHandle endpoint_handle, HcommMemHandle mem_handle, void **mem_desc,
+                               uint32_t *mem_desc_len);
+  static HcommResult MemImport(EndpointHandle endpoint_handle, const void *mem_desc, uint32_t desc_len,
+                               CommMem *out_mem);
+  static HcommResult MemUnimport(EndpointHandle endpoint_handle, const void *mem_desc, uint32_t desc_len);
+  static HcommResult ChannelCreate(EndpointHandle endpoint_handle, CommEngine engine, HcommChannelDesc *channel_descs,
+                                   uint32_t channel_num, ChannelHandle *channels);
+  static HcommResult ChannelDestroy(const ChannelHandle *channels, uint32_t channel_num);
+  static HcommResult ChannelGetStatus(const ChannelHandle *channel_list, uint32_t list_num, int32_t *status_list);
+
+  static int32_t Write(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src, uint64_t len);
+  static int32_t Read(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src, uint64_t len);
+  static int32_t ChannelFence(ThreadHandle thread, ChannelHandle channel);
+  static int32_t BatchTransfer(ThreadHandle thread, ChannelHandle channel, const HcommBatchTransferDesc *transfer_descs,
+                               uint32_t transfer_desc_num);
+};
+
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_PROXY_HCOMM_LOOPBACK_H_
@@ -9,6 +9,7 @@
  */
 
 #include "hcomm_proxy.h"
+#include "hcomm_loopback.h"
 #include "common/hixl_checker.h"
 
 extern "C" {
@@ -71,14 +72,24 @@ __attribute__((weak)) int32_t HcommExceptionUnregisterCallback(HcommExceptionCal
 }
 
 namespace hixl {
+void HcommProxy::MarkLoopbackEndpoint(EndpointDesc &endpoint) {
+  HcommLoopback::MarkEndpoint(endpoint);
+}
+
 HcclResult HcommProxy::MemReg(EndpointHandle endpoint_handle, const char *mem_tag, const CommMem *mem,
                               HcommMemHandle *mem_handle) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::MemReg(endpoint_handle, mem_tag, mem, mem_handle));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommMemReg != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommMemReg is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommMemReg(endpoint_handle, mem_tag, mem, mem_handle));
 }
 
 HcclResult HcommProxy::MemUnreg(EndpointHandle endpoint_handle, void *mem_handle) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::MemUnreg(endpoint_handle, mem_handle));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommMemUnreg != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommMemUnreg is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommMemUnreg(endpoint_handle, mem_handle));
@@ -86,24 +97,36 @@ HcclResult HcommProxy::MemUnreg(EndpointHandle endpoint_handle, void *mem_handle
 
 HcclResult HcommProxy::MemExport(EndpointHandle endpoint_handle, void *mem_handle, void **mem_desc,
                                  uint32_t *mem_desc_len) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::MemExport(endpoint_handle, mem_handle, mem_desc, mem_desc_len));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommMemExport != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommMemExport is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommMemExport(endpoint_handle, mem_handle, mem_desc, mem_desc_len));
 }
 
 HcclResult HcommProxy::EndpointCreate(const EndpointDesc *endpoint, EndpointHandle *endpoint_handle) {
+  if (endpoint != nullptr && HcommLoopback::IsMarkedEndpoint(*endpoint)) {
+    return static_cast<HcclResult>(HcommLoopback::EndpointCreate(endpoint, endpoint_handle));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommEndpointCreate != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommEndpointCreate is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommEndpointCreate(endpoint, endpoint_handle));
 }
 
 HcclResult HcommProxy::EndpointDestroy(EndpointHandle endpoint_handle) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::EndpointDestroy(endpoint_handle));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommEndpointDestroy != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommEndpointDestroy is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommEndpointDestroy(endpoint_handle));
 }
 
 HcclResult HcommProxy::EndpointGetListenPort(EndpointHandle endpoint_handle, uint32_t *port) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::EndpointGetListenPort(endpoint_handle, port));
+  }
   if (HcommEndpointGetListenPort == nullptr) {
     HIXL_LOGI("function HcommEndpointGetListenPort is null, maybe unsupported.");
     return HCCL_E_NOT_SUPPORT;
@@ -113,12 +136,18 @@ HcclResult HcommProxy::EndpointGetListenPort(EndpointHandle endpoint_handle, uin
 
 HcclResult HcommProxy::MemImport(EndpointHandle endpoint_handle, const void *mem_desc, uint32_t desc_len,
                                  CommMem *out_mem) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::MemImport(endpoint_handle, mem_desc, desc_len, out_mem));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommMemImport != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommMemImport is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommMemImport(endpoint_handle, mem_desc, desc_len, out_mem));
 }
 
 HcclResult HcommProxy::MemUnimport(EndpointHandle endpoint_handle, const void *mem_desc, uint32_t desc_len) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(HcommLoopback::MemUnimport(endpoint_handle, mem_desc, desc_len));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommMemUnimport != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommMemUnimport is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommMemUnimport(endpoint_handle, mem_desc, desc_len));
@@ -126,18 +155,28 @@ HcclResult HcommProxy::MemUnimport(EndpointHandle endpoint_handle, const void *m
 
 HcclResult HcommProxy::ChannelCreate(EndpointHandle endpoint_handle, CommEngine engine, HcommChannelDesc *channel_descs,
                                      uint32_t channel_num, ChannelHandle *channels) {
+  if (HcommLoopback::OwnsEndpoint(endpoint_handle)) {
+    return static_cast<HcclResult>(
+        HcommLoopback::ChannelCreate(endpoint_handle, engine, channel_descs, channel_num, channels));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommChannelCreate != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommChannelCreate is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommChannelCreate(endpoint_handle, engine, channel_descs, channel_num, channels));
 }
 
 HcclResult HcommProxy::ChannelDestroy(const ChannelHandle *channels, uint32_t channel_num) {
+  if (channels != nullptr && channel_num != 0U && HcommLoopback::OwnsChannel(channels[0])) {
+    return static_cast<HcclResult>(HcommLoopback::ChannelDestroy(channels, channel_num));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommChannelDestroy != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommChannelDestroy is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommChannelDestroy(channels, channel_num));
 }
 
 HcclResult HcommProxy::ChannelGetStatus(const ChannelHandle *channel_list, uint32_t list_num, int32_t *status_list) {
+  if (channel_list != nullptr && list_num != 0U && HcommLoopback::OwnsChannel(channel_list[0])) {
+    return static_cast<HcclResult>(HcommLoopback::ChannelGetStatus(channel_list, list_num, status_list));
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommChannelGetStatus != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommChannelGetStatus is null, maybe unsupported.");
   return static_cast<HcclResult>(HcommChannelGetStatus(channel_list, list_num, status_list));
@@ -145,6 +184,9 @@ HcclResult HcommProxy::ChannelGetStatus(const ChannelHandle *channel_list, uint3
 
 int32_t HcommProxy::WriteNbiOnThread(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src,
                                      uint64_t len) {
+  if (HcommLoopback::OwnsChannel(channel)) {
+    return HcommLoopback::Write(thread, channel, dst, src, len);
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommWriteNbiOnThread != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommWriteNbiOnThread is null, maybe unsupported.");
   return HcommWriteNbiOnThread(thread, channel, dst, src, len);
@@ -152,6 +194,9 @@ int32_t HcommProxy::WriteNbiOnThread(ThreadHandle thread, ChannelHandle channel,
 
 int32_t HcommProxy::ReadNbiOnThread(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src,
                                     uint64_t len) {
+  if (HcommLoopback::OwnsChannel(channel)) {
+    return HcommLoopback::Read(thread, channel, dst, src, len);
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommReadNbiOnThread != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommReadNbiOnThread is null, maybe unsupported.");
   return HcommReadNbiOnThread(thread, channel, dst, src, len);
@@ -183,6 +228,9 @@ int32_t HcommProxy::BatchModeEnd(const char *batch_tag) {
 }
 
 int32_t HcommProxy::ReadOnThread(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src, uint64_t len) {
+  if (HcommLoopback::OwnsChannel(channel)) {
+    return HcommLoopback::Read(thread, channel, dst, src, len);
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommReadOnThread != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommReadOnThread is null, maybe unsupported.");
   return HcommReadOnThread(thread, channel, dst, src, len);
@@ -190,12 +238,18 @@ int32_t HcommProxy::ReadOnThread(ThreadHandle thread, ChannelHandle channel, voi
 
 int32_t HcommProxy::WriteOnThread(ThreadHandle thread, ChannelHandle channel, void *dst, const void *src,
                                   uint64_t len) {
+  if (HcommLoopback::OwnsChannel(channel)) {
+    return HcommLoopback::Write(thread, channel, dst, src, len);
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommWriteOnThread != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommWriteOnThread is null, maybe unsupported.");
   return HcommWriteOnThread(thread, channel, dst, src, len);
 }
 
 int32_t HcommProxy::ChannelFenceOnThread(ThreadHandle thread, ChannelHandle channel) {
+  if (HcommLoopback::OwnsChannel(channel)) {
+    return HcommLoopback::ChannelFence(thread, channel);
+  }
   HIXL_CHK_BOOL_RET_STATUS(HcommChannelFenceOnThread != nullptr, HCCL_E_NOT_SUPPORT,
                            "function HcommChannelFenceOnThread is null, maybe unsupported.");
   return HcommChannelFenceOnThread(thread, channel);
@@ -203,6 +257,9 @@ int32_t HcommProxy::ChannelFenceOnThread(ThreadHandle thread, ChannelHandle chan
 
 int32_t HcommProxy::BatchTransferOnThread(ThreadHandle thread, ChannelHandle channel,
                                           const HcommBatchTransferDesc *transfer_descs, uint32_t transfer_desc_num) {
+  if (HcommLoopback::OwnsChannel(channel)) {
+    return HcommLoopback::BatchTransfer(thread, channel, transfer_descs, transfer_desc_num);
+  }
   if (HcommBatchTransferOnThread == nullptr) {
     HIXL_LOGI("function HcommBatchTransferOnThread is null, maybe unsupported.");
     return HCCL_E_NOT_SUPPORT;
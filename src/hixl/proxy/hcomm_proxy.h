@@ -19,6 +19,12 @@ namespace hixl {
 
 class HcommProxy {
  public:
+  /**
+   * @brief Serve the endpoint created from this description, and the memory and channels created on it, from the
+   *        CPU loopback backend (HcommLoopback) instead of libhcomm. Other endpoints in the process are unaffected.
+   */
+  static void MarkLoopbackEndpoint(EndpointDesc &endpoint);
+
   static HcclResult MemReg(EndpointHandle endpoint_handle, const char *mem_tag, const CommMem *mem,
                            HcommMemHandle *mem_handle);
   static HcclResult MemUnreg(EndpointHandle endpoint_handle, HcommMemHandle mem_handle);
@@ -9,6 +9,7 @@
  */
 
 #include "adxl_inner_engine.h"
+#include <chrono>
 #include "acl/acl.h"
 #include "comm_adapter/comm_adapter.h"
 #include "common/llm_utils.h"
@@ -524,6 +525,9 @@ Status AdxlInnerEngine::TransferAsync(const AscendString &remote_engine, Transfe
   auto channel = channel_manager_.GetChannel(ChannelType::kClient, remote_engine.GetString());
   ADXL_CHK_BOOL_RET_STATUS(channel != nullptr, NOT_CONNECTED, "Failed to get channel, remote_engine:%s",
                            remote_engine.GetString());
+  const auto transfer_start_us = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+          .count());
   auto id = next_req_id_.fetch_add(1);
   req = reinterpret_cast<void *>(static_cast<uintptr_t>(id));
   if (user_config_channel_pool_) {
@@ -546,12 +550,17 @@ Status AdxlInnerEngine::TransferAsync(const AscendString &remote_engine, Transfe
   uint64_t start_time = 0;
   start_time = hixl::HixlProfilingReporter::GetSysCycleTime();
   hixl::TransferInfo transfer_info = {start_time, static_cast<hixl::TransferOp>(operation), remote_engine};
+  for (const auto &op_desc : op_descs) {
+    transfer_info.bytes += op_desc.len;
+  }
+  transfer_info.start_us = transfer_start_us;
   std::lock_guard<std::mutex> lock(req2channel_mutex_);
   req_map_.emplace(id, transfer_info);
   return SUCCESS;
 }
 
-Status AdxlInnerEngine::GetTransferStatus(const TransferReq &req, TransferStatus &status) {
+Status AdxlInnerEngine::GetTransferStatus(const TransferReq &req, TransferStatus &status,
+                                          hixl::TransferInfo *finished_info) {
   hixl::TemporaryRtContext with_context(aclrt_context_);
   std::lock_guard<std::mutex> lock(req2channel_mutex_);
   auto id = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(req));
@@ -591,6 +600,9 @@ Status AdxlInnerEngine::GetTransferStatus(const TransferReq &req, TransferStatus
     hixl::HixlProfType type = (op_type == hixl::TransferOp::READ ? hixl::HixlProfType::HixlOpBatchRead
                                                                  : hixl::HixlProfType::HixlOpBatchWrite);
     HIXL_API_PROFILING_WITH_TIME(type, start_time);
+    if (finished_info != nullptr) {
+      *finished_info = it->second;
+    }
     req_map_.erase(it);
   }
   return ret;
@@ -53,7 +53,8 @@ class AdxlInnerEngine {
                        const std::vector<TransferOpDesc> &op_descs, const TransferArgs &optional_args,
                        TransferReq &req);
 
-  Status GetTransferStatus(const TransferReq &req, TransferStatus &status);
+  // finished_info非空时，请求结束后输出其下发信息，供调用方计入传输统计
+  Status GetTransferStatus(const TransferReq &req, TransferStatus &status, hixl::TransferInfo *finished_info = nullptr);
 
   Status SendNotify(const AscendString &remote_engine, const NotifyDesc &notify, int32_t timeout_in_millis = 1000);
 
@@ -61,19 +61,20 @@ Status BufferTransferService::Initialize() {
 
 void BufferTransferService::Finalize() {
   stop_signal_.store(true);
-  buffer_req_cv_.notify_all();
+  // 先关闭全部队列，避免处理线程阻塞在向下游已满队列的入队上
+  buffer_req_queue_.Close();
+  buffer_resp_queue_.Close();
+  buffer_second_step_queue_.Close();
+  buffer_ctrl_msg_queue_.Close();
   if (buffer_req_processor_.joinable()) {
     buffer_req_processor_.join();
   }
-  buffer_resp_cv_.notify_all();
   if (buffer_resp_processor_.joinable()) {
     buffer_resp_processor_.join();
   }
-  buffer_second_step_cv_.notify_all();
   if (buffer_second_step_processor_.joinable()) {
     buffer_second_step_processor_.join();
   }
-  ctrl_msg_cv_.notify_all();
   if (ctrl_msg_processor_.joinable()) {
     ctrl_msg_processor_.join();
   }
@@ -298,14 +299,8 @@ void BufferTransferService::ProcessBufferReqFirstStep() {
   aclrtSetCurrentContext(aclrt_context_);
   while (!stop_signal_.load()) {
     std::pair<ChannelPtr, BufferReq> req;
-    {
-      std::unique_lock<std::mutex> lock(buffer_req_mutex_);
-      buffer_req_cv_.wait(lock, [this] { return !buffer_req_queue_.empty() || stop_signal_.load(); });
-      if (stop_signal_.load()) {
-        break;
-      }
-      req = std::move(buffer_req_queue_.front());
-      buffer_req_queue_.pop();
+    if (!buffer_req_queue_.Pop(req) || stop_signal_.load()) {
+      break;
     }
     auto &channel = req.first;
     auto &buffer_req = req.second;
@@ -327,14 +322,8 @@ void BufferTransferService::ProcessBufferReqSecondStep() {
   aclrtSetCurrentContext(aclrt_context_);
   while (!stop_signal_.load()) {
     std::pair<ChannelPtr, BufferReq> req;
-    {
-      std::unique_lock<std::mutex> lock(buffer_second_step_mutex_);
-      buffer_second_step_cv_.wait(lock, [this] { return !buffer_second_step_queue_.empty() || stop_signal_.load(); });
-      if (stop_signal_.load()) {
-        break;
-      }
-      req = std::move(buffer_second_step_queue_.front());
-      buffer_second_step_queue_.pop();
+    if (!buffer_second_step_queue_.Pop(req) || stop_signal_.load()) {
+      break;
     }
     auto &channel = req.first;
     auto &buffer_req = req.second;
@@ -587,14 +576,8 @@ Status BufferTransferService::ProcessCopyWithAsync(const ChannelPtr &channel, co
 void BufferTransferService::ProcessCtrlMsg() {
   while (!stop_signal_.load()) {
     std::pair<ChannelPtr, BufferReq> buffer_req;
-    {
-      std::unique_lock<std::mutex> lock(buffer_ctrl_msg_mutex_);
-      ctrl_msg_cv_.wait(lock, [this] { return !buffer_ctrl_msg_queue_.empty() || stop_signal_.load(); });
-      if (stop_signal_.load()) {
-        break;
-      }
-      buffer_req = std::move(buffer_ctrl_msg_queue_.front());
-      buffer_ctrl_msg_queue_.pop();
+    if (!buffer_ctrl_msg_queue_.Pop(buffer_req) || stop_signal_.load()) {
+      break;
     }
     auto &channel = buffer_req.first;
     if (channel->IsFinalized()) {
@@ -632,14 +615,8 @@ void BufferTransferService::ProcessBufferResp() {
   aclrtSetCurrentContext(aclrt_context_);
   while (!stop_signal_.load()) {
     std::pair<ChannelPtr, BufferResp> resp;
-    {
-      std::unique_lock<std::mutex> lock(buffer_resp_mutex_);
-      buffer_resp_cv_.wait(lock, [this] { return !buffer_resp_queue_.empty() || stop_signal_.load(); });
-      if (stop_signal_.load()) {
-        break;
-      }
-      resp = std::move(buffer_resp_queue_.front());
-      buffer_resp_queue_.pop();
+    if (!buffer_resp_queue_.Pop(resp) || stop_signal_.load()) {
+      break;
     }
     HandleBufferResp(resp.first, resp.second);
   }
@@ -708,44 +685,33 @@ Status BufferTransferService::HandleBufferResp(const ChannelPtr &channel, Buffer
 
 Status BufferTransferService::PushBufferReq(const ChannelPtr &channel, BufferReq &buffer_req) {
   ADXL_CHK_BOOL_RET_STATUS(buffer_req.timeout > kTimeoutLoss, TIMEOUT, "Time is not enough to push req.");
-  {
-    std::lock_guard<std::mutex> lock(buffer_req_mutex_);
-    buffer_req.recv_start_time = std::chrono::steady_clock::now();
-    buffer_req.timeout = buffer_req.timeout - kTimeoutLoss;
-    buffer_req_queue_.emplace(channel, buffer_req);
-  }
-  buffer_req_cv_.notify_one();
+  buffer_req.recv_start_time = std::chrono::steady_clock::now();
+  buffer_req.timeout = buffer_req.timeout - kTimeoutLoss;
+  // runs on the channel receive thread: never block it and never drop the msg, a full ring spills to overflow
+  ADXL_CHK_BOOL_RET_STATUS(buffer_req_queue_.ForceEmplace(channel, buffer_req), FAILED, "Buffer service is finalized.");
   return SUCCESS;
 }
 
 Status BufferTransferService::PushSecondStepReq(const ChannelPtr &channel, BufferReq &buffer_req) {
   ADXL_CHK_BOOL_RET_STATUS(buffer_req.timeout > kTimeoutLoss, TIMEOUT, "Time is not enough to push req.");
-  {
-    std::lock_guard<std::mutex> lock(buffer_second_step_mutex_);
-    buffer_req.recv_start_time = std::chrono::steady_clock::now();
-    buffer_req.timeout = buffer_req.timeout - kTimeoutLoss;
-    buffer_second_step_queue_.emplace(channel, buffer_req);
-  }
-  buffer_second_step_cv_.notify_one();
+  buffer_req.recv_start_time = std::chrono::steady_clock::now();
+  buffer_req.timeout = buffer_req.timeout - kTimeoutLoss;
+  ADXL_CHK_BOOL_RET_STATUS(buffer_second_step_queue_.Emplace(channel, buffer_req), FAILED,
+                           "Buffer service is finalized.");
   return SUCCESS;
 }
 
 void BufferTransferService::PushCtrlMsg(const ChannelPtr &channel, BufferReq &buffer_req) {
-  {
-    std::lock_guard<std::mutex> lock(buffer_ctrl_msg_mutex_);
-    buffer_ctrl_msg_queue_.emplace(channel, buffer_req);
+  if (!buffer_ctrl_msg_queue_.Emplace(channel, buffer_req)) {
+    LLMLOGW("Skip ctrl msg, buffer service is finalized, channel_id:%s.", channel->GetChannelId().c_str());
   }
-  ctrl_msg_cv_.notify_one();
 }
 
 Status BufferTransferService::PushBufferResp(const ChannelPtr &channel, BufferResp &buffer_resp) {
   ADXL_CHK_BOOL_RET_STATUS(buffer_resp.timeout > kTimeoutLoss, TIMEOUT, "Time is not enough to push req.");
-  {
-    std::lock_guard<std::mutex> lock(buffer_resp_mutex_);
-    buffer_resp.timeout = buffer_resp.timeout - kTimeoutLoss;
-    buffer_resp_queue_.emplace(channel, buffer_resp);
-  }
-  buffer_resp_cv_.notify_one();
+  buffer_resp.timeout = buffer_resp.timeout - kTimeoutLoss;
+  // runs on the channel receive thread: never block it and never drop the msg, a full ring spills to overflow
+  ADXL_CHK_BOOL_RET_STATUS(buffer_resp_queue_.ForceEmplace(channel, buffer_resp), FAILED, "Buffer service is finalized.");
   return SUCCESS;
 }
 
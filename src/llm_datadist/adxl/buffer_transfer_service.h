@@ -11,15 +11,20 @@
 #ifndef CANN_GRAPH_ENGINE_BUFFER_TRANSFER_SERVICE_H
 #define CANN_GRAPH_ENGINE_BUFFER_TRANSFER_SERVICE_H
 
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 #include "adxl/adxl_types.h"
 #include "common/llm_mem_pool.h"
 #include "common/llm_thread_pool.h"
+#include "common/mpmc_queue.h"
 #include "comm_channel.h"
 #include "control_msg_handler.h"
 
 namespace adxl {
 using CopyExtraInfo = std::pair<aclrtMemcpyKind, uint64_t>;
+// 各处理线程的请求队列容量，队列满时入队方阻塞直至处理线程取走请求
+constexpr size_t kBufferQueueCapacity = 1024U;
 struct SliceInfo {
   std::vector<uintptr_t> src_addrs;
   std::vector<uintptr_t> dst_addrs;
@@ -112,21 +117,10 @@ class BufferTransferService {
   std::thread ctrl_msg_processor_;
   std::atomic<bool> stop_signal_{false};
 
-  std::mutex buffer_req_mutex_;
-  std::queue<std::pair<ChannelPtr, BufferReq>> buffer_req_queue_;
-  std::condition_variable buffer_req_cv_;
-
-  std::mutex buffer_resp_mutex_;
-  std::queue<std::pair<ChannelPtr, BufferResp>> buffer_resp_queue_;
-  std::condition_variable buffer_resp_cv_;
-
-  std::mutex buffer_second_step_mutex_;
-  std::queue<std::pair<ChannelPtr, BufferReq>> buffer_second_step_queue_;
-  std::condition_variable buffer_second_step_cv_;
-
-  std::mutex buffer_ctrl_msg_mutex_;
-  std::queue<std::pair<ChannelPtr, BufferReq>> buffer_ctrl_msg_queue_;
-  std::condition_variable ctrl_msg_cv_;
+  hixl::BlockingMpmcQueue<std::pair<ChannelPtr, BufferReq>> buffer_req_queue_{kBufferQueueCapacity};
+  hixl::BlockingMpmcQueue<std::pair<ChannelPtr, BufferResp>> buffer_resp_queue_{kBufferQueueCapacity};
+  hixl::BlockingMpmcQueue<std::pair<ChannelPtr, BufferReq>> buffer_second_step_queue_{kBufferQueueCapacity};
+  hixl::BlockingMpmcQueue<std::pair<ChannelPtr, BufferReq>> buffer_ctrl_msg_queue_{kBufferQueueCapacity};
 
   std::mutex req_id_mutex_;
   std::map<uint64_t, std::set<void *>> req_id_buffers_;
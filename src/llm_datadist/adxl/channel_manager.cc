@@ -390,7 +390,14 @@ Status ChannelManager::Finalize() {
   for (const auto &channel : GetAllClientChannel()) {
     (void)DestroyChannel(ChannelType::kClient, channel->GetChannelId());
   }
-  channels_.clear();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    channels_.clear();
+    for (auto &lru_channels : lru_channels_) {
+      lru_channels.clear();
+    }
+  }
+  capacity_cv_.notify_all();
   return SUCCESS;
 }
 
@@ -420,6 +427,51 @@ std::vector<ChannelPtr> ChannelManager::GetAllServerChannel() const {
   return channels;
 }
 
+int32_t ChannelManager::GetChannelCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int32_t>(channels_.size());
+}
+
+int32_t ChannelManager::GetChannelCount(ChannelType channel_type) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int32_t>(lru_channels_[static_cast<size_t>(channel_type)].size());
+}
+
+ChannelPtr ChannelManager::PickEvictionCandidate(ChannelType channel_type) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &lru_channels = lru_channels_[static_cast<size_t>(channel_type)];
+  // every channel is visited at most twice: once to clear its flag, once to be picked
+  size_t budget = lru_channels.size() * 2U;
+  while (!lru_channels.empty() && budget-- > 0U) {
+    auto channel = lru_channels.front();
+    lru_channels.splice(lru_channels.end(), lru_channels, lru_channels.begin());
+    if (channel->IsDisconnecting()) {
+      continue;
+    }
+    if (channel->GetHasTransferred()) {
+      // second chance; keep the flag while a transfer is still in flight
+      if (channel->GetTransferCount() == 0) {
+        channel->SetHasTransferred(false);
+      }
+      continue;
+    }
+    channel->SetDisconnecting(true);
+    return channel;
+  }
+  return nullptr;
+}
+
+bool ChannelManager::WaitForCapacity(int32_t max_channel, int32_t timeout_in_millis) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return capacity_cv_.wait_for(lock, std::chrono::milliseconds(timeout_in_millis), [this, max_channel]() {
+    return static_cast<int32_t>(channels_.size()) < max_channel || stop_signal_.load();
+  }) && (static_cast<int32_t>(channels_.size()) < max_channel);
+}
+
+void ChannelManager::UnlinkLruLocked(ChannelType channel_type, const ChannelPtr &channel) {
+  lru_channels_[static_cast<size_t>(channel_type)].erase(channel->lru_pos_);
+}
+
 void ChannelManager::SendHeartbeats() {
   auto channels = GetAllClientChannel();
   for (const auto &channel : channels) {
@@ -460,6 +512,8 @@ Status ChannelManager::CreateChannel(const ChannelInfo &channel_info, ChannelPtr
                            "Channel already exists, channel_type = %d, channel id:%s",
                            static_cast<int32_t>(channel_info.channel_type), channel_info.channel_id.c_str());
   (void)channels_.emplace(std::make_pair(channel_info.channel_type, channel_info.channel_id), channel);
+  auto &lru_channels = lru_channels_[static_cast<size_t>(channel_info.channel_type)];
+  channel->lru_pos_ = lru_channels.insert(lru_channels.end(), channel);
   channel_ptr = channel;
   LLMLOGI("Create channel success, channel_type = %d, channel id = %s", static_cast<int32_t>(channel_info.channel_type),
           channel_info.channel_id.c_str());
@@ -491,15 +545,21 @@ ChannelPtr ChannelManager::GetChannel(ChannelType channel_type, const std::strin
 }
 
 void ChannelManager::DestroyChannels() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  for (const auto &entry : channels_) {
-    auto channel = entry.second;
-    (void)RemoveFd(channel->GetFd());
-    (void)channel->Finalize();
-    const bool is_client = (entry.first.first == ChannelType::kClient);
-    StatisticManager::GetInstance().RemoveStatisticChannel(entry.first.second, is_client);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &entry : channels_) {
+      auto channel = entry.second;
+      (void)RemoveFd(channel->GetFd());
+      (void)channel->Finalize();
+      const bool is_client = (entry.first.first == ChannelType::kClient);
+      StatisticManager::GetInstance().RemoveStatisticChannel(entry.first.second, is_client);
+    }
+    channels_.clear();
+    for (auto &lru_channels : lru_channels_) {
+      lru_channels.clear();
+    }
   }
-  channels_.clear();
+  capacity_cv_.notify_all();
 }
 
 Status ChannelManager::DestroyChannel(ChannelType channel_type, const std::string &channel_id) {
@@ -511,7 +571,9 @@ Status ChannelManager::DestroyChannel(ChannelType channel_type, const std::strin
     (void)RemoveFd(channel->GetFd());
     auto channel_ret = channel->Finalize();
     ret = channel_ret != SUCCESS ? channel_ret : ret;
+    UnlinkLruLocked(channel_type, channel);
     channels_.erase(it);
+    capacity_cv_.notify_all();
     const bool is_client = (channel_type == ChannelType::kClient);
     StatisticManager::GetInstance().RemoveStatisticChannel(channel_id, is_client);
     LLMLOGI("Destroy channel end, channel_type = %d, channel_id = %s", static_cast<int32_t>(channel_type),
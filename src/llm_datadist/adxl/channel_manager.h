@@ -18,6 +18,7 @@
 #include <queue>
 #include <atomic>
 #include <functional>
+#include <list>
 #include "comm_channel.h"
 #include "buffer_transfer_service.h"
 
@@ -49,6 +50,15 @@ class ChannelManager {
   std::vector<ChannelPtr> GetAllClientChannel() const;
   std::vector<ChannelPtr> GetAllServerChannel() const;
 
+  int32_t GetChannelCount() const;
+  int32_t GetChannelCount(ChannelType channel_type) const;
+  // Pick the least recently used channel of channel_type that is not already disconnecting and mark it
+  // disconnecting. Channels with has_transferred set get a second chance: the flag is cleared and they move to the
+  // tail. Returns nullptr when no channel can be picked.
+  ChannelPtr PickEvictionCandidate(ChannelType channel_type);
+  // Block until the total channel count drops below max_channel; woken by channel destruction.
+  bool WaitForCapacity(int32_t max_channel, int32_t timeout_in_millis);
+
   void SetDisconnectCallback(std::function<Status(const std::string &, int32_t)> callback) {
     disconnect_callback_ = callback;
   }
@@ -86,6 +96,7 @@ class ChannelManager {
   Status HandleNotifyMessage(const ChannelPtr &channel, const std::string &msg_str) const;
   Status HandleNotifyAckMessage(const ChannelPtr &channel, const std::string &msg_str) const;
   Status RemoveFd(int32_t fd);
+  void UnlinkLruLocked(ChannelType channel_type, const ChannelPtr &channel);
 
   NotifyAckCallback notify_ack_callback_;
 
@@ -103,6 +114,9 @@ class ChannelManager {
   // mutex for map channels_
   mutable std::mutex mutex_;
   std::map<std::pair<ChannelType, std::string>, ChannelPtr> channels_;
+  // per ChannelType LRU order, head is the eviction end; guarded by mutex_
+  std::list<ChannelPtr> lru_channels_[2];
+  std::condition_variable capacity_cv_;
 
   int epoll_fd_ = -1;
   static int64_t wait_time_in_millis_;
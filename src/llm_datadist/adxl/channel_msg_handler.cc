@@ -30,10 +30,10 @@ namespace adxl {
 
 namespace {
 constexpr int32_t kWaitRespTime = 20;
-constexpr int32_t kCheckDisconnetPeriod = 10;
 constexpr int32_t kMaxTrafficClassRange = 255;
 constexpr int32_t kTrafficClassStep = 4;
 constexpr int32_t kMaxServiceLevel = 7;
+constexpr size_t kMaxRankTableCacheNum = 4096U;
 }  // namespace
 
 static inline void from_json(const nlohmann::json &j, AddrInfo &op_desc) {
@@ -214,6 +214,11 @@ void ChannelMsgHandler::Finalize() {
     (void)llm::CommAdapter::GetInstance().DlHcclDeregisterGlobalMem(handle);
   }
   handle_to_addr_.clear();
+  local_mem_snapshot_.reset();
+  {
+    std::lock_guard<std::mutex> cache_lock(rank_table_cache_mutex_);
+    rank_table_cache_.clear();
+  }
   if (segment_table_ != nullptr) {
     segment_table_->Clear();
   }
@@ -237,6 +242,7 @@ Status ChannelMsgHandler::RegisterMem(const MemDesc &mem, MemType type, MemHandl
   ADXL_CHK_BOOL_RET_STATUS(segment_table_ != nullptr, FAILED, "Segment table is null.");
   segment_table_->AddRange(listen_info_, mem.addr, mem_end, type);
   handle_to_addr_[mem_handle] = AddrInfo{mem.addr, mem_end, type};
+  local_mem_snapshot_.reset();
   LLMLOGI("RegisterMem success: handle=%p, total registered handles=%zu.", mem_handle, handle_to_addr_.size());
   return SUCCESS;
 }
@@ -253,6 +259,7 @@ Status ChannelMsgHandler::DeregisterMem(MemHandle mem_handle) {
   segment_table_->RemoveRange(listen_info_, addr_info.start_addr, addr_info.end_addr, addr_info.mem_type);
   ADXL_CHK_HCCL_RET(llm::CommAdapter::GetInstance().DlHcclDeregisterGlobalMem(mem_handle));
   handle_to_addr_.erase(it);
+  local_mem_snapshot_.reset();
   LLMLOGI("DeregisterMem success: handle=%p, total registered handles=%zu.", mem_handle, handle_to_addr_.size());
   return SUCCESS;
 }
@@ -325,7 +332,18 @@ Status ChannelMsgHandler::CreateChannel(const ChannelInfo &channel_info, bool is
 }
 
 Status ChannelMsgHandler::ParseRankTable(const ChannelConnectInfo &peer_channel_info, std::string &rank_table,
-                                         int32_t &local_rank_id, int32_t &peer_rank_id) const {
+                                         int32_t &local_rank_id, int32_t &peer_rank_id) {
+  {
+    std::lock_guard<std::mutex> lock(rank_table_cache_mutex_);
+    const auto it = rank_table_cache_.find(peer_channel_info.channel_id);
+    if ((it != rank_table_cache_.cend()) && (it->second.peer_comm_res == peer_channel_info.comm_res)) {
+      rank_table = it->second.rank_table;
+      local_rank_id = it->second.local_rank_id;
+      peer_rank_id = it->second.peer_rank_id;
+      LLMLOGI("Reuse cached rank table, remote engine:%s.", peer_channel_info.channel_id.c_str());
+      return SUCCESS;
+    }
+  }
   auto rank_table_generator = llm::RankTableGeneratorFactory::Create(local_comm_res_, peer_channel_info.comm_res);
   ADXL_CHK_BOOL_RET_STATUS(rank_table_generator != nullptr, PARAM_INVALID, "Failed to create rank table generator.");
   ADXL_CHK_STATUS_RET(rank_table_generator->Generate(device_id_, rank_table), "Failed to generate rank table");
@@ -335,24 +353,39 @@ Status ChannelMsgHandler::ParseRankTable(const ChannelConnectInfo &peer_channel_
   ADXL_CHK_BOOL_RET_STATUS(peer_rank_id >= 0, PARAM_INVALID,
                            "Failed to get peer rank id, please check rank table, "
                            "not support connect with self device.");
+  std::lock_guard<std::mutex> lock(rank_table_cache_mutex_);
+  if (rank_table_cache_.size() >= kMaxRankTableCacheNum) {
+    rank_table_cache_.clear();
+  }
+  rank_table_cache_[peer_channel_info.channel_id] =
+      PeerRankTable{peer_channel_info.comm_res, rank_table, local_rank_id, peer_rank_id};
   return SUCCESS;
 }
 
+std::shared_ptr<const LocalMemSnapshot> ChannelMsgHandler::GetLocalMemSnapshot() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (local_mem_snapshot_ == nullptr) {
+    auto snapshot = std::make_shared<LocalMemSnapshot>();
+    snapshot->addrs.reserve(handle_to_addr_.size());
+    for (const auto &addr_info : handle_to_addr_) {
+      snapshot->registered_mems[addr_info.first] = reinterpret_cast<void *>(addr_info.second.start_addr);
+      snapshot->addrs.emplace_back(addr_info.second);
+    }
+    local_mem_snapshot_ = std::move(snapshot);
+  }
+  return local_mem_snapshot_;
+}
+
 Status ChannelMsgHandler::ConnectInfoProcess(const ChannelConnectInfo &peer_channel_info, int32_t timeout,
                                              bool is_client) {
   if (user_config_channel_pool_) {
-    auto start_time = std::chrono::steady_clock::now();
     NotifyEviction();
-    while (GetTotalChannelCount() >= max_channel_) {
-      auto elapsed =
-          std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start_time).count();
-      if (elapsed >= timeout) {
-        LLMLOGE(RESOURCE_EXHAUSTED,
-                "Failed to Connect %s after %d ms, channel resource exhausted, adjust channel pool config to avoid",
-                peer_channel_info.channel_id.c_str(), timeout);
-        return RESOURCE_EXHAUSTED;
-      }
-      std::this_thread::sleep_for(std::chrono::milliseconds(kCheckDisconnetPeriod));
+    // Wait for a free slot; destroying any channel wakes this wait instead of polling.
+    if (!channel_manager_->WaitForCapacity(max_channel_, timeout)) {
+      LLMLOGE(RESOURCE_EXHAUSTED,
+              "Failed to Connect %s after %d ms, channel resource exhausted, adjust channel pool config to avoid",
+              peer_channel_info.channel_id.c_str(), timeout);
+      return RESOURCE_EXHAUSTED;
     }
   }
   std::string rank_table;
@@ -368,13 +401,8 @@ Status ChannelMsgHandler::ConnectInfoProcess(const ChannelConnectInfo &peer_chan
   channel_info.comm_config = comm_config_;
   auto ret = strcpy_s(channel_info.comm_config.hcclCommName, COMM_NAME_MAX_LENGTH, peer_channel_info.comm_name.c_str());
   ADXL_CHK_BOOL_RET_STATUS(ret == EOK, FAILED, "Failed to copy comm name.");
-  channel_info.rank_table = rank_table;
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto &addr_info : handle_to_addr_) {
-      channel_info.registered_mems[addr_info.first] = reinterpret_cast<void *>(addr_info.second.start_addr);
-    }
-  }
+  channel_info.rank_table = std::move(rank_table);
+  channel_info.registered_mems = GetLocalMemSnapshot()->registered_mems;
   constexpr uint32_t kTimeInSec = 1000;
   auto left_time = timeout % kTimeInSec == 0 ? 0 : 1;
   channel_info.timeout_sec = timeout / kTimeInSec + left_time;
@@ -385,12 +413,7 @@ Status ChannelMsgHandler::ConnectInfoProcess(const ChannelConnectInfo &peer_chan
 Status ChannelMsgHandler::FillLocalConnectInfo(ChannelConnectInfo &channel_connect_info) const {
   channel_connect_info.channel_id = listen_info_;
   channel_connect_info.comm_res = local_comm_res_;
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto &addr_info : handle_to_addr_) {
-      channel_connect_info.addrs.emplace_back(addr_info.second);
-    }
-  }
+  channel_connect_info.addrs = GetLocalMemSnapshot()->addrs;
   return SUCCESS;
 }
 
@@ -733,15 +756,14 @@ Status ChannelMsgHandler::SetupChannelManagerCallbacks() {
 }
 
 int32_t ChannelMsgHandler::GetTotalChannelCount() const {
-  auto client_channels = channel_manager_->GetAllClientChannel();
-  auto server_channels = channel_manager_->GetAllServerChannel();
-  return static_cast<int32_t>(client_channels.size() + server_channels.size());
+  return channel_manager_->GetChannelCount();
 }
 
 bool ChannelMsgHandler::ShouldTriggerEviction() const {
-  bool should_evict = GetTotalChannelCount() >= high_waterline_;
+  const int32_t current_count = GetTotalChannelCount();
+  bool should_evict = current_count >= high_waterline_;
   if (should_evict) {
-    LLMLOGI("Eviction triggered: current_channel_count(%d) >= high_mark(%d)", GetTotalChannelCount(), high_waterline_);
+    LLMLOGI("Eviction triggered: current_channel_count(%d) >= high_mark(%d)", current_count, high_waterline_);
   }
   return should_evict;
 }
@@ -768,54 +790,47 @@ Status ChannelMsgHandler::NotifyEviction() {
   return SUCCESS;
 }
 
+bool ChannelMsgHandler::PickEvictionCandidate(ChannelType channel_type, std::vector<EvictItem> &target_items) const {
+  auto channel = channel_manager_->PickEvictionCandidate(channel_type);
+  if (channel == nullptr) {
+    return false;
+  }
+  target_items.push_back(EvictItem{channel->GetChannelId(), channel_type});
+  return true;
+}
+
 std::vector<EvictItem> ChannelMsgHandler::SelectEvictionCandidates(int32_t need_expire) const {
-  auto client_channels = channel_manager_->GetAllClientChannel();
-  auto server_channels = channel_manager_->GetAllServerChannel();
+  const int32_t client_num = channel_manager_->GetChannelCount(ChannelType::kClient);
+  const int32_t server_num = channel_manager_->GetChannelCount(ChannelType::kServer);
 
-  LLMLOGI("SelectEvictionCandidates: need_expire=%d, client_channels=%zu, server_channels=%zu", need_expire,
-          client_channels.size(), server_channels.size());
+  LLMLOGI("SelectEvictionCandidates: need_expire=%d, client_channels=%d, server_channels=%d", need_expire, client_num,
+          server_num);
 
-  std::sort(client_channels.begin(), client_channels.end(), [](const ChannelPtr &a, const ChannelPtr &b) {
-    if (a->GetHasTransferred() != b->GetHasTransferred()) {
-      return !a->GetHasTransferred();
-    }
-    return false;
-  });
+  // Evict from the side with more channels until both sides are even, then alternate between them. Each side is
+  // walked in LRU order, and a channel that transferred since the last scan is skipped once (second chance).
   std::vector<EvictItem> target_items;
-  target_items.reserve(need_expire);
-  auto client_it = client_channels.begin();
-  auto server_it = server_channels.begin();
-  auto client_end = client_channels.end();
-  auto server_end = server_channels.end();
-  int32_t diff = std::abs(static_cast<int32_t>(client_channels.size() - server_channels.size()));
+  target_items.reserve(static_cast<size_t>(std::max(need_expire, 0)));
+  int32_t diff = std::abs(client_num - server_num);
   int32_t pick_extra = std::min(diff, need_expire);
-  bool pick_client_first = (client_channels.size() > server_channels.size());
-
+  const ChannelType extra_type = (client_num > server_num) ? ChannelType::kClient : ChannelType::kServer;
   for (int32_t i = 0; i < pick_extra && need_expire > 0; i++) {
-    if (pick_client_first && client_it != client_end) {
-      target_items.push_back(EvictItem{(*client_it)->GetChannelId(), ChannelType::kClient});
-      (*client_it)->SetDisconnecting(true);
-      ++client_it;
-    } else if (server_it != server_end) {
-      target_items.push_back(EvictItem{(*server_it)->GetChannelId(), ChannelType::kServer});
-      (*server_it)->SetDisconnecting(true);
-      ++server_it;
-    }
+    (void)PickEvictionCandidate(extra_type, target_items);
     need_expire--;
   }
+  bool client_left = true;
+  bool server_left = true;
   bool pick_client = true;
-  while (need_expire > 0 && (client_it != client_end || server_it != server_end)) {
-    if (pick_client && client_it != client_end) {
-      target_items.push_back(EvictItem{(*client_it)->GetChannelId(), ChannelType::kClient});
-      (*client_it)->SetDisconnecting(true);
-      ++client_it;
-    } else if (!pick_client && server_it != server_end) {
-      target_items.push_back(EvictItem{(*server_it)->GetChannelId(), ChannelType::kServer});
-      (*server_it)->SetDisconnecting(true);
-      ++server_it;
-    }
-    need_expire--;
+  while (need_expire > 0 && (client_left || server_left)) {
+    // When one side has no candidate left, keep picking from the other side only.
+    const bool use_client = client_left && (pick_client || !server_left);
     pick_client = !pick_client;
+    if (use_client) {
+      client_left = PickEvictionCandidate(ChannelType::kClient, target_items);
+      need_expire -= client_left ? 1 : 0;
+    } else {
+      server_left = PickEvictionCandidate(ChannelType::kServer, target_items);
+      need_expire -= server_left ? 1 : 0;
+    }
   }
 
   return target_items;
@@ -835,7 +850,6 @@ void ChannelMsgHandler::EvictionLoop() {
       evict_queue_.pop();
       ProcessEviction(item);
     }
-    ResetAllTransferFlags();
   }
 }
 
@@ -910,21 +924,4 @@ Status ChannelMsgHandler::ProcessClientEviction(const std::string &channel_id, i
   }
   return ret;
 }
-
-Status ChannelMsgHandler::ResetAllTransferFlags() const {
-  auto client_channels = channel_manager_->GetAllClientChannel();
-  auto server_channels = channel_manager_->GetAllServerChannel();
-  for (auto &channel : client_channels) {
-    if (channel->GetTransferCount() == 0) {
-      channel->SetHasTransferred(false);
-    }
-  }
-  for (auto &channel : server_channels) {
-    if (channel->GetTransferCount() == 0) {
-      channel->SetHasTransferred(false);
-    }
-  }
-  LLMLOGI("Reset transfer flags, client=%zu, server=%zu", client_channels.size(), server_channels.size());
-  return SUCCESS;
-}
 }  // namespace adxl
@@ -18,6 +18,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <optional>
+#include <memory>
+#include <unordered_map>
 #include "channel_manager.h"
 #include "common/msg_handler_plugin.h"
 #include "segment_table.h"
@@ -62,6 +64,20 @@ struct PendingDisconnectRequest {
   RequestDisconnectResp resp;
 };
 
+// Read-only snapshot of local registered memory, rebuilt lazily after RegisterMem/DeregisterMem.
+struct LocalMemSnapshot {
+  std::map<MemHandle, void *> registered_mems;
+  std::vector<AddrInfo> addrs;
+};
+
+// Rank table generated for a peer, regenerated when the peer comm_res changes.
+struct PeerRankTable {
+  std::string peer_comm_res;
+  std::string rank_table;
+  int32_t local_rank_id;
+  int32_t peer_rank_id;
+};
+
 using CallbackProcessor = std::function<Status(int32_t fd, const char *msg, uint64_t msg_len, bool &keep_fd)>;
 
 class ChannelMsgHandler {
@@ -111,7 +127,8 @@ class ChannelMsgHandler {
   Status StopDaemon();
   Status CreateChannel(const ChannelInfo &channel_info, bool is_client, const ChannelConnectInfo &peer_channel_info);
   Status ParseRankTable(const ChannelConnectInfo &peer_channel_info, std::string &rank_table, int32_t &local_rank_id,
-                        int32_t &peer_rank_id) const;
+                        int32_t &peer_rank_id);
+  std::shared_ptr<const LocalMemSnapshot> GetLocalMemSnapshot() const;
   Status ConnectInfoProcess(const ChannelConnectInfo &peer_channel_info, int32_t timeout, bool is_client);
   Status ProcessConnectRequest(int32_t fd, const char *msg, uint64_t msg_len, bool &keep_fd);
   Status DisconnectInfoProcess(ChannelType channel_type, const ChannelDisconnectInfo &peer_disconnect_info);
@@ -144,9 +161,9 @@ class ChannelMsgHandler {
   bool ShouldTriggerEviction() const;
   Status NotifyEviction();
   Status ProcessEviction(const EvictItem &item);
-  Status ResetAllTransferFlags() const;
   void EvictionLoop();
   std::vector<EvictItem> SelectEvictionCandidates(int32_t need_expire) const;
+  bool PickEvictionCandidate(ChannelType channel_type, std::vector<EvictItem> &target_items) const;
   Status StartEvictionThread();
   Status SetupChannelManagerCallbacks();
 
@@ -179,6 +196,9 @@ class ChannelMsgHandler {
   aclrtContext aclrt_context_{nullptr};
   mutable std::mutex mutex_;
   std::map<MemHandle, AddrInfo> handle_to_addr_;
+  mutable std::shared_ptr<const LocalMemSnapshot> local_mem_snapshot_;  // guarded by mutex_
+  std::mutex rank_table_cache_mutex_;
+  std::unordered_map<std::string, PeerRankTable> rank_table_cache_;  // key: peer channel_id
 
   std::string local_comm_name_;
   std::string local_comm_res_;
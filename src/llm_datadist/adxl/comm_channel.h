@@ -18,6 +18,7 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <list>
 #include <unordered_map>
 #include "nlohmann/json.hpp"
 #include "acl/acl.h"
@@ -205,6 +206,8 @@ class CommChannel {
   std::vector<NotifyMsg> notify_messages_;
 
   friend class ChannelManager;
+  // Position in ChannelManager's per-type LRU list, guarded by ChannelManager::mutex_.
+  std::list<std::shared_ptr<CommChannel>>::iterator lru_pos_;
   // Single link-level lock: serializes submit, sync, async poll, slot abort, and disconnect teardown so
   // concurrent threads never share or abort the one channel stream mid-issue.
   std::mutex device_launch_mu_;
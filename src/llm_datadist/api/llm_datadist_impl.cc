@@ -8,6 +8,8 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
+#include <chrono>
 #include "llm_datadist/llm_datadist.h"
 #include "llm_datadist/llm_engine_types.h"
 #include "common/llm_inner_types.h"
@@ -22,6 +24,7 @@
 #include "common/hixl_utils.h"
 #include "common/llm_checker.h"
 #include "common/llm_scope_guard.h"
+#include "common/transfer_telemetry.h"
 
 namespace llm_datadist {
 namespace {
@@ -130,6 +133,68 @@ void CalcIndicesWithValidRanges(const KvCacheExtParam &ext_param, llm::PullCache
     pull_cache_param.dst_tensor_indices.push_back(indices_beg + i);
   }
 }
+
+// 本端cache中单个张量第一维上一个batch或block的字节数，无法计算时为0
+uint64_t CalcBytesPerSlice(const Cache &cache) {
+  const auto &shape = cache.cache_desc.shape;
+  int64_t tensor_size = 0;
+  if (shape.empty() || (shape[0U] <= 0) ||
+      (llm::LLMUtils::CalcTensorMemSize(shape, static_cast<ge::DataType>(cache.cache_desc.data_type), tensor_size) !=
+       ge::SUCCESS)) {
+    return 0U;
+  }
+  return static_cast<uint64_t>(tensor_size / shape[0U]);
+}
+
+uint64_t CalcTransferTensorNum(const Cache &cache, const std::pair<int32_t, int32_t> &layer_range,
+                               const KvCacheExtParam &ext_param) {
+  if (layer_range.first < 0) {
+    return cache.cache_desc.num_tensors;
+  }
+  return static_cast<uint64_t>(layer_range.second - layer_range.first + 1) * ext_param.tensor_num_per_layer;
+}
+
+// 按本端cache描述估算一次传输的字节数，size>0时为每个张量的传输字节数
+uint64_t CalcTransferBytes(const Cache &cache, const std::pair<int32_t, int32_t> &layer_range,
+                           const KvCacheExtParam &ext_param, uint64_t slice_num, int64_t size = -1) {
+  const uint64_t bytes_per_tensor = (size > 0) ? static_cast<uint64_t>(size) : CalcBytesPerSlice(cache) * slice_num;
+  return bytes_per_tensor * CalcTransferTensorNum(cache, layer_range, ext_param);
+}
+
+uint64_t CalcPullTaskBytes(const PullKvTask &task) {
+  if (task.src_blocks.empty()) {
+    return CalcTransferBytes(task.dst_cache, task.ext_param.dst_layer_range, task.ext_param, 1U, task.size);
+  }
+  const uint64_t block_num = task.dst_blocks.empty() ? task.src_blocks.size() : task.dst_blocks.size();
+  return CalcTransferBytes(task.dst_cache, task.ext_param.dst_layer_range, task.ext_param, block_num);
+}
+
+// 与PullKvCache/PullKvBlocks的参数校验和转换一致
+Status ToPullCacheTask(const PullKvTask &task, llm::PullCacheTask &pull_cache_task) {
+  LLM_CHK_STATUS_RET(CheckKvCacheExtParam(task.ext_param));
+  auto &pull_cache_param = pull_cache_task.pull_cache_param;
+  pull_cache_param.tensor_num_per_layer = task.ext_param.tensor_num_per_layer;
+  pull_cache_task.cache_id = task.dst_cache.cache_id;
+  if (task.src_blocks.empty()) {
+    LLM_CHK_BOOL_RET_STATUS(task.dst_blocks.empty(), LLM_PARAM_INVALID,
+                            "src_blocks is empty, pull from non-block cache to blocks is not supported");
+    LLM_CHK_BOOL_RET_STATUS((task.size == -1) || (task.size > 0), LLM_PARAM_INVALID,
+                            "Invalid size (%ld), size must = -1 or > 0", task.size);
+    pull_cache_param.batch_index = task.batch_index;
+    pull_cache_param.size = task.size;
+    CalcIndicesWithValidRanges(task.ext_param, pull_cache_param);
+    pull_cache_task.cache_key = ToCacheKey(task.src_cache_index, true);
+    return LLM_SUCCESS;
+  }
+  LLM_CHK_BOOL_RET_STATUS(task.src_cache_index.batch_index == 0U, LLM_PARAM_INVALID,
+                          "invalid src_cache_index.batch_index (%u), only 0 is supported in pull block",
+                          task.src_cache_index.batch_index);
+  pull_cache_param.prompt_blocks = task.src_blocks;
+  pull_cache_param.decoder_blocks = task.dst_blocks;
+  CalcIndicesWithValidRanges(task.ext_param, pull_cache_param);
+  pull_cache_task.cache_key = ToCacheKey(task.src_cache_index, task.dst_blocks.empty());
+  return LLM_SUCCESS;
+}
 }  // namespace
 
 class LlmDataDist::LlmDataDistImpl {
@@ -155,6 +220,8 @@ class LlmDataDist::LlmDataDistImpl {
                       const std::vector<uint64_t> &src_blocks, const std::vector<uint64_t> &dst_blocks,
                       const KvCacheExtParam &dst_param);
 
+  Status PullKvCaches(const std::vector<PullKvTask> &tasks, std::vector<Status> &rets);
+
   Status PushKvCache(const Cache &src_cache, const CacheIndex &dst_cache_index, uint32_t src_batch_index = 0U,
                      int64_t size = -1, const KvCacheExtParam &ext_param = {});
 
@@ -167,6 +234,11 @@ class LlmDataDist::LlmDataDistImpl {
 
   Status UnregisterKvCache(int64_t cache_id);
 
+  void RecordTransfer(uint64_t remote_cluster_id, hixl::TransferOp operation, uint64_t bytes,
+                      std::chrono::steady_clock::time_point start);
+
+  void GetTransferStatistics(uint64_t remote_cluster_id, ClusterTransferStatistics &statistics) const;
+
  private:
   Status PushData(const Cache &src_cache, const KvCacheExtParam &ext_param,
                   llm::TransferCacheConfig &transfer_cache_config, llm::TransferBlockConfig &transfer_block_config);
@@ -176,6 +248,7 @@ class LlmDataDist::LlmDataDistImpl {
   LlmRole role_;
   uint64_t cluster_id_;
   std::vector<int32_t> device_ids_;
+  hixl::TransferTelemetry telemetry_;
 };
 
 Status LlmDataDist::LlmDataDistImpl::Initialize(const std::map<AscendString, AscendString> &options) {
@@ -238,7 +311,13 @@ Status LlmDataDist::LlmDataDistImpl::UnlinkLlmClusters(const std::vector<Cluster
   LLM_CHK_BOOL_RET_STATUS(timeout > 0, LLM_PARAM_INVALID, "Check timeout (%d) > 0 failed", timeout);
   std::vector<llm::ClusterInfo> cluster_infos;
   LLM_CHK_STATUS_RET(ConvertClusterInfos(clusters, cluster_infos), "Failed to unlink clusters");
-  return llm_data_dist_.UnlinkClusters(cluster_infos, rets, timeout, force_flag);
+  const auto ret = llm_data_dist_.UnlinkClusters(cluster_infos, rets, timeout, force_flag);
+  for (size_t i = 0U; (i < rets.size()) && (i < clusters.size()); ++i) {
+    if (rets[i] == LLM_SUCCESS) {
+      telemetry_.Remove(std::to_string(clusters[i].remote_cluster_id));
+    }
+  }
+  return ret;
 }
 
 Status LlmDataDist::LlmDataDistImpl::PullKvBlocks(const CacheIndex &src_cache_index, const Cache &dst_cache,
@@ -277,6 +356,30 @@ Status LlmDataDist::LlmDataDistImpl::PullKvCache(const CacheIndex &src_cache_ind
   return llm_data_dist_.PullCache(dst_cache.cache_id, ToCacheKey(src_cache_index, true), pull_cache_param);
 }
 
+Status LlmDataDist::LlmDataDistImpl::PullKvCaches(const std::vector<PullKvTask> &tasks, std::vector<Status> &rets) {
+  LLM_CHK_BOOL_RET_STATUS((llm_data_dist_.IsInitialized()), ge::FAILED, "LlmDataDist is not initialized");
+  rets.assign(tasks.size(), LLM_SUCCESS);
+  std::vector<llm::PullCacheTask> pull_cache_tasks;
+  std::vector<size_t> task_indices;
+  for (size_t i = 0U; i < tasks.size(); ++i) {
+    llm::PullCacheTask pull_cache_task{};
+    rets[i] = ToPullCacheTask(tasks[i], pull_cache_task);
+    if (rets[i] == LLM_SUCCESS) {
+      pull_cache_tasks.emplace_back(std::move(pull_cache_task));
+      task_indices.emplace_back(i);
+    }
+  }
+  if (!pull_cache_tasks.empty()) {
+    std::vector<Status> pull_rets;
+    (void)llm_data_dist_.PullCaches(pull_cache_tasks, pull_rets);
+    for (size_t i = 0U; (i < task_indices.size()) && (i < pull_rets.size()); ++i) {
+      rets[task_indices[i]] = pull_rets[i];
+    }
+  }
+  const auto failed_it = std::find_if(rets.cbegin(), rets.cend(), [](Status ret) { return ret != LLM_SUCCESS; });
+  return (failed_it == rets.cend()) ? LLM_SUCCESS : *failed_it;
+}
+
 Status LlmDataDist::LlmDataDistImpl::SetRole(LlmRole role, const std::map<AscendString, AscendString> &options) {
   LLM_CHK_BOOL_RET_STATUS((llm_data_dist_.IsInitialized()), ge::FAILED, "LlmDataDist is not initialized");
   const auto &role_str = RoleToString(role);
@@ -432,6 +535,31 @@ Status LlmDataDist::LlmDataDistImpl::RegisterKvCache(const CacheDesc &cache_desc
   return LLM_SUCCESS;
 }
 
+void LlmDataDist::LlmDataDistImpl::RecordTransfer(uint64_t remote_cluster_id, hixl::TransferOp operation,
+                                                  uint64_t bytes, std::chrono::steady_clock::time_point start) {
+  const auto cost =
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+  telemetry_.Record(std::to_string(remote_cluster_id), operation, bytes, static_cast<uint64_t>(cost));
+}
+
+void LlmDataDist::LlmDataDistImpl::GetTransferStatistics(uint64_t remote_cluster_id,
+                                                         ClusterTransferStatistics &statistics) const {
+  const auto peer_statistics = telemetry_.Query(std::to_string(remote_cluster_id));
+  const auto convert = [](const hixl::TransferStatistics &src, TransferStatistics &dst) {
+    dst.bytes_per_second = src.bytes_per_second;
+    dst.ops_per_second = src.ops_per_second;
+    dst.total_bytes = src.total_bytes;
+    dst.total_ops = src.total_ops;
+    dst.p50_latency_us = src.p50_latency_us;
+    dst.p90_latency_us = src.p90_latency_us;
+    dst.p99_latency_us = src.p99_latency_us;
+    dst.max_latency_us = src.max_latency_us;
+  };
+  statistics.window_ms = peer_statistics.window_ms;
+  convert(peer_statistics.read, statistics.pull);
+  convert(peer_statistics.write, statistics.push);
+}
+
 Status LlmDataDist::LlmDataDistImpl::UnregisterKvCache(int64_t cache_id) {
   LLM_CHK_BOOL_RET_STATUS((llm_data_dist_.IsInitialized()), ge::FAILED, "LlmDataDist is not initialized");
   LLM_CHK_STATUS_RET(llm_data_dist_.UnregisterCache(cache_id), "Failed to unregister cache, cache_id = %ld", cache_id);
@@ -509,12 +637,15 @@ Status LlmDataDist::PullKvCache(const CacheIndex &src_cache_index, const Cache &
                                 int64_t size, const KvCacheExtParam &ext_param) {
   LLMLOGI("[PullKvCache] start");
   LLM_CHK_BOOL_RET_STATUS(impl_ != nullptr, LLM_FAILED, "impl is nullptr, check LlmDataDist construct");
+  const auto start = std::chrono::steady_clock::now();
   const auto ret = impl_->PullKvCache(src_cache_index, dst_cache, batch_index, size, ext_param);
   LLM_CHK_BOOL_RET_STATUS(ret == LLM_SUCCESS, ret,
                           "[PullKvCache] failed, src_cluster_id = %lu, src_cache_id = %ld, src_batch_index = %u, "
                           "dst_cache_id = %ld",
                           src_cache_index.cluster_id, src_cache_index.cache_id, src_cache_index.batch_index,
                           dst_cache.cache_id);
+  impl_->RecordTransfer(src_cache_index.cluster_id, hixl::READ,
+                        CalcTransferBytes(dst_cache, ext_param.dst_layer_range, ext_param, 1U, size), start);
   LLMLOGI("[PullKvCache] success, src_cluster_id = %lu, src_cache_id = %ld, src_batch_index = %u, dst_cache_id = %ld",
           src_cache_index.cluster_id, src_cache_index.cache_id, src_cache_index.batch_index, dst_cache.cache_id);
   return LLM_SUCCESS;
@@ -525,12 +656,16 @@ Status LlmDataDist::PullKvBlocks(const CacheIndex &src_cache_index, const Cache
                                  const KvCacheExtParam &ext_param) {
   LLMLOGI("[PullKvBlocks] start");
   LLM_CHK_BOOL_RET_STATUS(impl_ != nullptr, LLM_FAILED, "impl is nullptr, check LlmDataDist construct");
+  const auto start = std::chrono::steady_clock::now();
   const auto ret = impl_->PullKvBlocks(src_cache_index, dst_cache, src_blocks, dst_blocks, ext_param);
   LLM_CHK_BOOL_RET_STATUS(ret == LLM_SUCCESS, ret,
                           "[PullKvBlocks] failed, src_cluster_id = %lu, src_cache_id = %ld, dst_cache_id = %ld, "
                           "src_blocks = %s, dst_blocks = %s",
                           src_cache_index.cluster_id, src_cache_index.cache_id, dst_cache.cache_id,
                           hixl::ToString(src_blocks).c_str(), hixl::ToString(dst_blocks).c_str());
+  const uint64_t block_num = dst_blocks.empty() ? src_blocks.size() : dst_blocks.size();
+  impl_->RecordTransfer(src_cache_index.cluster_id, hixl::READ,
+                        CalcTransferBytes(dst_cache, ext_param.dst_layer_range, ext_param, block_num), start);
   LLMLOGI(
       "[PullKvBlocks] success, src_cluster_id = %lu, src_cache_id = %ld, dst_cache_id = %ld, "
       "src_blocks = %s, dst_blocks = %s",
@@ -539,6 +674,25 @@ Status LlmDataDist::PullKvBlocks(const CacheIndex &src_cache_index, const Cache
   return LLM_SUCCESS;
 }
 
+Status LlmDataDist::PullKvCaches(const std::vector<PullKvTask> &tasks, std::vector<Status> &rets) {
+  LLMLOGI("[PullKvCaches] start, task_num = %zu", tasks.size());
+  LLM_CHK_BOOL_RET_STATUS(impl_ != nullptr, LLM_FAILED, "impl is nullptr, check LlmDataDist construct");
+  const auto start = std::chrono::steady_clock::now();
+  const auto ret = impl_->PullKvCaches(tasks, rets);
+  size_t failed_num = 0U;
+  for (size_t i = 0U; (i < tasks.size()) && (i < rets.size()); ++i) {
+    if (rets[i] != LLM_SUCCESS) {
+      ++failed_num;
+      continue;
+    }
+    impl_->RecordTransfer(tasks[i].src_cache_index.cluster_id, hixl::READ, CalcPullTaskBytes(tasks[i]), start);
+  }
+  LLM_CHK_BOOL_RET_STATUS(ret == LLM_SUCCESS, ret, "[PullKvCaches] failed, task_num = %zu, failed_num = %zu",
+                          tasks.size(), failed_num);
+  LLMLOGI("[PullKvCaches] success, task_num = %zu", tasks.size());
+  return LLM_SUCCESS;
+}
+
 Status LlmDataDist::CopyKvCache(const Cache &src_cache, const Cache &dst_cache, uint32_t src_batch_index,
                                 uint32_t dst_batch_index, uint64_t offset, int64_t size) {
   (void)src_cache;
@@ -566,12 +720,15 @@ Status LlmDataDist::PushKvCache(const Cache &src_cache, const CacheIndex &dst_ca
                                 int64_t size, const KvCacheExtParam &ext_param) {
   LLMLOGI("[PushKvCache] start");
   LLM_CHK_BOOL_RET_STATUS(impl_ != nullptr, LLM_FAILED, "impl is nullptr, check LlmDataDist construct");
+  const auto start = std::chrono::steady_clock::now();
   const auto ret = impl_->PushKvCache(src_cache, dst_cache_index, src_batch_index, size, ext_param);
   LLM_CHK_BOOL_RET_STATUS(ret == LLM_SUCCESS, ret,
                           "[PushKvCache] failed, dst_cluster_id = %lu, dst_cache_id = %ld, dst_batch_index = %u, "
                           "src_cache_id = %ld",
                           dst_cache_index.cluster_id, dst_cache_index.cache_id, dst_cache_index.batch_index,
                           src_cache.cache_id);
+  impl_->RecordTransfer(dst_cache_index.cluster_id, hixl::WRITE,
+                        CalcTransferBytes(src_cache, ext_param.src_layer_range, ext_param, 1U), start);
   LLMLOGI("[PushKvCache] success, dst_cluster_id = %lu, dst_cache_id = %ld, dst_batch_index = %u, src_cache_id = %ld",
           dst_cache_index.cluster_id, dst_cache_index.cache_id, dst_cache_index.batch_index, src_cache.cache_id);
   return LLM_SUCCESS;
@@ -582,12 +739,15 @@ Status LlmDataDist::PushKvBlocks(const Cache &src_cache, const CacheIndex &dst_c
                                  const KvCacheExtParam &ext_param) {
   LLMLOGI("[PushKvBlocks] start");
   LLM_CHK_BOOL_RET_STATUS(impl_ != nullptr, LLM_FAILED, "impl is nullptr, check LlmDataDist construct");
+  const auto start = std::chrono::steady_clock::now();
   const auto ret = impl_->PushKvBlocks(src_cache, dst_cache_index, src_blocks, dst_blocks, ext_param);
   LLM_CHK_BOOL_RET_STATUS(ret == LLM_SUCCESS, ret,
                           "[PushKvBlocks] failed, dst_cluster_id = %lu, dst_cache_id = %ld, src_cache_id = %ld, "
                           "src_blocks = %s, dst_blocks = %s",
                           dst_cache_index.cluster_id, dst_cache_index.cache_id, src_cache.cache_id,
                           hixl::ToString(src_blocks).c_str(), hixl::ToString(dst_blocks).c_str());
+  impl_->RecordTransfer(dst_cache_index.cluster_id, hixl::WRITE,
+                        CalcTransferBytes(src_cache, ext_param.src_layer_range, ext_param, src_blocks.size()), start);
   LLMLOGI(
       "[PushKvBlocks] success, dst_cluster_id = %lu, dst_cache_id = %ld, src_cache_id = %ld, "
       "src_blocks = %s, dst_blocks = %s",
@@ -596,6 +756,12 @@ Status LlmDataDist::PushKvBlocks(const Cache &src_cache, const CacheIndex &dst_c
   return LLM_SUCCESS;
 }
 
+Status LlmDataDist::GetTransferStatistics(uint64_t remote_cluster_id, ClusterTransferStatistics &statistics) {
+  LLM_CHK_BOOL_RET_STATUS(impl_ != nullptr, LLM_FAILED, "impl is nullptr, check LlmDataDist construct");
+  impl_->GetTransferStatistics(remote_cluster_id, statistics);
+  return LLM_SUCCESS;
+}
+
 Status LlmDataDist::RegisterKvCache(const CacheDesc &cache_desc, const std::vector<uint64_t> &addrs,
                                     const RegisterCfg &cfg, int64_t &cache_id) {
   LLMLOGI("[RegisterKvCache] start");
@@ -9,58 +9,70 @@
  */
 
 #include "cache_manager.h"
+#include <algorithm>
+#include <atomic>
 #include <numeric>
 #include "acl/acl.h"
 #include "common/llm_utils.h"
 #include "common/llm_thread_pool.h"
+#include "common/mem_utils.h"
 #include "common/def_types.h"
 #include "common/hixl_utils.h"
 
 namespace llm {
 namespace {
 constexpr uint64_t kMaxBlockSize = 4UL * 1024 * 1024 * 1024;  // 4GB
+constexpr uint32_t kCopyThreadNum = 4U;
+constexpr size_t kMaxBatchCopyNum = 4096U;  // 单次aclrtMemcpyBatch的最大拷贝数
 
 class CopyJob {
  public:
-  explicit CopyJob(aclrtStream stream, uint64_t max_block_size = kMaxBlockSize)
-      : stream_(stream), max_block_size_(max_block_size) {}
+  explicit CopyJob(uint64_t max_block_size = kMaxBlockSize) : max_block_size_(max_block_size) {}
   ~CopyJob() = default;
 
-  ge::Status AddCopyTask(void *dst, uint64_t dest_max, const void *src, uint64_t count, aclrtMemcpyKind kind) {
-    if (!NeedCopyAsync(kind, count)) {
-      if (aclrt_context_ == nullptr) {
-        LLM_CHK_BOOL_RET_STATUS(aclrtGetCurrentContext(&aclrt_context_) == ACL_ERROR_NONE, ge::FAILED,
-                                "Failed to get aclrt context");
+  /**
+   * @brief 提交一个device上的拷贝计划，不等待完成
+   * D2D大块拷贝异步下发到该device的stream；H2D/D2H优先使用aclrtMemcpyBatch整批提交；其余按线程数分组同步拷贝，
+   * 所有拷贝均在该device的context下执行
+   */
+  ge::Status Submit(const CopyPlan &plan) {
+    LLM_CHECK_NOTNULL(plan.device);
+    CopyDevice &device = *plan.device;
+    hixl::TemporaryRtContext with_context(device.context);
+    std::vector<CopyItem> sync_items;
+    for (const auto &item : plan.items) {
+      if (NeedCopyAsync(plan.kind, item.count)) {
+        LLM_CHK_STATUS_RET(AddAsyncCopyTask(item, device.stream));
+      } else {
+        sync_items.emplace_back(item);
       }
-      auto fut = pool_.commit([this, dst, dest_max, src, count, kind]() -> ge::Status {
-        (void)aclrtSetCurrentContext(aclrt_context_);
-        const auto ret = aclrtMemcpy(dst, dest_max, src, count, kind);
-        LLM_CHK_BOOL_RET_STATUS(ret == ACL_ERROR_NONE, ge::FAILED, "failed to copy cache, aclrt_ret = 0x%X",
-                                static_cast<uint32_t>(ret));
-        return ge::SUCCESS;
-      });
-      LLM_CHK_BOOL_RET_STATUS(fut.valid(), ge::FAILED, "Failed to commit copy task");
-      copy_futs_.emplace_back(std::move(fut));
+    }
+    if (sync_items.empty()) {
       return ge::SUCCESS;
     }
-    need_sync_ = true;
-    uint64_t offset = 0;
-    uint64_t remaining = count;
-    while (remaining > 0) {
-      uint64_t size_to_copy = remaining <= max_block_size_ ? remaining : max_block_size_;
-      auto dst_start = static_cast<uint8_t *>(dst) + offset;
-      auto src_start = static_cast<const uint8_t *>(src) + offset;
-      LLM_CHK_ACL_RET(
-          aclrtMemcpyAsync(dst_start, dest_max, src_start, size_to_copy, ACL_MEMCPY_DEVICE_TO_DEVICE, stream_));
-      offset += max_block_size_;
-      remaining -= size_to_copy;
+    if (SupportBatchCopy(plan.kind, device)) {
+      for (size_t begin = 0U; begin < sync_items.size(); begin += kMaxBatchCopyNum) {
+        const size_t end = std::min(sync_items.size(), begin + kMaxBatchCopyNum);
+        LLM_CHK_STATUS_RET(CommitCopyTask(std::vector<CopyItem>(sync_items.begin() + begin, sync_items.begin() + end),
+                                          plan.kind, device, true));
+      }
+      return ge::SUCCESS;
+    }
+    const size_t group_size = (sync_items.size() + kCopyThreadNum - 1U) / kCopyThreadNum;
+    for (size_t begin = 0U; begin < sync_items.size(); begin += group_size) {
+      const size_t end = std::min(sync_items.size(), begin + group_size);
+      LLM_CHK_STATUS_RET(CommitCopyTask(std::vector<CopyItem>(sync_items.begin() + begin, sync_items.begin() + end),
+                                        plan.kind, device, false));
     }
     return ge::SUCCESS;
   }
 
+  /**
+   * @brief 所有已提交计划的统一完成点
+   */
   ge::Status GetResult() {
-    if (need_sync_) {
-      LLM_CHK_STATUS_RET(aclrtSynchronizeStream(stream_));
+    for (const auto stream : sync_streams_) {
+      LLM_CHK_STATUS_RET(aclrtSynchronizeStream(stream));
     }
     for (size_t i = 0U; i < copy_futs_.size(); ++i) {
       LLM_CHK_STATUS_RET(copy_futs_[i].get(), "Failed to copy cache, index = %zu", i);
@@ -69,16 +81,86 @@ class CopyJob {
   }
 
  private:
-  bool NeedCopyAsync(aclrtMemcpyKind kind, uint64_t count) const {
+  static bool NeedCopyAsync(aclrtMemcpyKind kind, uint64_t count) {
     constexpr uint64_t kMinBlockSize = 2UL * 1024 * 1024;  // 2MB
     return (kind == ACL_MEMCPY_DEVICE_TO_DEVICE) && (count >= kMinBlockSize);
   }
 
-  aclrtStream stream_ = nullptr;
-  aclrtContext aclrt_context_ = nullptr;
-  bool need_sync_ = false;
+  static bool SupportBatchCopy(aclrtMemcpyKind kind, const CopyDevice &device) {
+    return ((kind == ACL_MEMCPY_HOST_TO_DEVICE) || (kind == ACL_MEMCPY_DEVICE_TO_HOST)) &&
+           device.support_batch_copy.load();
+  }
+
+  ge::Status AddAsyncCopyTask(const CopyItem &item, aclrtStream stream) {
+    if (std::find(sync_streams_.cbegin(), sync_streams_.cend(), stream) == sync_streams_.cend()) {
+      sync_streams_.emplace_back(stream);
+    }
+    uint64_t offset = 0;
+    uint64_t remaining = item.count;
+    while (remaining > 0) {
+      uint64_t size_to_copy = remaining <= max_block_size_ ? remaining : max_block_size_;
+      auto dst_start = static_cast<uint8_t *>(item.dst) + offset;
+      auto src_start = static_cast<const uint8_t *>(item.src) + offset;
+      LLM_CHK_ACL_RET(aclrtMemcpyAsync(dst_start, item.dest_max - offset, src_start, size_to_copy,
+                                       ACL_MEMCPY_DEVICE_TO_DEVICE, stream));
+      offset += size_to_copy;
+      remaining -= size_to_copy;
+    }
+    return ge::SUCCESS;
+  }
+
+  // use_batch为true时使用aclrtMemcpyBatch，device不支持时回退为逐个拷贝并记录到该device
+  ge::Status CommitCopyTask(std::vector<CopyItem> items, aclrtMemcpyKind kind, CopyDevice &device, bool use_batch) {
+    auto fut = pool_.commit([items, kind, &device, use_batch]() -> ge::Status {
+      (void)aclrtSetCurrentContext(device.context);
+      if (use_batch) {
+        const auto ret = BatchCopy(items, kind, device.device_id);
+        if (ret != ACL_ERROR_RT_FEATURE_NOT_SUPPORT) {
+          LLM_CHK_BOOL_RET_STATUS(ret == ACL_ERROR_NONE, ge::FAILED, "failed to batch copy cache, aclrt_ret = 0x%X",
+                                  static_cast<uint32_t>(ret));
+          return ge::SUCCESS;
+        }
+        LLMLOGI("aclrtMemcpyBatch is not supported on device:%d, fallback to aclrtMemcpy", device.device_id);
+        device.support_batch_copy.store(false);
+      }
+      for (const auto &item : items) {
+        const auto ret = aclrtMemcpy(item.dst, item.dest_max, item.src, item.count, kind);
+        LLM_CHK_BOOL_RET_STATUS(ret == ACL_ERROR_NONE, ge::FAILED, "failed to copy cache, aclrt_ret = 0x%X",
+                                static_cast<uint32_t>(ret));
+      }
+      return ge::SUCCESS;
+    });
+    LLM_CHK_BOOL_RET_STATUS(fut.valid(), ge::FAILED, "Failed to commit copy task");
+    copy_futs_.emplace_back(std::move(fut));
+    return ge::SUCCESS;
+  }
+
+  static aclError BatchCopy(const std::vector<CopyItem> &items, aclrtMemcpyKind kind, int32_t device_id) {
+    const size_t batch_num = items.size();
+    std::vector<void *> dsts(batch_num);
+    std::vector<void *> srcs(batch_num);
+    std::vector<size_t> dest_maxs(batch_num);
+    std::vector<size_t> sizes(batch_num);
+    for (size_t i = 0U; i < batch_num; ++i) {
+      dsts[i] = items[i].dst;
+      srcs[i] = const_cast<void *>(items[i].src);
+      dest_maxs[i] = items[i].dest_max;
+      sizes[i] = items[i].count;
+    }
+    const aclrtMemLocation device_loc{static_cast<uint32_t>(device_id), ACL_MEM_LOCATION_TYPE_DEVICE};
+    const aclrtMemLocation host_loc{0U, ACL_MEM_LOCATION_TYPE_HOST};
+    // 所有拷贝方向一致，共用一个属性
+    aclrtMemcpyBatchAttr attr = (kind == ACL_MEMCPY_DEVICE_TO_HOST) ? aclrtMemcpyBatchAttr{host_loc, device_loc, {}}
+                                                                    : aclrtMemcpyBatchAttr{device_loc, host_loc, {}};
+    size_t attr_index = 0U;
+    size_t fail_index = 0U;
+    return aclrtMemcpyBatch(dsts.data(), dest_maxs.data(), srcs.data(), sizes.data(), batch_num, &attr, &attr_index,
+                            1U, &fail_index);
+  }
+
   uint64_t max_block_size_ = 0;
-  LLMThreadPool pool_{"ge_llm_cahm", 4};
+  std::vector<aclrtStream> sync_streams_;
+  LLMThreadPool pool_{"ge_llm_cahm", kCopyThreadNum};
   std::vector<std::future<ge::Status>> copy_futs_;
 };
 
@@ -101,7 +183,7 @@ const CacheEntry *CacheManager::DoGetCacheEntry(int64_t cache_id) const {
 
 bool CacheManager::GetCacheKey(const std::pair<int64_t, uint64_t> &cache_id_and_batch_index,
                                DataCacheKey &cache_key) const {
-  std::lock_guard<std::mutex> lk(mu_);
+  std::shared_lock<std::shared_mutex> lk(mu_);
   const auto iter = cache_id_and_batch_id_to_cache_key_.find(cache_id_and_batch_index);
   if (iter != cache_id_and_batch_id_to_cache_key_.end()) {
     cache_key = iter->second;
@@ -111,7 +193,7 @@ bool CacheManager::GetCacheKey(const std::pair<int64_t, uint64_t> &cache_id_and_
 }
 
 bool CacheManager::GetCacheEntry(const int64_t cache_id, CacheEntry &cache_entry) const {
-  std::lock_guard<std::mutex> lk(mu_);
+  std::shared_lock<std::shared_mutex> lk(mu_);
   auto entry = DoGetCacheEntry(cache_id);
   bool success = (entry != nullptr);
   if (success) {
@@ -121,7 +203,7 @@ bool CacheManager::GetCacheEntry(const int64_t cache_id, CacheEntry &cache_entry
 }
 
 bool CacheManager::GetCacheEntry(const DataCacheKey &cache_key, bool is_prefix, CacheEntry &cache_entry) const {
-  std::lock_guard<std::mutex> lk(mu_);
+  std::shared_lock<std::shared_mutex> lk(mu_);
   auto &cache_key_to_id = is_prefix ? prefix_key_to_id_ : cache_key_to_id_;
   const auto iter = cache_key_to_id.find(cache_key);
   if (iter == cache_key_to_id.cend()) {
@@ -140,22 +222,24 @@ ge::Status CacheManager::RegisterCacheEntry(int64_t cache_id, const std::vector<
                                             int64_t tensor_size) {
   CacheEntry cache_entry = CreateCacheEntry(cache_desc, addrs, tensor_size);
   {
-    std::lock_guard<std::mutex> lk(mu_);
+    std::lock_guard<std::shared_mutex> lk(mu_);
     AddCacheIndices(cache_entry, cache_id, cache_keys);
     cache_id_to_entry_[cache_id] = std::move(cache_entry);
-    LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   }
+  LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   return ge::SUCCESS;
 }
 
 ge::Status CacheManager::UnregisterCacheEntry(int64_t cache_id) {
-  std::lock_guard<std::mutex> lk(mu_);
-  auto iter = cache_id_to_entry_.find(cache_id);
-  if (iter == cache_id_to_entry_.cend()) {
-    return ge::SUCCESS;
+  {
+    std::lock_guard<std::shared_mutex> lk(mu_);
+    auto iter = cache_id_to_entry_.find(cache_id);
+    if (iter == cache_id_to_entry_.cend()) {
+      return ge::SUCCESS;
+    }
+    RemoveCacheIndices(iter->second, cache_id);
+    cache_id_to_entry_.erase(iter);
   }
-  RemoveCacheIndices(cache_id);
-  cache_id_to_entry_.erase(iter);
   LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   return ge::SUCCESS;
 }
@@ -195,14 +279,14 @@ ge::Status CacheManager::Allocate(int64_t cache_id, const CacheDesc &cache_desc,
   cache_entry.ext_ref_count = 1;
   cache_entry.cache_addrs = cache_tensors;
   {
-    std::lock_guard<std::mutex> lk(mu_);
+    std::lock_guard<std::shared_mutex> lk(mu_);
     LLM_CHK_STATUS_RET(CheckCacheKeys(cache_desc, cache_keys), "Check cache_keys failed");
     LLM_CHK_BOOL_RET_STATUS(cache_id_to_entry_.find(cache_id) == cache_id_to_entry_.cend(), ge::LLM_PARAM_INVALID,
                             "cache_id %ld already exists", cache_id);
     AddCacheIndices(cache_entry, cache_id, cache_keys);
     cache_id_to_entry_[cache_id] = std::move(cache_entry);
-    LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   }
+  LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   cache.cache_id = cache_id;
   (void)cache.per_device_tensor_addrs.emplace_back(std::move(tensor_addresses));
   LLMLOGI("[cache_id:%ld][Allocate] success, num_tensors = %u, shape = %s, placement = %u", cache_id,
@@ -240,7 +324,7 @@ CacheEntry CacheManager::CreateCacheEntry(const CacheDesc &cache_desc, std::vect
 ge::Status CacheManager::CheckCacheKeys(const CacheDesc &cache_desc, const std::vector<CacheKey> &cache_keys) const {
   LLM_CHK_BOOL_RET_STATUS(cache_keys.size() <= static_cast<size_t>(cache_desc.shape.front()), ge::LLM_PARAM_INVALID,
                           "Number of cache_keys(%zu) > batch_size (%ld)", cache_keys.size(), cache_desc.shape.front());
-  std::set<DataCacheKey> data_cache_keys;
+  std::unordered_set<DataCacheKey, PairHash> data_cache_keys;
   for (const auto &cache_key : cache_keys) {
     bool is_prefix = false;
     auto data_cache_key = CreateDataCacheKey(cache_key, is_prefix);
@@ -263,11 +347,13 @@ void CacheManager::AddCacheIndices(CacheEntry &cache_entry, int64_t cache_id, co
     auto data_cache_key = CreateDataCacheKey(cache_key, is_prefix);
     if (cache_entry.num_blocks > 0U) {
       cache_key_to_id_[data_cache_key] = cache_id;
+      cache_entry.key_refs.push_back(CacheKeyRef{data_cache_key, batch_index, false, false});
     } else if (data_cache_key.first != UINT64_MAX) {
       auto &key_to_id = is_prefix ? prefix_key_to_id_ : cache_key_to_id_;
       (void)key_to_id.emplace(data_cache_key, cache_id);
       cache_entry.id_to_batch_index_and_size[data_cache_key.first] = std::make_pair(batch_index, cache_entry.stride);
       cache_id_and_batch_id_to_cache_key_[std::make_pair(cache_id, batch_index)] = data_cache_key;
+      cache_entry.key_refs.push_back(CacheKeyRef{data_cache_key, batch_index, is_prefix, true});
       std::vector<uint64_t> tmp_tensor_indices(cache_entry.cache_addrs.size());
       std::iota(tmp_tensor_indices.begin(), tmp_tensor_indices.end(), 0);
       std::unordered_set<uint64_t> tensor_indices(tmp_tensor_indices.begin(), tmp_tensor_indices.end());
@@ -281,29 +367,30 @@ void CacheManager::AddCacheIndices(CacheEntry &cache_entry, int64_t cache_id, co
   }
 }
 
-void CacheManager::RemoveCacheIndices(int64_t cache_id) {
-  for (auto it = cache_key_to_id_.begin(); it != cache_key_to_id_.end();) {
-    if (it->second == cache_id) {
-      it = cache_key_to_id_.erase(it);
-    } else {
-      ++it;
+void CacheManager::RemoveCacheIndices(const CacheEntry &cache_entry, int64_t cache_id) {
+  for (const auto &key_ref : cache_entry.key_refs) {
+    auto &key_to_id = key_ref.is_prefix ? prefix_key_to_id_ : cache_key_to_id_;
+    const auto it = key_to_id.find(key_ref.key);
+    // blocks cache的key允许被后注册的cache覆盖，仅删除仍指向本cache的索引
+    if ((it != key_to_id.end()) && (it->second == cache_id)) {
+      (void)key_to_id.erase(it);
     }
-  }
-  for (auto it = prefix_key_to_id_.begin(); it != prefix_key_to_id_.end();) {
-    if (it->second == cache_id) {
-      it = prefix_key_to_id_.erase(it);
-    } else {
-      ++it;
+    if (key_ref.has_batch_index) {
+      (void)cache_id_and_batch_id_to_cache_key_.erase(std::make_pair(cache_id, key_ref.batch_index));
     }
   }
-  for (auto it = cache_id_and_batch_id_to_cache_key_.begin(); it != cache_id_and_batch_id_to_cache_key_.end();) {
-    if (it->first.first == cache_id) {
-      it = cache_id_and_batch_id_to_cache_key_.erase(it);
-    } else {
-      ++it;
+  (void)cache_id_to_tensor_indices_.erase(cache_id);
+}
+
+void CacheManager::RemoveKeyRef(CacheEntry &cache_entry, const DataCacheKey &data_cache_key, bool is_prefix) {
+  auto &key_refs = cache_entry.key_refs;
+  for (size_t i = 0U; i < key_refs.size(); ++i) {
+    if ((key_refs[i].key == data_cache_key) && (key_refs[i].is_prefix == is_prefix)) {
+      key_refs[i] = key_refs.back();
+      key_refs.pop_back();
+      return;
     }
   }
-  (void)cache_id_to_tensor_indices_.erase(cache_id);
 }
 
 void CacheManager::RemoveBatchIndex(CacheEntry &cache_entry, int64_t cache_id, uint64_t batch_id) {
@@ -321,34 +408,39 @@ DataCacheKey CacheManager::CreateDataCacheKey(const CacheKey &cache_key, bool &i
 }
 
 ge::Status CacheManager::Deallocate(int64_t cache_id) {
-  std::lock_guard<std::mutex> lk(mu_);
-  auto it = cache_id_to_entry_.find(cache_id);
-  if (it == cache_id_to_entry_.cend()) {
-    LLMLOGI("[cache_id:%ld][Deallocate] cache_id does not exist", cache_id);
-    return ge::SUCCESS;
-  }
+  CacheEntry released_entry;  // 显存归还放到锁外，避免持写锁期间阻塞查询
+  {
+    std::lock_guard<std::shared_mutex> lk(mu_);
+    auto it = cache_id_to_entry_.find(cache_id);
+    if (it == cache_id_to_entry_.cend()) {
+      LLMLOGI("[cache_id:%ld][Deallocate] cache_id does not exist", cache_id);
+      return ge::SUCCESS;
+    }
 
-  auto &cache_entry = it->second;
-  if (!cache_entry.is_owned) {
-    LLMLOGI("[cache_id:%ld][Deallocate] cannot deallocate registered cache", cache_id);
-    return ge::SUCCESS;
-  }
-  if (cache_entry.num_blocks > 0U) {
-    RemoveCacheIndices(cache_id);
-    (void)cache_id_to_entry_.erase(it);
-    LLMLOGI("[cache_id:%ld][Deallocate blocks cache] success", cache_id);
-    LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
-    return ge::SUCCESS;
-  }
-  cache_entry.ext_ref_count = 0;
-  if (cache_entry.id_to_batch_index_and_size.empty()) {
-    (void)cache_id_to_entry_.erase(it);
-    LLMLOGI("[cache_id:%ld][Deallocate] success", cache_id);
-    LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
-  } else {
-    LLMLOGI("[cache_id:%ld][Deallocate] delayed for that it is still referenced by %zu cache_key(s)", cache_id,
-            cache_entry.id_to_batch_index_and_size.size());
+    auto &cache_entry = it->second;
+    if (!cache_entry.is_owned) {
+      LLMLOGI("[cache_id:%ld][Deallocate] cannot deallocate registered cache", cache_id);
+      return ge::SUCCESS;
+    }
+    if (cache_entry.num_blocks > 0U) {
+      RemoveCacheIndices(cache_entry, cache_id);
+      released_entry = std::move(cache_entry);
+      (void)cache_id_to_entry_.erase(it);
+      LLMLOGI("[cache_id:%ld][Deallocate blocks cache] success", cache_id);
+    } else {
+      cache_entry.ext_ref_count = 0;
+      if (!cache_entry.id_to_batch_index_and_size.empty()) {
+        LLMLOGI("[cache_id:%ld][Deallocate] delayed for that it is still referenced by %zu cache_key(s)", cache_id,
+                cache_entry.id_to_batch_index_and_size.size());
+        return ge::SUCCESS;
+      }
+      released_entry = std::move(cache_entry);
+      (void)cache_id_to_entry_.erase(it);
+      (void)cache_id_to_tensor_indices_.erase(cache_id);
+      LLMLOGI("[cache_id:%ld][Deallocate] success", cache_id);
+    }
   }
+  LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   return ge::SUCCESS;
 }
 
@@ -360,8 +452,9 @@ ge::Status CacheManager::RemoveCacheKey(const CacheKey &cache_key) {
 
 ge::Status CacheManager::RemoveCacheKey(const DataCacheKey &data_cache_key, bool is_prefix,
                                         const std::unordered_set<uint64_t> &tensor_indices) {
+  CacheEntry released_entry;
   auto &key_to_id = is_prefix ? prefix_key_to_id_ : cache_key_to_id_;
-  std::lock_guard<std::mutex> lk(mu_);
+  std::unique_lock<std::shared_mutex> lk(mu_);
   auto it = key_to_id.find(data_cache_key);
   if (it == key_to_id.cend()) {
     LLMLOGI("[RemoveCacheKey] cache_key (%lu, %lu) does not exist, is_prefix = %d", data_cache_key.first,
@@ -397,13 +490,17 @@ ge::Status CacheManager::RemoveCacheKey(const DataCacheKey &data_cache_key, bool
     return ge::SUCCESS;
   }
   RemoveBatchIndex(cache_entry, cache_id, data_cache_key.first);
+  RemoveKeyRef(cache_entry, data_cache_key, is_prefix);
   (void)key_to_id.erase(it);
   LLMLOGI("[cache_id:%ld] [RemoveCacheKey] success, cache_key = (%lu, %lu), is_prefix = %d", cache_id,
           data_cache_key.first, data_cache_key.second, static_cast<int32_t>(is_prefix));
   if ((cache_entry.ext_ref_count == 0) && cache_entry.id_to_batch_index_and_size.empty()) {
-    (void)cache_id_to_entry_.erase(cache_id);
+    released_entry = std::move(cache_entry);
+    (void)cache_id_to_entry_.erase(entry_it);
+    (void)cache_id_to_tensor_indices_.erase(cache_id);
     LLMLOGI("[cache_id:%ld][Deallocate] success", cache_id);
   }
+  lk.unlock();
   LLM_CHK_STATUS_RET(UpdateCacheTable(), "Failed to update cache table");
   return ge::SUCCESS;
 }
@@ -421,12 +518,27 @@ ge::Status CacheManager::CopyCache(const CopyCacheParam &copy_cache_param) {
   LLM_CHK_BOOL_RET_STATUS(src_cache_entry.cache_addrs.size() == dst_cache_entry.cache_addrs.size(),
                           ge::LLM_PARAM_INVALID, "num_tensors mismatches, src_tensor_num = %zu, dst_tensor_num = %zu",
                           src_cache_entry.cache_addrs.size(), dst_cache_entry.cache_addrs.size());
-  if (copy_cache_param.copy_block_infos.empty()) {
-    return CopyCacheForContinuous(src_cache_entry, dst_cache_entry, copy_cache_param,
-                                  src_cache_entry.cache_addrs.size());
-  } else {
-    return CopyCacheForBlocks(src_cache_entry, dst_cache_entry, copy_cache_param, src_cache_entry.cache_addrs.size());
+  // cache_addrs按device依次排列，所有device的拷贝一起提交、统一等待
+  const size_t device_num = copy_devices_.size();
+  LLM_CHK_BOOL_RET_STATUS((device_num > 0U) && (src_cache_entry.cache_addrs.size() % device_num == 0U),
+                          ge::LLM_PARAM_INVALID, "num_tensors (%zu) is not divisible by device_num (%zu)",
+                          src_cache_entry.cache_addrs.size(), device_num);
+  const size_t per_device_addr_num = src_cache_entry.cache_addrs.size() / device_num;
+  std::vector<CopyPlan> copy_plans(device_num);
+  for (size_t device_index = 0U; device_index < device_num; ++device_index) {
+    if (copy_cache_param.copy_block_infos.empty()) {
+      LLM_CHK_STATUS_RET(BuildContinuousCopyPlan(src_cache_entry, dst_cache_entry, copy_cache_param,
+                                                 per_device_addr_num, device_index, copy_plans[device_index]));
+    } else {
+      LLM_CHK_STATUS_RET(BuildBlockCopyPlan(src_cache_entry, dst_cache_entry, copy_cache_param, per_device_addr_num,
+                                            device_index, copy_plans[device_index]));
+    }
   }
+  LLMLOGI("[Copy][%ld->%ld] start, device_num = %zu", src_id, dst_id, device_num);
+  LLM_CHK_STATUS_RET(ExecuteCopyPlans(copy_plans, 0U), "[Copy][%ld->%ld] copy failed", src_id, dst_id);
+  LLMLOGI("[Copy][%ld->%ld] success, device_num = %zu, num_tensors = %zu, num_blocks = %zu", src_id, dst_id,
+          device_num, per_device_addr_num, copy_cache_param.copy_block_infos.size());
+  return ge::SUCCESS;
 }
 
 ge::Status CacheManager::CopyCacheForContinuous(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
@@ -434,65 +546,108 @@ ge::Status CacheManager::CopyCacheForContinuous(const CacheEntry &src_cache_entr
                                                 size_t device_index) {
   const auto src_id = copy_cache_param.src_cache_id;
   const auto dst_id = copy_cache_param.dst_cache_id;
+  std::vector<CopyPlan> copy_plans(1U);
+  LLM_CHK_STATUS_RET(BuildContinuousCopyPlan(src_cache_entry, dst_cache_entry, copy_cache_param, per_device_addr_num,
+                                             device_index, copy_plans[0U]));
+  LLMLOGI("[Copy][%ld->%ld] start", src_id, dst_id);
+  LLM_CHK_STATUS_RET(ExecuteCopyPlans(copy_plans, device_index), "[Copy][%ld->%ld] copy failed", src_id, dst_id);
+  LLMLOGI(
+      "[Copy][%ld->%ld] success, num_tensors = %zu, src_batch_index = %u, "
+      "dst_batch_index = %u, offset = %lu, size = %ld",
+      src_id, dst_id, per_device_addr_num, copy_cache_param.src_batch_index, copy_cache_param.dst_batch_index,
+      copy_cache_param.offset, copy_cache_param.size);
+  return ge::SUCCESS;
+}
+
+ge::Status CacheManager::CopyCacheForBlocks(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
+                                            const CopyCacheParam &copy_cache_param, size_t per_device_addr_num,
+                                            size_t device_index) {
+  const auto src_id = copy_cache_param.src_cache_id;
+  const auto dst_id = copy_cache_param.dst_cache_id;
+  std::vector<CopyPlan> copy_plans(1U);
+  LLM_CHK_STATUS_RET(BuildBlockCopyPlan(src_cache_entry, dst_cache_entry, copy_cache_param, per_device_addr_num,
+                                        device_index, copy_plans[0U]));
+  LLMLOGI("[Copy][%ld->%ld] start", src_id, dst_id);
+  LLM_CHK_STATUS_RET(ExecuteCopyPlans(copy_plans, device_index), "[Copy][%ld->%ld] copy failed", src_id, dst_id);
+  LLMLOGI("[Copy][%ld->%ld] success, num_tensors = %zu, num_blocks = %zu", src_id, dst_id, per_device_addr_num,
+          copy_cache_param.copy_block_infos.size());
+  return ge::SUCCESS;
+}
+
+ge::Status CacheManager::BuildContinuousCopyPlan(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
+                                                 const CopyCacheParam &copy_cache_param, size_t per_device_addr_num,
+                                                 size_t device_index, CopyPlan &copy_plan) {
+  const auto src_id = copy_cache_param.src_cache_id;
+  const auto dst_id = copy_cache_param.dst_cache_id;
   uint64_t copy_size;
   LLM_CHK_STATUS_RET(CheckCopyParams(src_cache_entry, dst_cache_entry, copy_cache_param, copy_size),
                      "[Copy][%ld->%ld] check param failed", src_id, dst_id);
   auto src_offset = src_cache_entry.stride * copy_cache_param.src_batch_index + copy_cache_param.offset;
   auto dst_offset = dst_cache_entry.stride * copy_cache_param.dst_batch_index + copy_cache_param.offset;
-  LLMLOGI("[Copy][%ld->%ld] start", src_id, dst_id);
-  EnsureCopyStream(device_index);
-  const auto copy_kind = ResolveCopyKind(src_cache_entry.placement, dst_cache_entry.placement);
-  CopyJob copy_job(copy_streams_[device_index]);
+  auto dst_max = dst_cache_entry.stride - copy_cache_param.offset;
+  copy_plan.kind = ResolveCopyKind(src_cache_entry.placement, dst_cache_entry.placement);
+  copy_plan.items.reserve(per_device_addr_num);
   auto begin = device_index * per_device_addr_num;
   for (size_t i = 0U; i < per_device_addr_num; ++i) {
     auto src_addr = PtrToPtr<void, uint8_t>(src_cache_entry.cache_addrs[begin + i].get()) + src_offset;
-    auto dst_max = dst_cache_entry.stride - copy_cache_param.offset;
     auto dst_addr = PtrToPtr<void, uint8_t>(dst_cache_entry.cache_addrs[begin + i].get()) + dst_offset;
-    LLM_CHK_STATUS_RET(copy_job.AddCopyTask(dst_addr, dst_max, src_addr, copy_size, copy_kind),
-                       "[Copy][%ld->%ld] invoke aclrtMemcpy failed, index = %zu", src_id, dst_id, i);
+    copy_plan.items.emplace_back(CopyItem{dst_addr, dst_max, src_addr, copy_size});
   }
-  LLM_CHK_STATUS_RET(copy_job.GetResult(), "[Copy][%ld->%ld] invoke aclrtSynchronizeStream failed", src_id, dst_id);
-  LLMLOGI(
-      "[Copy][%ld->%ld] success, num_tensors = %zu, src_batch_index = %u, "
-      "dst_batch_index = %u, offset = %lu, size = %ld",
-      src_id, dst_id, per_device_addr_num, copy_cache_param.src_batch_index, copy_cache_param.dst_batch_index,
-      copy_cache_param.offset, copy_cache_param.size);
   return ge::SUCCESS;
 }
 
-ge::Status CacheManager::CopyCacheForBlocks(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
+ge::Status CacheManager::BuildBlockCopyPlan(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
                                             const CopyCacheParam &copy_cache_param, size_t per_device_addr_num,
-                                            size_t device_index) {
+                                            size_t device_index, CopyPlan &copy_plan) {
   const auto src_id = copy_cache_param.src_cache_id;
   const auto dst_id = copy_cache_param.dst_cache_id;
   LLM_CHK_BOOL_RET_STATUS(src_cache_entry.stride == dst_cache_entry.stride, ge::FAILED,
                           "[Copy][%ld->%ld] failed, block_size mismatches, src = %lu, dst = %lu", src_id, dst_id,
                           src_cache_entry.stride, dst_cache_entry.stride);
   const auto block_size = src_cache_entry.stride;
-  LLMLOGI("[Copy][%ld->%ld] start", src_id, dst_id);
-  EnsureCopyStream(device_index);
-  CopyJob copy_job(copy_streams_[device_index]);
-  const auto copy_kind = ResolveCopyKind(src_cache_entry.placement, dst_cache_entry.placement);
+  // 先校验block映射并合并两侧均连续的相邻block，各tensor共用同一组区间
+  std::vector<std::pair<std::pair<uint64_t, uint64_t>, uint64_t>> block_ranges;  // (src_start, dst_start), num
+  for (const auto &block_index_pair : copy_cache_param.copy_block_infos) {
+    const auto src_block_index = block_index_pair.first;
+    const auto dst_block_index = block_index_pair.second;
+    LLM_CHK_BOOL_RET_STATUS(src_block_index < src_cache_entry.num_blocks, ge::LLM_PARAM_INVALID,
+                            "src_block_index:%lu out of range [0, %lu)", src_block_index, src_cache_entry.num_blocks);
+    LLM_CHK_BOOL_RET_STATUS(dst_block_index < dst_cache_entry.num_blocks, ge::LLM_PARAM_INVALID,
+                            "dst_block_index:%lu out of range [0, %lu)", dst_block_index, dst_cache_entry.num_blocks);
+    if (!block_ranges.empty()) {
+      auto &last = block_ranges.back();
+      if ((last.first.first + last.second == src_block_index) && (last.first.second + last.second == dst_block_index)) {
+        ++last.second;
+        continue;
+      }
+    }
+    block_ranges.emplace_back(std::make_pair(src_block_index, dst_block_index), 1U);
+  }
+  copy_plan.kind = ResolveCopyKind(src_cache_entry.placement, dst_cache_entry.placement);
+  copy_plan.items.reserve(per_device_addr_num * block_ranges.size());
   auto begin = device_index * per_device_addr_num;
   for (size_t i = 0U; i < per_device_addr_num; ++i) {
     auto src_addr_base = PtrToPtr<void, uint8_t>(src_cache_entry.cache_addrs[begin + i].get());
     auto dst_addr_base = PtrToPtr<void, uint8_t>(dst_cache_entry.cache_addrs[begin + i].get());
-    for (auto &block_index_pair : copy_cache_param.copy_block_infos) {
-      const auto src_block_index = block_index_pair.first;
-      const auto dst_block_index = block_index_pair.second;
-      LLM_CHK_BOOL_RET_STATUS(src_block_index < src_cache_entry.num_blocks, ge::LLM_PARAM_INVALID,
-                              "src_block_index:%lu out of range [0, %lu)", src_block_index, src_cache_entry.num_blocks);
-      LLM_CHK_BOOL_RET_STATUS(dst_block_index < dst_cache_entry.num_blocks, ge::LLM_PARAM_INVALID,
-                              "dst_block_index:%lu out of range [0, %lu)", dst_block_index, src_cache_entry.num_blocks);
-      auto src_addr = src_addr_base + block_size * src_block_index;
-      auto dst_addr = dst_addr_base + block_size * dst_block_index;
-      LLM_CHK_STATUS_RET(copy_job.AddCopyTask(dst_addr, block_size, src_addr, block_size, copy_kind),
-                         "[Copy][%ld->%ld] invoke aclrtMemcpy failed, index = %zu", src_id, dst_id, i);
+    for (const auto &block_range : block_ranges) {
+      auto src_addr = src_addr_base + block_size * block_range.first.first;
+      auto dst_addr = dst_addr_base + block_size * block_range.first.second;
+      const auto copy_size = block_size * block_range.second;
+      copy_plan.items.emplace_back(CopyItem{dst_addr, copy_size, src_addr, copy_size});
     }
   }
-  LLM_CHK_STATUS_RET(copy_job.GetResult(), "[Copy][%ld->%ld] invoke aclrtSynchronizeStream failed", src_id, dst_id);
-  LLMLOGI("[Copy][%ld->%ld] success, num_tensors = %zu, num_blocks = %zu", src_id, dst_id, per_device_addr_num,
-          copy_cache_param.copy_block_infos.size());
+  return ge::SUCCESS;
+}
+
+ge::Status CacheManager::ExecuteCopyPlans(std::vector<CopyPlan> &copy_plans, size_t device_begin) {
+  LLM_CHK_STATUS_RET(EnsureCopyStreams(device_begin, copy_plans.size()), "Failed to create copy streams");
+  CopyJob copy_job;
+  for (size_t i = 0U; i < copy_plans.size(); ++i) {
+    copy_plans[i].device = copy_devices_[device_begin + i].get();
+    LLM_CHK_STATUS_RET(copy_job.Submit(copy_plans[i]), "Failed to submit copy plan, device_index = %zu",
+                       device_begin + i);
+  }
+  LLM_CHK_STATUS_RET(copy_job.GetResult(), "Failed to wait copy tasks");
   return ge::SUCCESS;
 }
 
@@ -534,35 +689,83 @@ aclrtMemcpyKind CacheManager::ResolveCopyKind(CachePlacement src_placement, Cach
 }
 
 void CacheManager::DestroyCopyStream(size_t device_index) {
-  if (device_index < copy_streams_.size() && (copy_streams_[device_index] != nullptr)) {
-    LLM_CHK_ACL(aclrtDestroyStream(copy_streams_[device_index]));
-    copy_streams_[device_index] = nullptr;
+  std::lock_guard<std::mutex> lk(copy_mu_);
+  DoDestroyCopyStream(device_index);
+}
+
+void CacheManager::DoDestroyCopyStream(size_t device_index) {
+  if ((device_index < copy_devices_.size()) && (copy_devices_[device_index]->stream != nullptr)) {
+    auto &device = *copy_devices_[device_index];
+    hixl::TemporaryRtContext with_context(device.context);
+    LLM_CHK_ACL(aclrtDestroyStream(device.stream));
+    device.stream = nullptr;
+  }
+}
+
+void CacheManager::DestroyCopyDevices() {
+  for (size_t device_index = 0U; device_index < copy_devices_.size(); ++device_index) {
+    DoDestroyCopyStream(device_index);
+    if (copy_devices_[device_index]->own_context) {
+      LLM_CHK_ACL(aclrtDestroyContext(copy_devices_[device_index]->context));
+    }
   }
+  copy_devices_.clear();
 }
 
 void CacheManager::Finalize() {
-  DestroyCopyStream(0U);
+  {
+    std::lock_guard<std::mutex> lk(copy_mu_);
+    DestroyCopyDevices();
+  }
   cache_access_table_updater_.Finalize();
 }
 
-ge::Status CacheManager::EnsureCopyStream(size_t device_index) {
+ge::Status CacheManager::EnsureCopyStreams(size_t device_begin, size_t device_num) {
   std::lock_guard<std::mutex> lk(copy_mu_);
-  if (copy_streams_[device_index] == nullptr) {
-    LLM_CHK_ACL_RET(aclrtCreateStream(&copy_streams_[device_index]));
+  LLM_CHK_BOOL_RET_STATUS(device_begin + device_num <= copy_devices_.size(), ge::LLM_PARAM_INVALID,
+                          "device range [%zu, %zu) out of range, copy device num = %zu", device_begin,
+                          device_begin + device_num, copy_devices_.size());
+  for (size_t device_index = device_begin; device_index < device_begin + device_num; ++device_index) {
+    auto &device = *copy_devices_[device_index];
+    if (device.stream == nullptr) {
+      hixl::TemporaryRtContext with_context(device.context);
+      LLM_CHK_ACL_RET(aclrtCreateStream(&device.stream));
+    }
   }
   return ge::SUCCESS;
 }
 
-ge::Status CacheManager::InitCopyStreams(size_t device_num) {
-  copy_streams_.resize(device_num);
+ge::Status CacheManager::InitCopyStreams(const std::vector<int32_t> &device_ids) {
+  std::lock_guard<std::mutex> lk(copy_mu_);
+  // 重复初始化时先释放上一次的资源
+  DestroyCopyDevices();
+  int32_t current_device_id = -1;
+  LLM_CHK_ACL_RET(aclrtGetDevice(&current_device_id));
+  const std::vector<int32_t> copy_device_ids =
+      device_ids.empty() ? std::vector<int32_t>{current_device_id} : device_ids;
+  for (const auto device_id : copy_device_ids) {
+    auto device = MakeUnique<CopyDevice>();
+    LLM_CHECK_NOTNULL(device);
+    device->device_id = device_id;
+    if (device_id == current_device_id) {
+      device->context = aclrt_context_;
+    } else {
+      // aclrtCreateContext会切换当前线程的context，创建后恢复
+      hixl::TemporaryRtContext with_context(aclrt_context_);
+      LLM_CHK_ACL_RET(aclrtCreateContext(&device->context, device_id));
+      device->own_context = true;
+    }
+    copy_devices_.emplace_back(std::move(device));
+  }
+  LLMLOGI("Init copy devices success, device num:%zu", copy_devices_.size());
   return ge::SUCCESS;
 }
 
-ge::Status CacheManager::Initialize(bool access_remote_cache) {
+ge::Status CacheManager::Initialize(bool access_remote_cache, const std::vector<int32_t> &device_ids) {
   enable_remote_cache_accessible_ = access_remote_cache;
   LLM_CHK_STATUS_RET(cache_access_table_updater_.Initialize(access_remote_cache));
   LLM_CHK_ACL_RET(aclrtGetCurrentContext(&aclrt_context_));
-  copy_streams_.resize(1U);
+  LLM_CHK_STATUS_RET(InitCopyStreams(device_ids), "Failed to init copy devices");
   return ge::SUCCESS;
 }
 
@@ -574,6 +777,9 @@ ge::Status CacheManager::UpdateCacheTable() {
   if (!enable_remote_cache_accessible_) {
     return ge::SUCCESS;
   }
+  // 刷新期间只读索引，不阻塞并发查询；table_mu_保证各次刷新按序写入最新状态
+  std::lock_guard<std::mutex> table_lk(table_mu_);
+  std::shared_lock<std::shared_mutex> lk(mu_);
   hixl::TemporaryRtContext with_context(aclrt_context_);
   LLM_CHK_ACL_RET(cache_access_table_updater_.UpdateTableBuffer(cache_id_to_entry_, cache_key_to_id_));
   return ge::SUCCESS;
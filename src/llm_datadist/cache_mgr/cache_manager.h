@@ -11,9 +11,14 @@
 #ifndef CANN_GRAPH_ENGINE_RUNTIME_LLM_DATADIST_V2_CACHE_MANAGER_H_
 #define CANN_GRAPH_ENGINE_RUNTIME_LLM_DATADIST_V2_CACHE_MANAGER_H_
 
+#include <atomic>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "llm_datadist/llm_error_codes.h"
 #include "acl/acl.h"
 #include "common/common.h"
@@ -22,6 +27,31 @@
 
 namespace llm {
 using DataCacheKey = std::pair<uint64_t, uint64_t>;  // req id/prefix id, model id
+
+struct CopyItem {
+  void *dst;
+  uint64_t dest_max;
+  const void *src;
+  uint64_t count;
+};
+
+// CopyCache在单个device上使用的资源，cache_addrs中第i组tensor对应第i个device
+struct CopyDevice {
+  int32_t device_id = -1;
+  aclrtContext context = nullptr;
+  bool own_context = false;
+  aclrtStream stream = nullptr;  // 在context下创建，绑定到该device
+  // 该device上aclrtMemcpyBatch返回不支持后置为false，之后直接逐个拷贝
+  std::atomic<bool> support_batch_copy{true};
+};
+
+// 单个device上一次CopyCache的scatter/gather列表
+struct CopyPlan {
+  CopyDevice *device = nullptr;
+  aclrtMemcpyKind kind = ACL_MEMCPY_DEVICE_TO_DEVICE;
+  std::vector<CopyItem> items;
+};
+
 class CacheManager {
  public:
   CacheManager() = default;
@@ -48,9 +78,9 @@ class CacheManager {
   ge::Status CopyCacheForBlocks(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
                                 const CopyCacheParam &copy_cache_param, size_t per_device_addr_num,
                                 size_t device_index = 0U);
-  ge::Status Initialize(bool access_remote_cache);
+  // device_ids为cache_addrs中各组tensor所在的device，为空时仅使用当前device
+  ge::Status Initialize(bool access_remote_cache, const std::vector<int32_t> &device_ids = {});
   std::pair<void *, size_t> GetCacheTableBufferAndSize() const;
-  ge::Status InitCopyStreams(size_t device_num);
   void DestroyCopyStream(size_t device_index);
   LlmMemPool *GetNpuMemPool() const;
 
@@ -59,25 +89,41 @@ class CacheManager {
   static CacheEntry CreateCacheEntry(const CacheDesc &cache_desc, std::vector<uintptr_t> &addrs, int64_t tensor_size);
   static void NoDelete(void *) {}
   void AddCacheIndices(CacheEntry &cache_entry, int64_t cache_id, const std::vector<CacheKey> &cache_keys);
-  void RemoveCacheIndices(int64_t cache_id);
+  void RemoveCacheIndices(const CacheEntry &cache_entry, int64_t cache_id);
+  static void RemoveKeyRef(CacheEntry &cache_entry, const DataCacheKey &data_cache_key, bool is_prefix);
   void RemoveBatchIndex(CacheEntry &cache_entry, int64_t cache_id, uint64_t batch_id);
   ge::Status CheckCacheKeys(const CacheDesc &cache_desc, const std::vector<CacheKey> &cache_keys) const;
   static DataCacheKey CreateDataCacheKey(const CacheKey &cache_key, bool &is_prefix);
   static ge::Status CheckCopyParams(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
                                     const CopyCacheParam &copy_cache_param, uint64_t &copy_size);
   static aclrtMemcpyKind ResolveCopyKind(CachePlacement src_placement, CachePlacement dst_placement);
-  ge::Status EnsureCopyStream(size_t device_index);
+  static ge::Status BuildContinuousCopyPlan(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
+                                            const CopyCacheParam &copy_cache_param, size_t per_device_addr_num,
+                                            size_t device_index, CopyPlan &copy_plan);
+  static ge::Status BuildBlockCopyPlan(const CacheEntry &src_cache_entry, const CacheEntry &dst_cache_entry,
+                                       const CopyCacheParam &copy_cache_param, size_t per_device_addr_num,
+                                       size_t device_index, CopyPlan &copy_plan);
+  // 提交所有device的拷贝计划后统一等待完成，copy_plans[i]对应device_begin + i
+  ge::Status ExecuteCopyPlans(std::vector<CopyPlan> &copy_plans, size_t device_begin);
+  // 当前device复用aclrt_context_，其余device各自创建context
+  ge::Status InitCopyStreams(const std::vector<int32_t> &device_ids);
+  ge::Status EnsureCopyStreams(size_t device_begin, size_t device_num);
+  // 以下两个接口调用方需持有copy_mu_
+  void DoDestroyCopyStream(size_t device_index);
+  void DestroyCopyDevices();
   ge::Status UpdateCacheTable();
 
-  mutable std::mutex mu_;
+  // 查询持读锁，增删持写锁；释放按CacheEntry::key_refs删除索引，写锁内耗时与该cache的key数成正比
+  mutable std::shared_mutex mu_;
   std::mutex copy_mu_;
-  std::map<int64_t, CacheEntry> cache_id_to_entry_;
-  std::map<int64_t, std::unordered_set<uint64_t>> cache_id_to_tensor_indices_;
-  std::map<DataCacheKey, int64_t> cache_key_to_id_;
-  std::map<DataCacheKey, int64_t> prefix_key_to_id_;
-  std::map<std::pair<int64_t, uint32_t>, DataCacheKey> cache_id_and_batch_id_to_cache_key_;
+  std::mutex table_mu_;  // 串行化cache access table刷新，刷新时仅持mu_读锁
+  CacheIdToEntryMap cache_id_to_entry_;
+  std::unordered_map<int64_t, std::unordered_set<uint64_t>> cache_id_to_tensor_indices_;
+  CacheKeyToIdMap cache_key_to_id_;
+  CacheKeyToIdMap prefix_key_to_id_;
+  std::unordered_map<std::pair<int64_t, uint32_t>, DataCacheKey, PairHash> cache_id_and_batch_id_to_cache_key_;
   LlmMemPool *npu_mem_pool_ = nullptr;
-  std::vector<aclrtStream> copy_streams_;
+  std::vector<std::unique_ptr<CopyDevice>> copy_devices_;  // Initialize后数量不变，stream按需创建，受copy_mu_保护
   LlmMemPool *host_mem_pool_ = nullptr;
   CacheAccessTableUpdater cache_access_table_updater_;
   bool enable_remote_cache_accessible_ = false;
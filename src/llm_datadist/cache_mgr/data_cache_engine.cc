@@ -9,7 +9,9 @@
  */
 
 #include "data_cache_engine.h"
+#include <algorithm>
 #include <limits>
+#include <map>
 #include <set>
 #include "llm_datadist/llm_error_codes.h"
 #include "comm_statistic_manager.h"
@@ -150,8 +152,14 @@ ge::Status DataCacheEngine::PullCache(int64_t cache_id, const CacheKey &cache_ke
   hixl::TemporaryRtContext with_context(aclrt_context_);
   LLM_CHK_BOOL_RET_STATUS(entity->CheckEntityInfo(), ge::LLM_NOT_YET_LINK,
                           "pull cache must wait until the query_register_mem_status return ok");
+  return PullCacheFromEntity(*entity, cache_id, cache_entry, cache_key, pull_cache_param);
+}
+
+ge::Status DataCacheEngine::PullCacheFromEntity(CommEntity &entity, int64_t cache_id, const CacheEntry &cache_entry,
+                                                const CacheKey &cache_key,
+                                                const PullCacheParam &pull_cache_param) const {
   if (access_remote_cache_) {
-    DataTransferClient client(*entity, nullptr);
+    DataTransferClient client(entity, nullptr);
     LLM_CHK_STATUS_RET(client.PullCacheByGet(cache_entry, cache_key, pull_cache_param, sync_cache_timeout_));
     LLMLOGI(
         "[PullCache] success, cache_id = %ld, num_tensors = %zu, stride = %lu, "
@@ -161,23 +169,118 @@ ge::Status DataCacheEngine::PullCache(int64_t cache_id, const CacheKey &cache_ke
     return ge::SUCCESS;
   }
   LLM_DISMISSABLE_GUARD(abort_stream, [this]() -> void { LLM_CHK_ACL(aclrtStreamAbort(req_stream_)); });
-  entity->ClearResponseFlags();
-  if (cache_entry.placement == CachePlacement::HOST) {
+  entity.ClearResponseFlags();
+  // 已注册为可远端访问的host缓存与device缓存一样由远端直接写入，无需经device中转buffer
+  if ((cache_entry.placement == CachePlacement::HOST) && (!cache_entry.remote_accessible)) {
     LLM_CHK_BOOL_RET_STATUS(npu_pool_memory_ != nullptr, ge::LLM_PARAM_INVALID, "Device memory pool is not enabled.");
-    D2HDataTransferClient client(*entity, req_stream_);
+    D2HDataTransferClient client(entity, req_stream_);
     LLM_CHK_STATUS_RET(client.PullCache(cache_entry, cache_key, pull_cache_param, sync_cache_timeout_),
                        "Failed to pull kv from remote cluster:%lu", cache_key.prompt_cluster_id);
     LLM_DISMISS_GUARD(abort_stream);
     return ge::SUCCESS;
   }
 
-  DataTransferClient client(*entity, req_stream_);
+  DataTransferClient client(entity, req_stream_);
   LLM_CHK_STATUS_RET(client.PullCache(cache_entry, cache_key, pull_cache_param, sync_cache_timeout_),
                      "Failed to pull kv from remote cluster:%lu", cache_key.prompt_cluster_id);
   LLM_DISMISS_GUARD(abort_stream);
   return ge::SUCCESS;
 }
 
+ge::Status DataCacheEngine::PullCaches(const std::vector<PullCacheTask> &tasks, std::vector<ge::Status> &rets) const {
+  const auto start = std::chrono::steady_clock::now();
+  rets.assign(tasks.size(), ge::SUCCESS);
+  // 按远端集群分组，各组独立拉取，某一集群未建链只影响该组的key
+  std::map<uint64_t, std::vector<size_t>> cluster_to_indices;
+  for (size_t i = 0U; i < tasks.size(); ++i) {
+    cluster_to_indices[tasks[i].cache_key.prompt_cluster_id].emplace_back(i);
+  }
+  for (const auto &cluster_and_indices : cluster_to_indices) {
+    PullCachesFromCluster(cluster_and_indices.first, tasks, cluster_and_indices.second, rets);
+  }
+  const auto failed_num = static_cast<size_t>(
+      std::count_if(rets.cbegin(), rets.cend(), [](ge::Status ret) { return ret != ge::SUCCESS; }));
+  LLMLOGI("[PullCaches] finished, cluster_num = %zu, task_num = %zu, failed_num = %zu, cost = %ld us",
+          cluster_to_indices.size(), tasks.size(), failed_num,
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+  const auto failed_it = std::find_if(rets.cbegin(), rets.cend(), [](ge::Status ret) { return ret != ge::SUCCESS; });
+  return (failed_it == rets.cend()) ? ge::SUCCESS : *failed_it;
+}
+
+void DataCacheEngine::PullCachesFromCluster(uint64_t remote_cluster_id, const std::vector<PullCacheTask> &tasks,
+                                            const std::vector<size_t> &indices, std::vector<ge::Status> &rets) const {
+  const auto fail_all = [&indices, &rets](ge::Status ret) -> void {
+    for (const auto index : indices) {
+      rets[index] = ret;
+    }
+  };
+  const auto entity = comm_entity_manager_->GetEntityByRemoteClusterId(remote_cluster_id);
+  if (entity == nullptr) {
+    LLMLOGE(ge::LLM_NOT_YET_LINK, "current cluster is not linked with remote cluster:%lu", remote_cluster_id);
+    fail_all(ge::LLM_NOT_YET_LINK);
+    return;
+  }
+  // 同一集群的批次只获取一次拉取锁，批次内各项不会被其他拉取穿插
+  std::lock_guard<std::mutex> pull_lock(entity->GetPullMutex());
+  if ((entity->GetCurState() == FsmState::FSM_DESTROYED_STATE) || (!entity->CheckEntityInfo())) {
+    LLMLOGE(ge::LLM_NOT_YET_LINK, "current cluster is not linked with remote cluster:%lu", remote_cluster_id);
+    fail_all(ge::LLM_NOT_YET_LINK);
+    return;
+  }
+  hixl::TemporaryRtContext with_context(aclrt_context_);
+  std::vector<PullCacheTask> group_tasks;
+  std::vector<CacheEntry> group_entries;
+  std::vector<ge::Status> group_rets;
+  std::vector<size_t> group_indices;
+  for (const auto index : indices) {
+    CacheEntry cache_entry;
+    if (!cache_manager_->GetCacheEntry(tasks[index].cache_id, cache_entry)) {
+      LLMLOGE(ge::LLM_KV_CACHE_NOT_EXIST, "cache id:%ld not found", tasks[index].cache_id);
+      rets[index] = ge::LLM_KV_CACHE_NOT_EXIST;
+      continue;
+    }
+    rets[index] = CheckParam(cache_entry, tasks[index].pull_cache_param);
+    if (rets[index] != ge::SUCCESS) {
+      continue;
+    }
+    // 未注册为可远端访问的host缓存需经device中转buffer，只能逐项拉取
+    const bool need_staging =
+        (!access_remote_cache_) && (cache_entry.placement == CachePlacement::HOST) && (!cache_entry.remote_accessible);
+    if (need_staging || ((!access_remote_cache_) && (!entity->IsRemoteBatchPullSupported()))) {
+      rets[index] = PullCacheFromEntity(*entity, tasks[index].cache_id, cache_entry, tasks[index].cache_key,
+                                        tasks[index].pull_cache_param);
+      continue;
+    }
+    group_tasks.emplace_back(tasks[index]);
+    group_entries.emplace_back(std::move(cache_entry));
+    group_rets.emplace_back(ge::SUCCESS);
+    group_indices.emplace_back(index);
+  }
+  if (group_tasks.empty()) {
+    return;
+  }
+  if (access_remote_cache_) {
+    DataTransferClient client(*entity, nullptr);
+    (void)client.PullCachesByGet(group_entries, group_tasks, sync_cache_timeout_, group_rets);
+  } else {
+    LLM_DISMISSABLE_GUARD(abort_stream, [this]() -> void { LLM_CHK_ACL(aclrtStreamAbort(req_stream_)); });
+    entity->ClearResponseFlags();
+    DataTransferClient client(*entity, req_stream_);
+    if (client.PullCaches(group_entries, group_tasks, sync_cache_timeout_, group_rets) == ge::SUCCESS) {
+      LLM_DISMISS_GUARD(abort_stream);
+    }
+  }
+  for (size_t i = 0U; i < group_indices.size(); ++i) {
+    const auto index = group_indices[i];
+    rets[index] = group_rets[i];
+    // 对端或请求缓冲不支持合并的项按单个请求重试
+    if (rets[index] == ge::LLM_FEATURE_NOT_ENABLED) {
+      rets[index] = PullCacheFromEntity(*entity, tasks[index].cache_id, group_entries[i], tasks[index].cache_key,
+                                        tasks[index].pull_cache_param);
+    }
+  }
+}
+
 ge::Status DataCacheEngine::SwapBlocks(const Cache &src, const Cache &dst, const uint64_t block_size,
                                        const uint32_t type,
                                        const std::vector<std::pair<int64_t, int64_t>> &block_mapping) const {
@@ -207,7 +310,7 @@ ge::Status DataCacheEngine::Initialize(const std::map<ge::AscendString, ge::Asce
   LLM_ASSERT_RT_OK(aclrtGetCurrentContext(&aclrt_context_));
   LLM_CHK_STATUS_RET(LLMUtils::ParseFlag(kLlmOptionEnableRemoteCacheAccessible, options, access_remote_cache_),
                      "Failed to parse option %s", kLlmOptionEnableRemoteCacheAccessible);
-  LLM_CHK_STATUS_RET(cache_manager_->Initialize(access_remote_cache_));
+  LLM_CHK_STATUS_RET(cache_manager_->Initialize(access_remote_cache_, {device_id_}));
   const auto &buffer_and_size = cache_manager_->GetCacheTableBufferAndSize();
   LLM_CHK_STATUS_RET(
       GlobalMemManager::GetInstance().RegisterMem(buffer_and_size.first, buffer_and_size.second,
@@ -253,6 +356,7 @@ void DataCacheEngine::Finalize() {
       LLM_CHK_ACL(aclrtDestroyStream(req_stream_));
       req_stream_ = nullptr;
     }
+    transfer_event_pool_.Finalize();
     if (transfer_stream_ != nullptr) {
       LLM_CHK_ACL(aclrtDestroyStream(transfer_stream_));
       transfer_stream_ = nullptr;
@@ -451,6 +555,24 @@ ge::Status DataCacheEngine::CheckTensorIndices(const CacheEntry &cache_entry, co
 
 ge::Status DataCacheEngine::TransferCache(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
                                           const TransferBlockConfig &transfer_block_config) {
+  return DoTransferCache(task_id, transfer_cache_config, {}, transfer_block_config);
+}
+
+ge::Status DataCacheEngine::TransferCacheLayers(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
+                                                const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                                const TransferBlockConfig &transfer_block_config,
+                                                const LayerReadyCallback &ready_callback,
+                                                const LayerDoneCallback &done_callback) {
+  LLM_CHK_BOOL_RET_STATUS(!layer_indices.empty(), ge::LLM_PARAM_INVALID, "layer_indices is empty");
+  return DoTransferCache(task_id, transfer_cache_config, layer_indices, transfer_block_config, ready_callback,
+                         done_callback);
+}
+
+ge::Status DataCacheEngine::DoTransferCache(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
+                                            const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                            const TransferBlockConfig &transfer_block_config,
+                                            const LayerReadyCallback &ready_callback,
+                                            const LayerDoneCallback &done_callback) {
   // cache_id is local, find local addr by cache_id
   CacheEntry cache_entry;
   LLM_CHK_BOOL_RET_STATUS(cache_manager_->GetCacheEntry(transfer_cache_config.src_cache_id, cache_entry),
@@ -476,11 +598,19 @@ ge::Status DataCacheEngine::TransferCache(const uint64_t task_id, const Transfer
   LLM_ASSERT_RT_OK(ret, "create transfer stream failed");
   LLM_ASSERT_NOTNULL(transfer_stream_, "transfer stream is nullptr");
   LLM_DISMISSABLE_GUARD(abort_stream, [this]() -> void { LLM_CHK_ACL(aclrtStreamAbort(transfer_stream_)); });
-  LayerWiseTransferJob layer_wise_transfer_job(*entity, transfer_stream_);
-  LLM_CHK_STATUS_RET(layer_wise_transfer_job.TransferCache(cache_entry, transfer_cache_config, transfer_block_config,
-                                                           sync_cache_timeout_, access_remote_cache_),
-                     "task:%lu of cluster:%lu transfer cache of layer[%lu] failed", task_id,
-                     transfer_cache_config.cluster_id, transfer_cache_config.layer_index);
+  LayerWiseTransferJob layer_wise_transfer_job(*entity, transfer_stream_, &transfer_event_pool_);
+  if (layer_indices.empty()) {
+    LLM_CHK_STATUS_RET(layer_wise_transfer_job.TransferCache(cache_entry, transfer_cache_config, transfer_block_config,
+                                                             sync_cache_timeout_, access_remote_cache_),
+                       "task:%lu of cluster:%lu transfer cache of layer[%lu] failed", task_id,
+                       transfer_cache_config.cluster_id, transfer_cache_config.layer_index);
+  } else {
+    LLM_CHK_STATUS_RET(layer_wise_transfer_job.TransferCacheLayers(cache_entry, transfer_cache_config, layer_indices,
+                                                                   transfer_block_config, sync_cache_timeout_,
+                                                                   access_remote_cache_, ready_callback, done_callback),
+                       "task:%lu of cluster:%lu transfer cache of %zu layers failed", task_id,
+                       transfer_cache_config.cluster_id, layer_indices.size());
+  }
   LLM_DISMISS_GUARD(abort_stream);
   return ge::SUCCESS;
 }
@@ -20,6 +20,8 @@
 #include "cache_mgr/comm_mem_manager.h"
 #include "cache_manager.h"
 #include "common/llm_mem_pool.h"
+#include "data_transfer/transfer_event_pool.h"
+#include "data_transfer/layer_wise_transfer_job.h"
 
 namespace llm {
 using TimePoint = std::chrono::time_point<std::chrono::steady_clock>;
@@ -34,12 +36,20 @@ class DataCacheEngine {
   ge::Status Deallocate(int64_t cache_id) const;
   ge::Status RemoveCacheKey(const CacheKey &cache_key) const;
   ge::Status PullCache(int64_t cache_id, const CacheKey &cache_key, const PullCacheParam &pull_cache_param) const;
+  // 批量拉取多个cache，可来自不同远端集群，rets按tasks顺序返回各项结果，返回值为首个失败项的错误码
+  ge::Status PullCaches(const std::vector<PullCacheTask> &tasks, std::vector<ge::Status> &rets) const;
   ge::Status CopyCache(const CopyCacheParam &copy_cache_param) const;
   ge::Status SwapBlocks(const Cache &src, const Cache &dst, const uint64_t block_size, const uint32_t type,
                         const std::vector<std::pair<int64_t, int64_t>> &block_mapping) const;
   ge::Status CheckCapacity(size_t size) const;
   ge::Status TransferCache(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
                            const TransferBlockConfig &transfer_block_config);
+  // 远端cache不可访问时ready_callback/done_callback在逐层下发前后调用，远端cache可访问时不调用
+  ge::Status TransferCacheLayers(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
+                                 const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                 const TransferBlockConfig &transfer_block_config,
+                                 const LayerReadyCallback &ready_callback = nullptr,
+                                 const LayerDoneCallback &done_callback = nullptr);
   void SetCommEntityManager(CommEntityManager *comm_entity_manager);
   void SetCommMemManager(CommMemManager *comm_mem_manager);
   void SetCacheManager(CacheManager *cache_manager);
@@ -48,6 +58,16 @@ class DataCacheEngine {
  private:
   static ge::Status CheckParam(const CacheEntry &cache_entry, const PullCacheParam &pull_cache_param);
   static ge::Status CheckTensorIndices(const CacheEntry &cache_entry, const PullCacheParam &pull_cache_param);
+  ge::Status PullCacheFromEntity(CommEntity &entity, int64_t cache_id, const CacheEntry &cache_entry,
+                                 const CacheKey &cache_key, const PullCacheParam &pull_cache_param) const;
+  void PullCachesFromCluster(uint64_t remote_cluster_id, const std::vector<PullCacheTask> &tasks,
+                             const std::vector<size_t> &indices, std::vector<ge::Status> &rets) const;
+  // layer_indices为空时按transfer_cache_config中的单层传输
+  ge::Status DoTransferCache(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
+                             const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                             const TransferBlockConfig &transfer_block_config,
+                             const LayerReadyCallback &ready_callback = nullptr,
+                             const LayerDoneCallback &done_callback = nullptr);
   ge::Status InitializeMemoryPool(const std::map<ge::AscendString, ge::AscendString> &options);
   ge::Status InitializeDeviceMemoryPool(const std::map<ge::AscendString, ge::AscendString> &options);
   ge::Status InitializeHostMemoryPool(const std::map<ge::AscendString, ge::AscendString> &options);
@@ -67,6 +87,8 @@ class DataCacheEngine {
   std::unique_ptr<LlmMemPool> npu_mem_pool_{};
   aclrtStream transfer_stream_{nullptr};
   std::once_flag create_stream_once_flag_;
+  // transfer_stream_上逐层传输使用的event，跨请求复用
+  TransferEventPool transfer_event_pool_;
   void *host_pool_memory_{nullptr};
   std::unique_ptr<LlmMemPool> host_mem_pool_{};
   void *npu_pool_handle_{nullptr};
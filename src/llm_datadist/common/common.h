@@ -13,6 +13,9 @@
 
 #include <vector>
 #include <map>
+#include <functional>
+#include <unordered_map>
+#include <utility>
 #include "ge_common/api_error_codes.h"
 #include "common/llm_inner_types.h"
 namespace llm {
@@ -39,6 +42,9 @@ union TransferInfo {
   void *dst_addr;
 };
 
+// is_pull_block取此值时为批量拉取请求：buffer_info_count为子请求个数，其后依次存放完整的子请求，各自占用req_size字节
+constexpr uint32_t kBatchPullFlag = 2U;
+
 struct TransferCacheReq {
   uint32_t is_pull_block = 0U;
   uint32_t num_tensors = 0U;
@@ -70,6 +76,23 @@ struct ResponseInfo {
   uint64_t sync_flag_addresses[];
 };
 
+struct PairHash {
+  template <typename T1, typename T2>
+  size_t operator()(const std::pair<T1, T2> &p) const noexcept {
+    const size_t h1 = std::hash<T1>{}(p.first);
+    const size_t h2 = std::hash<T2>{}(p.second);
+    return h1 ^ (h2 + 0x9e3779b97f4a7c15ULL + (h1 << 6U) + (h1 >> 2U));
+  }
+};
+
+// An index key bound to a cache, kept by the entry so that releasing it does not scan the index maps
+struct CacheKeyRef {
+  std::pair<uint64_t, uint64_t> key;  // req_id/prefix_id, model_id
+  uint32_t batch_index = 0U;
+  bool is_prefix = false;
+  bool has_batch_index = false;  // false for blocks cache, which only binds key to cache_id
+};
+
 struct CacheEntry {
   uint64_t num_blocks = 0U;  // > 0 means is blocks when cache_mem_type is not MIX
   uint32_t batch_size;
@@ -83,7 +106,11 @@ struct CacheEntry {
   bool is_owned = false;
   bool remote_accessible = true;
   CacheMemType cache_mem_type = CacheMemType::CACHE;
+  std::vector<CacheKeyRef> key_refs;
 };
+
+using CacheIdToEntryMap = std::unordered_map<int64_t, CacheEntry>;
+using CacheKeyToIdMap = std::unordered_map<std::pair<uint64_t, uint64_t>, int64_t, PairHash>;
 }  // namespace llm
 
 #endif  // CANN_GRAPH_ENGINE_RUNTIME_LLM_DATADIST_V2_COMMON_H_
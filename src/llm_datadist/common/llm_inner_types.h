@@ -90,6 +90,13 @@ struct PullCacheParam {
   uint64_t tensor_num_per_layer = kDefaultTensorNumPerLayer;
 };
 
+// 批量拉取中的一项，同一批次的cache_key须来自同一个远端集群
+struct PullCacheTask {
+  int64_t cache_id = -1;
+  CacheKey cache_key;
+  PullCacheParam pull_cache_param;
+};
+
 struct TransferCacheConfig {
   int64_t src_cache_id = 0U;
   uint64_t batch_index = 0U;
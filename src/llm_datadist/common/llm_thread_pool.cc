@@ -18,8 +18,8 @@
 #include "llm_thread_pool.h"
 
 namespace llm {
-LLMThreadPool::LLMThreadPool(std::string thread_name_prefix, const uint32_t size)
-    : thread_name_prefix_(std::move(thread_name_prefix)), is_stopped_(false) {
+LLMThreadPool::LLMThreadPool(std::string thread_name_prefix, const uint32_t size, const size_t queue_capacity)
+    : thread_name_prefix_(std::move(thread_name_prefix)), tasks_(queue_capacity), is_stopped_(false) {
   idle_thrd_num_ = size < 1U ? 1U : size;
 
   for (uint32_t i = 0U; i < idle_thrd_num_; ++i) {
@@ -36,10 +36,7 @@ void LLMThreadPool::Destroy() {
     return;
   }
   is_stopped_.store(true);
-  {
-    const std::unique_lock<std::mutex> lock{m_lock_};
-    cond_var_.notify_all();
-  }
+  tasks_.Close();
 
   for (std::thread &thd : pool_) {
     if (thd.joinable()) {
@@ -63,16 +60,9 @@ void LLMThreadPool::ThreadFunc(LLMThreadPool *const thread_pool, uint32_t thread
   }
 
   while (!thread_pool->is_stopped_) {
-    std::function<void()> task;
-    {
-      std::unique_lock<std::mutex> lock{thread_pool->m_lock_};
-      thread_pool->cond_var_.wait(
-          lock, [thread_pool]() -> bool { return thread_pool->is_stopped_.load() || (!thread_pool->tasks_.empty()); });
-      if (thread_pool->is_stopped_ && thread_pool->tasks_.empty()) {
-        return;
-      }
-      task = std::move(thread_pool->tasks_.front());
-      thread_pool->tasks_.pop();
+    ThreadTask task;
+    if (!thread_pool->tasks_.Pop(task)) {
+      return;
     }
     --thread_pool->idle_thrd_num_;
     task();
@@ -19,24 +19,28 @@
 #define CANN_GRAPH_ENGINE_RUNTIME_LLM_DATADIST_V2_LLM_THREAD_POOL_H_
 
 #include <atomic>
-#include <condition_variable>
 #include <functional>
 #include <future>
 #include <memory>
-#include <queue>
 #include <thread>
 #include <vector>
 
 #include "llm_datadist/llm_error_codes.h"
 #include "common/llm_log.h"
+#include "common/inline_task.h"
+#include "common/mpmc_queue.h"
 #include "mem_utils.h"
 
 namespace llm {
-using ThreadTask = std::function<void()>;
+using ThreadTask = hixl::InlineTask;
+
+// 任务环的容量；环满时commit不阻塞，任务转入溢出链表，池内任务提交任务也不会死锁
+constexpr size_t kDefaultTaskQueueCapacity = 4096U;
 
 class LLMThreadPool {
  public:
-  explicit LLMThreadPool(std::string thread_name_prefix, const uint32_t size = 4U);
+  explicit LLMThreadPool(std::string thread_name_prefix, const uint32_t size = 4U,
+                         const size_t queue_capacity = kDefaultTaskQueueCapacity);
   ~LLMThreadPool();
   void Destroy();
 
@@ -50,18 +54,12 @@ class LLMThreadPool {
       return fail_future;
     }
 
-    const auto bindFunc = std::bind(std::forward<Func>(func), std::forward<Args>(args)...);
-    const auto task = MakeShared<std::packaged_task<retType()>>(bindFunc);
-    if (task == nullptr) {
-      LLMLOGE(ge::FAILED, "Make shared failed.");
+    std::packaged_task<retType()> task(std::bind(std::forward<Func>(func), std::forward<Args>(args)...));
+    std::future<retType> future = task.get_future();
+    if (!tasks_.ForceEmplace(std::move(task))) {
+      LLMLOGE(ge::FAILED, "thread pool has been stopped.");
       return fail_future;
     }
-    std::future<retType> future = task->get_future();
-    {
-      const std::lock_guard<std::mutex> lock{m_lock_};
-      tasks_.emplace([task]() { (*task)(); });
-    }
-    cond_var_.notify_one();
     LLMLOGD("commit run task end");
     return future;
   }
@@ -71,9 +69,7 @@ class LLMThreadPool {
  private:
   std::string thread_name_prefix_;
   std::vector<std::thread> pool_;
-  std::queue<ThreadTask> tasks_;
-  std::mutex m_lock_;
-  std::condition_variable cond_var_;
+  hixl::BlockingMpmcQueue<ThreadTask> tasks_;
   std::atomic<bool> is_stopped_;
   std::atomic<uint32_t> idle_thrd_num_;
 };
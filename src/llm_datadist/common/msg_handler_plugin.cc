@@ -10,6 +10,7 @@
 
 #include "msg_handler_plugin.h"
 #include <netinet/tcp.h>
+#include <fcntl.h>
 #include <csignal>
 #include "common/llm_utils.h"
 #include "common/llm_checker.h"
@@ -20,6 +21,13 @@ namespace {
 constexpr int32_t kListenBacklog = 128;
 constexpr int64_t kDefaultSleepTime = 1;
 constexpr uint32_t kMagicNumber = 0xA4B3C2D1;
+constexpr int32_t kIoPollIntervalMs = 100;
+constexpr int32_t kListenPollIntervalMs = 100;
+// 与连接处理时设置的SO_RCVTIMEO一致，超时未发送请求的连接直接关闭
+constexpr std::chrono::seconds kPendingConnTimeout(60);
+// 帧头：magic(4) + length(8) + type(4)
+constexpr size_t kMsgHeaderSize = sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int32_t);
+constexpr int32_t kMsgIovNum = 4;
 }  // namespace
 
 void MsgHandlerPlugin::Initialize() {
@@ -136,7 +144,10 @@ ssize_t MsgHandlerPlugin::Write(int32_t fd, const void *buf, size_t len) {
   size_t nbytes = len;
   while (nbytes > 0U) {
     auto rc = write(fd, pos, nbytes);
-    if (rc < 0 && (errno == EAGAIN || errno == EINTR)) {
+    if (rc < 0 && errno == EINTR) {
+      continue;
+    } else if (rc < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      WaitFdReady(fd, POLLOUT);
       continue;
     } else if (rc < 0) {
       LLMLOGE(ge::FAILED, "Socket write failed, error msg:%s, errno:%d", strerror(errno), errno);
@@ -148,16 +159,63 @@ ssize_t MsgHandlerPlugin::Write(int32_t fd, const void *buf, size_t len) {
     pos += rc;
     nbytes -= rc;
   }
-  LLMLOGI("Socket write completed: %zu bytes", len);
+  LLMLOGD("Socket write completed: %zu bytes", len);
   return static_cast<ssize_t>(len);
 }
 
+ssize_t MsgHandlerPlugin::WriteV(int32_t fd, struct iovec *iov, int32_t iov_cnt) {
+  size_t total = 0U;
+  for (int32_t i = 0; i < iov_cnt; ++i) {
+    total += iov[i].iov_len;
+  }
+  size_t written = 0U;
+  int32_t index = 0;
+  while (index < iov_cnt) {
+    auto rc = writev(fd, &iov[index], iov_cnt - index);
+    if (rc < 0 && errno == EINTR) {
+      continue;
+    } else if (rc < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      WaitFdReady(fd, POLLOUT);
+      continue;
+    } else if (rc < 0) {
+      LLMLOGE(ge::FAILED, "Socket writev failed, error msg:%s, errno:%d", strerror(errno), errno);
+      return rc;
+    } else if ((rc == 0) && (written < total)) {
+      LLMLOGW("Socket writev incompleted: expected %zu bytes, actual %zu bytes", total, written);
+      return static_cast<ssize_t>(written);
+    }
+    written += static_cast<size_t>(rc);
+    // 跳过已写完的段，部分写入的段调整起始位置后继续
+    size_t left = static_cast<size_t>(rc);
+    while ((index < iov_cnt) && (left >= iov[index].iov_len)) {
+      left -= iov[index].iov_len;
+      ++index;
+    }
+    if (index < iov_cnt) {
+      iov[index].iov_base = static_cast<char *>(iov[index].iov_base) + left;
+      iov[index].iov_len -= left;
+    }
+  }
+  LLMLOGD("Socket writev completed: %zu bytes", total);
+  return static_cast<ssize_t>(total);
+}
+
+void MsgHandlerPlugin::WaitFdReady(int32_t fd, int16_t events) {
+  struct pollfd poll_fd{};
+  poll_fd.fd = fd;
+  poll_fd.events = events;
+  (void)poll(&poll_fd, 1U, kIoPollIntervalMs);
+}
+
 ssize_t MsgHandlerPlugin::Read(int32_t fd, void *buf, size_t len) {
   auto pos = static_cast<uint8_t *>(buf);
   size_t nbytes = len;
   while (nbytes > 0U) {
     auto rc = read(fd, pos, nbytes);
-    if (rc < 0 && (errno == EAGAIN || errno == EINTR)) {
+    if (rc < 0 && errno == EINTR) {
+      continue;
+    } else if (rc < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      WaitFdReady(fd, POLLIN);
       continue;
     } else if (rc < 0) {
       LLMLOGE(ge::FAILED, "Socket read failed, error msg:%s, errno:%d", strerror(errno), errno);
@@ -213,29 +271,79 @@ ge::Status MsgHandlerPlugin::DoConnectedProcess(int32_t conn_fd) {
 }
 
 ge::Status MsgHandlerPlugin::DoAccept() {
-  if (!listener_running_ || listen_fd_ < 0) {
-    return ge::SUCCESS;
-  }
-  struct sockaddr_storage addr;
-  socklen_t addr_len = sizeof(addr);
-  auto conn_fd = accept(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &addr_len);
-  if (conn_fd < 0) {
-    if (!listener_running_) {
+  // 监听fd为非阻塞，一次取完backlog中的所有连接
+  while (listener_running_ && listen_fd_ >= 0) {
+    struct sockaddr_storage addr;
+    socklen_t addr_len = sizeof(addr);
+    auto conn_fd = accept(listen_fd_, reinterpret_cast<sockaddr *>(&addr), &addr_len);
+    if (conn_fd < 0) {
+      if (!listener_running_) {
+        return ge::SUCCESS;
+      }
+      LLM_CHK_BOOL_RET_STATUS(errno == EWOULDBLOCK || errno == EAGAIN || errno == EINTR || errno == ECONNABORTED,
+                              ge::FAILED, "Failed to accept, error msg=%s, errno=%d", strerror(errno), errno);
       return ge::SUCCESS;
     }
-    LLM_CHK_BOOL_RET_STATUS(errno == EWOULDBLOCK || errno == EINTR || errno == ECONNABORTED, ge::FAILED,
-                            "Failed to accept, error msg=%s, errno=%d", strerror(errno), errno);
+    LLMLOGI("accept success, fd:%d, addr.sin_family:%d", conn_fd, addr.ss_family);
+    if (addr.ss_family == AF_INET || addr.ss_family == AF_INET6) {
+      pending_conns_.emplace_back(PendingConn{conn_fd, std::chrono::steady_clock::now()});
+    } else {
+      close(conn_fd);
+    }
+  }
+  return ge::SUCCESS;
+}
+
+void MsgHandlerPlugin::DispatchReadyConns(const std::vector<struct pollfd> &poll_fds) {
+  const auto now = std::chrono::steady_clock::now();
+  size_t kept = 0U;
+  // poll_fds[0]为监听fd，poll_fds[i + 1]对应pending_conns_[i]
+  for (size_t i = 0U; i < pending_conns_.size(); ++i) {
+    const auto &conn = pending_conns_[i];
+    if (poll_fds[i + 1U].revents != 0) {
+      // 请求数据已到达(或对端关闭)，此时线程池中的处理不会阻塞在首个读操作上
+      const int32_t conn_fd = conn.fd;
+      (void)thread_pool_->commit([this, conn_fd]() -> void { (void)DoConnectedProcess(conn_fd); });
+    } else if (now - conn.accept_time > kPendingConnTimeout) {
+      LLMLOGW("Connection fd:%d sent no request within %ld s, close it", conn.fd,
+              static_cast<int64_t>(kPendingConnTimeout.count()));
+      close(conn.fd);
+    } else {
+      pending_conns_[kept++] = conn;
+    }
+  }
+  pending_conns_.resize(kept);
+}
+
+ge::Status MsgHandlerPlugin::PollOnce() {
+  std::vector<struct pollfd> poll_fds(pending_conns_.size() + 1U);
+  poll_fds[0].fd = listen_fd_;
+  poll_fds[0].events = POLLIN;
+  for (size_t i = 0U; i < pending_conns_.size(); ++i) {
+    poll_fds[i + 1U].fd = pending_conns_[i].fd;
+    poll_fds[i + 1U].events = POLLIN;
+  }
+  const auto ret = poll(poll_fds.data(), static_cast<nfds_t>(poll_fds.size()), kListenPollIntervalMs);
+  if (ret < 0) {
+    LLM_CHK_BOOL_RET_STATUS(errno == EINTR, ge::FAILED, "Failed to poll, error msg=%s, errno=%d", strerror(errno),
+                            errno);
     return ge::SUCCESS;
   }
-  LLM_DISMISSABLE_GUARD(close_fd, ([conn_fd]() { close(conn_fd); }));
-  LLMLOGI("accept success, fd:%d, addr.sin_family:%d", conn_fd, addr.ss_family);
-  if (addr.ss_family == AF_INET || addr.ss_family == AF_INET6) {
-    (void)thread_pool_->commit([this, conn_fd]() -> void { (void)DoConnectedProcess(conn_fd); });
-    LLM_DISMISS_GUARD(close_fd);
+  // 先处理已有连接再accept，新连接追加在pending_conns_尾部，不影响下标对应关系
+  DispatchReadyConns(poll_fds);
+  if ((poll_fds[0].revents & POLLIN) != 0) {
+    LLM_CHK_STATUS_RET(DoAccept(), "Failed to accept");
   }
   return ge::SUCCESS;
 }
 
+void MsgHandlerPlugin::ClosePendingConns() {
+  for (const auto &conn : pending_conns_) {
+    close(conn.fd);
+  }
+  pending_conns_.clear();
+}
+
 ge::Status MsgHandlerPlugin::SockAddrInit(const std::string &ip, uint32_t listen_port, int32_t ai_family,
                                           struct sockaddr_storage &server_addr, socklen_t &addr_len) const {
   if (ai_family == AF_INET) {
@@ -283,6 +391,9 @@ ge::Status MsgHandlerPlugin::StartDaemon(const std::string &ip, uint32_t listen_
   LLM_CHK_BOOL_RET_STATUS(socket_ret == 0, ge::FAILED,
                           "Failed to set socket opt SO_REUSEADDR, socket_ret:%d, error msg:%s, errno:%d", socket_ret,
                           strerror(errno), errno);
+  const int32_t flags = fcntl(listen_fd_, F_GETFL, 0);
+  LLM_CHK_BOOL_RET_STATUS((flags >= 0) && (fcntl(listen_fd_, F_SETFL, flags | O_NONBLOCK) == 0), ge::FAILED,
+                          "Failed to set listen socket non-blocking, error msg:%s, errno:%d", strerror(errno), errno);
   LLM_CHK_BOOL_RET_STATUS(bind(listen_fd_, reinterpret_cast<sockaddr *>(&server_addr), addr_len) >= 0, ge::FAILED,
                           "Failed to bind port:%u, error msg:%s, errno:%d.", listen_port, strerror(errno), errno);
   socket_ret = listen(listen_fd_, kListenBacklog);
@@ -292,13 +403,15 @@ ge::Status MsgHandlerPlugin::StartDaemon(const std::string &ip, uint32_t listen_
   thread_pool_ = MakeUnique<LLMThreadPool>("ge_llm_mhp", kThreadPoolSize);
   LLM_CHECK_NOTNULL(thread_pool_);
   listener_running_ = true;
+  // 监听线程通过poll统一等待新连接与已accept连接的首个请求，线程池只处理已有数据可读的连接
   listener_ = std::thread([this]() {
     while (listener_running_) {
-      auto ret = DoAccept();
+      auto ret = PollOnce();
       if (ret != ge::SUCCESS && listener_running_) {
         std::this_thread::sleep_for(std::chrono::seconds(kDefaultSleepTime));
       }
     }
+    ClosePendingConns();
     return;
   });
 
@@ -307,44 +420,42 @@ ge::Status MsgHandlerPlugin::StartDaemon(const std::string &ip, uint32_t listen_
 }
 
 ge::Status MsgHandlerPlugin::SendMsg(int32_t fd, int32_t msg_type, const std::string &msg_str) {
-  auto len = Write(fd, &kMagicNumber, sizeof(kMagicNumber));
-  LLM_CHK_BOOL_RET_STATUS(len == static_cast<ssize_t>(sizeof(kMagicNumber)), ge::FAILED,
-                          "Failed to send magic number, expect write len:%zu, actually write len:%zd",
-                          sizeof(kMagicNumber), len);
+  uint32_t magic_number = kMagicNumber;
   uint64_t length = msg_str.size() + sizeof(msg_type);
-  len = Write(fd, &length, sizeof(length));
-  LLM_CHK_BOOL_RET_STATUS(len == static_cast<ssize_t>(sizeof(length)), ge::FAILED,
-                          "Failed to send msg len:%zu, expect write len:%zu, actually write len:%zd", length,
-                          sizeof(length), len);
-  len = Write(fd, &msg_type, sizeof(msg_type));
-  LLM_CHK_BOOL_RET_STATUS(len == static_cast<ssize_t>(sizeof(msg_type)), ge::FAILED,
+  int32_t type = msg_type;
+  // 帧头与消息体合并为一次writev，避免小包分多次发送
+  struct iovec iov[kMsgIovNum] = {{&magic_number, sizeof(magic_number)},
+                                  {&length, sizeof(length)},
+                                  {&type, sizeof(type)},
+                                  {const_cast<char *>(msg_str.data()), msg_str.size()}};
+  const size_t expect_len = kMsgHeaderSize + msg_str.size();
+  const auto len = WriteV(fd, iov, kMsgIovNum);
+  LLM_CHK_BOOL_RET_STATUS(len == static_cast<ssize_t>(expect_len), ge::FAILED,
                           "Failed to send msg type:%d, expect write len:%zu, actually write len:%zd", msg_type,
-                          sizeof(msg_type), len);
-  len = Write(fd, msg_str.c_str(), msg_str.size());
-  LLM_CHK_BOOL_RET_STATUS(len == static_cast<ssize_t>(msg_str.size()), ge::FAILED,
-                          "Failed to send msg:%s, expect write len:%zu, actually write len:%zd", msg_str.c_str(),
-                          msg_str.size(), len);
+                          expect_len, len);
   return ge::SUCCESS;
 }
 
 ge::Status MsgHandlerPlugin::RecvMsg(int32_t fd, int32_t &msg_type, std::vector<char> &msg) {
+  // 帧头一次读取，消息体一次读取
+  uint8_t header[kMsgHeaderSize];
+  auto n = Read(fd, header, sizeof(header));
+  LLM_CHK_BOOL_RET_STATUS(n == static_cast<ssize_t>(sizeof(header)), ge::FAILED,
+                          "Failed to recv msg header len:%zd, expect len:%zu", n, sizeof(header));
   uint32_t magic_number = 0U;
-  auto n = Read(fd, &magic_number, sizeof(magic_number));
-  LLM_CHK_BOOL_RET_STATUS(n == static_cast<ssize_t>(sizeof(magic_number)), ge::FAILED,
-                          "Failed to recv magic num len:%zd, expect len:%zu", n, sizeof(magic_number));
+  uint64_t length = 0U;
+  int32_t type = 0;
+  size_t offset = 0U;
+  (void)memcpy_s(&magic_number, sizeof(magic_number), &header[offset], sizeof(magic_number));
+  offset += sizeof(magic_number);
+  (void)memcpy_s(&length, sizeof(length), &header[offset], sizeof(length));
+  offset += sizeof(length);
+  (void)memcpy_s(&type, sizeof(type), &header[offset], sizeof(type));
   LLM_CHK_BOOL_RET_STATUS(magic_number == kMagicNumber, ge::FAILED, "Failed to check recv magic num:%u", magic_number);
   const static size_t kMaxLength = 1ULL << 20;
-  uint64_t length = 0;
-  n = Read(fd, &length, sizeof(length));
-  LLM_CHK_BOOL_RET_STATUS(n == static_cast<ssize_t>(sizeof(length)), ge::FAILED,
-                          "Failed to recv msg len:%zd, expect len:%zu", n, sizeof(length));
   LLM_CHK_BOOL_RET_STATUS(length <= kMaxLength && length >= sizeof(int32_t), ge::FAILED,
                           "Failed to check msg len:%lu, must in range: [%zu, %zu]", length, sizeof(int32_t),
                           kMaxLength);
-  int32_t type = 0;
-  n = Read(fd, &type, sizeof(type));
-  LLM_CHK_BOOL_RET_STATUS(n == static_cast<ssize_t>(sizeof(type)), ge::FAILED,
-                          "Failed to recv msg type len:%zd, expect len:%zu", n, sizeof(type));
   msg_type = type;
   size_t msg_len = static_cast<size_t>(length) - sizeof(int32_t);
   msg.resize(msg_len + 1U);
@@ -365,9 +476,10 @@ void MsgHandlerPlugin::Finalize() {
   if (listener_running_) {
     listener_running_ = false;
   }
-  ListenClose();
+  // poll带超时，监听线程可自行退出，退出后再关闭监听fd
   if (listener_.joinable()) {
     listener_.join();
   }
+  ListenClose();
 }
 }  // namespace llm
@@ -15,6 +15,8 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <netdb.h>
+#include <poll.h>
+#include <sys/uio.h>
 #include "acl/acl.h"
 #include "llm_datadist/llm_error_codes.h"
 #include "common/llm_thread_pool.h"
@@ -36,11 +38,23 @@ class MsgHandlerPlugin {
   static void Disconnect(int32_t conn_fd);
   static ge::Status SendMsg(int32_t fd, int32_t msg_type, const std::string &msg_str);
   static ge::Status RecvMsg(int32_t fd, int32_t &msg_type, std::vector<char> &msg);
+  // 聚合写多段数据，单次writev完成时仅一次系统调用
+  static ssize_t WriteV(int32_t fd, struct iovec *iov, int32_t iov_cnt);
 
  private:
+  // 已accept但尚未收到请求数据的连接，由监听线程统一等待可读后再交给线程池处理
+  struct PendingConn {
+    int32_t fd;
+    std::chrono::steady_clock::time_point accept_time;
+  };
+
   void ListenClose();
+  void ClosePendingConns();
   ge::Status DoConnectedProcess(int32_t conn_fd);
   ge::Status DoAccept();
+  ge::Status PollOnce();
+  void DispatchReadyConns(const std::vector<struct pollfd> &poll_fds);
+  static void WaitFdReady(int32_t fd, int16_t events);
   static ge::Status DoConnect(struct ::addrinfo *addr, int32_t &conn_fd, int32_t &err_no, int32_t timeout,
                               ge::Status default_err);
   static ge::Status GetAiFamily(const std::string &ip, int32_t &ai_family);
@@ -50,6 +64,7 @@ class MsgHandlerPlugin {
   int32_t listen_fd_ = -1;
   std::atomic<bool> listener_running_{false};
   std::thread listener_;
+  std::vector<PendingConn> pending_conns_;  // 仅监听线程访问
   std::unique_ptr<LLMThreadPool> thread_pool_ = nullptr;
   ConnectedProcess connected_process_;
   aclrtContext aclrt_context_ = nullptr;
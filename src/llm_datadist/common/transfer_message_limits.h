@@ -37,6 +37,10 @@ constexpr uint64_t kMaxTransferInfoCount =
          ? (kMaxRequestPayloadSize - sizeof(TransferCacheReq)) / sizeof(TransferInfo)
          : 0U);
 
+// 批量拉取请求的子请求个数上限，响应中每个子请求占用一个uint64_t返回码
+constexpr uint32_t kMaxBatchPullItemNum = 256U;
+static_assert(kMaxBatchPullItemNum <= kMaxDstAddrCount, "batch pull response must fit in the response buffer");
+
 constexpr uint32_t kBufferInfoMultiplierD2h = 1U;
 constexpr uint32_t kBufferInfoMultiplierD2dH2d = 2U;
 
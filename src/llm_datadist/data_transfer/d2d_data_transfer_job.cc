@@ -16,6 +16,7 @@
 #include "cache_mgr/cache_manager.h"
 #include "comm_statistic_manager.h"
 #include "data_transfer/data_transfer_utils.h"
+#include "common/transfer_message_limits.h"
 #include "acl/acl.h"
 
 namespace llm {
@@ -98,7 +99,7 @@ ge::Status D2DDataTransferJob::Process(bool &is_done) {
     event_ = nullptr;
   }
   if (send_tasks_.empty()) {
-    LLM_CHK_STATUS_RET(comm_entity_->SendResponse(ge::SUCCESS));
+    LLM_CHK_STATUS_RET(SendFinishedResponse());
     is_done = true;
     const auto finished_time_point = std::chrono::steady_clock::now();
     const auto cost = static_cast<uint64_t>(
@@ -115,15 +116,20 @@ ge::Status D2DDataTransferJob::Process(bool &is_done) {
   return ge::SUCCESS;
 }
 
+ge::Status D2DDataTransferJob::SendFinishedResponse() {
+  return comm_entity_->SendResponse(ge::SUCCESS);
+}
+
 ge::Status D2DDataTransferJob::GenerateCacheTask(const CacheEntry &cache_entry, const TransferCacheReq &request,
-                                                 const uint64_t offset) {
+                                                 const uint64_t offset,
+                                                 std::list<HcclOneSideOpDesc> &send_tasks) const {
   if (request.is_pull_block == 1U) {
     LLM_CHK_BOOL_RET_STATUS(request.block_size != 0U, ge::LLM_PARAM_INVALID,
                             "req:%lu, model_id:%lu, block size(%lu) is invalid", request.req_id, request.model_id,
                             request.block_size);
   }
   uint64_t stride_or_block_size = (request.block_size != 0U) ? request.block_size : cache_entry.stride;
-  const auto ret = GetSendTask(cache_entry, request, stride_or_block_size, offset, send_tasks_);
+  const auto ret = GetSendTask(cache_entry, request, stride_or_block_size, offset, send_tasks);
   LLM_CHK_STATUS_RET(ret, "comm_entity:%s get send task failed", comm_entity_->GetDesc().c_str());
   return ge::SUCCESS;
 }
@@ -131,7 +137,7 @@ ge::Status D2DDataTransferJob::GenerateCacheTask(const CacheEntry &cache_entry,
 ge::Status D2DDataTransferJob::GenerateSendTask(const CacheEntry &cache_entry, const uint64_t offset) {
   // 解析本地地址上发送过来的cache info
   const TransferCacheReq &request = comm_entity_->GetRequest();
-  return GenerateCacheTask(cache_entry, request, offset);
+  return GenerateCacheTask(cache_entry, request, offset, send_tasks_);
 }
 
 ge::Status D2DDataTransferJob::PullCache() {
@@ -139,4 +145,54 @@ ge::Status D2DDataTransferJob::PullCache() {
                      "Failed to batch get, task size:%zu.", send_tasks_.size());
   return ge::SUCCESS;
 }
+
+void D2DDataTransferJob::TakeSendTasks(std::list<HcclOneSideOpDesc> &send_tasks) {
+  send_tasks.splice(send_tasks.end(), send_tasks_);
+}
+
+ge::Status D2DBatchDataTransferJob::Initialize(const CacheEntry &cache_entry, CommEntity &comm_entity,
+                                               uint64_t offset) {
+  (void)cache_entry;
+  (void)offset;
+  comm_entity_ = &comm_entity;
+  timeout_point_ = std::chrono::steady_clock::now();
+  return ge::SUCCESS;
+}
+
+ge::Status D2DBatchDataTransferJob::AddItem(const CacheEntry &cache_entry, const TransferCacheReq &request,
+                                            uint64_t offset, const std::pair<uint64_t, uint64_t> &cache_key_to_remove,
+                                            std::unordered_set<uint64_t> tensor_indices) {
+  // 先生成到临时列表，失败的子请求不会留下部分任务
+  std::list<HcclOneSideOpDesc> item_tasks;
+  LLM_CHK_STATUS_RET(GenerateCacheTask(cache_entry, request, offset, item_tasks),
+                     "batch item[%zu] generate send task failed", items_.size());
+  send_tasks_.splice(send_tasks_.end(), item_tasks);
+  items_.emplace_back(BatchItem{ge::SUCCESS, cache_key_to_remove, std::move(tensor_indices)});
+  return ge::SUCCESS;
+}
+
+void D2DBatchDataTransferJob::AddFailedItem(ge::Status ret) {
+  items_.emplace_back(BatchItem{ret, {UINT64_MAX, UINT64_MAX}, {}});
+}
+
+ge::Status D2DBatchDataTransferJob::SendFinishedResponse() {
+  const auto item_num = static_cast<uint32_t>(items_.size());
+  LLM_CHK_STATUS_RET(comm_entity_->SendResponse([this, item_num](ResponseInfo &response_info, uint64_t &size) -> void {
+    response_info.ret_code = static_cast<int32_t>(ge::SUCCESS);
+    response_info.transfer_count = item_num;
+    for (uint32_t i = 0U; i < item_num; ++i) {
+      response_info.sync_flag_addresses[i] = static_cast<uint64_t>(items_[i].ret);
+    }
+    size = transfer_message_limits::CalcResponseSize(item_num);
+  }));
+  const auto cache_manager = comm_entity_->GetCacheManager();
+  LLM_CHECK_NOTNULL(cache_manager);
+  for (const auto &item : items_) {
+    if ((item.ret == ge::SUCCESS) && (item.cache_key_to_remove.first != UINT64_MAX)) {
+      LLM_CHK_STATUS(cache_manager->RemoveCacheKey(item.cache_key_to_remove, false, item.tensor_indices));
+    }
+  }
+  LLMLOGI("comm_entity:%s batch pull finished, item num:%u", comm_entity_->GetDesc().c_str(), item_num);
+  return ge::SUCCESS;
+}
 }  // namespace llm
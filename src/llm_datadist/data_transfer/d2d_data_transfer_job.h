@@ -12,6 +12,8 @@
 #define CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_D2D_DATA_TRANSFER_JOB_H_
 
 #include <list>
+#include <unordered_set>
+#include <vector>
 #include "common/common.h"
 #include "comm_adapter/comm_adapter.h"
 #include "link_mgr/comm_entity.h"
@@ -23,14 +25,45 @@ class D2DDataTransferJob : public DataTransferJob {
   ge::Status Initialize(const CacheEntry &cache_entry, CommEntity &comm_entity, uint64_t offset) override;
   ge::Status Process(bool &is_done) override;
   ge::Status PullCache() override;
+  // 取出已生成的传输任务，由调用方与其他请求的任务合并下发
+  void TakeSendTasks(std::list<HcclOneSideOpDesc> &send_tasks);
+
+ protected:
+  // 全部任务发送完成后回复请求方
+  virtual ge::Status SendFinishedResponse();
+  ge::Status GenerateCacheTask(const CacheEntry &cache_entry, const TransferCacheReq &request, const uint64_t offset,
+                               std::list<HcclOneSideOpDesc> &send_tasks) const;
 
- private:
-  ge::Status GenerateCacheTask(const CacheEntry &cache_entry, const TransferCacheReq &request, const uint64_t offset);
-  ge::Status GenerateSendTask(const CacheEntry &cache_entry, const uint64_t offset);
   CommEntity *comm_entity_;
   std::list<HcclOneSideOpDesc> send_tasks_;
-  aclrtEvent event_;
   std::chrono::steady_clock::time_point timeout_point_;
+
+ private:
+  ge::Status GenerateSendTask(const CacheEntry &cache_entry, const uint64_t offset);
+  aclrtEvent event_;
+};
+
+// 批量拉取请求(kBatchPullFlag)的D2D传输，各子请求的任务合并下发，响应中按子请求顺序返回各自的结果
+class D2DBatchDataTransferJob : public D2DDataTransferJob {
+ public:
+  // cache_entry与offset不使用，子请求经AddItem/AddFailedItem逐个登记
+  ge::Status Initialize(const CacheEntry &cache_entry, CommEntity &comm_entity, uint64_t offset) override;
+  // 生成子请求的传输任务，失败时不登记该子请求，由调用方以AddFailedItem记录错误码
+  ge::Status AddItem(const CacheEntry &cache_entry, const TransferCacheReq &request, uint64_t offset,
+                     const std::pair<uint64_t, uint64_t> &cache_key_to_remove,
+                     std::unordered_set<uint64_t> tensor_indices);
+  void AddFailedItem(ge::Status ret);
+
+ protected:
+  ge::Status SendFinishedResponse() override;
+
+ private:
+  struct BatchItem {
+    ge::Status ret;
+    std::pair<uint64_t, uint64_t> cache_key_to_remove;
+    std::unordered_set<uint64_t> tensor_indices;
+  };
+  std::vector<BatchItem> items_;
 };
 }  // namespace llm
 #endif  // CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_D2D_DATA_TRANSFER_JOB_H_
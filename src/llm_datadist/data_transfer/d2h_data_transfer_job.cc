@@ -9,6 +9,7 @@
  */
 
 #include "data_transfer/d2h_data_transfer_job.h"
+#include <algorithm>
 #include <cinttypes>
 #include <numeric>
 #include "common/llm_checker.h"
@@ -26,6 +27,7 @@ constexpr int32_t kTaskTypeTransferBlock = 1;
 constexpr int32_t kTaskTypeEndBlock = 2;
 constexpr int32_t kTimeoutOffset = 500;
 constexpr size_t kCopyThreadNum = 8U;
+constexpr size_t kCopyStreamNum = 4U;
 constexpr size_t kMaxBlockNum = 60 * 1024U;
 
 ge::Status ValidateD2HClientPullLayout(uint32_t dst_addr_count, size_t prompt_block_count, uint64_t &request_size) {
@@ -418,6 +420,15 @@ D2HDataTransferClient::D2HDataTransferClient(CommEntity &comm_entity, aclrtStrea
 }
 
 D2HDataTransferClient::~D2HDataTransferClient() {
+  for (auto copy_event : copy_events_) {
+    LLM_CHK_ACL(aclrtDestroyEvent(copy_event));
+  }
+  for (auto copy_stream : copy_streams_) {
+    if (copy_pending_) {
+      LLM_CHK_ACL(aclrtStreamAbort(copy_stream));
+    }
+    LLM_CHK_ACL(aclrtDestroyStream(copy_stream));
+  }
   for (auto buffer_data : buffers_) {
     comm_entity_->GetCacheManager()->GetNpuMemPool()->Free(buffer_data);
   }
@@ -430,6 +441,9 @@ ge::Status D2HDataTransferClient::PullCache(const CacheEntry &cache_entry, const
                                             const PullCacheParam &pull_cache_param, int32_t timeout_in_ms) {
   timeout_in_ms_ = timeout_in_ms;
   timeout_tp_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_in_ms_ + kTimeoutOffset);
+  // 由llm datadist申请的host缓存来自aclrtMallocHost锁页内存池，可以异步拷贝
+  // 用户注册的host内存可能为可分页内存，仍同步拷贝
+  async_copy_ = cache_entry.is_owned;
   LLM_CHK_STATUS_RET(Prepare(cache_entry, cache_key, pull_cache_param));
   LLM_CHK_STATUS_RET(RunTasks());
   return ge::SUCCESS;
@@ -465,6 +479,9 @@ ge::Status D2HDataTransferClient::Prepare(const CacheEntry &cache_entry, const C
   send_dev_flag_ = PtrToPtr<void, uint8_t>(send_flag);
   auto host_flag = static_cast<uint8_t>(1U);
   LLM_CHK_ACL_RET(aclrtMemcpy(send_dev_flag_, sizeof(uint8_t), &host_flag, sizeof(uint8_t), ACL_MEMCPY_HOST_TO_DEVICE));
+  if (async_copy_) {
+    LLM_CHK_STATUS_RET(CreateCopyStreams(), "Failed to create copy streams");
+  }
 
   LLM_CHK_STATUS_RET(SendRequest(cache_entry, cache_key, pull_cache_param), "Failed to send request");
   // PUT req & flag
@@ -585,8 +602,9 @@ void D2HDataTransferClient::FillRequest(const CacheEntry &cache_entry, const Cac
 }
 
 ge::Status D2HDataTransferClient::RunTasks() {
-  LLMThreadPool thread_pool("ge_llm_copy", kCopyThreadNum);
+  LLMThreadPool thread_pool("ge_llm_copy", async_copy_ ? 0U : kCopyThreadNum);
   std::vector<std::future<ge::Status>> futures;
+  size_t copy_task_num = 0U;
   std::chrono::steady_clock::time_point copy_start;
   for (const auto &task : tasks_) {
     if (task.task_type == kTaskTypeStartBlock) {
@@ -596,17 +614,27 @@ ge::Status D2HDataTransferClient::RunTasks() {
       LLMLOGD("wait flag success");
       copy_start = std::chrono::steady_clock::now();
     } else if (task.task_type == kTaskTypeTransferBlock) {
-      auto fut = thread_pool.commit([this, &task]() -> ge::Status { return CopyAsync(task); });
-      futures.emplace_back(std::move(fut));
+      if (async_copy_) {
+        copy_pending_ = true;
+        LLM_CHK_STATUS_RET(CopyOnStream(task, copy_streams_[copy_task_num % copy_streams_.size()]));
+        ++copy_task_num;
+      } else {
+        auto fut = thread_pool.commit([this, &task]() -> ge::Status { return CopyAsync(task); });
+        futures.emplace_back(std::move(fut));
+      }
     } else if (task.task_type == kTaskTypeEndBlock) {
+      if (async_copy_) {
+        LLM_CHK_STATUS_RET(GateBufferReuse(std::min(copy_task_num, copy_streams_.size())));
+        copy_task_num = 0U;
+      }
       for (auto &fut : futures) {
         LLM_CHK_STATUS_RET(fut.get());
       }
       auto copy_end = std::chrono::steady_clock::now();
       auto cost = std::chrono::duration_cast<std::chrono::microseconds>(copy_end - copy_start).count();
       futures.clear();
-      LLMLOGD("Buffer[%u] copy end, cost = %ld us", task.buffer_index, cost);
-      // D2H flag
+      LLMLOGD("Buffer[%u] copy %s, cost = %ld us", task.buffer_index, async_copy_ ? "launched" : "end", cost);
+      // D2H flag, 异步拷贝时stream_已等待本buffer的拷贝完成，远端收到flag后才会复用该buffer
       LLM_CHK_STATUS_RET(buffered_sender_.Put(send_dev_flag_, remote_receive_flag_addresses_[task.buffer_index],
                                               sizeof(int32_t), true));
       LLMLOGD("Buffer[%u] flag sent", task.buffer_index);
@@ -614,8 +642,54 @@ ge::Status D2HDataTransferClient::RunTasks() {
       // do nothing
     }
   }
+  if (async_copy_) {
+    LLM_CHK_STATUS_RET(WaitCopyDone(), "Failed to wait copy done");
+    copy_pending_ = false;
+  }
   return ge::SUCCESS;
 }
+
+ge::Status D2HDataTransferClient::CreateCopyStreams() {
+  for (size_t i = 0U; i < kCopyStreamNum; ++i) {
+    aclrtStream copy_stream = nullptr;
+    LLM_CHK_ACL_RET(aclrtCreateStreamWithConfig(&copy_stream, 0, ACL_STREAM_FAST_LAUNCH | ACL_STREAM_FAST_SYNC));
+    copy_streams_.emplace_back(copy_stream);
+    aclrtEvent copy_event = nullptr;
+    LLM_CHK_ACL_RET(aclrtCreateEvent(&copy_event));
+    copy_events_.emplace_back(copy_event);
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status D2HDataTransferClient::CopyOnStream(const TransferBlocksTask &task, aclrtStream copy_stream) const {
+  auto src_addr = buffers_[task.buffer_index] + task.block_span.buffer_block_start * block_size_;
+  auto dst_addr = tensor_addresses_[task.block_span.tensor_index] + task.block_span.tensor_offset;
+  const auto size = task.block_span.size;
+  LLMLOGD("Buffer[%u] copy async, tensor_index:%u, src_offset = %lu, dst_offset = %lu, size = %u", task.buffer_index,
+          task.block_span.tensor_index, task.block_span.buffer_block_start * block_size_, task.block_span.tensor_offset,
+          size);
+  LLM_CHK_ACL_RET(aclrtMemcpyAsync(dst_addr, size, src_addr, size, ACL_MEMCPY_DEVICE_TO_HOST, copy_stream));
+  return ge::SUCCESS;
+}
+
+ge::Status D2HDataTransferClient::GateBufferReuse(size_t used_stream_num) const {
+  // 发送buffer释放flag的stream_等待各copy stream上已下发的拷贝，不阻塞host侧继续处理下一个buffer
+  for (size_t i = 0U; i < used_stream_num; ++i) {
+    LLM_CHK_ACL_RET(aclrtRecordEvent(copy_events_[i], copy_streams_[i]));
+    LLM_CHK_ACL_RET(aclrtStreamWaitEvent(stream_, copy_events_[i]));
+    LLM_CHK_ACL_RET(aclrtResetEvent(copy_events_[i], stream_));
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status D2HDataTransferClient::WaitCopyDone() const {
+  const auto left_time =
+      std::chrono::duration_cast<std::chrono::milliseconds>(timeout_tp_ - std::chrono::steady_clock::now()).count();
+  LLM_CHK_BOOL_RET_STATUS(left_time > 0, ge::LLM_TIMEOUT, "Wait copy done timed out, timeout_ms:%ld", timeout_in_ms_);
+  LLM_CHK_ACL_RET(aclrtSynchronizeStreamWithTimeout(stream_, static_cast<int32_t>(left_time)));
+  return ge::SUCCESS;
+}
+
 ge::Status D2HDataTransferClient::CopyAsync(const TransferBlocksTask &task) const {
   LLM_CHK_ACL_RET(aclrtSetCurrentContext(comm_entity_->GetCurrentContext()));
   auto src_addr = buffers_[task.buffer_index] + task.block_span.buffer_block_start * block_size_;
@@ -103,6 +103,10 @@ class D2HDataTransferClient {
   void FillRequest(const CacheEntry &cache_entry, const CacheKey &cache_key, const PullCacheParam &pull_cache_param,
                    TransferCacheReq &request, uint64_t &size) const;
   ge::Status CopyAsync(const TransferBlocksTask &task) const;
+  ge::Status CreateCopyStreams();
+  ge::Status CopyOnStream(const TransferBlocksTask &task, aclrtStream copy_stream) const;
+  ge::Status GateBufferReuse(size_t used_stream_num) const;
+  ge::Status WaitCopyDone() const;
 
   CommEntity *comm_entity_ = nullptr;
   aclrtStream stream_;
@@ -120,6 +124,12 @@ class D2HDataTransferClient {
   std::chrono::steady_clock::time_point timeout_tp_;
   BufferedSender buffered_sender_;
   std::vector<TransferBlocksTask> tasks_;
+  // 目的host内存为锁页内存时，中转buffer的拷贝以异步方式下发到copy_streams_
+  bool async_copy_ = false;
+  std::vector<aclrtStream> copy_streams_;
+  std::vector<aclrtEvent> copy_events_;
+  // 已下发但尚未确认完成的异步拷贝，异常退出时需在销毁stream前abort
+  bool copy_pending_ = false;
 };
 }  // namespace llm
 #endif  // CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_V2_DATA_TRANSFER_D2H_DATA_TRANSFER_JOB_H_
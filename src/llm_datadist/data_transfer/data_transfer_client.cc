@@ -15,6 +15,7 @@
 #include "common/transfer_message_limits.h"
 
 #include <cinttypes>
+#include <new>
 
 namespace llm {
 namespace {
@@ -106,31 +107,31 @@ ge::Status SetBufferInfo(const PullCacheParam &pull_cache_param, const CacheEntr
 
 }  // namespace
 
-ge::Status DataTransferClient::ConstructTransferInfo(const PullCacheParam &pull_cache_param,
-                                                     const CacheEntry &cache_entry, const CacheKey &cache_key,
-                                                     int32_t timeout) const {
-  std::vector<std::vector<std::pair<int64_t, int64_t>>> contiguous_blocks_pair;
-  uint32_t buffer_info_count = 0U;
-  uint32_t is_pull_block = 0U;
-  LLM_CHK_STATUS_RET(SetBufferInfoCount(pull_cache_param, buffer_info_count, is_pull_block, contiguous_blocks_pair),
+ge::Status DataTransferClient::CalcRequestLayout(const PullCacheParam &pull_cache_param, const CacheEntry &cache_entry,
+                                                 RequestLayout &layout) {
+  LLM_CHK_STATUS_RET(SetBufferInfoCount(pull_cache_param, layout.buffer_info_count, layout.is_pull_block,
+                                        layout.contiguous_blocks_pair),
                      "set buffer_info_count failed");
-  const uint32_t dst_addr_count = pull_cache_param.dst_tensor_indices.empty()
-                                      ? static_cast<uint32_t>(cache_entry.cache_addrs.size())
-                                      : static_cast<uint32_t>(pull_cache_param.dst_tensor_indices.size());
-  const uint64_t request_size = transfer_message_limits::CalcMinRequestSize(dst_addr_count, buffer_info_count,
-                                                                            static_cast<uint32_t>(kSrcAndDstNum));
-  TransferCacheReq *request_ptr = nullptr;
-  LLM_CHK_STATUS_RET(comm_entity_->GetTransferCacheReq(request_size, request_ptr), "Failed to get transfer cache req");
-  LLM_ASSERT_NOTNULL(request_ptr);
-  TransferCacheReq &request = *request_ptr;
+  layout.dst_addr_count = pull_cache_param.dst_tensor_indices.empty()
+                              ? static_cast<uint32_t>(cache_entry.cache_addrs.size())
+                              : static_cast<uint32_t>(pull_cache_param.dst_tensor_indices.size());
+  layout.request_size = transfer_message_limits::CalcMinRequestSize(layout.dst_addr_count, layout.buffer_info_count,
+                                                                    static_cast<uint32_t>(kSrcAndDstNum));
+  return ge::SUCCESS;
+}
+
+ge::Status DataTransferClient::FillTransferCacheReq(const PullCacheParam &pull_cache_param,
+                                                    const CacheEntry &cache_entry, const CacheKey &cache_key,
+                                                    int32_t timeout, const RequestLayout &layout,
+                                                    TransferCacheReq &request) {
   request.cache_id = cache_key.prompt_cache_id;
   request.batch_index = cache_key.prompt_batch_index;
   request.req_id = cache_key.req_id;
   request.prefix_id = cache_key.prefix_id;
   request.model_id = cache_key.model_id;
-  request.dst_addr_count = dst_addr_count;
-  request.buffer_info_count = buffer_info_count;
-  request.is_pull_block = is_pull_block;
+  request.dst_addr_count = layout.dst_addr_count;
+  request.buffer_info_count = layout.buffer_info_count;
+  request.is_pull_block = layout.is_pull_block;
   request.dst_placement = 1;
   request.timeout_in_ms = timeout;
   request.num_tensors = request.dst_addr_count;
@@ -145,12 +146,24 @@ ge::Status DataTransferClient::ConstructTransferInfo(const PullCacheParam &pull_
     request.src_tensor_start_index = pull_cache_param.src_tensor_indices.front();
   }
   SetDstAddr(pull_cache_param, cache_entry, request);
-  LLM_CHK_STATUS_RET(SetBufferInfo(pull_cache_param, cache_entry, contiguous_blocks_pair, request),
+  LLM_CHK_STATUS_RET(SetBufferInfo(pull_cache_param, cache_entry, layout.contiguous_blocks_pair, request),
                      "Failed to set buffer info");
-  request.req_size = request_size;
+  request.req_size = layout.request_size;
   return ge::SUCCESS;
 }
 
+ge::Status DataTransferClient::ConstructTransferInfo(const PullCacheParam &pull_cache_param,
+                                                     const CacheEntry &cache_entry, const CacheKey &cache_key,
+                                                     int32_t timeout) const {
+  RequestLayout layout;
+  LLM_CHK_STATUS_RET(CalcRequestLayout(pull_cache_param, cache_entry, layout));
+  TransferCacheReq *request_ptr = nullptr;
+  LLM_CHK_STATUS_RET(comm_entity_->GetTransferCacheReq(layout.request_size, request_ptr),
+                     "Failed to get transfer cache req");
+  LLM_ASSERT_NOTNULL(request_ptr);
+  return FillTransferCacheReq(pull_cache_param, cache_entry, cache_key, timeout, layout, *request_ptr);
+}
+
 ge::Status DataTransferClient::GetResponseInfo() const {
   void *resp_addr = comm_entity_->GetEntityInfo().local_resp_ptr;
   const auto &response_info = PtrToPtr<void, ResponseInfo>(resp_addr);
@@ -223,8 +236,101 @@ ge::Status DataTransferClient::PullCache(const CacheEntry &cache_entry, const Ca
   return ge::SUCCESS;
 }
 
-ge::Status DataTransferClient::PullCacheByGet(const CacheEntry &cache_entry, const CacheKey &cache_key,
-                                              const PullCacheParam &pull_cache_param, int32_t timeout_in_ms) const {
+ge::Status DataTransferClient::PullBatchFromRemote(const std::vector<size_t> &indices, uint64_t request_size,
+                                                   std::vector<ge::Status> &rets) const {
+  const auto start = std::chrono::steady_clock::now();
+  auto *header = new (comm_entity_->GetEntityInfo().send_buffer_req_ptr) TransferCacheReq();
+  header->is_pull_block = kBatchPullFlag;
+  header->buffer_info_count = static_cast<uint32_t>(indices.size());
+  header->timeout_in_ms = timeout_in_ms_;
+  header->req_size = request_size;
+  auto fill_req_func = [request_size](TransferCacheReq &request, uint64_t &size) -> void {
+    // request already filled, just set size
+    (void)request;
+    size = request_size;
+  };
+  LLM_CHK_STATUS_RET(comm_entity_->SendRequest(fill_req_func, req_stream_),
+                     "put batch pull request to remote_cluster[%lu] failed", comm_entity_->GetClusterId());
+  LLM_CHK_STATUS_RET(SynchronizeStreamTask(start), "batch pull timeout");
+  const auto *response_info = PtrToPtr<void, ResponseInfo>(comm_entity_->GetEntityInfo().local_resp_ptr);
+  LLM_ASSERT_NOTNULL(response_info);
+  const auto ret = static_cast<ge::Status>(response_info->ret_code);
+  LLM_CHK_BOOL_RET_STATUS(ret == ge::SUCCESS, ret, "batch pull failed in remote cluster[%lu]",
+                          comm_entity_->GetClusterId());
+  LLM_CHK_BOOL_RET_STATUS(response_info->transfer_count == indices.size(), ge::FAILED,
+                          "batch pull response item num:%u mismatches request item num:%zu",
+                          response_info->transfer_count, indices.size());
+  for (size_t i = 0U; i < indices.size(); ++i) {
+    rets[indices[i]] = static_cast<ge::Status>(response_info->sync_flag_addresses[i]);
+  }
+  LLMLOGD("entity:%s batch pull %zu keys success", comm_entity_->GetDesc().c_str(), indices.size());
+  return ge::SUCCESS;
+}
+
+ge::Status DataTransferClient::PullCaches(const std::vector<CacheEntry> &cache_entries,
+                                          const std::vector<PullCacheTask> &tasks, int32_t timeout_in_ms,
+                                          std::vector<ge::Status> &rets) {
+  using namespace transfer_message_limits;
+  timeout_in_ms_ = timeout_in_ms;
+  // 子请求依次写入发送缓冲中批量头部之后，缓冲或子请求个数达到上限时先发出当前批次
+  uint8_t *const buffer = comm_entity_->GetEntityInfo().send_buffer_req_ptr;
+  std::vector<size_t> batch_indices;
+  uint64_t batch_size = sizeof(TransferCacheReq);
+  const auto flush_batch = [this, &batch_indices, &batch_size, &rets]() -> ge::Status {
+    const auto ret = PullBatchFromRemote(batch_indices, batch_size, rets);
+    if (ret != ge::SUCCESS) {
+      for (const auto index : batch_indices) {
+        rets[index] = ret;
+      }
+    }
+    batch_indices.clear();
+    batch_size = sizeof(TransferCacheReq);
+    return ret;
+  };
+  const auto fail_remaining = [&tasks, &rets](size_t begin, ge::Status ret) -> void {
+    for (size_t i = begin; i < tasks.size(); ++i) {
+      rets[i] = (rets[i] == ge::SUCCESS) ? ret : rets[i];
+    }
+  };
+  for (size_t i = 0U; i < tasks.size(); ++i) {
+    if (rets[i] != ge::SUCCESS) {
+      continue;
+    }
+    RequestLayout layout;
+    rets[i] = CalcRequestLayout(tasks[i].pull_cache_param, cache_entries[i], layout);
+    if (rets[i] != ge::SUCCESS) {
+      continue;
+    }
+    if (sizeof(TransferCacheReq) + layout.request_size > kMaxRequestPayloadSize) {
+      // 单项加上批量头部已超出请求缓冲，由调用方按单个请求拉取
+      rets[i] = ge::LLM_FEATURE_NOT_ENABLED;
+      continue;
+    }
+    if ((batch_indices.size() == kMaxBatchPullItemNum) || (batch_size + layout.request_size > kMaxRequestPayloadSize)) {
+      const auto ret = flush_batch();
+      if (ret != ge::SUCCESS) {
+        fail_remaining(i, ret);
+        return ret;
+      }
+    }
+    auto *request = new (buffer + batch_size) TransferCacheReq();
+    rets[i] = FillTransferCacheReq(tasks[i].pull_cache_param, cache_entries[i], tasks[i].cache_key, timeout_in_ms,
+                                   layout, *request);
+    if (rets[i] != ge::SUCCESS) {
+      continue;
+    }
+    batch_size += layout.request_size;
+    batch_indices.emplace_back(i);
+  }
+  if (!batch_indices.empty()) {
+    LLM_CHK_STATUS_RET(flush_batch(), "Failed to batch pull from remote cluster:%lu", comm_entity_->GetClusterId());
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status DataTransferClient::GenerateGetTasks(const CacheEntry &cache_entry, const CacheKey &cache_key,
+                                                const PullCacheParam &pull_cache_param, int32_t timeout_in_ms,
+                                                std::list<HcclOneSideOpDesc> &get_tasks) const {
   LLM_CHK_STATUS_RET(ConstructTransferInfo(pull_cache_param, cache_entry, cache_key, timeout_in_ms));
   const auto &request = comm_entity_->GetRequest();
   CacheEntry remote_cache_entry;
@@ -240,7 +346,49 @@ ge::Status DataTransferClient::PullCacheByGet(const CacheEntry &cache_entry, con
   }
   LLMLOGD("pull_cache begin from the offset: (%" PRIu64 ").", offset);
   LLM_CHK_STATUS_RET(job.Initialize(remote_cache_entry, *comm_entity_, offset));
-  LLM_CHK_STATUS_RET(job.PullCache(), "Failed to pull cache");
+  job.TakeSendTasks(get_tasks);
+  return ge::SUCCESS;
+}
+
+ge::Status DataTransferClient::PullCacheByGet(const CacheEntry &cache_entry, const CacheKey &cache_key,
+                                              const PullCacheParam &pull_cache_param, int32_t timeout_in_ms) const {
+  std::list<HcclOneSideOpDesc> get_tasks;
+  LLM_CHK_STATUS_RET(GenerateGetTasks(cache_entry, cache_key, pull_cache_param, timeout_in_ms, get_tasks));
+  const auto task_num = get_tasks.size();
+  LLM_CHK_STATUS_RET(comm_entity_->BatchTransfer(get_tasks, false, true, timeout_in_ms),
+                     "Failed to batch get, task size:%zu.", task_num);
+  return ge::SUCCESS;
+}
+
+ge::Status DataTransferClient::PullCachesByGet(const std::vector<CacheEntry> &cache_entries,
+                                               const std::vector<PullCacheTask> &tasks, int32_t timeout_in_ms,
+                                               std::vector<ge::Status> &rets) const {
+  // 请求在本端解析为get任务，各项只依赖本地的cache访问表，逐项失败不影响同批次其他项
+  std::list<HcclOneSideOpDesc> get_tasks;
+  std::vector<size_t> pending_indices;
+  for (size_t i = 0U; i < tasks.size(); ++i) {
+    if (rets[i] != ge::SUCCESS) {
+      continue;
+    }
+    std::list<HcclOneSideOpDesc> item_tasks;
+    rets[i] = GenerateGetTasks(cache_entries[i], tasks[i].cache_key, tasks[i].pull_cache_param, timeout_in_ms,
+                               item_tasks);
+    if (rets[i] != ge::SUCCESS) {
+      LLMLOGW("[PullCaches] task[%zu] skipped, cache_id = %ld, ret = %u", i, tasks[i].cache_id, rets[i]);
+      continue;
+    }
+    get_tasks.splice(get_tasks.end(), item_tasks);
+    pending_indices.emplace_back(i);
+  }
+  if (get_tasks.empty()) {
+    return ge::SUCCESS;
+  }
+  const auto task_num = get_tasks.size();
+  const auto ret = comm_entity_->BatchTransfer(get_tasks, false, true, timeout_in_ms);
+  for (const auto index : pending_indices) {
+    rets[index] = ret;
+  }
+  LLM_CHK_STATUS_RET(ret, "Failed to batch get, key num:%zu, task size:%zu.", pending_indices.size(), task_num);
   return ge::SUCCESS;
 }
 }  // namespace llm
@@ -11,6 +11,8 @@
 #ifndef CANN_GRAPH_ENGINE_RUNTIME_LLM_DATADIST_V2_DATA_TRANSFER_DATA_TRANSFER_CLIENT_H_
 #define CANN_GRAPH_ENGINE_RUNTIME_LLM_DATADIST_V2_DATA_TRANSFER_DATA_TRANSFER_CLIENT_H_
 
+#include <list>
+#include <vector>
 #include "llm_datadist/llm_error_codes.h"
 #include "ge_common/api_error_codes.h"
 #include "common/llm_inner_types.h"
@@ -28,12 +30,36 @@ class DataTransferClient {
                        int32_t timeout_in_ms);
   ge::Status PullCacheByGet(const CacheEntry &cache_entry, const CacheKey &cache_key,
                             const PullCacheParam &pull_cache_param, int32_t timeout_in_ms) const;
+  // 远端cache可直接访问时，将多个key的拉取任务合并为一次BatchTransfer，rets中为各项的结果
+  ge::Status PullCachesByGet(const std::vector<CacheEntry> &cache_entries, const std::vector<PullCacheTask> &tasks,
+                             int32_t timeout_in_ms, std::vector<ge::Status> &rets) const;
+  // 请求-响应模式下将多个key打包为批量拉取请求，对端需支持批量拉取(IsRemoteBatchPullSupported)。
+  // 仅处理rets中为SUCCESS的项，单项超出请求缓冲时置为LLM_FEATURE_NOT_ENABLED，由调用方按单个请求重试
+  ge::Status PullCaches(const std::vector<CacheEntry> &cache_entries, const std::vector<PullCacheTask> &tasks,
+                        int32_t timeout_in_ms, std::vector<ge::Status> &rets);
 
  private:
+  struct RequestLayout {
+    std::vector<std::vector<std::pair<int64_t, int64_t>>> contiguous_blocks_pair;
+    uint32_t buffer_info_count = 0U;
+    uint32_t is_pull_block = 0U;
+    uint32_t dst_addr_count = 0U;
+    uint64_t request_size = 0U;
+  };
+  static ge::Status CalcRequestLayout(const PullCacheParam &pull_cache_param, const CacheEntry &cache_entry,
+                                      RequestLayout &layout);
+  static ge::Status FillTransferCacheReq(const PullCacheParam &pull_cache_param, const CacheEntry &cache_entry,
+                                         const CacheKey &cache_key, int32_t timeout, const RequestLayout &layout,
+                                         TransferCacheReq &request);
+  ge::Status PullBatchFromRemote(const std::vector<size_t> &indices, uint64_t request_size,
+                                 std::vector<ge::Status> &rets) const;
   ge::Status PullCacheFromRemote(const TimePoint &start_time) const;
   ge::Status SendCacheInfoToRemote() const;
   ge::Status SynchronizeStreamTask(const TimePoint &start_time) const;
   ge::Status GetResponseInfo() const;
+  ge::Status GenerateGetTasks(const CacheEntry &cache_entry, const CacheKey &cache_key,
+                              const PullCacheParam &pull_cache_param, int32_t timeout_in_ms,
+                              std::list<HcclOneSideOpDesc> &get_tasks) const;
   ge::Status ConstructTransferInfo(const PullCacheParam &pull_cache_param, const CacheEntry &cache_entry,
                                    const CacheKey &cache_key, int32_t timeout) const;
 
@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <thread>
 #include "llm_datadist/llm_error_codes.h"
 #include "common/def_types.h"
 #include "common/llm_utils.h"
@@ -21,9 +22,22 @@ constexpr uint32_t kMaxTaskNum = 1024U;
 constexpr uint64_t kMaxBatchPutNum = 64U;
 constexpr uint64_t kBlocksCacheKey = 1UL;
 constexpr uint64_t kCacheKeyByIdType = 2UL;
+// 同一stream上最多在途的批次数，每批最多kMaxTaskNum个任务
+constexpr size_t kMaxInflightBatches = 4U;
 }  // namespace
-LayerWiseTransferJob::LayerWiseTransferJob(CommEntity &comm_entity, aclrtStream stream)
-    : stream_(stream), comm_entity_(&comm_entity) {}
+LayerWiseTransferJob::LayerWiseTransferJob(CommEntity &comm_entity, aclrtStream stream,
+                                           TransferEventPool *event_pool)
+    : stream_(stream),
+      comm_entity_(&comm_entity),
+      event_pool_((event_pool != nullptr) ? event_pool : &local_event_pool_) {}
+
+LayerWiseTransferJob::~LayerWiseTransferJob() {
+  // 正常流程下WaitAll后已无在途批次；异常退出时stream已被abort，event直接归还
+  for (const auto &batch : inflight_batches_) {
+    event_pool_->Release(batch.event);
+  }
+  inflight_batches_.clear();
+}
 
 ge::Status LayerWiseTransferJob::GenerateCacheToCacheTask(const CacheEntry &cache_entry,
                                                           const std::vector<std::shared_ptr<void>> &src_layer_addrs,
@@ -88,9 +102,10 @@ ge::Status LayerWiseTransferJob::GenerateBlocksToBlocksTask(const CacheEntry &ca
                                                             const TransferBlockConfig &transfer_block_config) {
   LLM_CHK_BOOL_RET_STATUS(cache_entry.num_blocks > 0, ge::LLM_PARAM_INVALID,
                           "check failed, request expect local cache is blocks");
-  std::vector<std::vector<std::pair<int64_t, int64_t>>> contiguous_blocks_pair;
-  LLM_CHK_STATUS_RET(LLMUtils::FindContiguousBlockIndexPair(transfer_block_config.src_blocks,
-                                                            transfer_block_config.dst_blocks, contiguous_blocks_pair));
+  if (contiguous_blocks_pair_.empty()) {
+    LLM_CHK_STATUS_RET(LLMUtils::FindContiguousBlockIndexPair(
+        transfer_block_config.src_blocks, transfer_block_config.dst_blocks, contiguous_blocks_pair_));
+  }
   if (transfer_block_config.block_mem_size > 0U) {
     LLM_CHK_BOOL_RET_STATUS(cache_entry.stride == transfer_block_config.block_mem_size, ge::LLM_PARAM_INVALID,
                             "block_mem_size[%lu] is not match cache stride:%lu", transfer_block_config.block_mem_size,
@@ -99,7 +114,7 @@ ge::Status LayerWiseTransferJob::GenerateBlocksToBlocksTask(const CacheEntry &ca
   for (size_t i = 0UL; i < src_layer_addrs.size(); ++i) {
     const auto src_layer_addr = src_layer_addrs[i];
     const auto dst_layer_addr = transfer_cache_config.dst_addrs[i];
-    for (const auto &blocks_pair : contiguous_blocks_pair) {
+    for (const auto &blocks_pair : contiguous_blocks_pair_) {
       LLM_CHK_BOOL_RET_STATUS((static_cast<uint64_t>(blocks_pair.front().first) < cache_entry.num_blocks) &&
                                   (static_cast<uint64_t>(blocks_pair.back().first) < cache_entry.num_blocks),
                               ge::LLM_PARAM_INVALID, "src block index[%ld] or [%ld] is out of range [0, %lu)",
@@ -150,26 +165,132 @@ ge::Status LayerWiseTransferJob::Prepare(const CacheEntry &cache_entry,
   return ge::SUCCESS;
 }
 
-ge::Status LayerWiseTransferJob::SynchronizeTransferCacheWithRecord(const int32_t timeout_in_ms) {
-  const auto start = std::chrono::steady_clock::now();
-  while (!layer_transfer_tasks_.empty()) {
-    LLM_CHK_STATUS_RET(DataTransferUtils::SendCache(stream_, *comm_entity_, layer_transfer_tasks_, event_),
-                       "comm_entity:%s send cache failed", comm_entity_->GetDesc().c_str());
+ge::Status LayerWiseTransferJob::SubmitLayer(const CacheEntry &cache_entry,
+                                             const TransferCacheConfig &transfer_cache_config,
+                                             const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms,
+                                             const LayerDoneCallback &callback) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_in_ms);
+  auto ret = ReapInflight(false, deadline);
+  if (ret == ge::SUCCESS) {
+    // 此时前序层仍可在途，本层任务生成与其传输重叠
+    ret = Prepare(cache_entry, transfer_cache_config, transfer_block_config);
+  }
+  auto &send_statistic_info = comm_entity_->GetSendStatisticInfo(stream_);
+  std::vector<HcclOneSideOpDesc> desces;
+  desces.reserve(std::min(layer_transfer_tasks_.size(), static_cast<size_t>(kMaxTaskNum)));
+  // 空层也记录一个event，保证回调按下发顺序触发
+  while (ret == ge::SUCCESS) {
+    if (inflight_batches_.size() >= kMaxInflightBatches) {
+      ret = ReapInflight(true, deadline);
+      if (ret != ge::SUCCESS) {
+        break;
+      }
+    }
+    desces.clear();
+    while ((desces.size() < kMaxTaskNum) && !layer_transfer_tasks_.empty()) {
+      desces.emplace_back(layer_transfer_tasks_.front());
+      layer_transfer_tasks_.pop_front();
+    }
+    ret = DataTransferUtils::SendBatchCache(stream_, desces, *comm_entity_);
+    if (ret != ge::SUCCESS) {
+      LLMLOGE(ret, "comm_entity:%s send cache failed, layer_index:%lu, data num:%zu", comm_entity_->GetDesc().c_str(),
+              transfer_cache_config.layer_index, desces.size());
+      break;
+    }
+    aclrtEvent event = nullptr;
+    ret = event_pool_->Acquire(event);
+    if (ret != ge::SUCCESS) {
+      break;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const aclError rt_ret = aclrtRecordEvent(event, stream_);
+    if (rt_ret != ACL_ERROR_NONE) {
+      event_pool_->Release(event);
+      LLMLOGE(ge::FAILED, "record event failed, ret:%d", rt_ret);
+      ret = ge::FAILED;
+      break;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    send_statistic_info.event_record_times++;
+    send_statistic_info.event_record_total_cost +=
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+    const bool last_of_layer = layer_transfer_tasks_.empty();
+    inflight_batches_.emplace_back(InflightBatch{event, transfer_cache_config.layer_index, last_of_layer, callback});
+    if (last_of_layer) {
+      break;
+    }
+  }
+  if (ret != ge::SUCCESS) {
+    // 下发失败后stream状态不可信，前序在途层一并按失败处理
+    layer_transfer_tasks_.clear();
+    FailInflight(ret);
+    if (callback != nullptr) {
+      callback(transfer_cache_config.layer_index, ret);
+    }
+    return ret;
+  }
+  LLMLOGD("comm_entity:%s submit layer:%lu, inflight batch num:%zu", comm_entity_->GetDesc().c_str(),
+          transfer_cache_config.layer_index, inflight_batches_.size());
+  return ge::SUCCESS;
+}
+
+ge::Status LayerWiseTransferJob::ReapInflight(bool wait_oldest,
+                                              const std::chrono::steady_clock::time_point &deadline) {
+  bool need_wait = wait_oldest;
+  while (!inflight_batches_.empty()) {
+    auto &batch = inflight_batches_.front();
     aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
-    while (status != ACL_EVENT_RECORDED_STATUS_COMPLETE) {
-      if (std::chrono::steady_clock::now() > start + std::chrono::milliseconds(timeout_in_ms)) {
-        LLMLOGE(ge::LLM_TIMEOUT, "stream handle transfer request timeout");
+    LLM_CHK_STATUS_RET(DataTransferUtils::QueryEventStatus(batch.event, status),
+                       "comm_entity:%s query event status failed", comm_entity_->GetDesc().c_str());
+    if (status != ACL_EVENT_RECORDED_STATUS_COMPLETE) {
+      if (!need_wait) {
+        break;
+      }
+      if (std::chrono::steady_clock::now() > deadline) {
+        LLMLOGE(ge::LLM_TIMEOUT, "stream handle transfer request timeout, layer_index:%lu", batch.layer_index);
         return ge::LLM_TIMEOUT;
       }
-      LLM_CHK_STATUS_RET(DataTransferUtils::QueryEventStatus(event_, status),
-                         "comm_entity:%s query event status failed", comm_entity_->GetDesc().c_str());
-      LLMLOGI("query event status ret=%d", status);
+      std::this_thread::yield();
+      continue;
+    }
+    need_wait = false;
+    event_pool_->Release(batch.event);
+    const InflightBatch done = std::move(batch);
+    inflight_batches_.pop_front();
+    if (done.last_of_layer && (done.callback != nullptr)) {
+      done.callback(done.layer_index, ge::SUCCESS);
+    }
+  }
+  return ge::SUCCESS;
+}
+
+void LayerWiseTransferJob::FailInflight(ge::Status ret) {
+  while (!inflight_batches_.empty()) {
+    const InflightBatch batch = std::move(inflight_batches_.front());
+    inflight_batches_.pop_front();
+    event_pool_->Release(batch.event);
+    if (batch.last_of_layer && (batch.callback != nullptr)) {
+      batch.callback(batch.layer_index, ret);
     }
-    if (event_ != nullptr) {
-      LLM_ASSERT_RT_OK(aclrtDestroyEvent(event_));
-      event_ = nullptr;
+  }
+}
+
+ge::Status LayerWiseTransferJob::WaitAll(int32_t timeout_in_ms) {
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_in_ms);
+  while (!inflight_batches_.empty()) {
+    const auto ret = ReapInflight(true, deadline);
+    if (ret != ge::SUCCESS) {
+      FailInflight(ret);
+      return ret;
     }
   }
+  return ge::SUCCESS;
+}
+
+ge::Status LayerWiseTransferJob::SynchronizeTransferCacheWithRecord(const int32_t timeout_in_ms) {
+  const auto start = std::chrono::steady_clock::now();
+  LLM_CHK_STATUS_RET(WaitAll(timeout_in_ms), "comm_entity:%s wait inflight layers failed",
+                     comm_entity_->GetDesc().c_str());
   LLM_CHK_ACL_RET(aclrtSynchronizeStreamWithTimeout(stream_, timeout_in_ms));
 
   const auto finished = std::chrono::steady_clock::now();
@@ -183,8 +304,8 @@ ge::Status LayerWiseTransferJob::SynchronizeTransferCacheWithRecord(const int32_
   return ge::SUCCESS;
 }
 
-ge::Status LayerWiseTransferJob::FillRemoteLayerAddrs(int32_t timeout_in_ms, TransferCacheConfig &transfer_config,
-                                                      const TransferBlockConfig &transfer_block_config) const {
+ge::Status LayerWiseTransferJob::FindRemoteCacheEntry(int32_t timeout_in_ms, const TransferCacheConfig &transfer_config,
+                                                      CacheEntry &remote_cache_entry) const {
   TransferCacheReq request{};
   request.timeout_in_ms = timeout_in_ms;
   if (transfer_config.type == kBlocksCacheKey) {
@@ -194,10 +315,12 @@ ge::Status LayerWiseTransferJob::FillRemoteLayerAddrs(int32_t timeout_in_ms, Tra
     request.cache_id = static_cast<int64_t>(transfer_config.model_id_or_cache_id);
   } else {
   }
-  CacheEntry remote_cache_entry;
   LLM_CHK_STATUS_RET(comm_entity_->GetCacheAccessTable().FindCacheEntry(request, remote_cache_entry));
-  LLM_CHK_STATUS_RET(ValidateRemoteCache(remote_cache_entry, transfer_config, transfer_block_config),
-                     "Validate remote cache failed.");
+  return ge::SUCCESS;
+}
+
+void LayerWiseTransferJob::FillDstLayerAddrs(const CacheEntry &remote_cache_entry,
+                                             TransferCacheConfig &transfer_config) {
   auto begin_index =
       remote_cache_entry.cache_addrs.begin() + transfer_config.dst_layer_index * transfer_config.tensor_num_per_layer;
   const std::vector<std::shared_ptr<void>> dst_layer_addrs(begin_index,
@@ -206,6 +329,15 @@ ge::Status LayerWiseTransferJob::FillRemoteLayerAddrs(int32_t timeout_in_ms, Tra
     transfer_config.dst_addrs.emplace_back(reinterpret_cast<uintptr_t>(cache_addr.get()) +
                                            transfer_config.dst_batch_index * remote_cache_entry.stride);
   }
+}
+
+ge::Status LayerWiseTransferJob::FillRemoteLayerAddrs(int32_t timeout_in_ms, TransferCacheConfig &transfer_config,
+                                                      const TransferBlockConfig &transfer_block_config) const {
+  CacheEntry remote_cache_entry;
+  LLM_CHK_STATUS_RET(FindRemoteCacheEntry(timeout_in_ms, transfer_config, remote_cache_entry));
+  LLM_CHK_STATUS_RET(ValidateRemoteCache(remote_cache_entry, transfer_config, transfer_block_config),
+                     "Validate remote cache failed.");
+  FillDstLayerAddrs(remote_cache_entry, transfer_config);
   LLMLOGI("Transfer type:%lu, model_or_cache_id:%lu, dst_layer_index:%lu.", transfer_config.type,
           transfer_config.model_id_or_cache_id, transfer_config.dst_layer_index);
   return ge::SUCCESS;
@@ -251,16 +383,105 @@ ge::Status LayerWiseTransferJob::TransferCache(const CacheEntry &cache_entry,
     LLM_CHK_STATUS_RET(FillRemoteLayerAddrs(timeout_in_ms, transfer_config, transfer_block_config),
                        "Fill remote addrs failed.");
   }
-  LLM_CHK_STATUS_RET(Prepare(cache_entry, transfer_config, transfer_block_config), "prepare transfer task failed");
   if (access_remote_cache) {
+    LLM_CHK_STATUS_RET(Prepare(cache_entry, transfer_config, transfer_block_config), "prepare transfer task failed");
     LLM_CHK_STATUS_RET(comm_entity_->BatchTransfer(layer_transfer_tasks_, true, false, timeout_in_ms),
                        "Failed to batch put, task size:%zu.", layer_transfer_tasks_.size());
     LLMLOGI("comm_entity:%s send all task of request finished", comm_entity_->GetDesc().c_str());
   } else {
+    LLM_CHK_STATUS_RET(SubmitLayer(cache_entry, transfer_config, transfer_block_config, timeout_in_ms),
+                       "submit transfer task failed");
     LLM_CHK_STATUS_RET(SynchronizeTransferCacheWithRecord(timeout_in_ms), "transfer cache with record failed");
   }
   LLM_DISMISS_GUARD(stream);
   return ge::SUCCESS;
 }
 
+ge::Status LayerWiseTransferJob::TransferCacheLayers(const CacheEntry &cache_entry,
+                                                     const TransferCacheConfig &transfer_cache_config,
+                                                     const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                                     const TransferBlockConfig &transfer_block_config,
+                                                     int32_t timeout_in_ms, bool access_remote_cache,
+                                                     const LayerReadyCallback &ready_callback,
+                                                     const LayerDoneCallback &done_callback) {
+  LLM_CHK_BOOL_RET_STATUS(!layer_indices.empty(), ge::LLM_PARAM_INVALID, "layer_indices is empty.");
+  LLM_DISMISSABLE_GUARD(stream, [this]() -> void { LLM_CHK_ACL(aclrtStreamAbort(comm_entity_->GetStream())); });
+  if (access_remote_cache) {
+    LLM_CHK_STATUS_RET(
+        TransferRemoteCacheLayers(cache_entry, transfer_cache_config, layer_indices, transfer_block_config,
+                                  timeout_in_ms));
+  } else {
+    LLM_CHK_STATUS_RET(SubmitLayers(cache_entry, transfer_cache_config, layer_indices, transfer_block_config,
+                                    timeout_in_ms, ready_callback, done_callback));
+  }
+  LLM_DISMISS_GUARD(stream);
+  return ge::SUCCESS;
+}
+
+ge::Status LayerWiseTransferJob::TransferRemoteCacheLayers(
+    const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
+    const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices, const TransferBlockConfig &transfer_block_config,
+    int32_t timeout_in_ms) {
+  LLM_CHK_BOOL_RET_STATUS(cache_entry.remote_accessible, ge::LLM_PARAM_INVALID,
+                          "local cache is not remote accessible.");
+  CacheEntry remote_cache_entry;
+  LLM_CHK_STATUS_RET(FindRemoteCacheEntry(timeout_in_ms, transfer_cache_config, remote_cache_entry),
+                     "Find remote cache failed.");
+  for (const auto &layer_index : layer_indices) {
+    TransferCacheConfig layer_config = transfer_cache_config;
+    layer_config.layer_index = layer_index.first;
+    layer_config.dst_layer_index = layer_index.second;
+    layer_config.dst_addrs.clear();
+    LLM_CHK_STATUS_RET(ValidateRemoteCache(remote_cache_entry, layer_config, transfer_block_config),
+                       "Validate remote cache failed, dst_layer_index:%lu.", layer_config.dst_layer_index);
+    FillDstLayerAddrs(remote_cache_entry, layer_config);
+    LLM_CHK_STATUS_RET(Prepare(cache_entry, layer_config, transfer_block_config),
+                       "prepare transfer task failed, layer_index:%lu.", layer_config.layer_index);
+  }
+  LLMLOGI("Transfer type:%lu, model_or_cache_id:%lu, layer num:%zu, task size:%zu.", transfer_cache_config.type,
+          transfer_cache_config.model_id_or_cache_id, layer_indices.size(), layer_transfer_tasks_.size());
+  LLM_CHK_STATUS_RET(comm_entity_->BatchTransfer(layer_transfer_tasks_, true, false, timeout_in_ms),
+                     "Failed to batch put, task size:%zu.", layer_transfer_tasks_.size());
+  LLMLOGI("comm_entity:%s send all task of request finished", comm_entity_->GetDesc().c_str());
+  return ge::SUCCESS;
+}
+
+ge::Status LayerWiseTransferJob::SubmitLayers(const CacheEntry &cache_entry,
+                                              const TransferCacheConfig &transfer_cache_config,
+                                              const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                              const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms,
+                                              const LayerReadyCallback &ready_callback,
+                                              const LayerDoneCallback &done_callback) {
+  const uint64_t tensor_num_per_layer = transfer_cache_config.tensor_num_per_layer;
+  LLM_CHK_BOOL_RET_STATUS(transfer_cache_config.dst_addrs.size() == layer_indices.size() * tensor_num_per_layer,
+                          ge::LLM_PARAM_INVALID,
+                          "dst_addrs size[%zu] is not match layer num[%zu] * tensor_num_per_layer[%lu]",
+                          transfer_cache_config.dst_addrs.size(), layer_indices.size(), tensor_num_per_layer);
+  TransferCacheConfig layer_config = transfer_cache_config;
+  for (size_t i = 0U; i < layer_indices.size(); ++i) {
+    layer_config.layer_index = layer_indices[i].first;
+    layer_config.dst_layer_index = layer_indices[i].second;
+    const auto dst_begin = transfer_cache_config.dst_addrs.cbegin() + i * tensor_num_per_layer;
+    layer_config.dst_addrs.assign(dst_begin, dst_begin + tensor_num_per_layer);
+    if (ready_callback != nullptr) {
+      const auto ret = ready_callback(layer_config.layer_index);
+      if (ret != ge::SUCCESS) {
+        LLMLOGE(ret, "comm_entity:%s wait layer:%lu ready failed", comm_entity_->GetDesc().c_str(),
+                layer_config.layer_index);
+        // 已下发的层仍在传输，等待其完成后按实际结果回调，未下发的后续层不回调
+        (void)WaitAll(timeout_in_ms);
+        if (done_callback != nullptr) {
+          done_callback(layer_config.layer_index, ret);
+        }
+        return ret;
+      }
+    }
+    LLM_CHK_STATUS_RET(SubmitLayer(cache_entry, layer_config, transfer_block_config, timeout_in_ms, done_callback),
+                       "comm_entity:%s submit layer:%lu failed", comm_entity_->GetDesc().c_str(),
+                       layer_config.layer_index);
+  }
+  LLM_CHK_STATUS_RET(SynchronizeTransferCacheWithRecord(timeout_in_ms), "transfer cache with record failed");
+  LLMLOGI("comm_entity:%s transfer %zu layers finished", comm_entity_->GetDesc().c_str(), layer_indices.size());
+  return ge::SUCCESS;
+}
 }  // namespace llm
@@ -11,19 +11,49 @@
 #ifndef CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_LAYER_WISE_TRANSFER_JOB_H_
 #define CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_LAYER_WISE_TRANSFER_JOB_H_
 
+#include <deque>
+#include <functional>
 #include "ge_common/api_error_codes.h"
 #include "link_mgr/comm_entity.h"
+#include "data_transfer/transfer_event_pool.h"
 
 namespace llm {
+// 层传输完成回调，layer_index为源层号，ret为该层传输结果
+using LayerDoneCallback = std::function<void(uint64_t layer_index, ge::Status ret)>;
+// 层就绪回调，在下发该层之前调用，用于等待该层数据计算完成；返回失败时不再下发该层及后续层
+using LayerReadyCallback = std::function<ge::Status(uint64_t layer_index)>;
+
 class LayerWiseTransferJob {
  public:
-  LayerWiseTransferJob(CommEntity &comm_entity, aclrtStream stream);
-  ~LayerWiseTransferJob() = default;
+  // event_pool为空时使用job内部的event池，job析构时销毁
+  LayerWiseTransferJob(CommEntity &comm_entity, aclrtStream stream, TransferEventPool *event_pool = nullptr);
+  ~LayerWiseTransferJob();
   ge::Status TransferCache(const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
                            const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms,
                            bool access_remote_cache);
+  // 多层一次传输。远端cache可访问模式下远端cache只查询一次，所有层的任务合并为一次BatchTransfer；
+  // 否则逐层经SubmitLayer下发，dst_addrs按layer_indices顺序依次存放各层地址，前序层传输与后续层就绪等待重叠
+  ge::Status TransferCacheLayers(const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
+                                 const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                 const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms,
+                                 bool access_remote_cache = true, const LayerReadyCallback &ready_callback = nullptr,
+                                 const LayerDoneCallback &done_callback = nullptr);
+  // 非远端cache访问模式下异步下发一层：生成任务后按批下发并记录event即返回，不等待完成。
+  // 在途批次达到上限时先等待最早的批次完成，已完成层的回调在下一次SubmitLayer或WaitAll中触发
+  ge::Status SubmitLayer(const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
+                         const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms,
+                         const LayerDoneCallback &callback = nullptr);
+  // 按下发顺序等待所有在途层完成并触发回调，超时或失败时未完成层的回调收到对应错误码。
+  // SubmitLayer失败时所有在途层同样按失败回调
+  ge::Status WaitAll(int32_t timeout_in_ms);
 
  private:
+  struct InflightBatch {
+    aclrtEvent event;
+    uint64_t layer_index;
+    bool last_of_layer;
+    LayerDoneCallback callback;
+  };
   ge::Status Prepare(const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
                      const TransferBlockConfig &transfer_block_config);
   ge::Status GenerateCacheToCacheTask(const CacheEntry &cache_entry,
@@ -38,8 +68,21 @@ class LayerWiseTransferJob {
                                         const TransferCacheConfig &transfer_cache_config,
                                         const TransferBlockConfig &transfer_block_config);
   ge::Status SynchronizeTransferCacheWithRecord(const int32_t timeout_in_ms);
+  ge::Status TransferRemoteCacheLayers(const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
+                                       const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                       const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms);
+  ge::Status SubmitLayers(const CacheEntry &cache_entry, const TransferCacheConfig &transfer_cache_config,
+                          const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                          const TransferBlockConfig &transfer_block_config, int32_t timeout_in_ms,
+                          const LayerReadyCallback &ready_callback, const LayerDoneCallback &done_callback);
+  // 回收已完成的在途批次；wait_oldest为true时至少等待最早的一个批次完成
+  ge::Status ReapInflight(bool wait_oldest, const std::chrono::steady_clock::time_point &deadline);
+  void FailInflight(ge::Status ret);
   ge::Status FillRemoteLayerAddrs(int32_t timeout_in_ms, TransferCacheConfig &transfer_config,
                                   const TransferBlockConfig &transfer_block_config) const;
+  ge::Status FindRemoteCacheEntry(int32_t timeout_in_ms, const TransferCacheConfig &transfer_config,
+                                  CacheEntry &remote_cache_entry) const;
+  static void FillDstLayerAddrs(const CacheEntry &remote_cache_entry, TransferCacheConfig &transfer_config);
 
   ge::Status ValidateRemoteCache(const CacheEntry &remote_cache_entry, const TransferCacheConfig &transfer_cache_config,
                                  const TransferBlockConfig &transfer_block_config) const;
@@ -47,7 +90,11 @@ class LayerWiseTransferJob {
   aclrtStream stream_;
   CommEntity *comm_entity_;
   std::list<HcclOneSideOpDesc> layer_transfer_tasks_;
-  aclrtEvent event_{nullptr};
+  // B2B连续block划分与层无关，多层传输时仅计算一次
+  std::vector<std::vector<std::pair<int64_t, int64_t>>> contiguous_blocks_pair_;
+  TransferEventPool local_event_pool_;
+  TransferEventPool *event_pool_;
+  std::deque<InflightBatch> inflight_batches_;
 };
 }  // namespace llm
 #endif  // CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_LAYER_WISE_TRANSFER_JOB_H_
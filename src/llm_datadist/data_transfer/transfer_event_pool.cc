@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "data_transfer/transfer_event_pool.h"
+#include "common/llm_log.h"
+#include "common/llm_checker.h"
+
+namespace llm {
+TransferEventPool::~TransferEventPool() {
+  Finalize();
+}
+
+ge::Status TransferEventPool::Acquire(aclrtEvent &event) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idle_events_.empty()) {
+      event = idle_events_.back();
+      idle_events_.pop_back();
+      return ge::SUCCESS;
+    }
+  }
+  event = nullptr;
+  LLM_CHK_ACL_RET(aclrtCreateEvent(&event));
+  return ge::SUCCESS;
+}
+
+void TransferEventPool::Release(aclrtEvent event) {
+  if (event == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  idle_events_.emplace_back(event);
+}
+
+void TransferEventPool::Finalize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto event : idle_events_) {
+    LLM_CHK_ACL(aclrtDestroyEvent(event));
+  }
+  idle_events_.clear();
+}
+
+size_t TransferEventPool::IdleSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return idle_events_.size();
+}
+}  // namespace llm
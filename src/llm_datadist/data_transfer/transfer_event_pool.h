@@ -0,0 +1,39 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_TRANSFER_EVENT_POOL_H_
+#define CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_TRANSFER_EVENT_POOL_H_
+
+#include <mutex>
+#include <vector>
+#include "acl/acl.h"
+#include "ge_common/api_error_codes.h"
+
+namespace llm {
+// 可复用的event池，避免每次传输都创建/销毁event；Acquire时池空则按需创建
+class TransferEventPool {
+ public:
+  TransferEventPool() = default;
+  ~TransferEventPool();
+  TransferEventPool(const TransferEventPool &) = delete;
+  TransferEventPool &operator=(const TransferEventPool &) = delete;
+
+  ge::Status Acquire(aclrtEvent &event);
+  void Release(aclrtEvent event);
+  // 销毁池中空闲的event，需在event所属context下调用
+  void Finalize();
+  size_t IdleSize() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<aclrtEvent> idle_events_;
+};
+}  // namespace llm
+#endif  // CANN_GRAPH_ENGINE_RUNTIME_LLM_ENGINE_DATA_TRANSFER_TRANSFER_EVENT_POOL_H_
@@ -11,6 +11,7 @@
 #include "send_state.h"
 
 #include "common/llm_log.h"
+#include "common/def_types.h"
 #include "common/mem_utils.h"
 #include "data_transfer/d2h_data_transfer_job.h"
 #include "data_transfer/h2d_data_transfer_job.h"
@@ -86,6 +87,9 @@ ge::Status SendState::Prepare(CommEntity &entity) {
     LLMLOGI("set timeout by request = %d(ms)", timeout_in_ms);
   }
   entity.SetTimeoutPoint(std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_in_ms));
+  if (request.is_pull_block == kBatchPullFlag) {
+    return PrepareBatch(entity);
+  }
   CacheEntry cache_entry{};
   uint64_t offset;
   LLM_CHK_STATUS_RET(QueryCacheEntryAndOffset(entity, cache_entry, offset));
@@ -110,6 +114,65 @@ ge::Status SendState::Prepare(CommEntity &entity) {
   return ge::SUCCESS;
 }
 
+ge::Status SendState::PrepareBatch(CommEntity &entity) {
+  using namespace transfer_message_limits;
+  const auto &header = entity.GetRequest();
+  entity.GetRecvStatisticInfo().req_info_get_times++;
+  entity.SetCacheKeyToRemove({UINT64_MAX, UINT64_MAX});
+  const auto cache_manager = entity.GetCacheManager();
+  LLM_CHECK_NOTNULL(cache_manager, "entity:%s get cache manager failed", entity.GetDesc().c_str());
+  // 头部或子请求布局非法时整批失败，子请求自身的参数错误只影响该子请求
+  LLM_CHK_BOOL_RET_STATUS((header.buffer_info_count > 0U) && (header.buffer_info_count <= kMaxBatchPullItemNum),
+                          ge::LLM_PARAM_INVALID, "batch item num:%u is out of range[1, %u]", header.buffer_info_count,
+                          kMaxBatchPullItemNum);
+  LLM_CHK_BOOL_RET_STATUS((header.req_size >= sizeof(TransferCacheReq)) && (header.req_size <= kMaxRequestPayloadSize),
+                          ge::LLM_PARAM_INVALID, "batch req_size:%lu is out of range[%zu, %lu]", header.req_size,
+                          sizeof(TransferCacheReq), kMaxRequestPayloadSize);
+  auto job = MakeUnique<D2DBatchDataTransferJob>();
+  LLM_CHECK_NOTNULL(job);
+  LLM_CHK_STATUS_RET(job->Initialize(CacheEntry{}, entity, 0U));
+  const auto *base = PtrToPtr<TransferCacheReq, uint8_t>(&header);
+  uint64_t item_offset = sizeof(TransferCacheReq);
+  for (uint32_t i = 0U; i < header.buffer_info_count; ++i) {
+    LLM_CHK_BOOL_RET_STATUS(item_offset + sizeof(TransferCacheReq) <= header.req_size, ge::LLM_PARAM_INVALID,
+                            "batch item[%u] offset:%lu exceeds req_size:%lu", i, item_offset, header.req_size);
+    const auto &item = *PtrToPtr<uint8_t, TransferCacheReq>(base + item_offset);
+    LLM_CHK_BOOL_RET_STATUS(
+        (item.req_size >= sizeof(TransferCacheReq)) && (item.req_size <= header.req_size - item_offset),
+        ge::LLM_PARAM_INVALID, "batch item[%u] req_size:%lu is invalid, left size:%lu", i, item.req_size,
+        header.req_size - item_offset);
+    const auto ret = PrepareBatchItem(*cache_manager, item, *job);
+    if (ret != ge::SUCCESS) {
+      LLMLOGW("batch item[%u] prepare failed, req_id = %lu, ret = %u", i, item.req_id, ret);
+      job->AddFailedItem(ret);
+    }
+    item_offset += item.req_size;
+  }
+  entity.SetDataTransferJob(std::move(job));
+  return ge::SUCCESS;
+}
+
+ge::Status SendState::PrepareBatchItem(const CacheManager &cache_manager, const TransferCacheReq &request,
+                                       D2DBatchDataTransferJob &job) {
+  CacheEntry cache_entry{};
+  uint64_t offset = 0U;
+  std::pair<uint64_t, uint64_t> cache_key_to_remove{UINT64_MAX, UINT64_MAX};
+  LLM_CHK_STATUS_RET(QueryCacheEntryAndOffset(cache_manager, request, cache_entry, offset, cache_key_to_remove));
+  LLM_CHK_STATUS_RET(CheckParam(cache_entry, request), "Failed to check param");
+  // 批量请求只合并D2D传输，其余类型由请求方按单个请求重试
+  const auto transfer_type = ResolveTransferType(request, cache_entry);
+  LLM_CHK_BOOL_RET_STATUS(transfer_type == kTransferTypeD2D, ge::LLM_FEATURE_NOT_ENABLED,
+                          "transfer type %d is not supported in batch pull", transfer_type);
+  LLM_CHK_STATUS_RET(ValidateTransferRequest(request, transfer_type), "Failed to validate transfer request");
+  // 子请求紧邻存放，transfer_infos不能越过该子请求自身的req_size
+  const uint64_t min_request_size = transfer_message_limits::CalcMinRequestSize(
+      request.dst_addr_count, request.buffer_info_count, transfer_message_limits::kBufferInfoMultiplierD2dH2d);
+  LLM_CHK_BOOL_RET_STATUS(min_request_size <= request.req_size, ge::LLM_PARAM_INVALID,
+                          "req_size:%lu < expected:%lu, dst_addr_count:%u, buffer_info_count:%u", request.req_size,
+                          min_request_size, request.dst_addr_count, request.buffer_info_count);
+  return job.AddItem(cache_entry, request, offset, cache_key_to_remove, GetLayerRangeTensorIndices(request));
+}
+
 ge::Status SendState::Process(CommEntity &entity) {
   if (std::chrono::steady_clock::now() > entity.GetTimeoutPoint()) {
     entity.SendResponse(ge::LLM_TIMEOUT);
@@ -135,22 +198,30 @@ ge::Status SendState::Postprocess(CommEntity &entity) {
 }
 
 ge::Status SendState::QueryCacheEntryAndOffset(CommEntity &entity, CacheEntry &cache_entry, uint64_t &offset) {
-  const TransferCacheReq &request = entity.GetRequest();
   auto &recv_statistic_info = entity.GetRecvStatisticInfo();
   recv_statistic_info.req_info_get_times++;
-  ge::Status ret = ge::SUCCESS;
   const auto cache_manager = entity.GetCacheManager();
   LLM_CHECK_NOTNULL(cache_manager, "entity:%s get cache manager failed", entity.GetDesc().c_str());
-  entity.SetCacheKeyToRemove({UINT64_MAX, UINT64_MAX});
+  std::pair<uint64_t, uint64_t> cache_key_to_remove{UINT64_MAX, UINT64_MAX};
+  entity.SetCacheKeyToRemove(cache_key_to_remove);
+  LLM_CHK_STATUS_RET(
+      QueryCacheEntryAndOffset(*cache_manager, entity.GetRequest(), cache_entry, offset, cache_key_to_remove));
+  entity.SetCacheKeyToRemove(cache_key_to_remove);
+  return ge::SUCCESS;
+}
+
+ge::Status SendState::QueryCacheEntryAndOffset(const CacheManager &cache_manager, const TransferCacheReq &request,
+                                               CacheEntry &cache_entry, uint64_t &offset,
+                                               std::pair<uint64_t, uint64_t> &cache_key_to_remove) {
   if (request.is_pull_block == 1U) {
     offset = 0U;
-    return QueryBlocksCache(*cache_manager, request, cache_entry);
+    return QueryBlocksCache(cache_manager, request, cache_entry);
   }
 
   DataCacheKey data_cache_key;
   bool is_prefix = false;
-  if (!GetCacheKey(*cache_manager, request, data_cache_key, is_prefix)) {
-    ret = QueryCacheByCacheId(*cache_manager, request, cache_entry);
+  if (!GetCacheKey(cache_manager, request, data_cache_key, is_prefix)) {
+    const auto ret = QueryCacheByCacheId(cache_manager, request, cache_entry);
     LLM_CHK_STATUS_RET(ret, "query cache by cache id[%lu] failed", request.cache_id);
     LLM_CHK_BOOL_RET_STATUS(request.batch_index < cache_entry.batch_size, ge::LLM_KV_CACHE_NOT_EXIST,
                             "batch_index (%lu)out of range [0, %u)", request.batch_index, cache_entry.batch_size);
@@ -158,14 +229,14 @@ ge::Status SendState::QueryCacheEntryAndOffset(CommEntity &entity, CacheEntry &c
     return ge::SUCCESS;
   }
   // query by cache_key
-  LLM_CHK_BOOL_RET_STATUS(cache_manager->GetCacheEntry(data_cache_key, is_prefix, cache_entry),
+  LLM_CHK_BOOL_RET_STATUS(cache_manager.GetCacheEntry(data_cache_key, is_prefix, cache_entry),
                           ge::LLM_KV_CACHE_NOT_EXIST,
                           "Failed to get cache entry by data_cache_key: (%lu, %lu), is_prefix = %d",
                           data_cache_key.first, data_cache_key.second, static_cast<int32_t>(is_prefix));
   offset = cache_entry.id_to_batch_index_and_size.at(data_cache_key.first).first * cache_entry.stride;
   if ((!is_prefix) && (cache_entry.is_owned) && (request.is_pull_block == 0U)) {
     LLMLOGI("CacheKey(%lu, %lu) need to be removed after pulling", data_cache_key.first, data_cache_key.second);
-    entity.SetCacheKeyToRemove(data_cache_key);
+    cache_key_to_remove = data_cache_key;
   }
   return ge::SUCCESS;
 }
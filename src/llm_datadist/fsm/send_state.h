@@ -17,6 +17,7 @@
 #include "common/common.h"
 #include "fsm/base_state.h"
 #include "link_mgr/comm_entity.h"
+#include "data_transfer/d2d_data_transfer_job.h"
 
 namespace llm {
 struct CacheDataSlice {
@@ -39,8 +40,14 @@ class SendState : public BaseState {
 
  private:
   static ge::Status Prepare(CommEntity &entity);
+  static ge::Status PrepareBatch(CommEntity &entity);
+  static ge::Status PrepareBatchItem(const CacheManager &cache_manager, const TransferCacheReq &request,
+                                     D2DBatchDataTransferJob &job);
   static ge::Status CheckParam(const CacheEntry &cache_entry, const TransferCacheReq &request);
   static ge::Status QueryCacheEntryAndOffset(CommEntity &entity, CacheEntry &cache_entry, uint64_t &offset);
+  static ge::Status QueryCacheEntryAndOffset(const CacheManager &cache_manager, const TransferCacheReq &request,
+                                             CacheEntry &cache_entry, uint64_t &offset,
+                                             std::pair<uint64_t, uint64_t> &cache_key_to_remove);
   static ge::Status QueryBlocksCache(const CacheManager &cache_manager, const TransferCacheReq &request,
                                      CacheEntry &cache_entry);
   static ge::Status QueryCacheByCacheId(const CacheManager &cache_manager, const TransferCacheReq &request,
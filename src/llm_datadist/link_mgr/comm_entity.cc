@@ -714,6 +714,14 @@ void CommEntity::SetCacheKeyToRemove(const std::pair<uint64_t, uint64_t> &cache_
   cache_key_to_remove_ = cache_key_to_remove;
 }
 
+bool CommEntity::IsRemoteBatchPullSupported() const {
+  return remote_batch_pull_supported_;
+}
+
+void CommEntity::SetRemoteBatchPullSupported(bool supported) {
+  remote_batch_pull_supported_ = supported;
+}
+
 std::mutex &CommEntity::GetPullMutex() {
   return pull_mutex_;
 }
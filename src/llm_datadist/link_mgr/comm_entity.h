@@ -193,6 +193,9 @@ class CommEntity {
   ge::Status SetRemoteAddresses();
   CacheAccessTable &GetCacheAccessTable();
   ge::Status GetTransferCacheReq(uint64_t request_size, TransferCacheReq *&request);
+  // 对端在建链时声明可处理批量拉取请求(kBatchPullFlag)时为true
+  bool IsRemoteBatchPullSupported() const;
+  void SetRemoteBatchPullSupported(bool supported);
 
  private:
   std::mutex process_mutex_;
@@ -220,6 +223,7 @@ class CommEntity {
   std::chrono::steady_clock::time_point timeout_point_;
   std::pair<uint64_t, uint64_t> cache_key_to_remove_;
   bool is_exchanged_mem_{false};
+  bool remote_batch_pull_supported_{false};
   std::mutex pull_mutex_;
 };
 
@@ -38,6 +38,10 @@ static void from_json(const nlohmann::json &j, LLMExchangeInfo &l) {
   j.at("comm_res").get_to(l.comm_res);
   j.at("timeout").get_to(l.timeout);
   j.at("force_link").get_to(l.force_link);
+  l.batch_pull = false;
+  if (j.contains("batch_pull")) {
+    j.at("batch_pull").get_to(l.batch_pull);
+  }
 }
 
 static void to_json(nlohmann::json &j, const LLMExchangeInfo &l) {
@@ -52,6 +56,7 @@ static void to_json(nlohmann::json &j, const LLMExchangeInfo &l) {
   j["comm_res"] = l.comm_res;
   j["timeout"] = l.timeout;
   j["force_link"] = l.force_link;
+  j["batch_pull"] = l.batch_pull;
 }
 
 static void from_json(const nlohmann::json &j, LLMLinkStatus &l) {
@@ -187,6 +192,7 @@ ge::Status LinkMsgHandler::ProcessConnectRequest(int32_t fd, const std::vector<c
   exchange_info.req_size = kDefaultReqBufferSize;
   exchange_info.resp_addr = PtrToValue(mem_info_ptr->resp_);
   exchange_info.resp_size = kDefaultRespBufferSize;
+  exchange_info.batch_pull = true;
   LLM_CHK_STATUS_RET(SendMsg(fd, LinkMsgType::kConnect, exchange_info), "Failed to send connect msg");
 
   auto ret = ge::SUCCESS;
@@ -326,6 +332,7 @@ ge::Status LinkMsgHandler::ExchangeInfoProcess(const LLMExchangeInfo &peer_excha
   entity->SetEntityCommInfo(comm_info_ptr);
   entity->SetContext(aclrt_context_);
   entity->SetCacheManager(cache_manager_);
+  entity->SetRemoteBatchPullSupported(peer_exchange_info.batch_pull);
   LLM_CHK_STATUS_RET(SetEntityMemInfo(peer_exchange_info, entity, mem_info_ptr), "Failed ti set entity mem info");
   LLMLOGI("Success to create comm entity:%s", entity->GetDesc().c_str());
   LLM_CHK_STATUS_RET(comm_entity_manager_->AddEntity(peer_exchange_info.cluster_id, entity), "Failed to add entity");
@@ -390,6 +397,7 @@ ge::Status LinkMsgHandler::LinkCluster(const ClusterInfo &cluster, int32_t timeo
   exchange_info.req_size = kDefaultReqBufferSize;
   exchange_info.resp_addr = PtrToValue(mem_info_ptr->resp_);
   exchange_info.resp_size = kDefaultRespBufferSize;
+  exchange_info.batch_pull = true;
 
   LLM_CHK_STATUS_RET(SendMsg(conn_fd, LinkMsgType::kConnect, exchange_info), "Failed to send connect msg");
   LLMExchangeInfo peer_exchange_info = {};
@@ -34,6 +34,7 @@ struct LLMExchangeInfo {
   std::string comm_name;
   int32_t timeout;
   bool force_link;
+  bool batch_pull;  // 本端可处理批量拉取请求，旧版本对端不携带该字段
 };
 
 struct LLMLinkStatus {
@@ -9,6 +9,7 @@
  */
 
 #include "llm_datadist_v2.h"
+#include <algorithm>
 #include "common/llm_utils.h"
 #include "llm_datadist_timer.h"
 #include "comm_statistic_manager.h"
@@ -247,6 +248,57 @@ ge::Status LLMDataDistV2::PullBlocks(int64_t cache_id, const CacheKey &cache_key
   return PullCache(cache_id, cache_key, pull_cache_param);
 }
 
+ge::Status LLMDataDistV2::CheckPullCacheTask(const PullCacheTask &task) const {
+  const auto &pull_cache_param = task.pull_cache_param;
+  LLM_CHK_BOOL_RET_STATUS(pull_cache_param.tensor_num_per_layer > 0UL, ge::LLM_PARAM_INVALID,
+                          "tensor_num_per_layer is invalid, must > 0");
+  LLM_CHK_BOOL_RET_STATUS(cluster_id_ != task.cache_key.prompt_cluster_id, ge::LLM_PARAM_INVALID,
+                          "data can not be pulled from own cluster:%lu", cluster_id_);
+  if (!pull_cache_param.prompt_blocks.empty()) {
+    LLM_CHK_BOOL_RET_STATUS(pull_cache_param.prompt_blocks.size() == pull_cache_param.decoder_blocks.size(),
+                            ge::LLM_PARAM_INVALID, "number of src_blocks (%zu) mismatches that of dst_blocks (%zu)",
+                            pull_cache_param.prompt_blocks.size(), pull_cache_param.decoder_blocks.size());
+    LLM_CHK_BOOL_RET_STATUS(task.cache_key.prompt_batch_index == 0U, ge::LLM_PARAM_INVALID,
+                            "invalid cache_key.prompt_batch_index (%lu), only 0 is supported in pull block",
+                            task.cache_key.prompt_batch_index);
+  }
+  return ge::SUCCESS;
+}
+
+ge::Status LLMDataDistV2::PullCaches(const std::vector<PullCacheTask> &tasks, std::vector<ge::Status> &rets) const {
+  const auto start = std::chrono::steady_clock::now();
+  LLM_CHK_BOOL_RET_STATUS(is_initialized_.load(std::memory_order::memory_order_relaxed), ge::FAILED,
+                          "Llm datadist of cluster:%lu is not initialized.", cluster_id_);
+  hixl::TemporaryRtContext with_context(aclrt_context_);
+  // 参数非法的项只记录在rets中，不影响同批次的其他项
+  rets.assign(tasks.size(), ge::SUCCESS);
+  std::vector<PullCacheTask> valid_tasks;
+  std::vector<size_t> valid_indices;
+  for (size_t i = 0U; i < tasks.size(); ++i) {
+    rets[i] = CheckPullCacheTask(tasks[i]);
+    if (rets[i] == ge::SUCCESS) {
+      valid_tasks.emplace_back(tasks[i]);
+      valid_indices.emplace_back(i);
+    }
+  }
+  std::vector<ge::Status> valid_rets;
+  auto ret = valid_tasks.empty() ? ge::SUCCESS : data_cache_engine_->PullCaches(valid_tasks, valid_rets);
+  for (size_t i = 0U; i < valid_rets.size(); ++i) {
+    rets[valid_indices[i]] = valid_rets[i];
+  }
+  const auto failed_it = std::find_if(rets.cbegin(), rets.cend(), [](ge::Status status) {
+    return status != ge::SUCCESS;
+  });
+  ret = (failed_it == rets.cend()) ? ret : *failed_it;
+  const auto end = std::chrono::steady_clock::now();
+  auto &func_statistic_info = CommStatisticManager::GetInstance().GetFuncStatisticInfo();
+  const uint64_t cost = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+  CommStatisticManager::UpdateCost(cost, func_statistic_info.pull_func_times, func_statistic_info.pull_func_min_cost,
+                                   func_statistic_info.pull_func_max_cost, func_statistic_info.pull_func_total_cost);
+  LLM_CHK_STATUS_RET(ret, "pull caches failed, task_num = %zu", tasks.size());
+  return ge::SUCCESS;
+}
+
 ge::Status LLMDataDistV2::CopyCache(const CopyCacheParam &copy_cache_param) const {
   const auto start = std::chrono::steady_clock::now();
   LLM_CHK_BOOL_RET_STATUS(is_initialized_.load(std::memory_order::memory_order_relaxed), ge::FAILED,
@@ -322,6 +374,44 @@ ge::Status LLMDataDistV2::TransferCache(const uint64_t task_id, const TransferCa
   return ge::SUCCESS;
 }
 
+ge::Status LLMDataDistV2::TransferCacheLayers(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
+                                              const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                              const TransferBlockConfig &transfer_block_config,
+                                              const LayerReadyCallback &ready_callback,
+                                              const LayerDoneCallback &done_callback) {
+  const auto start = std::chrono::steady_clock::now();
+  LLM_CHK_BOOL_RET_STATUS(is_initialized_.load(std::memory_order::memory_order_relaxed), ge::FAILED,
+                          "Llm datadist of cluster:%lu is not initialized.", cluster_id_);
+  hixl::TemporaryRtContext with_context(aclrt_context_);
+  LLM_CHK_BOOL_RET_STATUS(transfer_cache_config.tensor_num_per_layer > 0UL, ge::LLM_PARAM_INVALID,
+                          "tensor_num_per_layer is invalid, must > 0");
+  std::unique_lock<std::mutex> lk(transfer_mutex_);
+  // 等待层就绪期间释放锁，其他传输任务不必排在模型计算之后；锁只覆盖各层的下发
+  LayerReadyCallback unlocked_ready_callback = nullptr;
+  if (ready_callback != nullptr) {
+    unlocked_ready_callback = [&lk, &ready_callback](uint64_t layer_index) -> ge::Status {
+      lk.unlock();
+      const auto ret = ready_callback(layer_index);
+      lk.lock();
+      return ret;
+    };
+  }
+  LLM_CHK_STATUS_RET(
+      data_cache_engine_->TransferCacheLayers(task_id, transfer_cache_config, layer_indices, transfer_block_config,
+                                              unlocked_ready_callback, done_callback),
+      "task:%lu of cluster:%lu transfer cache of %zu layers failed", task_id, transfer_cache_config.cluster_id,
+      layer_indices.size());
+  const auto end = std::chrono::steady_clock::now();
+  auto &func_statistic_info = CommStatisticManager::GetInstance().GetFuncStatisticInfo();
+  const uint64_t cost = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+  CommStatisticManager::UpdateCost(
+      cost, func_statistic_info.transfer_func_times, func_statistic_info.transfer_func_min_cost,
+      func_statistic_info.transfer_func_max_cost, func_statistic_info.transfer_func_total_cost);
+  LLMLOGI("task:%lu of cluster:%lu transfer cache of %zu layers success", task_id, transfer_cache_config.cluster_id,
+          layer_indices.size());
+  return ge::SUCCESS;
+}
+
 ge::Status LLMDataDistV2::UnregisterCache(int64_t cache_id) const {
   LLM_CHK_BOOL_RET_STATUS(is_initialized_.load(std::memory_order::memory_order_relaxed), ge::FAILED,
                           "Llm datadist of cluster:%lu is not initialized.", cluster_id_);
@@ -51,6 +51,9 @@ class LLMDataDistV2 {
 
   ge::Status PullBlocks(int64_t cache_id, const CacheKey &cache_key, const PullCacheParam &pull_cache_param = {}) const;
 
+  // rets按tasks顺序返回各项结果，参数非法或拉取失败的项不影响其他项，返回值为首个失败项的错误码
+  ge::Status PullCaches(const std::vector<PullCacheTask> &tasks, std::vector<ge::Status> &rets) const;
+
   ge::Status CopyCache(const CopyCacheParam &copy_cache_param) const;
 
   ge::Status SwapBlocks(const Cache &src, const Cache &dst, const uint64_t block_size, const uint32_t type,
@@ -61,6 +64,12 @@ class LLMDataDistV2 {
   ge::Status TransferCache(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
                            const TransferBlockConfig &transfer_block_config);
 
+  ge::Status TransferCacheLayers(const uint64_t task_id, const TransferCacheConfig &transfer_cache_config,
+                                 const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                 const TransferBlockConfig &transfer_block_config,
+                                 const LayerReadyCallback &ready_callback = nullptr,
+                                 const LayerDoneCallback &done_callback = nullptr);
+
   ge::Status LinkClusters(const std::vector<ClusterInfo> &clusters, std::vector<ge::Status> &rets,
                           const int32_t timeout) const;
 
@@ -75,6 +84,7 @@ class LLMDataDistV2 {
 
  private:
   void DoInnerFinalize();
+  ge::Status CheckPullCacheTask(const PullCacheTask &task) const;
   virtual ge::Status DoInitialize(const std::map<ge::AscendString, ge::AscendString> &options);
   virtual void DoFinalize();
   ge::Status DoInnerInitialize(int32_t device_id, bool remote_cache_accessible,
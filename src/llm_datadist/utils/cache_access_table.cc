@@ -146,9 +146,8 @@ void CacheAccessTableUpdater::Finalize() {
   }
 }
 
-ge::Status CacheAccessTableUpdater::UpdateTableBuffer(
-    const std::map<int64_t, CacheEntry> &cache_id_to_entry,
-    std::map<std::pair<uint64_t, uint64_t>, int64_t> &cache_key_to_id) {
+ge::Status CacheAccessTableUpdater::UpdateTableBuffer(const CacheIdToEntryMap &cache_id_to_entry,
+                                                      const CacheKeyToIdMap &cache_key_to_id) {
   uint64_t version_num = ++version_num_;  // start from 1
   LLM_CHK_BOOL_RET_STATUS(version_num != UINT64_MAX, ge::FAILED, "version_num reached UINT64_MAX");
   std::vector<uint8_t> buffer;
@@ -164,10 +163,8 @@ ge::Status CacheAccessTableUpdater::UpdateTableBuffer(
   return ge::SUCCESS;
 }
 
-ge::Status CacheAccessTableUpdater::ToBuffer(uint64_t version_num,
-                                             const std::map<int64_t, CacheEntry> &cache_id_to_entry,
-                                             std::map<std::pair<uint64_t, uint64_t>, int64_t> &cache_key_to_id,
-                                             std::vector<uint8_t> &buffer) {
+ge::Status CacheAccessTableUpdater::ToBuffer(uint64_t version_num, const CacheIdToEntryMap &cache_id_to_entry,
+                                             const CacheKeyToIdMap &cache_key_to_id, std::vector<uint8_t> &buffer) {
   size_t total_size = sizeof(CacheTableHeader);
   total_size += sizeof(CacheIndex) * cache_key_to_id.size();
   std::unordered_map<int64_t, size_t> cache_id_to_summary_size;
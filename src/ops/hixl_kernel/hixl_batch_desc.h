@@ -0,0 +1,46 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef CANN_HIXL_SRC_OPS_HIXL_KERNEL_HIXL_BATCH_DESC_H_
+#define CANN_HIXL_SRC_OPS_HIXL_KERNEL_HIXL_BATCH_DESC_H_
+
+#include <cstdint>
+#include "cs/hixl_cs.h"
+#include "hcomm/hcomm_res_defs.h"
+
+namespace hixl {
+/**
+ * @brief 将HixlOneSideOpDesc批量转换为HcommBatchTransferDesc
+ * 读写方向在编译期确定，循环体内无分支，逐元素仅做定长字段搬移，便于编译器展开与向量化。
+ * @param [in] op_list 待转换的描述符
+ * @param [in] list_num 描述符个数
+ * @param [out] descs 输出数组，调用方保证至少list_num个元素
+ */
+template <bool kIsRead>
+inline void FillBatchTransferDescs(const HixlOneSideOpDesc *__restrict op_list, uint32_t list_num,
+                                   HcommBatchTransferDesc *__restrict descs) {
+  constexpr HcommTransferType kTransType = kIsRead ? HCOMM_TRANSFER_TYPE_READ : HCOMM_TRANSFER_TYPE_WRITE;
+  for (uint32_t i = 0U; i < list_num; ++i) {
+    const HixlOneSideOpDesc &op = op_list[i];
+    HcommBatchTransferDesc &desc = descs[i];
+    desc.transType = kTransType;
+    if constexpr (kIsRead) {
+      desc.transferInfo.read.len = op.len;
+      desc.transferInfo.read.dst = op.local_buf;
+      desc.transferInfo.read.src = op.remote_buf;
+    } else {
+      desc.transferInfo.write.len = op.len;
+      desc.transferInfo.write.dst = op.remote_buf;
+      desc.transferInfo.write.src = op.local_buf;
+    }
+  }
+}
+}  // namespace hixl
+
+#endif  // CANN_HIXL_SRC_OPS_HIXL_KERNEL_HIXL_BATCH_DESC_H_
@@ -10,12 +10,12 @@
 #include "hixl_batch_transfer.h"
 #include <cinttypes>
 #include <mutex>
-#include <vector>
 #include "cs/hixl_cs.h"
 #include "common/hixl_log.h"
 #include "common/hixl_checker.h"
 #include "common/scope_guard.h"
 #include "proxy/hcomm_proxy.h"
+#include "hixl_batch_desc.h"
 #include "transfer_context_manager.h"
 #include "hixl/hixl.h"
 
@@ -33,64 +33,44 @@ Status ValidateBatchTransferParam(HixlOneSideOpParam *param) {
   return SUCCESS;
 }
 
-int32_t TransferWithBatch(bool is_read, HixlOneSideOpParam *param) {
-  auto *op_list = reinterpret_cast<HixlOneSideOpDesc *>(static_cast<uintptr_t>(param->op_desc_list_addr));
-  std::vector<HcommBatchTransferDesc> descs(param->list_num);
-  for (uint32_t i = 0; i < param->list_num; i++) {
-    descs[i].transType = is_read ? HCOMM_TRANSFER_TYPE_READ : HCOMM_TRANSFER_TYPE_WRITE;
-    if (is_read) {
-      descs[i].transferInfo.read.len = op_list[i].len;
-      descs[i].transferInfo.read.dst = op_list[i].local_buf;
-      descs[i].transferInfo.read.src = op_list[i].remote_buf;
-    } else {
-      descs[i].transferInfo.write.len = op_list[i].len;
-      descs[i].transferInfo.write.dst = op_list[i].remote_buf;
-      descs[i].transferInfo.write.src = op_list[i].local_buf;
-    }
-  }
-
-  int32_t ret = HcommProxy::BatchTransferOnThread(param->thread, param->channel, descs.data(), param->list_num);
-  if (ret == HCCL_E_NOT_SUPPORT) {
-    HIXL_LOGD("[HixlBatchTransfer] HcommBatchTransferOnThread not supported.");
-    return HCCL_E_NOT_SUPPORT;
+int32_t TransferWithBatch(bool is_read, HixlOneSideOpParam *param, TransferContext &ctx) {
+  const auto *op_list = reinterpret_cast<const HixlOneSideOpDesc *>(static_cast<uintptr_t>(param->op_desc_list_addr));
+  HcommBatchTransferDesc *descs = ctx.AcquireBatchDescs(param->list_num);
+  if (is_read) {
+    FillBatchTransferDescs<true>(op_list, param->list_num, descs);
+  } else {
+    FillBatchTransferDescs<false>(op_list, param->list_num, descs);
   }
-  return ret;
+  return HcommProxy::BatchTransferOnThread(param->thread, param->channel, descs, param->list_num);
 }
 
 Status TransferWithSingle(bool is_read, HixlOneSideOpParam *param) {
-  auto *op_list = reinterpret_cast<HixlOneSideOpDesc *>(static_cast<uintptr_t>(param->op_desc_list_addr));
+  const auto *op_list = reinterpret_cast<const HixlOneSideOpDesc *>(static_cast<uintptr_t>(param->op_desc_list_addr));
+  HIXL_LOGD("[HixlBatchPutAndGet] single transfer start, is_read:%d, list_num=%u, thread=%" PRIu64
+            ", channel=%" PRIu64,
+            static_cast<int32_t>(is_read), param->list_num, param->thread, param->channel);
   if (is_read) {
     for (uint32_t i = 0; i < param->list_num; i++) {
-      HIXL_LOGD("[HixlBatchPutAndGet] HcommReadOnThread start, list_num=%u, i=%u, thread=%" PRIu64 ", channel=%" PRIu64
-                ", "
-                "dst_buf_list[%u]=%p, src_buf_list[%u]=%p, len_list[%u]=%lu",
-                param->list_num, i, param->thread, param->channel, i, op_list[i].local_buf, i, op_list[i].remote_buf, i,
-                op_list[i].len);
       HIXL_CHK_HCCL_RET(
           static_cast<HcclResult>(HcommProxy::ReadOnThread(param->thread, param->channel, op_list[i].local_buf,
                                                            op_list[i].remote_buf, op_list[i].len)),
-          "thread:%" PRIu64 ", channel:%" PRIu64 ", dst_buf:%p, src_buf:%p, size:%" PRIu64 " bytes", param->thread,
-          param->channel, op_list[i].local_buf, op_list[i].remote_buf, op_list[i].len);
+          "thread:%" PRIu64 ", channel:%" PRIu64 ", i:%u, dst_buf:%p, src_buf:%p, size:%" PRIu64 " bytes",
+          param->thread, param->channel, i, op_list[i].local_buf, op_list[i].remote_buf, op_list[i].len);
     }
   } else {
     for (uint32_t i = 0; i < param->list_num; i++) {
-      HIXL_LOGD("[HixlBatchPutAndGet] HcommWriteOnThread start, list_num=%u, i=%u, thread=%" PRIu64 ", channel=%" PRIu64
-                ", "
-                "dst_buf_list[%u]=%p, src_buf_list[%u]=%p, len_list[%u]=%lu",
-                param->list_num, i, param->thread, param->channel, i, op_list[i].remote_buf, i, op_list[i].local_buf, i,
-                op_list[i].len);
       HIXL_CHK_HCCL_RET(
           static_cast<HcclResult>(HcommProxy::WriteOnThread(param->thread, param->channel, op_list[i].remote_buf,
                                                             op_list[i].local_buf, op_list[i].len)),
-          "thread:%" PRIu64 ", channel:%" PRIu64 ", dst_buf:%p, src_buf:%p, size:%" PRIu64 " bytes", param->thread,
-          param->channel, op_list[i].remote_buf, op_list[i].local_buf, op_list[i].len);
+          "thread:%" PRIu64 ", channel:%" PRIu64 ", i:%u, dst_buf:%p, src_buf:%p, size:%" PRIu64 " bytes",
+          param->thread, param->channel, i, op_list[i].remote_buf, op_list[i].local_buf, op_list[i].len);
     }
   }
   return SUCCESS;
 }
 
-Status HixlBatchTransferTask(bool is_read, HixlOneSideOpParam *param) {
-  int32_t batch_ret = TransferWithBatch(is_read, param);
+Status HixlBatchTransferTask(bool is_read, HixlOneSideOpParam *param, TransferContext &ctx) {
+  int32_t batch_ret = TransferWithBatch(is_read, param, ctx);
   if (batch_ret == HCCL_E_NOT_SUPPORT) {
     HIXL_LOGD("[HixlBatchTransfer] HcommBatchTransferOnThread not supported, fallback to single calls");
     return TransferWithSingle(is_read, param);
@@ -135,16 +115,18 @@ Status HandleRemoteFlag(HixlOneSideOpParam *param) {
 Status HixlBatchTransfer(bool is_read, HixlOneSideOpParam *param) {
   HIXL_LOGD("[HixlBatchPutAndGet] HixlBatchTransfer %s start.", is_read ? "read" : "write");
   HIXL_CHK_STATUS_RET(ValidateBatchTransferParam(param), "[HixlBatchPutAndGet] validate param failed");
-  auto ctx = TransferContextManager::Instance().Get(param->thread);
+  std::shared_ptr<TransferContext> ctx_holder;
+  TransferContext *ctx = TransferContextManager::Instance().Lookup(param->ctx_id, param->thread, ctx_holder);
   HIXL_CHK_BOOL_RET_STATUS(ctx != nullptr && ctx->GetState() == TRANSFER_THREAD_STATE_INITIALIZED, FAILED,
-                           "[HixlBatchPutAndGet] transfer context unavailable, thread:%lu",
-                           static_cast<uint64_t>(param->thread));
+                           "[HixlBatchPutAndGet] transfer context unavailable, thread:%lu, ctx_id:%u",
+                           static_cast<uint64_t>(param->thread), param->ctx_id);
   std::lock_guard<TransferContext> transfer_lock(*ctx);
-  HIXL_CHK_BOOL_RET_STATUS(ctx->GetState() == TRANSFER_THREAD_STATE_INITIALIZED, FAILED,
-                           "[HixlBatchPutAndGet] transfer context deleting after lock, state:%u",
+  HIXL_CHK_BOOL_RET_STATUS(ctx->GetState() == TRANSFER_THREAD_STATE_INITIALIZED &&
+                               ctx->thread.load(std::memory_order_acquire) == param->thread,
+                           FAILED, "[HixlBatchPutAndGet] transfer context deleting after lock, state:%u",
                            static_cast<uint32_t>(ctx->GetState()));
 
-  HIXL_DISMISSABLE_GUARD(err_flag_guard, ([&ctx]() { ctx->WriteErrorFlag(); }));
+  HIXL_DISMISSABLE_GUARD(err_flag_guard, ([ctx]() { ctx->WriteErrorFlag(); }));
 
   constexpr const char *kBatchTag = "HixlKernel";
   HIXL_CHK_HCCL_RET(static_cast<HcclResult>(HcommProxy::BatchModeStart(kBatchTag)), "batch_tag:%s", kBatchTag);
@@ -153,7 +135,7 @@ Status HixlBatchTransfer(bool is_read, HixlOneSideOpParam *param) {
                                          kBatchTag);
                          }));
 
-  HIXL_CHK_STATUS_RET(HixlBatchTransferTask(is_read, param),
+  HIXL_CHK_STATUS_RET(HixlBatchTransferTask(is_read, param, *ctx),
                       "[HixlBatchPutAndGet] HixlBatchTransferTask failed, is_read:%d", static_cast<int32_t>(is_read));
 
   HIXL_CHK_HCCL_RET(static_cast<HcclResult>(HcommProxy::ChannelFenceOnThread(param->thread, param->channel)),
@@ -36,18 +36,76 @@ std::shared_ptr<TransferContext> TransferContextManager::Get(ThreadHandle thread
   return it->second;
 }
 
-HixlTransferThreadState TransferContextManager::Add(ThreadHandle thread, uint32_t notify_id, uint64_t err_flag_dev_va) {
+TransferContext *TransferContextManager::Lookup(uint32_t ctx_id, ThreadHandle thread,
+                                                std::shared_ptr<TransferContext> &holder) const {
+  if (ctx_id != 0U && ctx_id <= kMaxTransferContextId) {
+    TransferContext *ctx = slots_[ctx_id].load(std::memory_order_acquire);
+    if (ctx != nullptr && ctx->thread.load(std::memory_order_acquire) == thread) {
+      return ctx;
+    }
+  }
+  holder = Get(thread);
+  return holder.get();
+}
+
+std::shared_ptr<TransferContext> TransferContextManager::AcquireSlotContextLocked(uint32_t ctx_id,
+                                                                                  ThreadHandle thread) {
+  if (ctx_id == 0U || ctx_id > kMaxTransferContextId) {
+    if (ctx_id != 0U) {
+      HIXL_LOGW("[TransferContextManager] ctx_id=%u out of range [1, %u], fallback to thread lookup", ctx_id,
+                kMaxTransferContextId);
+    }
+    return nullptr;
+  }
+  if (slot_owners_.empty()) {
+    slot_owners_.resize(kMaxTransferContextId + 1U);
+  }
+  auto &owner = slot_owners_[ctx_id];
+  if (owner == nullptr) {
+    owner = std::make_shared<TransferContext>();
+    owner->batch_descs.resize(kDefaultBatchDescCapacity);
+    owner->thread.store(thread, std::memory_order_release);
+    slots_[ctx_id].store(owner.get(), std::memory_order_release);
+    return owner;
+  }
+  const ThreadHandle bound = owner->thread.load(std::memory_order_acquire);
+  if (bound != thread) {
+    auto it = contexts_.find(bound);
+    if (it != contexts_.end() && it->second == owner) {
+      HIXL_LOGW("[TransferContextManager] ctx_id=%u still bound to thread=%lu, thread=%lu fallback to thread lookup",
+                ctx_id, static_cast<uint64_t>(bound), static_cast<uint64_t>(thread));
+      return nullptr;
+    }
+    // 槽位上一任thread已删除，持锁换绑，避免快速路径在加锁后仍使用旧thread的context
+    std::lock_guard<TransferContext> ctx_lock(*owner);
+    owner->thread.store(thread, std::memory_order_release);
+  }
+  return owner;
+}
+
+HixlTransferThreadState TransferContextManager::Add(ThreadHandle thread, uint32_t notify_id, uint64_t err_flag_dev_va,
+                                                    uint32_t ctx_id) {
   std::unique_lock<std::mutex> lock(mutex_);
   auto &ctx = contexts_[thread];
-  if (ctx == nullptr) {
+  auto slot_ctx = AcquireSlotContextLocked(ctx_id, thread);
+  if (slot_ctx != nullptr) {
+    if (ctx != nullptr && ctx != slot_ctx) {
+      // thread改用新槽位，旧context作废，防止旧ctx_id命中
+      ctx->SetState(TRANSFER_THREAD_STATE_DELETED);
+    }
+    ctx = slot_ctx;
+  } else if (ctx == nullptr) {
     ctx = std::make_shared<TransferContext>();
+    ctx->batch_descs.resize(kDefaultBatchDescCapacity);
+    ctx->thread.store(thread, std::memory_order_release);
   }
-  ctx->SetState(TRANSFER_THREAD_STATE_INITIALIZED);
   ctx->notify_id = notify_id;
   ctx->err_flag_dev_va = err_flag_dev_va;
+  ctx->SetState(TRANSFER_THREAD_STATE_INITIALIZED);
 
-  HIXL_LOGI("[TransferContextManager] add transfer context success. thread=%lu notify_id=%u err_flag_dev_va=0x%lx",
-            static_cast<uint64_t>(thread), notify_id, static_cast<uint64_t>(err_flag_dev_va));
+  HIXL_LOGI("[TransferContextManager] add transfer context success. thread=%lu notify_id=%u err_flag_dev_va=0x%lx "
+            "ctx_id=%u",
+            static_cast<uint64_t>(thread), notify_id, static_cast<uint64_t>(err_flag_dev_va), ctx_id);
   lock.unlock();
 
   // 防止hcomm接口内回调hixl触发Get导致死锁，所以这里放到锁外面
@@ -10,14 +10,19 @@
 #ifndef CANN_HIXL_SRC_OPS_HIXL_KERNEL_TRANSFER_CONTEXT_MANAGER_H_
 #define CANN_HIXL_SRC_OPS_HIXL_KERNEL_TRANSFER_CONTEXT_MANAGER_H_
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "common/hixl_inner_types.h"
 
 namespace hixl {
+constexpr uint32_t kDefaultBatchDescCapacity = 128U;  // 与host侧单次kernel下发的描述符上限一致
+constexpr uint32_t kTransferContextSpinLimit = 1024U;  // 自旋超过该次数后让出CPU
 
 struct TransferContext {
   TransferContext() = default;
@@ -33,7 +38,13 @@ struct TransferContext {
   }
 
   void lock() {
+    uint32_t spins = 0U;
     while (spin_lock.test_and_set(std::memory_order_acquire)) {
+      // 持锁方被抢占时避免无限空转占满AICPU
+      if (++spins >= kTransferContextSpinLimit) {
+        spins = 0U;
+        std::this_thread::yield();
+      }
     }
   }
 
@@ -47,10 +58,23 @@ struct TransferContext {
 
   void WriteErrorFlag() const;
 
+  /**
+   * @brief 获取本context复用的HcommBatchTransferDesc数组，调用方需持有context锁
+   * 仅在list_num超过历史最大值时扩容，稳态下不产生内存分配
+   */
+  HcommBatchTransferDesc *AcquireBatchDescs(uint32_t list_num) {
+    if (batch_descs.size() < list_num) {
+      batch_descs.resize(list_num);
+    }
+    return batch_descs.data();
+  }
+
   std::atomic_flag spin_lock = ATOMIC_FLAG_INIT;
   std::atomic<HixlTransferThreadState> state{TRANSFER_THREAD_STATE_INITIALIZED};
+  std::atomic<ThreadHandle> thread{0U};  // 绑定的thread，槽位复用时更新，快速路径据此校验ctx_id是否过期
   uint32_t notify_id{0};
   uint64_t err_flag_dev_va{0};
+  std::vector<HcommBatchTransferDesc> batch_descs;
 };
 
 class TransferContextManager {
@@ -58,14 +82,31 @@ class TransferContextManager {
   static TransferContextManager &Instance();
 
   std::shared_ptr<TransferContext> Get(ThreadHandle thread) const;
-  HixlTransferThreadState Add(ThreadHandle thread, uint32_t notify_id = 0U, uint64_t err_flag_dev_va = 0U);
+
+  /**
+   * @brief kernel入口的快速查找，ctx_id有效时直接读槽位表，不加锁、不增减引用计数
+   * 槽位中的context在进程生命周期内不释放，调用方加锁后仍需校验state与thread
+   * @param [in] ctx_id host下发的槽位号，0或槽位未绑定该thread时退化为按thread查表
+   * @param [in] thread 本次传输使用的thread
+   * @param [out] holder 退化路径下持有context的引用，快速路径下保持为空
+   * @return 找不到时返回nullptr
+   */
+  TransferContext *Lookup(uint32_t ctx_id, ThreadHandle thread, std::shared_ptr<TransferContext> &holder) const;
+
+  HixlTransferThreadState Add(ThreadHandle thread, uint32_t notify_id = 0U, uint64_t err_flag_dev_va = 0U,
+                              uint32_t ctx_id = 0U);
   HixlTransferThreadState Delete(ThreadHandle thread);
 
  private:
   TransferContextManager() = default;
 
+  std::shared_ptr<TransferContext> AcquireSlotContextLocked(uint32_t ctx_id, ThreadHandle thread);
+
   mutable std::mutex mutex_;
   std::unordered_map<ThreadHandle, std::shared_ptr<TransferContext>> contexts_;
+  // 槽位表只增不减，slot_owners_持有所有权并仅在mutex_下修改，slots_供快速路径无锁读取
+  std::array<std::atomic<TransferContext *>, kMaxTransferContextId + 1U> slots_{};
+  std::vector<std::shared_ptr<TransferContext>> slot_owners_;
 };
 
 }  // namespace hixl
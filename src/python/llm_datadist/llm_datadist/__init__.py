@@ -31,6 +31,7 @@ from llm_datadist.v2.llm_types import (
     LayerSynchronizer,
     TransferConfig,
     CacheTask,
+    PullTask,
     TransferWithCacheKeyConfig,
     Memtype,
     MemInfo,
@@ -58,6 +59,7 @@ __all__ = [
     "LayerSynchronizer",
     "TransferConfig",
     "CacheTask",
+    "PullTask",
     "TransferWithCacheKeyConfig",
     "Memtype",
     "MemInfo",
@@ -87,6 +89,7 @@ v2_list = [
     "LayerSynchronizer",
     "TransferConfig",
     "CacheTask",
+    "PullTask",
     "TransferWithCacheKeyConfig",
     "Memtype",
     "MemInfo",
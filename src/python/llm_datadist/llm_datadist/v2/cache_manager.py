@@ -12,12 +12,13 @@
 
 from typing import List, Optional, Tuple, Union, Dict
 
-from llm_datadist.status import handle_llm_status, raise_if_false, raise_if_true
+from llm_datadist.status import handle_llm_status, raise_if_false, raise_if_true, code_2_status, LLMStatusCode, \
+    LLMException
 from llm_datadist.utils import log
 from llm_datadist.utils.utils import check_isinstance, check_dict, check_uint32, check_int64, check_uint64
 from llm_datadist.v2.llm_types import CacheDesc, Cache, CacheKey, CacheKeyByIdAndIndex, BlocksCacheKey, Placement, \
     TransferConfig, CacheTask, LayerSynchronizer, TransferWithCacheKeyConfig, PushType, check_layer_range, MemInfo, \
-    Memtype
+    Memtype, PullTask
 from llm_datadist.v2.llm_utils import (
     pack_cache_desc, pack_cache_key, pack_block_cache_key, pack_mem_info, \
     pack_cache_key_by_id, transfer_cache_async, TransferCacheParameters, layer_range_to_tensor_indices, \
@@ -228,6 +229,85 @@ class CacheManager(object):
                 dst_layer_range: 目的层范围
                 tensor_num_per_layer: 每层tensor数量
         """
+        packed_cache_key, param = self._pack_pull_blocks_param(src_cache_key, dst_cache, src_blocks, dst_blocks,
+                                                               **kwargs)
+        log.info('[pull_blocks] start, target cache_id = %d, cache_key = %s, '
+                 'src_layer_range = %s, dst_layer_range = %s, tensor_num_per_layer = %d',
+                 dst_cache.cache_id, src_cache_key, kwargs.get("src_layer_range"), kwargs.get("dst_layer_range"),
+                 param[-1])
+        ret = self._llm_datadist.pull_cache_v2(dst_cache.cache_id, packed_cache_key, param)
+        handle_llm_status(ret, '[pull_blocks]', f'src_cache_key = {src_cache_key}')
+        log.info('[pull_blocks] success')
+
+    def pull_cache(self,
+                   cache_key: Union[CacheKey, CacheKeyByIdAndIndex],
+                   cache: Cache,
+                   batch_index: int = 0,
+                   size: int = -1,
+                   **kwargs) -> None:
+        """
+        Args:
+            cache_key: CacheKey或CacheKeyByIdAndIndex
+            cache: 目标Cache
+            batch_index: batch index
+            size: 拉取的tensor大小, -1表示拉取全部大小
+            **kwargs:
+                src_layer_range: 源层范围
+                dst_layer_range: 目的层范围
+                tensor_num_per_layer: 每层tensor数量
+        """
+        packed_cache_key, param = self._pack_pull_cache_param(cache_key, cache, batch_index, size, **kwargs)
+        log.info('[pull_cache] start, cache_id = %d, batch_index = %d, size = %d, cache_key = %s, '
+                 'src_layer_range = %s, dst_layer_range = %s, tensor_num_per_layer = %d',
+                 cache.cache_id, batch_index, size, cache_key, kwargs.get("src_layer_range"),
+                 kwargs.get("dst_layer_range"), param[-1])
+        ret = self._llm_datadist.pull_cache_v2(cache.cache_id, packed_cache_key, param)
+        handle_llm_status(ret, '[pull_cache]', f'cache_key = {cache_key}')
+        log.info('[pull_cache] success')
+
+    def pull_caches(self, tasks: Union[List[PullTask], Tuple[PullTask]]) -> List[LLMStatusCode]:
+        """
+        批量拉取KV, 同一对端的多个cache_key合并为一次请求
+        Args:
+            tasks: 拉取任务列表, 每个任务对应一个cache_key
+
+        Returns:
+            与tasks一一对应的拉取结果, 单个任务失败不影响其余任务
+        """
+        check_isinstance("tasks", tasks, [list, tuple], PullTask)
+        raise_if_false(len(tasks) > 0, "tasks can not be empty.")
+        log.info('[pull_caches] start, task num = %d', len(tasks))
+        statuses = [LLMStatusCode.LLM_SUCCESS] * len(tasks)
+        packed_tasks = []
+        task_indices = []
+        for index, task in enumerate(tasks):
+            try:
+                if task.dst_cache.is_blocks_cache:
+                    packed_cache_key, param = self._pack_pull_blocks_param(task.src_cache_key, task.dst_cache,
+                                                                           task.src_blocks, task.dst_blocks,
+                                                                           **task.kwargs)
+                else:
+                    packed_cache_key, param = self._pack_pull_cache_param(task.src_cache_key, task.dst_cache,
+                                                                          task.batch_index, task.size, **task.kwargs)
+            except (LLMException, TypeError, ValueError) as e:
+                log.error('[pull_caches] task[%d] param check failed, %s', index, e)
+                statuses[index] = e.status_code if isinstance(e, LLMException) else LLMStatusCode.LLM_PARAM_INVALID
+                continue
+            packed_tasks.append((task.dst_cache.cache_id, packed_cache_key, param))
+            task_indices.append(index)
+        if packed_tasks:
+            ret, rets = self._llm_datadist.pull_caches_v2(packed_tasks)
+            # 未返回逐key结果时为整体失败, 如未初始化
+            if len(rets) != len(packed_tasks):
+                handle_llm_status(ret, '[pull_caches]', f'task num = {len(packed_tasks)}')
+            for index, task_ret in zip(task_indices, rets):
+                statuses[index] = code_2_status(task_ret)
+        log.info('[pull_caches] end, statuses = %s', statuses)
+        return statuses
+
+    def _pack_pull_blocks_param(self, src_cache_key: Union[CacheKey, CacheKeyByIdAndIndex, BlocksCacheKey],
+                                dst_cache: Cache, src_blocks: Union[Tuple[int], List[int]],
+                                dst_blocks: Union[Tuple[int], List[int]], **kwargs):
         src_layer_range = kwargs.get("src_layer_range")
         dst_layer_range = kwargs.get("dst_layer_range")
         tensor_num_per_layer = kwargs.get("tensor_num_per_layer", _NUM_TENSORS_PER_LAYER)
@@ -251,34 +331,13 @@ class CacheManager(object):
                            "src_blocks should be empty when src_cache_key is not instance of BlocksCacheKey.")
             packed_cache_key = pack_cache_key(src_cache_key) if isinstance(src_cache_key, CacheKey) \
                 else pack_cache_key_by_id(src_cache_key)
-
-        log.info('[pull_blocks] start, target cache_id = %d, cache_key = %s, '
-                 'src_layer_range = %s, dst_layer_range = %s, tensor_num_per_layer = %d',
-                 dst_cache.cache_id, src_cache_key, src_layer_range, dst_layer_range, tensor_num_per_layer)
         src_tensor_indices, dst_tensor_indices = layer_range_to_tensor_indices(src_layer_range, dst_layer_range,
                                                                                tensor_num_per_layer)
         param = (-1, 0, src_blocks, dst_blocks, src_tensor_indices, dst_tensor_indices, -1, -1, tensor_num_per_layer)
-        ret = self._llm_datadist.pull_cache_v2(dst_cache.cache_id, packed_cache_key, param)
-        handle_llm_status(ret, '[pull_blocks]', f'src_cache_key = {src_cache_key}')
-        log.info('[pull_blocks] success')
+        return packed_cache_key, param
 
-    def pull_cache(self,
-                   cache_key: Union[CacheKey, CacheKeyByIdAndIndex],
-                   cache: Cache,
-                   batch_index: int = 0,
-                   size: int = -1,
-                   **kwargs) -> None:
-        """
-        Args:
-            cache_key: CacheKey或CacheKeyByIdAndIndex
-            cache: 目标Cache
-            batch_index: batch index
-            size: 拉取的tensor大小, -1表示拉取全部大小
-            **kwargs:
-                src_layer_range: 源层范围
-                dst_layer_range: 目的层范围
-                tensor_num_per_layer: 每层tensor数量
-        """
+    def _pack_pull_cache_param(self, cache_key: Union[CacheKey, CacheKeyByIdAndIndex], cache: Cache,
+                               batch_index: int, size: int, **kwargs):
         if self._enable_remote_cache_accessible:
             check_isinstance("cache_key", cache_key, CacheKeyByIdAndIndex)
         else:
@@ -301,16 +360,10 @@ class CacheManager(object):
             packed_cache_key = pack_cache_key(cache_key)
         else:
             packed_cache_key = pack_cache_key_by_id(cache_key)
-    
-        log.info('[pull_cache] start, cache_id = %d, batch_index = %d, size = %d, cache_key = %s, '
-                 'src_layer_range = %s, dst_layer_range = %s, tensor_num_per_layer = %d',
-                 cache.cache_id, batch_index, size, cache_key, src_layer_range, dst_layer_range, tensor_num_per_layer)
         src_tensor_indices, dst_tensor_indices = layer_range_to_tensor_indices(src_layer_range, dst_layer_range,
                                                                                tensor_num_per_layer)
         param = (size, batch_index, [], [], src_tensor_indices, dst_tensor_indices, -1, -1, tensor_num_per_layer)
-        ret = self._llm_datadist.pull_cache_v2(cache.cache_id, packed_cache_key, param)
-        handle_llm_status(ret, '[pull_cache]', f'cache_key = {cache_key}')
-        log.info('[pull_cache] success')
+        return packed_cache_key, param
 
     def register_cache(self, cache_desc: CacheDesc, addrs: List[int],
                        cache_keys: Union[Tuple[CacheKey], List[CacheKey]] = (),
@@ -504,7 +557,8 @@ class CacheManager(object):
                                          dst_block_memory_size)
         log.info('[transfer_cache_async] start, params = %s', params)
         return transfer_cache_async(params, layer_synchronizer, self._llm_datadist.transfer_cache_v2,
-                                    enable_remote_cache=self._enable_remote_cache_accessible)
+                                    enable_remote_cache=self._enable_remote_cache_accessible,
+                                    transfer_layers_func=self._llm_datadist.transfer_cache_layers_with_sync_v2)
 
     def push_cache(self,
                    dst_cache_key: CacheKeyByIdAndIndex,
@@ -553,14 +607,15 @@ class CacheManager(object):
         log.info('[push_cache] start, cache_id = %d, src_batch_index = %d, dst_cache_key = %s, '
                  'src_layer_range = %s, dst_layer_range = %s, size = %d, tensor_num_per_layer = %d.',
                  src_cache.cache_id, src_batch_index, dst_cache_key, src_layer_range, dst_layer_range, size, tensor_num_per_layer)
-        for i, src_layer_index in enumerate(list(src_layer_range)):
-            dst_layer_index = dst_layer_range[i]
-            transfer_config = (src_cache.cache_id, src_batch_index, src_layer_index, [],
-                               dst_cache_key.cluster_id, dst_cache_key.cache_id,
-                               dst_cache_key.batch_index, PushType.CACHE_KEY_BY_ID.value,
-                               dst_layer_index, tensor_num_per_layer)
-            block_config = (0, [], [])
-            ret = self._llm_datadist.transfer_cache_v2(0, transfer_config, block_config)
+        # 所有层在一次native调用内完成：远端cache只查询一次，任务合并为一次批量传输
+        layer_indices = list(zip(src_layer_range, dst_layer_range))
+        transfer_config = (src_cache.cache_id, src_batch_index, 0, [],
+                           dst_cache_key.cluster_id, dst_cache_key.cache_id,
+                           dst_cache_key.batch_index, PushType.CACHE_KEY_BY_ID.value,
+                           0, tensor_num_per_layer)
+        block_config = (0, [], [])
+        if layer_indices:
+            ret = self._llm_datadist.transfer_cache_layers_v2(0, transfer_config, layer_indices, block_config)
             handle_llm_status(ret, '[push_cache]', f'dst_cache_key = {dst_cache_key}')
         log.info('[push_cache] success')
 
@@ -610,15 +665,15 @@ class CacheManager(object):
         log.info('[push_blocks] start, cache_id = %d, dst_cache_key = %s, '
                  'src_layer_range = %s, dst_layer_range = %s, tensor_num_per_layer = %d',
                  src_cache.cache_id, dst_cache_key, src_layer_range, dst_layer_range, tensor_num_per_layer)
-        for i, src_layer_index in enumerate(list(src_layer_range)):
-            dst_layer_index = dst_layer_range[i]
-            transfer_config = (src_cache.cache_id, 0, src_layer_index, [],
-                               dst_cache_key.cluster_id, dst_cache_key.model_id,
-                               0, PushType.BLOCKS_CACHE_KEY.value, dst_layer_index, tensor_num_per_layer)
-            block_config = (0,
-                            src_blocks if src_blocks is not None else [],
-                            dst_blocks if dst_blocks is not None else [])
-            ret = self._llm_datadist.transfer_cache_v2(0, transfer_config, block_config)
+        layer_indices = list(zip(src_layer_range, dst_layer_range))
+        transfer_config = (src_cache.cache_id, 0, 0, [],
+                           dst_cache_key.cluster_id, dst_cache_key.model_id,
+                           0, PushType.BLOCKS_CACHE_KEY.value, 0, tensor_num_per_layer)
+        block_config = (0,
+                        src_blocks if src_blocks is not None else [],
+                        dst_blocks if dst_blocks is not None else [])
+        if layer_indices:
+            ret = self._llm_datadist.transfer_cache_layers_v2(0, transfer_config, layer_indices, block_config)
             handle_llm_status(ret, '[push_blocks]', f'dst_cache_key = {dst_cache_key}')
         log.info('[push_blocks] success')
 
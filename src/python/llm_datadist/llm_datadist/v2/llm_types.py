@@ -11,7 +11,7 @@
 # ----------------------------------------------------------------------------
 
 __all__ = ['CacheDesc', 'CacheKey', 'CacheKeyByIdAndIndex', 'KvCache', 'BlocksCacheKey',
-           'Placement', 'CacheTask', 'TransferConfig', 'LayerSynchronizer', 'Cache']
+           'Placement', 'CacheTask', 'TransferConfig', 'LayerSynchronizer', 'Cache', 'PullTask']
 
 from abc import abstractmethod, ABC
 from enum import Enum, IntEnum
@@ -666,6 +666,68 @@ class TransferConfig:
         check_uint32("src_batch_index", src_batch_index)
 
 
+class PullTask:
+    """
+    CacheManager.pull_caches的单个拉取任务, 参数含义与pull_cache/pull_blocks一致, 由pull_caches统一校验
+    dst_cache为blocks cache时按pull_blocks处理, 否则按pull_cache处理
+    """
+    def __init__(self,
+                 src_cache_key: Union[CacheKey, CacheKeyByIdAndIndex, BlocksCacheKey],
+                 dst_cache: Cache,
+                 src_blocks: Union[Tuple[int], List[int]] = (),
+                 dst_blocks: Union[Tuple[int], List[int]] = (),
+                 batch_index: int = 0,
+                 size: int = -1,
+                 **kwargs):
+        self._src_cache_key = src_cache_key
+        self._dst_cache = dst_cache
+        self._src_blocks = src_blocks
+        self._dst_blocks = dst_blocks
+        self._batch_index = batch_index
+        self._size = size
+        self._kwargs = kwargs
+
+    def __repr__(self) -> str:
+        return (f"PullTask(src_cache_key={self._src_cache_key},"
+                f" dst_cache_id={self._dst_cache.cache_id if isinstance(self._dst_cache, Cache) else None},"
+                f" src_blocks={self._src_blocks},"
+                f" dst_blocks={self._dst_blocks},"
+                f" batch_index={self._batch_index},"
+                f" size={self._size},"
+                f" kwargs={self._kwargs})")
+
+    def __str__(self):
+        return self.__repr__()
+
+    @property
+    def src_cache_key(self) -> Union[CacheKey, CacheKeyByIdAndIndex, BlocksCacheKey]:
+        return self._src_cache_key
+
+    @property
+    def dst_cache(self) -> Cache:
+        return self._dst_cache
+
+    @property
+    def src_blocks(self) -> Union[Tuple[int], List[int]]:
+        return self._src_blocks
+
+    @property
+    def dst_blocks(self) -> Union[Tuple[int], List[int]]:
+        return self._dst_blocks
+
+    @property
+    def batch_index(self) -> int:
+        return self._batch_index
+
+    @property
+    def size(self) -> int:
+        return self._size
+
+    @property
+    def kwargs(self) -> dict:
+        return self._kwargs
+
+
 class CacheTask:
     def __init__(self, transfer_async_task):
         self._transfer_async_task = transfer_async_task
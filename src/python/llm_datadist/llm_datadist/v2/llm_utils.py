@@ -142,7 +142,8 @@ class TransferCacheJob:
 
     def __init__(self, params: TransferCacheParameters,
                  layer_synchronizer: LayerSynchronizer,
-                 transfer_cache_func):
+                 transfer_cache_func,
+                 transfer_layers_func=None):
         self._transfer_configs = params.transfer_configs
         self._src_block_indices = params.src_block_indices
         self._dst_block_indices = params.dst_block_indices
@@ -155,6 +156,8 @@ class TransferCacheJob:
         self._is_data_cache_engine = isinstance(params.src_cache, Cache)
         self._layer_synchronizer = layer_synchronizer
         self._transfer_cache_func = transfer_cache_func
+        self._transfer_layers_func = transfer_layers_func
+        self._synchronized_layers = set()
 
     def init(self):
         raise_if_false(self._cache_desc.num_tensors % 2 == 0, "cache_desc.num_tensors ({0}) is not even",
@@ -166,6 +169,10 @@ class TransferCacheJob:
             self.check_transfer_config(transfer_config)
 
     def transfer_layers(self):
+        if self._transfer_layers_func is not None and \
+                all(isinstance(config, TransferConfig) for config in self._transfer_configs):
+            self.submit_layers()
+            return
         for layer_i, src_layer_index in enumerate(range(self._num_layers)):
             to_transfer = [config for config in self._transfer_configs if src_layer_index in config.src_layer_range]
             if not to_transfer:
@@ -191,6 +198,41 @@ class TransferCacheJob:
                     log.info(f'transfer all layers to dst_cluster_id={config.dst_cluster_id} finished')
         log.info('transfer all layers finished')
 
+    def submit_layers(self):
+        # 每个目的端的所有层在一次native调用内逐层下发，前序层传输与后续层的同步等待重叠
+        for config in self._transfer_configs:
+            layer_indices = [(layer_index, layer_index) for layer_index in config.src_layer_range]
+            transfer_config = (self._cache_id, config.src_batch_index, 0, list(config.dst_addrs),
+                               config.dst_cluster_id, 0, 0, PushType.NO_CACHE_KEY.value, 0, _NUM_TENSORS_PER_LAYER)
+            block_config = (self._dst_block_memory_size if self._dst_block_memory_size is not None else 0,
+                            self._src_block_indices if self._src_block_indices is not None else [],
+                            self._dst_block_indices if self._dst_block_indices is not None else [])
+            ret = code_2_status(self._transfer_layers_func(TransferCacheJob.task_id, transfer_config, layer_indices,
+                                                           block_config, self._synchronize_layer))
+            TransferCacheJob.task_id += 1
+            self._rets[config.dst_cluster_id] = ret
+            if ret != LLMStatusCode.LLM_SUCCESS:
+                log.error(f'Failed to transfer layers {config.src_layer_range} '
+                          f'to dst_cluster_id={config.dst_cluster_id}, ret = {ret}')
+                return
+            log.info(f'transfer all layers to dst_cluster_id={config.dst_cluster_id} finished')
+        log.info('transfer all layers finished')
+
+    def _synchronize_layer(self, layer_index: int) -> bool:
+        # 多个目的端共享同一层时只同步一次
+        if layer_index in self._synchronized_layers:
+            return True
+        try:
+            synchronized = self._layer_synchronizer.synchronize_layer(layer_index, self._timeout_in_millis)
+        except Exception as e:
+            log.error(f'Failed to synchronize layer {layer_index}, error = {e}')
+            return False
+        if not synchronized:
+            log.error(f'Failed to synchronize layer {layer_index}')
+            return False
+        self._synchronized_layers.add(layer_index)
+        return True
+
     def transfer_layer(self, src_layer_index: int, dst_layer_idx,
                        transfer_config: Union[TransferConfig, TransferWithCacheKeyConfig]) -> LLMStatusCode:
         if isinstance(transfer_config, TransferConfig):
@@ -283,7 +325,8 @@ def transfer_cache_async(params: TransferCacheParameters,
                          layer_synchronizer: LayerSynchronizer,
                          transfer_cache_func,
                          default_error_code=LLMStatusCode.LLM_TIMEOUT,
-                         enable_remote_cache=False) -> CacheTask:
+                         enable_remote_cache=False,
+                         transfer_layers_func=None) -> CacheTask:
     _check_block_indices("dst_block_indices", params.dst_block_indices)
     _check_block_indices("src_block_indices", params.src_block_indices)
     if params.dst_block_memory_size is not None:
@@ -306,7 +349,7 @@ def transfer_cache_async(params: TransferCacheParameters,
     raise_if_false(params.dst_block_indices or params.dst_block_memory_size in (None, 0),
                    "dst_block_memory_size ({0}) is neither None nor 0 while dst is not blocks",
                    params.dst_block_memory_size)
-    transfer_job = TransferCacheJob(params, layer_synchronizer, transfer_cache_func)
+    transfer_job = TransferCacheJob(params, layer_synchronizer, transfer_cache_func, transfer_layers_func)
     transfer_job.init()
     transfer_thread = TransferAsyncThread(transfer_job, default_error_code)
     transfer_thread.start()
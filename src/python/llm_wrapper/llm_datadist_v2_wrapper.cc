@@ -164,6 +164,28 @@ ge::Status LLMDataDistV2Wrapper::PullCache(int64_t cache_id, const CacheKeyTuple
   return llm_data_dist->PullCache(cache_id, unpacked_key, unpacked_param);
 }
 
+std::pair<ge::Status, std::vector<ge::Status>> LLMDataDistV2Wrapper::PullCaches(
+    const std::vector<PullCacheTaskTuple> &tasks) {
+  ge::Status ret = ge::FAILED;
+  std::vector<ge::Status> rets;
+  std::vector<PullCacheTask> pull_cache_tasks;
+  pull_cache_tasks.reserve(tasks.size());
+  for (const auto &task : tasks) {
+    PullCacheTask pull_cache_task{};
+    pull_cache_task.cache_id = std::get<0U>(task);
+    pull_cache_task.cache_key = LLMDataDistV2Wrapper::UnpackCacheKey(std::get<1U>(task));
+    pull_cache_task.pull_cache_param = LLMDataDistV2Wrapper::UnpackPullCacheParam(std::get<2U>(task));
+    pull_cache_tasks.emplace_back(std::move(pull_cache_task));
+  }
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (llm_data_dist != nullptr) {
+      ret = llm_data_dist->PullCaches(pull_cache_tasks, rets);
+    }
+  }
+  return {ret, rets};
+}
+
 ge::Status LLMDataDistV2Wrapper::CopyCache(CopyCacheParamTuple copy_cache_param) {
   auto unpacked = LLMDataDistV2Wrapper::UnpackCopyCacheParam(std::move(copy_cache_param));
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -211,6 +233,31 @@ ge::Status LLMDataDistV2Wrapper::TransferCache(const uint64_t task_id,
   return llm_data_dist->TransferCache(task_id, unpacked_config, unpacked_block);
 }
 
+ge::Status LLMDataDistV2Wrapper::TransferCacheLayers(const uint64_t task_id,
+                                                     const TransferCacheConfigTuple &transfer_cache_param,
+                                                     const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                                     const TransferBlockConfigTuple &transfer_block_param) {
+  auto unpacked_config = LLMDataDistV2Wrapper::UnpackTransferCacheConfig(transfer_cache_param);
+  auto unpacked_block = LLMDataDistV2Wrapper::UnpackTransferBlockConfig(transfer_block_param);
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  LLM_CHECK_NOTNULL(llm_data_dist);
+  return llm_data_dist->TransferCacheLayers(task_id, unpacked_config, layer_indices, unpacked_block);
+}
+
+ge::Status LLMDataDistV2Wrapper::TransferCacheLayersWithSync(
+    const uint64_t task_id, const TransferCacheConfigTuple &transfer_cache_param,
+    const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+    const TransferBlockConfigTuple &transfer_block_param, const std::function<bool(uint64_t)> &synchronize_layer) {
+  auto unpacked_config = LLMDataDistV2Wrapper::UnpackTransferCacheConfig(transfer_cache_param);
+  auto unpacked_block = LLMDataDistV2Wrapper::UnpackTransferBlockConfig(transfer_block_param);
+  const LayerReadyCallback ready_callback = [&synchronize_layer](uint64_t layer_index) -> ge::Status {
+    return synchronize_layer(layer_index) ? ge::SUCCESS : ge::LLM_PARAM_INVALID;
+  };
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  LLM_CHECK_NOTNULL(llm_data_dist);
+  return llm_data_dist->TransferCacheLayers(task_id, unpacked_config, layer_indices, unpacked_block, ready_callback);
+}
+
 ge::Status LLMDataDistV2Wrapper::SwitchRole(const std::string &role, std::map<std::string, std::string> &options) {
   std::shared_lock<std::shared_mutex> lock(mutex_);
   LLM_CHECK_NOTNULL(llm_data_dist);
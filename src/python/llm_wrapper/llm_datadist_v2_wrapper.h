@@ -11,6 +11,7 @@
 #ifndef CANN_GRAPH_ENGINE_PYTHON_LLM_WRAPPER_LLM_DATADIST_V2_WRAPPER_H
 #define CANN_GRAPH_ENGINE_PYTHON_LLM_WRAPPER_LLM_DATADIST_V2_WRAPPER_H
 
+#include <functional>
 #include <shared_mutex>
 
 #include "llm_datadist_v2.h"
@@ -32,6 +33,8 @@ using CacheKeyTuple = std::tuple<uint64_t, int64_t, uint64_t, uint64_t, uint64_t
 
 using MemInfoTuple = std::tuple<uint32_t, uint64_t, uint64_t>;
 
+using PullCacheTaskTuple = std::tuple<int64_t, CacheKeyTuple, PullCacheParamTuple>;
+
 using CopyCacheParamTuple = std::tuple<int64_t,
                                        int64_t,
                                        uint32_t,
@@ -96,6 +99,8 @@ class LLMDataDistV2Wrapper {
   static ge::Status PullCache(int64_t cache_id, const CacheKeyTuple &cache_key,
                               const PullCacheParamTuple &pull_cache_param);
 
+  static std::pair<ge::Status, std::vector<ge::Status>> PullCaches(const std::vector<PullCacheTaskTuple> &tasks);
+
   static ge::Status CopyCache(CopyCacheParamTuple copy_cache_param);
 
   static ge::Status RemoveCacheKey(const CacheKeyTuple &cache_key_tuple);
@@ -111,6 +116,17 @@ class LLMDataDistV2Wrapper {
                                   const TransferBlockConfigTuple &transfer_block_param =
                                       std::make_tuple(0, std::vector<uint64_t>{}, std::vector<uint64_t>{}));
 
+  static ge::Status TransferCacheLayers(const uint64_t task_id, const TransferCacheConfigTuple &transfer_cache_param,
+                                        const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                        const TransferBlockConfigTuple &transfer_block_param);
+
+  // synchronize_layer在下发每层之前调用，返回false时停止下发并返回失败
+  static ge::Status TransferCacheLayersWithSync(const uint64_t task_id,
+                                                const TransferCacheConfigTuple &transfer_cache_param,
+                                                const std::vector<std::pair<uint64_t, uint64_t>> &layer_indices,
+                                                const TransferBlockConfigTuple &transfer_block_param,
+                                                const std::function<bool(uint64_t)> &synchronize_layer);
+
   static ge::Status SwitchRole(const std::string &role, std::map<std::string, std::string> &options);
 
  private:
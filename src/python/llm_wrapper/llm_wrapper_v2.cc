@@ -16,6 +16,7 @@
 #include <vector>
 #include "pybind11/pybind11.h"
 #include "pybind11/stl.h"
+#include "pybind11/functional.h"
 #include "acl/acl.h"
 #include "graph/types.h"
 #include "llm_datadist/llm_error_codes.h"
@@ -93,10 +94,16 @@ void BuildDataDistV2Funcs(py::module &m) {
   (void)m.def("remap_registered_memory", &LLMDataDistV2Wrapper::RemapRegisteredMemory,
               py::call_guard<py::gil_scoped_release>());
   (void)m.def("pull_cache_v2", &LLMDataDistV2Wrapper::PullCache, py::call_guard<py::gil_scoped_release>());
+  (void)m.def("pull_caches_v2", &LLMDataDistV2Wrapper::PullCaches, py::call_guard<py::gil_scoped_release>());
   (void)m.def("copy_cache_v2", &LLMDataDistV2Wrapper::CopyCache, py::call_guard<py::gil_scoped_release>());
   (void)m.def("swap_blocks_v2", &LLMDataDistV2Wrapper::SwapBlocks, py::call_guard<py::gil_scoped_release>());
   (void)m.def("check_capacity_v2", &LLMDataDistV2Wrapper::CheckCapacity, py::call_guard<py::gil_scoped_release>());
   (void)m.def("transfer_cache_v2", &LLMDataDistV2Wrapper::TransferCache, py::call_guard<py::gil_scoped_release>());
+  (void)m.def("transfer_cache_layers_v2", &LLMDataDistV2Wrapper::TransferCacheLayers,
+              py::call_guard<py::gil_scoped_release>());
+  // 回调由pybind11在调用时重新获取GIL
+  (void)m.def("transfer_cache_layers_with_sync_v2", &LLMDataDistV2Wrapper::TransferCacheLayersWithSync,
+              py::call_guard<py::gil_scoped_release>());
   (void)m.def("link_clusters_v2", &LLMDataDistV2Wrapper::LinkClusters, py::call_guard<py::gil_scoped_release>());
   (void)m.def("unlink_clusters_v2", &LLMDataDistV2Wrapper::UnlinkClusters, py::call_guard<py::gil_scoped_release>());
   (void)m.def("switch_role_v2", &LLMDataDistV2Wrapper::SwitchRole, py::call_guard<py::gil_scoped_release>());
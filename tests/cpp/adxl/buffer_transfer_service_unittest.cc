@@ -70,19 +70,15 @@ class BufferTransferServiceUTest : public ::testing::Test {
   }
 
   template <typename Queue, typename Predicate>
-  void WaitUntilQueueProcessed(std::mutex &mutex, Queue &queue, Predicate &&predicate) {
+  void WaitUntilQueueProcessed(Queue &queue, Predicate &&predicate) {
     const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(kWaitTimeoutMs);
     while (std::chrono::steady_clock::now() < deadline) {
-      {
-        std::lock_guard<std::mutex> lock(mutex);
-        if (queue.empty() && predicate()) {
-          return;
-        }
+      if ((queue.SizeApprox() == 0U) && predicate()) {
+        return;
       }
       std::this_thread::sleep_for(std::chrono::milliseconds(10));
     }
-    std::lock_guard<std::mutex> lock(mutex);
-    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.SizeApprox(), 0U);
     EXPECT_TRUE(predicate());
   }
 
@@ -100,7 +96,34 @@ TEST_F(BufferTransferServiceUTest, ProcessBufferReqSkipsFinalizedChannel) {
   buffer_req.timeout = 1000;
 
   ASSERT_EQ(service_->PushBufferReq(channel, buffer_req), SUCCESS);
-  WaitUntilQueueProcessed(service_->buffer_req_mutex_, service_->buffer_req_queue_, []() { return true; });
+  WaitUntilQueueProcessed(service_->buffer_req_queue_, []() { return true; });
+}
+
+TEST_F(BufferTransferServiceUTest, PushBufferReqAndRespKeepMsgWhenQueueFull) {
+  // 未Initialize的服务没有处理线程，队列只进不出
+  BufferTransferService service(std::vector<llm::LlmMemPool *>{}, 1024);
+  auto channel = CreateChannel();
+  BufferReq buffer_req{};
+  buffer_req.timeout = 1000;
+  BufferResp buffer_resp{};
+  buffer_resp.timeout = 1000;
+  while (service.buffer_req_queue_.TryEmplace(channel, buffer_req)) {
+  }
+  while (service.buffer_resp_queue_.TryEmplace(channel, buffer_resp)) {
+  }
+  const size_t req_num = service.buffer_req_queue_.SizeApprox();
+  const size_t resp_num = service.buffer_resp_queue_.SizeApprox();
+  // 队列满时不阻塞接收线程，也不丢弃消息
+  EXPECT_EQ(service.PushBufferReq(channel, buffer_req), SUCCESS);
+  EXPECT_EQ(service.PushBufferResp(channel, buffer_resp), SUCCESS);
+  EXPECT_EQ(service.buffer_req_queue_.SizeApprox(), req_num + 1U);
+  EXPECT_EQ(service.buffer_resp_queue_.SizeApprox(), resp_num + 1U);
+
+  service.Finalize();
+  buffer_req.timeout = 1000;
+  buffer_resp.timeout = 1000;
+  EXPECT_EQ(service.PushBufferReq(channel, buffer_req), FAILED);
+  EXPECT_EQ(service.PushBufferResp(channel, buffer_resp), FAILED);
 }
 
 TEST_F(BufferTransferServiceUTest, ProcessBufferReqSecondStepSkipsFinalizedChannel) {
@@ -112,8 +135,7 @@ TEST_F(BufferTransferServiceUTest, ProcessBufferReqSecondStepSkipsFinalizedChann
   buffer_req.timeout = 1000;
 
   ASSERT_EQ(service_->PushSecondStepReq(channel, buffer_req), SUCCESS);
-  WaitUntilQueueProcessed(service_->buffer_second_step_mutex_, service_->buffer_second_step_queue_,
-                          []() { return true; });
+  WaitUntilQueueProcessed(service_->buffer_second_step_queue_, []() { return true; });
 }
 
 TEST_F(BufferTransferServiceUTest, ProcessBufferReqSecondStepReleasesExpiredRequest) {
@@ -125,14 +147,9 @@ TEST_F(BufferTransferServiceUTest, ProcessBufferReqSecondStepReleasesExpiredRequ
   buffer_req.timeout = kExpiredTimeoutUs;
   buffer_req.recv_start_time = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
 
-  {
-    std::lock_guard<std::mutex> lock(service_->buffer_second_step_mutex_);
-    service_->buffer_second_step_queue_.emplace(channel, buffer_req);
-  }
-  service_->buffer_second_step_cv_.notify_one();
+  ASSERT_TRUE(service_->buffer_second_step_queue_.Emplace(channel, buffer_req));
 
-  WaitUntilQueueProcessed(service_->buffer_second_step_mutex_, service_->buffer_second_step_queue_,
-                          []() { return true; });
+  WaitUntilQueueProcessed(service_->buffer_second_step_queue_, []() { return true; });
 }
 
 TEST_F(BufferTransferServiceUTest, ProcessCtrlMsgSkipsFinalizedChannel) {
@@ -143,7 +160,7 @@ TEST_F(BufferTransferServiceUTest, ProcessCtrlMsgSkipsFinalizedChannel) {
   buffer_req.transfer_type = TransferType::kWriteH2RH;
 
   service_->PushCtrlMsg(channel, buffer_req);
-  WaitUntilQueueProcessed(service_->buffer_ctrl_msg_mutex_, service_->buffer_ctrl_msg_queue_, []() { return true; });
+  WaitUntilQueueProcessed(service_->buffer_ctrl_msg_queue_, []() { return true; });
 }
 
 TEST_F(BufferTransferServiceUTest, BuildBufferSliceAddrsSuccess) {
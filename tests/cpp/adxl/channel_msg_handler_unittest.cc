@@ -24,6 +24,7 @@
 #undef private
 
 #include "common/msg_handler_plugin.h"
+#include "depends/llm_datadist/src/data_cache_engine_test_helper.h"
 
 namespace adxl {
 namespace {
@@ -234,4 +235,62 @@ TEST_F(ChannelMsgHandlerUnitTest, CreateChannelRejectsInvalidRemoteMemRange) {
 
   EXPECT_EQ(handler_->CreateChannel(channel_info, true, peer_info), PARAM_INVALID);
 }
+
+TEST_F(ChannelMsgHandlerUnitTest, ParseRankTableReusesCachedRankTableForSamePeer) {
+  handler_->rank_table_cache_[kRemoteEngine] = PeerRankTable{kRemoteCommRes, "cached_rank_table", 0, 1};
+  ChannelConnectInfo peer_info{};
+  peer_info.channel_id = kRemoteEngine;
+  peer_info.comm_res = kRemoteCommRes;
+  std::string rank_table;
+  int32_t local_rank_id = -1;
+  int32_t peer_rank_id = -1;
+  // "remote_comm_res" cannot be parsed, so success means the generator was skipped
+  EXPECT_EQ(handler_->ParseRankTable(peer_info, rank_table, local_rank_id, peer_rank_id), SUCCESS);
+  EXPECT_EQ(rank_table, "cached_rank_table");
+  EXPECT_EQ(local_rank_id, 0);
+  EXPECT_EQ(peer_rank_id, 1);
+
+  // peer comm_res changed, rank table must be regenerated
+  peer_info.comm_res = "changed_comm_res";
+  EXPECT_NE(handler_->ParseRankTable(peer_info, rank_table, local_rank_id, peer_rank_id), SUCCESS);
+}
+
+TEST_F(ChannelMsgHandlerUnitTest, LocalMemSnapshotRebuiltAfterInvalidate) {
+  llm::MockMmpaForHcclApi::Install();
+  llm::CommAdapter::GetInstance().Initialize();
+  SegmentTable segment_table;
+  handler_->segment_table_ = &segment_table;
+
+  auto empty_snapshot = handler_->GetLocalMemSnapshot();
+  ASSERT_NE(empty_snapshot, nullptr);
+  EXPECT_TRUE(empty_snapshot->addrs.empty());
+  EXPECT_EQ(handler_->GetLocalMemSnapshot(), empty_snapshot);
+
+  MemDesc mem{};
+  mem.addr = kRemoteAddrStart;
+  mem.len = kRemoteAddrEnd - kRemoteAddrStart;
+  MemHandle handle = nullptr;
+  ASSERT_EQ(handler_->RegisterMem(mem, MEM_HOST, handle), SUCCESS);
+  auto snapshot = handler_->GetLocalMemSnapshot();
+  ASSERT_NE(snapshot, empty_snapshot);
+  ASSERT_EQ(snapshot->addrs.size(), 1U);
+  EXPECT_EQ(snapshot->addrs[0].start_addr, kRemoteAddrStart);
+  EXPECT_EQ(snapshot->registered_mems.at(handle), reinterpret_cast<void *>(kRemoteAddrStart));
+  EXPECT_EQ(handler_->GetLocalMemSnapshot(), snapshot);
+  // connect info is filled from the same snapshot
+  ChannelConnectInfo connect_info{};
+  EXPECT_EQ(handler_->FillLocalConnectInfo(connect_info), SUCCESS);
+  ASSERT_EQ(connect_info.addrs.size(), 1U);
+  EXPECT_EQ(connect_info.addrs[0].end_addr, kRemoteAddrEnd);
+
+  ASSERT_EQ(handler_->DeregisterMem(handle), SUCCESS);
+  auto rebuilt_snapshot = handler_->GetLocalMemSnapshot();
+  ASSERT_NE(rebuilt_snapshot, snapshot);
+  EXPECT_TRUE(rebuilt_snapshot->addrs.empty());
+  EXPECT_TRUE(rebuilt_snapshot->registered_mems.empty());
+
+  handler_->segment_table_ = nullptr;
+  llm::CommAdapter::GetInstance().Finalize();
+  llm::MockMmpaForHcclApi::Reset();
+}
 }  // namespace adxl
@@ -451,6 +451,54 @@ TEST_F(ChannelPoolUnitTest, TestTransferCompletionDuringEviction) {
   EXPECT_EQ(GetCurrentChannelCount(), 6);
 }
 
+TEST_F(ChannelPoolUnitTest, TestWaitForCapacityWokenByDestroy) {
+  Status ret = channel_msg_handler_->Initialize(channel_options_, nullptr);
+  ASSERT_EQ(ret, SUCCESS);
+  CreateChannels(3, ChannelType::kClient);
+  CreateChannels(2, ChannelType::kServer);
+  EXPECT_EQ(channel_manager_->GetChannelCount(), 5);
+  EXPECT_EQ(channel_manager_->GetChannelCount(ChannelType::kClient), 3);
+  EXPECT_EQ(channel_manager_->GetChannelCount(ChannelType::kServer), 2);
+  // pool is full, waiter should time out
+  EXPECT_FALSE(channel_manager_->WaitForCapacity(5, 10));
+
+  std::atomic<bool> has_capacity(false);
+  std::thread waiter([this, &has_capacity]() {
+    has_capacity = channel_manager_->WaitForCapacity(5, 5000);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  const auto start = std::chrono::steady_clock::now();
+  ASSERT_EQ(channel_manager_->DestroyChannel(ChannelType::kClient, BuildChannelId(kClientChannelBasePort)), SUCCESS);
+  waiter.join();
+  const auto cost =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_TRUE(has_capacity);
+  // woken by destroy instead of polling until timeout
+  EXPECT_LT(cost, 1000);
+  EXPECT_EQ(channel_manager_->GetChannelCount(ChannelType::kClient), 2);
+}
+
+TEST_F(ChannelPoolUnitTest, TestPickEvictionCandidateInLruOrder) {
+  CreateChannels(3, ChannelType::kClient);
+  ChannelPtr hot_channel = channel_manager_->GetChannel(ChannelType::kClient, BuildChannelId(kClientChannelBasePort));
+  hot_channel->SetHasTransferred(true);
+  // oldest channel has transferred, so it gets a second chance and moves to the tail
+  auto first = channel_manager_->PickEvictionCandidate(ChannelType::kClient);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(first->GetChannelId(), BuildChannelId(kClientChannelBasePort + 1U));
+  EXPECT_TRUE(first->IsDisconnecting());
+  auto second = channel_manager_->PickEvictionCandidate(ChannelType::kClient);
+  ASSERT_NE(second, nullptr);
+  EXPECT_EQ(second->GetChannelId(), BuildChannelId(kClientChannelBasePort + 2U));
+  auto third = channel_manager_->PickEvictionCandidate(ChannelType::kClient);
+  ASSERT_NE(third, nullptr);
+  EXPECT_EQ(third->GetChannelId(), BuildChannelId(kClientChannelBasePort));
+  EXPECT_FALSE(hot_channel->GetHasTransferred());
+  // all channels are disconnecting now
+  EXPECT_EQ(channel_manager_->PickEvictionCandidate(ChannelType::kClient), nullptr);
+  EXPECT_EQ(channel_manager_->PickEvictionCandidate(ChannelType::kServer), nullptr);
+}
+
 TEST_F(ChannelPoolUnitTest, DestroyServerChannelRemovesServerStatistics) {
   CreateChannels(1, ChannelType::kServer);
   const std::string &channel_id = created_channel_ids_.back();
@@ -0,0 +1,258 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "common/inline_task.h"
+#include "common/mpmc_queue.h"
+
+namespace hixl {
+TEST(MpmcQueueTest, CapacityRoundsUpAndFullQueueRejects) {
+  MpmcQueue<int> queue(3U);
+  EXPECT_EQ(queue.Capacity(), 4U);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.TryPush(int(i)));
+  }
+  EXPECT_FALSE(queue.TryPush(4));
+  EXPECT_EQ(queue.SizeApprox(), 4U);
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.TryPop(value));
+  // 回绕后继续可用
+  EXPECT_TRUE(queue.TryPush(5));
+  ASSERT_TRUE(queue.TryPop(value));
+  EXPECT_EQ(value, 5);
+}
+
+TEST(MpmcQueueTest, DestructorReleasesRemainingItems) {
+  auto counter = std::make_shared<int>(0);
+  {
+    MpmcQueue<std::shared_ptr<int>> queue(8U);
+    EXPECT_TRUE(queue.TryEmplace(counter));
+    EXPECT_TRUE(queue.TryEmplace(counter));
+    EXPECT_EQ(counter.use_count(), 3);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueueTest, BlockingQueueDeliversAllItemsAcrossThreads) {
+  constexpr uint64_t kProducerNum = 4U;
+  constexpr uint64_t kConsumerNum = 4U;
+  constexpr uint64_t kItemsPerProducer = 20000U;
+  // 容量远小于总量，覆盖生产者在队列满时等待的路径
+  BlockingMpmcQueue<uint64_t> queue(16U);
+  std::atomic<uint64_t> sum{0U};
+  std::atomic<uint64_t> count{0U};
+  std::vector<std::thread> consumers;
+  for (uint64_t i = 0U; i < kConsumerNum; ++i) {
+    consumers.emplace_back([&queue, &sum, &count]() {
+      uint64_t value = 0U;
+      while (queue.Pop(value)) {
+        sum.fetch_add(value);
+        count.fetch_add(1U);
+      }
+    });
+  }
+  std::vector<std::thread> producers;
+  for (uint64_t p = 0U; p < kProducerNum; ++p) {
+    producers.emplace_back([&queue, p]() {
+      for (uint64_t i = 1U; i <= kItemsPerProducer; ++i) {
+        EXPECT_TRUE(queue.Push(p * kItemsPerProducer + i));
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  queue.Close();
+  for (auto &consumer : consumers) {
+    consumer.join();
+  }
+  const uint64_t total = kProducerNum * kItemsPerProducer;
+  EXPECT_EQ(count.load(), total);
+  EXPECT_EQ(sum.load(), total * (total + 1U) / 2U);
+}
+
+TEST(MpmcQueueTest, SingleConsumerSleepingBetweenBurstsIsAlwaysWoken) {
+  constexpr uint64_t kBurstNum = 1000U;
+  constexpr uint64_t kProducerNum = 3U;
+  constexpr uint64_t kBurstSize = 2U;
+  BlockingMpmcQueue<uint64_t> queue(64U);
+  std::atomic<uint64_t> received{0U};
+  std::thread consumer([&queue, &received]() {
+    uint64_t value = 0U;
+    while (queue.Pop(value)) {
+      received.fetch_add(1U);
+    }
+  });
+  uint64_t expected = 0U;
+  for (uint64_t burst = 0U; burst < kBurstNum; ++burst) {
+    // 多个生产者同时通知，覆盖消费者登记等待后复查即取到元素、随后取消等待的交错
+    std::vector<std::thread> producers;
+    for (uint64_t p = 0U; p < kProducerNum; ++p) {
+      producers.emplace_back([&queue]() {
+        for (uint64_t i = 0U; i < kBurstSize; ++i) {
+          EXPECT_TRUE(queue.TryPush(1U));
+        }
+      });
+    }
+    for (auto &producer : producers) {
+      producer.join();
+    }
+    expected += kProducerNum * kBurstSize;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((received.load() < expected) && (std::chrono::steady_clock::now() < deadline)) {
+      std::this_thread::yield();
+    }
+    if (received.load() != expected) {
+      ADD_FAILURE() << "consumer was not woken, burst:" << burst << ", received:" << received.load()
+                    << ", expected:" << expected;
+      break;
+    }
+    // 留出时间让消费者自旋结束后进入futex睡眠
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  queue.Close();
+  consumer.join();
+}
+
+TEST(MpmcQueueTest, TryPushFailsWhenFullOrClosed) {
+  BlockingMpmcQueue<int> queue(2U);
+  EXPECT_TRUE(queue.TryPush(1));
+  EXPECT_TRUE(queue.TryPush(2));
+  EXPECT_FALSE(queue.TryPush(3));
+  int value = 0;
+  EXPECT_TRUE(queue.Pop(value));
+  EXPECT_EQ(value, 1);
+  queue.Close();
+  EXPECT_FALSE(queue.TryPush(4));
+  EXPECT_TRUE(queue.Pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(queue.Pop(value));
+}
+
+TEST(MpmcQueueTest, ForcePushSpillsWhenFullAndKeepsOrder) {
+  BlockingMpmcQueue<int> queue(2U);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_TRUE(queue.ForcePush(std::move(i)));
+  }
+  EXPECT_EQ(queue.SizeApprox(), 6U);
+  int value = 0;
+  EXPECT_TRUE(queue.Pop(value));
+  EXPECT_EQ(value, 0);
+  // 溢出链表非空时即使环有空位也进入链表，保持先进先出
+  EXPECT_TRUE(queue.ForcePush(6));
+  for (int expected = 1; expected <= 6; ++expected) {
+    EXPECT_TRUE(queue.Pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  queue.Close();
+  EXPECT_FALSE(queue.ForcePush(7));
+  EXPECT_FALSE(queue.Pop(value));
+}
+
+TEST(MpmcQueueTest, ForcePushWakesSleepingConsumer) {
+  BlockingMpmcQueue<int> queue(2U);
+  constexpr int kItemNum = 1000;
+  std::atomic<int> sum{0};
+  std::thread consumer([&queue, &sum]() {
+    int value = 0;
+    while (queue.Pop(value)) {
+      sum.fetch_add(value);
+    }
+  });
+  for (int i = 1; i <= kItemNum; ++i) {
+    EXPECT_TRUE(queue.ForcePush(std::move(i)));
+  }
+  queue.Close();
+  consumer.join();
+  EXPECT_EQ(sum.load(), kItemNum * (kItemNum + 1) / 2);
+}
+
+TEST(MpmcQueueTest, CloseWakesBlockedConsumerAndRejectsPush) {
+  BlockingMpmcQueue<int> queue(4U);
+  std::promise<bool> popped;
+  std::thread consumer([&queue, &popped]() {
+    int value = 0;
+    popped.set_value(queue.Pop(value));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  queue.Close();
+  consumer.join();
+  EXPECT_FALSE(popped.get_future().get());
+  EXPECT_FALSE(queue.Push(1));
+  EXPECT_TRUE(queue.IsClosed());
+}
+
+TEST(MpmcQueueTest, CloseDrainsPendingItems) {
+  BlockingMpmcQueue<int> queue(4U);
+  EXPECT_TRUE(queue.Push(1));
+  EXPECT_TRUE(queue.Push(2));
+  queue.Close();
+  int value = 0;
+  EXPECT_TRUE(queue.Pop(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_TRUE(queue.Pop(value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(queue.Pop(value));
+}
+
+TEST(InlineTaskTest, SmallCallableStoredInline) {
+  int result = 0;
+  auto lambda = [&result]() { result = 42; };
+  EXPECT_TRUE(InlineTask::IsInline<decltype(lambda)>());
+  InlineTask task(lambda);
+  InlineTask moved(std::move(task));
+  EXPECT_FALSE(static_cast<bool>(task));
+  ASSERT_TRUE(static_cast<bool>(moved));
+  moved();
+  EXPECT_EQ(result, 42);
+}
+
+TEST(InlineTaskTest, LargeCallableFallsBackToHeap) {
+  std::array<uint64_t, 16U> payload{};
+  payload[15U] = 7U;
+  uint64_t result = 0U;
+  auto lambda = [payload, &result]() { result = payload[15U]; };
+  EXPECT_FALSE(InlineTask::IsInline<decltype(lambda)>());
+  InlineTask task(lambda);
+  InlineTask other;
+  other = std::move(task);
+  other();
+  EXPECT_EQ(result, 7U);
+}
+
+TEST(InlineTaskTest, HoldsMoveOnlyPackagedTask) {
+  std::packaged_task<int()> packaged([]() { return 3; });
+  auto future = packaged.get_future();
+  InlineTask task(std::move(packaged));
+  task();
+  EXPECT_EQ(future.get(), 3);
+}
+
+TEST(InlineTaskTest, DestroysCapturedState) {
+  auto counter = std::make_shared<int>(0);
+  {
+    InlineTask task([counter]() { ++(*counter); });
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+}  // namespace hixl
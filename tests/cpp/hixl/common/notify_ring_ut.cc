@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "common/ctrl_msg.h"
+#include "common/notify_ring.h"
+
+namespace hixl {
+namespace {
+void PushString(NotifyRing &ring, const std::string &name, const std::string &msg, Status expect = SUCCESS) {
+  EXPECT_EQ(ring.Push(name.data(), name.size(), msg.data(), msg.size()), expect);
+}
+
+std::vector<std::pair<std::string, std::string>> Drain(NotifyRing &ring, size_t max_count = SIZE_MAX) {
+  std::vector<std::pair<std::string, std::string>> result;
+  (void)ring.Consume(
+      [&result](const NotifyView &view) {
+        result.emplace_back(std::string(view.name, view.name_len), std::string(view.notify_msg, view.notify_msg_len));
+      },
+      max_count);
+  return result;
+}
+}  // namespace
+
+TEST(NotifyRingTest, PushAndConsumeInOrder) {
+  NotifyRing ring(16U, 1024U);
+  PushString(ring, "a", "1");
+  PushString(ring, "bb", "22");
+  PushString(ring, "", "");
+  EXPECT_EQ(ring.Size(), 3U);
+  auto result = Drain(ring);
+  ASSERT_EQ(result.size(), 3U);
+  EXPECT_EQ(result[0].first, "a");
+  EXPECT_EQ(result[0].second, "1");
+  EXPECT_EQ(result[1].first, "bb");
+  EXPECT_EQ(result[1].second, "22");
+  EXPECT_TRUE(result[2].first.empty());
+  EXPECT_EQ(ring.Size(), 0U);
+  EXPECT_TRUE(Drain(ring).empty());
+}
+
+TEST(NotifyRingTest, EntryLimit) {
+  NotifyRing ring(2U, 1024U);
+  PushString(ring, "a", "1");
+  PushString(ring, "b", "2");
+  PushString(ring, "c", "3", RESOURCE_EXHAUSTED);
+  EXPECT_EQ(Drain(ring, 1U).size(), 1U);
+  PushString(ring, "c", "3");
+  auto result = Drain(ring);
+  ASSERT_EQ(result.size(), 2U);
+  EXPECT_EQ(result[0].first, "b");
+  EXPECT_EQ(result[1].first, "c");
+}
+
+TEST(NotifyRingTest, ByteLimitAndWrapAround) {
+  // 每条记录8字节头 + 4字节数据，对齐后16字节，环容量64字节可容纳4条
+  NotifyRing ring(64U, 64U);
+  for (int i = 0; i < 4; ++i) {
+    PushString(ring, "n" + std::to_string(i), "m" + std::to_string(i));
+  }
+  PushString(ring, "n4", "m4", RESOURCE_EXHAUSTED);
+  EXPECT_EQ(Drain(ring, 2U).size(), 2U);
+  // 尾部已满，新记录回绕至环首
+  PushString(ring, "n4", "m4");
+  PushString(ring, "n5", "m5");
+  PushString(ring, "n6", "m6", RESOURCE_EXHAUSTED);
+  auto result = Drain(ring);
+  ASSERT_EQ(result.size(), 4U);
+  for (size_t i = 0U; i < result.size(); ++i) {
+    EXPECT_EQ(result[i].first, "n" + std::to_string(i + 2U));
+    EXPECT_EQ(result[i].second, "m" + std::to_string(i + 2U));
+  }
+}
+
+TEST(NotifyRingTest, WrapMarkerSkipsTail) {
+  NotifyRing ring(64U, 64U);
+  PushString(ring, "aaaaaaaa", "bbbbbbbb");  // 24字节
+  PushString(ring, "cccccccc", "dddddddd");  // 24字节
+  EXPECT_EQ(Drain(ring, 1U).size(), 1U);
+  // 尾部仅剩16字节，24字节记录需跳过尾部写回环首
+  PushString(ring, "eeeeeeee", "ffffffff");
+  auto result = Drain(ring);
+  ASSERT_EQ(result.size(), 2U);
+  EXPECT_EQ(result[0].first, "cccccccc");
+  EXPECT_EQ(result[1].first, "eeeeeeee");
+  EXPECT_EQ(result[1].second, "ffffffff");
+}
+
+TEST(NotifyRingTest, RejectOversizedEntry) {
+  NotifyRing ring(4U, 1024U);
+  std::string too_long(kMaxNotifyNameLen + 1U, 'x');
+  PushString(ring, too_long, "", PARAM_INVALID);
+  PushString(ring, "name", std::string(kMaxNotifyMsgLen, 'm'), RESOURCE_EXHAUSTED);
+}
+
+TEST(NotifyRingTest, PushBatchIsAllOrNothing) {
+  NotifyRing ring(64U, 64U);
+  PushString(ring, "n0", "m0");
+  PushString(ring, "n1", "m1");
+  EXPECT_EQ(Drain(ring, 1U).size(), 1U);
+  // 剩余48字节可容纳3条，4条的批次整体拒绝，已占用位置与后续入队不受影响
+  const std::vector<NotifyView> batch{
+      {"n2", 2U, "m2", 2U}, {"n3", 2U, "m3", 2U}, {"n4", 2U, "m4", 2U}, {"n5", 2U, "m5", 2U}};
+  EXPECT_EQ(ring.PushBatch(batch.data(), batch.size()), RESOURCE_EXHAUSTED);
+  EXPECT_EQ(ring.Size(), 1U);
+  EXPECT_EQ(ring.PushBatch(batch.data(), 3U), SUCCESS);
+  auto result = Drain(ring);
+  ASSERT_EQ(result.size(), 4U);
+  for (size_t i = 0U; i < result.size(); ++i) {
+    EXPECT_EQ(result[i].first, "n" + std::to_string(i + 1U));
+    EXPECT_EQ(result[i].second, "m" + std::to_string(i + 1U));
+  }
+  const std::string too_long(kMaxNotifyNameLen + 1U, 'x');
+  const std::vector<NotifyView> invalid{{"a", 1U, "b", 1U}, {too_long.data(), too_long.size(), "", 0U}};
+  EXPECT_EQ(ring.PushBatch(invalid.data(), invalid.size()), PARAM_INVALID);
+  EXPECT_EQ(ring.Size(), 0U);
+}
+
+TEST(NotifyRingTest, ConcurrentProducers) {
+  constexpr int kThreadNum = 4;
+  constexpr int kPerThread = 500;
+  NotifyRing ring(kThreadNum * kPerThread, 1024U * 1024U);
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreadNum; ++t) {
+    producers.emplace_back([&ring, t]() {
+      for (int i = 0; i < kPerThread; ++i) {
+        PushString(ring, std::to_string(t), std::to_string(i));
+      }
+    });
+  }
+  size_t consumed = 0U;
+  while (consumed < static_cast<size_t>(kThreadNum * kPerThread)) {
+    consumed += ring.Consume([](const NotifyView &view) { EXPECT_GT(view.name_len, 0U); });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(ring.Size(), 0U);
+}
+}  // namespace hixl
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "common/notify_slot_ring.h"
+
+namespace hixl {
+namespace {
+// 模拟对端单边WRITE: 只拷贝slot的有效部分到server侧环
+void RemoteWrite(const std::vector<uint8_t> &staging, std::vector<uint8_t> &ring, uint64_t seq, size_t payload_len) {
+  const size_t offset = NotifySlotLayout::SlotOffset(seq);
+  std::copy(staging.begin() + offset, staging.begin() + offset + sizeof(NotifySlotHeader) + payload_len,
+            ring.begin() + offset);
+}
+
+std::vector<std::string> DrainNames(NotifyRing &sink) {
+  std::vector<std::string> names;
+  (void)sink.Consume([&names](const NotifyView &view) { names.emplace_back(view.name, view.name_len); });
+  return names;
+}
+
+uint64_t ReadConsumed(const std::vector<uint8_t> &ring) {
+  NotifySlotCtrl ctrl{};
+  std::copy(ring.begin(), ring.begin() + sizeof(ctrl), reinterpret_cast<uint8_t *>(&ctrl));
+  return ctrl.consumed;
+}
+}  // namespace
+
+TEST(NotifySlotRingTest, EncodeDecodeRoundTrip) {
+  std::vector<uint8_t> ring(NotifySlotLayout::RingSize());
+  const std::string name = "kv_ready";
+  const std::string msg = "layer_3";
+  ASSERT_EQ(NotifySlotLayout::Encode(ring.data(), 1U, name.data(), name.size(), msg.data(), msg.size()), SUCCESS);
+  NotifyView view{};
+  ASSERT_TRUE(NotifySlotLayout::Decode(ring.data(), 1U, view));
+  EXPECT_EQ(std::string(view.name, view.name_len), name);
+  EXPECT_EQ(std::string(view.notify_msg, view.notify_msg_len), msg);
+  EXPECT_FALSE(NotifySlotLayout::Decode(ring.data(), 1U + kNotifySlotsPerPeer, view));
+  EXPECT_EQ(NotifySlotLayout::Encode(ring.data(), 0U, name.data(), name.size(), msg.data(), msg.size()),
+            PARAM_INVALID);
+  std::string too_long(kMaxNotifyNameLen + 1U, 'x');
+  EXPECT_EQ(NotifySlotLayout::Encode(ring.data(), 2U, too_long.data(), too_long.size(), nullptr, 0U), PARAM_INVALID);
+}
+
+TEST(NotifySlotRingTest, PollWaitsForCompleteSlotInSeqOrder) {
+  std::vector<uint8_t> staging(NotifySlotLayout::RingSize());
+  std::vector<uint8_t> ring(NotifySlotLayout::RingSize());
+  NotifySlotRing slot_ring;
+  slot_ring.Reset(ring.data());
+  NotifyRing sink(kMaxNotifyQueueSize, kNotifyRingCapacity);
+  ASSERT_EQ(NotifySlotLayout::Encode(staging.data(), 1U, "a", 1U, "1", 1U), SUCCESS);
+  ASSERT_EQ(NotifySlotLayout::Encode(staging.data(), 2U, "b", 1U, "2", 1U), SUCCESS);
+  // seq 2先到达时不能越过seq 1
+  RemoteWrite(staging, ring, 2U, 2U);
+  EXPECT_EQ(slot_ring.Poll(sink), 0U);
+  // seq 1头部已到而载荷未完整，校验和不匹配
+  RemoteWrite(staging, ring, 1U, 0U);
+  EXPECT_EQ(slot_ring.Poll(sink), 0U);
+  RemoteWrite(staging, ring, 1U, 2U);
+  EXPECT_EQ(slot_ring.Poll(sink), 2U);
+  EXPECT_EQ(ReadConsumed(ring), 2U);
+  EXPECT_EQ(DrainNames(sink), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(NotifySlotRingTest, WrapAroundReusesSlots) {
+  std::vector<uint8_t> staging(NotifySlotLayout::RingSize());
+  std::vector<uint8_t> ring(NotifySlotLayout::RingSize());
+  NotifySlotRing slot_ring;
+  slot_ring.Reset(ring.data());
+  NotifyRing sink(kMaxNotifyQueueSize, kNotifyRingCapacity);
+  const uint64_t total = kNotifySlotsPerPeer * 3U + 5U;
+  uint64_t polled = 0U;
+  for (uint64_t seq = 1U; seq <= total; ++seq) {
+    const std::string name = std::to_string(seq);
+    ASSERT_EQ(NotifySlotLayout::Encode(staging.data(), seq, name.data(), name.size(), nullptr, 0U), SUCCESS);
+    RemoteWrite(staging, ring, seq, name.size());
+    if (seq % kNotifySlotsPerPeer == 0U) {
+      polled += slot_ring.Poll(sink);
+      EXPECT_EQ(ReadConsumed(ring), seq);
+      (void)DrainNames(sink);
+    }
+  }
+  polled += slot_ring.Poll(sink);
+  EXPECT_EQ(polled, total);
+  EXPECT_EQ(slot_ring.Consumed(), total);
+  const auto names = DrainNames(sink);
+  ASSERT_EQ(names.size(), 5U);
+  EXPECT_EQ(names.back(), std::to_string(total));
+}
+
+TEST(NotifySlotRingTest, StopsWhenSinkIsFull) {
+  std::vector<uint8_t> staging(NotifySlotLayout::RingSize());
+  std::vector<uint8_t> ring(NotifySlotLayout::RingSize());
+  NotifySlotRing slot_ring;
+  slot_ring.Reset(ring.data());
+  NotifyRing sink(2U, kNotifyRingCapacity);
+  for (uint64_t seq = 1U; seq <= 3U; ++seq) {
+    ASSERT_EQ(NotifySlotLayout::Encode(staging.data(), seq, "n", 1U, "m", 1U), SUCCESS);
+    RemoteWrite(staging, ring, seq, 2U);
+  }
+  EXPECT_EQ(slot_ring.Poll(sink), 2U);
+  EXPECT_EQ(ReadConsumed(ring), 2U);
+  (void)DrainNames(sink);
+  EXPECT_EQ(slot_ring.Poll(sink), 1U);
+  EXPECT_EQ(ReadConsumed(ring), 3U);
+}
+
+TEST(NotifySlotRingTest, ResyncDropsPartialSlotsAndKeepsConsumed) {
+  std::vector<uint8_t> staging(NotifySlotLayout::RingSize());
+  std::vector<uint8_t> ring(NotifySlotLayout::RingSize());
+  NotifySlotRing slot_ring;
+  slot_ring.Reset(ring.data());
+  NotifyRing sink(kMaxNotifyQueueSize, kNotifyRingCapacity);
+  for (uint64_t seq = 1U; seq <= 3U; ++seq) {
+    ASSERT_EQ(NotifySlotLayout::Encode(staging.data(), seq, "n", 1U, "m", 1U), SUCCESS);
+  }
+  // 一次写入失败: seq 1完整到达，seq 2缺失，seq 3完整到达
+  RemoteWrite(staging, ring, 1U, 2U);
+  RemoteWrite(staging, ring, 3U, 2U);
+  EXPECT_EQ(slot_ring.Poll(sink), 1U);
+  slot_ring.Resync();
+  EXPECT_EQ(slot_ring.Consumed(), 1U);
+  EXPECT_EQ(ReadConsumed(ring), 1U);
+  // 重新对齐后client从seq 2重写，旧的seq 3不会被误消费
+  ASSERT_EQ(NotifySlotLayout::Encode(staging.data(), 2U, "r", 1U, "2", 1U), SUCCESS);
+  RemoteWrite(staging, ring, 2U, 2U);
+  EXPECT_EQ(slot_ring.Poll(sink), 1U);
+  EXPECT_EQ(DrainNames(sink), (std::vector<std::string>{"n", "r"}));
+}
+}  // namespace hixl
@@ -83,6 +83,22 @@ TEST_F(ThreadPoolTest, TasksExecutedSuccessfully) {
   EXPECT_EQ(counter.load(), task_count);
 }
 
+TEST_F(ThreadPoolTest, CommitFromTaskDoesNotBlockWhenQueueFull) {
+  ThreadPool pool("test_full", 1U, 1U, 2U);
+  std::atomic<uint32_t> counter{0};
+  const uint32_t task_count = 16U;
+  // 唯一的工作线程在任务内提交超过队列容量的子任务，提交不阻塞，所有子任务最终执行
+  auto fut = pool.commit([&]() {
+    for (uint32_t i = 0; i < task_count; ++i) {
+      EXPECT_TRUE(pool.commit([&]() { counter.fetch_add(1); }).valid());
+    }
+  });
+  ASSERT_TRUE(fut.valid());
+  EXPECT_EQ(fut.wait_for(std::chrono::milliseconds(kTestTimeoutMs)), std::future_status::ready);
+  WaitForTasks(counter, task_count);
+  EXPECT_EQ(counter.load(), task_count);
+}
+
 TEST_F(ThreadPoolTest, ScaleUpWhenAllCoreThreadsBusy) {
   ThreadPool pool("test_scale", 2U, 4U);
   BlockingTaskContext ctx;
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "common/transfer_telemetry.h"
+
+namespace hixl {
+namespace {
+constexpr uint64_t kBaseMs = 1000000U;
+}  // namespace
+
+TEST(TransferTelemetryTest, UnknownPeerIsEmpty) {
+  TransferTelemetry telemetry;
+  const auto statistics = telemetry.Query("peer", kBaseMs);
+  EXPECT_EQ(statistics.window_ms, TransferTelemetry::kSlotMillis * TransferTelemetry::kWindowSlots);
+  EXPECT_EQ(statistics.read.total_ops, 0U);
+  EXPECT_EQ(statistics.write.total_ops, 0U);
+  EXPECT_EQ(statistics.read.p99_latency_us, 0U);
+}
+
+TEST(TransferTelemetryTest, SeparatesPeersAndDirections) {
+  TransferTelemetry telemetry;
+  telemetry.Record("a", READ, 100U, 10U, kBaseMs);
+  telemetry.Record("a", WRITE, 200U, 20U, kBaseMs);
+  telemetry.Record("b", WRITE, 300U, 30U, kBaseMs);
+  const auto a = telemetry.Query("a", kBaseMs + 999U);
+  EXPECT_EQ(a.read.total_bytes, 100U);
+  EXPECT_EQ(a.read.total_ops, 1U);
+  EXPECT_EQ(a.write.total_bytes, 200U);
+  const auto b = telemetry.Query("b", kBaseMs + 999U);
+  EXPECT_EQ(b.read.total_ops, 0U);
+  EXPECT_EQ(b.write.total_bytes, 300U);
+  // 远端首次传输后仅1s，按实际时长计算速率
+  EXPECT_DOUBLE_EQ(b.write.bytes_per_second, 300.0);
+  EXPECT_DOUBLE_EQ(b.write.ops_per_second, 1.0);
+}
+
+TEST(TransferTelemetryTest, LatencyQuantilesUseBucketUpperBound) {
+  TransferTelemetry telemetry;
+  for (uint64_t i = 0U; i < 98U; ++i) {
+    telemetry.Record("peer", READ, 1U, 5U, kBaseMs);
+  }
+  telemetry.Record("peer", READ, 1U, 100U, kBaseMs);
+  telemetry.Record("peer", READ, 1U, 3000U, kBaseMs);
+  const auto statistics = telemetry.Query("peer", kBaseMs);
+  EXPECT_EQ(statistics.read.total_ops, 100U);
+  // 5us落在[4, 7]桶，100us落在[64, 127]桶，3000us落在[2048, 4095]桶并以最大值截断
+  EXPECT_EQ(statistics.read.p50_latency_us, 7U);
+  EXPECT_EQ(statistics.read.p90_latency_us, 7U);
+  EXPECT_EQ(statistics.read.p99_latency_us, 3000U);
+  EXPECT_EQ(statistics.read.max_latency_us, 3000U);
+}
+
+TEST(TransferTelemetryTest, OldSlotsSlideOutOfWindow) {
+  TransferTelemetry telemetry;
+  const uint64_t window_ms = TransferTelemetry::kSlotMillis * TransferTelemetry::kWindowSlots;
+  telemetry.Record("peer", WRITE, 1000U, 1U, kBaseMs);
+  telemetry.Record("peer", WRITE, 10U, 1U, kBaseMs + window_ms - 1U);
+  auto statistics = telemetry.Query("peer", kBaseMs + window_ms - 1U);
+  EXPECT_EQ(statistics.write.total_bytes, 1010U);
+  statistics = telemetry.Query("peer", kBaseMs + window_ms);
+  EXPECT_EQ(statistics.write.total_bytes, 10U);
+  // 同一槽位进入新时间片时清零旧计数
+  telemetry.Record("peer", WRITE, 7U, 1U, kBaseMs + window_ms);
+  statistics = telemetry.Query("peer", kBaseMs + window_ms);
+  EXPECT_EQ(statistics.write.total_bytes, 17U);
+  EXPECT_EQ(statistics.write.total_ops, 2U);
+}
+
+TEST(TransferTelemetryTest, MergesShardsWhenThreadsOutnumberShards) {
+  TransferTelemetry telemetry;
+  constexpr uint64_t kThreadNum = TransferTelemetry::kShardNum * 2U;
+  constexpr uint64_t kRecordsPerThread = 1000U;
+  std::vector<std::thread> threads;
+  for (uint64_t t = 0U; t < kThreadNum; ++t) {
+    threads.emplace_back([&telemetry]() {
+      for (uint64_t i = 0U; i < kRecordsPerThread; ++i) {
+        telemetry.Record("peer", READ, 8U, 1U, kBaseMs);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  const auto statistics = telemetry.Query("peer", kBaseMs);
+  EXPECT_EQ(statistics.read.total_ops, kThreadNum * kRecordsPerThread);
+  EXPECT_EQ(statistics.read.total_bytes, kThreadNum * kRecordsPerThread * 8U);
+}
+
+TEST(TransferTelemetryTest, RecordsThroughCachedPeer) {
+  TransferTelemetry telemetry;
+  auto peer = telemetry.GetPeer("peer");
+  ASSERT_NE(peer, nullptr);
+  EXPECT_EQ(telemetry.GetPeer("peer"), peer);
+  TransferTelemetry::Record(*peer, WRITE, 100U, 10U, kBaseMs);
+  telemetry.Record("peer", WRITE, 50U, 20U, kBaseMs);
+  const auto statistics = telemetry.Query("peer", kBaseMs);
+  EXPECT_EQ(statistics.write.total_ops, 2U);
+  EXPECT_EQ(statistics.write.total_bytes, 150U);
+  EXPECT_EQ(statistics.write.max_latency_us, 20U);
+}
+
+TEST(TransferTelemetryTest, RemovedPeerIsDetachedFromCachedHolders) {
+  TransferTelemetry telemetry;
+  auto stale = telemetry.GetPeer("peer");
+  telemetry.Remove("peer");
+  EXPECT_TRUE(stale->removed.load());
+  // 断链前缓存的远端计数写入的数据不计入重新建链后的统计
+  TransferTelemetry::Record(*stale, READ, 100U, 1U, kBaseMs);
+  auto fresh = telemetry.GetPeer("peer");
+  EXPECT_NE(fresh, stale);
+  TransferTelemetry::Record(*fresh, READ, 10U, 1U, kBaseMs);
+  const auto statistics = telemetry.Query("peer", kBaseMs);
+  EXPECT_EQ(statistics.read.total_ops, 1U);
+  EXPECT_EQ(statistics.read.total_bytes, 10U);
+}
+
+TEST(TransferTelemetryTest, RemoveDropsPeerAndReRegisters) {
+  TransferTelemetry telemetry;
+  telemetry.Record("peer", READ, 100U, 1U, kBaseMs);
+  telemetry.Remove("peer");
+  EXPECT_EQ(telemetry.Query("peer", kBaseMs).read.total_ops, 0U);
+  telemetry.Record("peer", READ, 50U, 1U, kBaseMs);
+  const auto statistics = telemetry.Query("peer", kBaseMs);
+  EXPECT_EQ(statistics.read.total_ops, 1U);
+  EXPECT_EQ(statistics.read.total_bytes, 50U);
+}
+}  // namespace hixl
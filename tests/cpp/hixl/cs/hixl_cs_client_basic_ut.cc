@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <arpa/inet.h>
@@ -74,6 +75,7 @@ constexpr const char *kTransFlagNameHost = "_hixl_builtin_host_trans_flag";
 constexpr const char *kTransFlagNameDevice = "_hixl_builtin_dev_trans_flag";
 uint32_t kClientBufAddr = 1;
 uint32_t kServerDataAddr = 2;
+uint32_t kPushedDataAddr = 3;
 uint64_t kTransFlagAddr = 1;
 struct ImportedRemote {
   CommMem *remote_mem_list = nullptr;
@@ -174,6 +176,104 @@ TEST_F(HixlCSClientFixture, ImportRemoteMemAndClearRemoteMemInfo) {
   EXPECT_EQ(cli.ClearRemoteMemInfo(), SUCCESS);
 }
 
+static uint64_t AddrOf(const void *addr) {
+  return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(addr));
+}
+
+static bool InMemDir(const hixl::HixlCSClient &cli, const void *addr) {
+  return std::any_of(cli.desc_list_.cbegin(), cli.desc_list_.cend(),
+                     [addr](const HixlMemDesc &desc) { return desc.mem.addr == addr; });
+}
+
+TEST_F(HixlCSClientFixture, ApplyMemDirUpdateRemovesThenAddsMem) {
+  PrepareConnectionAndImport(cli, "127.0.0.1", 22335);
+  cli.mem_dir_version_ = 1UL;
+  MemDirUpdate update{};
+  update.version = 2UL;
+  update.added.push_back(MakeRemoteDesc("pushed", &kPushedDataAddr, kBlockSizeBytes));
+  update.removed.push_back(AddrOf(&kServerDataAddr));
+  EXPECT_EQ(cli.ApplyMemDirUpdate(update), SUCCESS);
+  // 导入成功后export_desc所有权转移到本地目录
+  EXPECT_EQ(update.added[0].export_desc, nullptr);
+  EXPECT_EQ(cli.mem_dir_version_.value(), 2UL);
+  EXPECT_FALSE(InMemDir(cli, &kServerDataAddr));
+  EXPECT_TRUE(InMemDir(cli, &kPushedDataAddr));
+  EXPECT_EQ(cli.mem_store_.server_regions_.count(&kServerDataAddr), 0U);
+  EXPECT_EQ(cli.mem_store_.server_regions_[&kPushedDataAddr].size, kBlockSizeBytes);
+  EXPECT_EQ(cli.tag_mem_descs_.count("server_data"), 0U);
+  EXPECT_EQ(cli.tag_mem_descs_["pushed"].addr, &kPushedDataAddr);
+  EXPECT_EQ(cli.imported_remote_bufs_.size(), cli.desc_list_.size());
+}
+
+TEST_F(HixlCSClientFixture, ApplyMemDirUpdateRemovesMemOnVersionGap) {
+  PrepareConnectionAndImport(cli, "127.0.0.1", 22336);
+  cli.mem_dir_version_ = 1UL;
+  MemDirUpdate update{};
+  update.version = 3UL;
+  update.added.push_back(MakeRemoteDesc("pushed", &kPushedDataAddr, kBlockSizeBytes));
+  update.removed.push_back(AddrOf(&kServerDataAddr));
+  // 版本缺失时仍先屏蔽注销的内存，新增内存等待全量目录
+  EXPECT_EQ(cli.ApplyMemDirUpdate(update), FAILED);
+  EXPECT_EQ(cli.mem_dir_version_.value(), 1UL);
+  EXPECT_FALSE(InMemDir(cli, &kServerDataAddr));
+  EXPECT_FALSE(InMemDir(cli, &kPushedDataAddr));
+  EXPECT_EQ(cli.mem_store_.server_regions_.count(&kServerDataAddr), 0U);
+  std::free(update.added[0].export_desc);
+}
+
+TEST_F(HixlCSClientFixture, ApplyMemDirUpdateRemovesMemWhileResyncing) {
+  PrepareConnectionAndImport(cli, "127.0.0.1", 22337);
+  cli.mem_dir_version_ = 1UL;
+  cli.mem_dir_resyncing_ = true;
+  MemDirUpdate update{};
+  update.version = 2UL;
+  update.removed.push_back(AddrOf(&kServerDataAddr));
+  EXPECT_EQ(cli.ApplyMemDirUpdate(update), SUCCESS);
+  EXPECT_EQ(cli.mem_dir_version_.value(), 1UL);
+  EXPECT_FALSE(InMemDir(cli, &kServerDataAddr));
+  EXPECT_TRUE(cli.mem_dir_resyncing_);
+}
+
+TEST_F(HixlCSClientFixture, ResetRemoteMemDirKeepsUnchangedMemAndDropsStale) {
+  PrepareConnectionAndImport(cli, "127.0.0.1", 22338);
+  cli.mem_dir_version_ = 1UL;
+  cli.mem_dir_resyncing_ = true;
+  MemDirUpdate update{};
+  update.version = 5UL;
+  update.reset = true;
+  update.added.push_back(MakeRemoteDesc(kTransFlagNameDevice, &kTransFlagAddr, kFlagSizeBytes));
+  // 地址相同但大小变化的内存按失效处理，重新导入
+  update.added.push_back(MakeRemoteDesc("server_data", &kServerDataAddr, kBlockSizeBytes * 2U));
+  update.added.push_back(MakeRemoteDesc("pushed", &kPushedDataAddr, kBlockSizeBytes));
+  EXPECT_EQ(cli.ApplyMemDirUpdate(update), SUCCESS);
+  EXPECT_FALSE(cli.mem_dir_resyncing_);
+  EXPECT_EQ(cli.mem_dir_version_.value(), 5UL);
+  ASSERT_EQ(cli.desc_list_.size(), 3U);
+  // 未变化的内存保持原导入，不会重复导入
+  EXPECT_NE(update.added[0].export_desc, nullptr);
+  EXPECT_EQ(update.added[1].export_desc, nullptr);
+  EXPECT_EQ(update.added[2].export_desc, nullptr);
+  EXPECT_EQ(cli.mem_store_.server_regions_[&kServerDataAddr].size, kBlockSizeBytes * 2U);
+  EXPECT_TRUE(InMemDir(cli, &kPushedDataAddr));
+  std::free(update.added[0].export_desc);
+}
+
+TEST_F(HixlCSClientFixture, RemoveRemoteMemDescIgnoresUnknownAddr) {
+  PrepareConnectionAndImport(cli, "127.0.0.1", 22339);
+  const size_t mem_num = cli.desc_list_.size();
+  cli.RemoveRemoteMemDesc(AddrOf(&kPushedDataAddr));
+  EXPECT_EQ(cli.desc_list_.size(), mem_num);
+  EXPECT_EQ(cli.recorded_remote_addrs_.size(), mem_num);
+
+  cli.RemoveRemoteMemDesc(AddrOf(&kServerDataAddr));
+  EXPECT_EQ(cli.desc_list_.size(), mem_num - 1U);
+  EXPECT_EQ(cli.recorded_remote_addrs_.size(), mem_num - 1U);
+  EXPECT_EQ(cli.imported_remote_bufs_.size(), mem_num - 1U);
+  EXPECT_EQ(cli.tag_mem_descs_.count("server_data"), 0U);
+  // 已移除的内存不再允许访问
+  EXPECT_FALSE(cli.mem_store_.CheckMemoryForAccess(true, &kServerDataAddr, kBlockSizeBytes));
+}
+
 TEST_F(HixlCSClientFixture, BatchPutSuccessWithStubbedHccl) {
   const char *client_ip = "127.0.0.1";
   uint32_t port = 22335;
@@ -262,6 +362,25 @@ TEST_F(HixlCSClientFixture, BatchPutSyncSuccess) {
   EXPECT_EQ(cli.BatchTransferSync(false, 1, descs, 5000U), SUCCESS);
 }
 
+// Host同步等待超时只放弃本次请求，不锁存失败，句柄在任务结束后回收
+TEST_F(HixlCSClientFixture, BatchPutSyncTimeoutKeepsClientUsable) {
+  const char *client_ip = "127.0.0.1";
+  uint32_t port = 22346;
+  PrepareConnectionAndImport(cli, client_ip, port);
+  RecordLocalMem(cli);
+  HixlOneSideOpDesc descs[] = {{&kServerDataAddr, static_cast<void *>(&kClientBufAddr), 4}};
+
+  kTransFlagAddr = 0U;  // 远端完成标志未置位，同步等待超时
+  EXPECT_EQ(cli.BatchTransferSync(false, 1, descs, 10U), TIMEOUT);
+  kTransFlagAddr = 1U;
+  EXPECT_FALSE(cli.transfer_failure_latched_);
+  ASSERT_EQ(cli.released_handles_.size(), 1U);
+
+  *static_cast<CompleteHandleInfo *>(cli.released_handles_.front())->flag_address = 1U;
+  EXPECT_EQ(cli.BatchTransferSync(false, 1, descs, 5000U), SUCCESS);
+  EXPECT_TRUE(cli.released_handles_.empty());
+}
+
 // 覆盖 C 封装 HixlCSClientBatchPutSync（与 BatchTransferSync Put 路径一致）
 TEST_F(HixlCSClientFixture, CsApiBatchPutSyncSuccess) {
   const char *client_ip = "127.0.0.1";
@@ -364,6 +483,37 @@ TEST_F(HixlCSClientFixture, ReleaseCompleteHandleTest) {
   EXPECT_TRUE(st == SUCCESS || status_out == HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING);
 }
 
+// 交还仍在途的句柄时标志位暂不回收，待任务结束后的下一次下发中回收
+TEST_F(HixlCSClientFixture, ReleaseHandleDefersFlagUntilTransferEnds) {
+  const char *client_ip = "127.0.0.1";
+  uint32_t port = 22345;
+  PrepareConnectionAndImport(cli, client_ip, port);
+  RecordLocalMem(cli);
+
+  void *query_handle = nullptr;
+  HixlOneSideOpDesc descs[] = {{&kServerDataAddr, static_cast<void *>(&kClientBufAddr), 4}};
+  ASSERT_EQ(cli.BatchTransferAsync(false, 1, descs, &query_handle), SUCCESS);
+  ASSERT_NE(query_handle, nullptr);
+  auto *handle = static_cast<CompleteHandleInfo *>(query_handle);
+  const int32_t flag_index = handle->flag_index;
+  const size_t top_index = cli.top_index_;
+  *handle->flag_address = 0U;  // 模拟完成标志尚未回写
+
+  EXPECT_EQ(cli.ReleaseHandle(query_handle), SUCCESS);
+  EXPECT_EQ(cli.released_handles_.size(), 1U);
+  EXPECT_EQ(cli.live_handles_[flag_index], handle);
+  EXPECT_EQ(cli.top_index_, top_index);
+
+  *handle->flag_address = 1U;
+  void *next_handle = nullptr;
+  ASSERT_EQ(cli.BatchTransferAsync(false, 1, descs, &next_handle), SUCCESS);
+  EXPECT_TRUE(cli.released_handles_.empty());
+  EXPECT_EQ(cli.top_index_, top_index);
+  HixlCompleteStatus status_out = HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING;
+  EXPECT_EQ(cli.CheckStatus(next_handle, &status_out), SUCCESS);
+  EXPECT_EQ(status_out, HixlCompleteStatus::HIXL_COMPLETE_STATUS_COMPLETED);
+}
+
 // 测试多次 BatchTransfer 后 CheckStatus 释放 handle
 TEST_F(HixlCSClientFixture, MultipleBatchTransferAndCheckStatus) {
   const char *client_ip = "127.0.0.1";
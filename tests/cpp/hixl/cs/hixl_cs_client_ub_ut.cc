@@ -397,6 +397,48 @@ TEST_F(HixlCSClientDeviceFixture, BatchPutDeviceNotifyWaitMultipleIntervals) {
   ExpectAsyncNotifyWaitCount(kNotifyWaitTaskInterval * 2U, 2U);
 }
 
+// 超长描述符按desc_chunk_size_拆分，未等待远端完成的字节数达到窗口时插入notify wait，并可按窗口查询进度
+TEST_F(HixlCSClientDeviceFixture, BatchPutDeviceSplitsOversizedDescAndReportsProgress) {
+  setenv("HIXL_UT_DEVICE_FLAG_HACK", "1", 1);
+  cli_.desc_chunk_size_ = 2U;  // 每个8字节描述符拆为4块，窗口为16字节
+  constexpr uint32_t kListNum = 4U;
+  std::vector<HixlOneSideOpDesc> descs = SetupBatchTransferList(kListNum);
+
+  MockAclRuntimeStub mock_acl;
+  llm::AclRuntimeStub::Install(&mock_acl);
+  EXPECT_CALL(mock_acl, aclrtWaitAndResetNotify(testing::_, testing::_, testing::_))
+      .Times(2)
+      .WillRepeatedly(testing::Return(ACL_SUCCESS));
+  EXPECT_CALL(mock_acl, aclrtMemcpyAsync(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_))
+      .WillRepeatedly(testing::Return(ACL_SUCCESS));
+  void *qh = nullptr;
+  const Status ret = cli_.BatchTransferAsync(false, kListNum, descs.data(), &qh);
+  llm::AclRuntimeStub::UnInstall(&mock_acl);
+  ASSERT_EQ(ret, SUCCESS);
+  ASSERT_NE(qh, nullptr);
+
+  auto *handle = static_cast<DeviceCompleteHandle *>(qh);
+  const std::vector<uint64_t> expected_progress{16U};
+  ASSERT_EQ(handle->progress_bytes, expected_progress);
+  ASSERT_NE(handle->progress_flags, nullptr);
+  uint64_t completed = 0U;
+  uint64_t total = 0U;
+  EXPECT_EQ(cli_.QueryProgress(qh, &completed, &total), SUCCESS);
+  EXPECT_EQ(completed, 0U);
+  EXPECT_EQ(total, kListNum * kLen8);
+
+  handle->progress_flags[0] = kDeviceFlagDoneValueForTest;
+  EXPECT_EQ(cli_.QueryProgress(qh, &completed, &total), SUCCESS);
+  EXPECT_EQ(completed, 16U);
+
+  *(static_cast<uint64_t *>(handle->host_flag)) = kDeviceFlagDoneValueForTest;
+  EXPECT_EQ(cli_.QueryProgress(qh, &completed, &total), SUCCESS);
+  EXPECT_EQ(completed, kListNum * kLen8);
+  HixlCompleteStatus st = HixlCompleteStatus::HIXL_COMPLETE_STATUS_WAITING;
+  EXPECT_EQ(cli_.CheckStatus(qh, &st), SUCCESS);
+  EXPECT_EQ(st, HixlCompleteStatus::HIXL_COMPLETE_STATUS_COMPLETED);
+}
+
 TEST_F(HixlCSClientDeviceFixture, BatchPutDeviceSlotReuse) {
   // With slot reuse mechanism, multiple concurrent transfers share the same slot
   // This test verifies that slot reuse works correctly
@@ -1545,6 +1545,25 @@ TEST_F(HixlCSClientUT, ParseConfigMaxActiveChannelsInvalid) {
   }
 }
 
+TEST_F(HixlCSClientUT, ParseConfigDescChunkSize) {
+  port_ = kPort;
+  HixlClientDesc desc{};
+  desc.server_ip = "127.0.0.1";
+  desc.server_port = port_;
+  desc.local_endpoint = &src_;
+  desc.remote_endpoint = &dst_;
+  HixlClientConfig config{};
+  config.global_resource_config = R"({"comm_resource_config.desc_chunk_size":1048576})";
+  EXPECT_EQ(client_.Create(&desc, &config), SUCCESS);
+  EXPECT_EQ(client_.desc_chunk_size_, 1048576U);
+  client_.Destroy();
+
+  config.global_resource_config = R"({"comm_resource_config.desc_chunk_size":1024})";
+  HixlClientHandle handle = reinterpret_cast<HixlClientHandle>(&client_);
+  EXPECT_EQ(HixlCSClientCreate(&desc, &config, &handle), HIXL_PARAM_INVALID);
+  EXPECT_EQ(handle, nullptr);
+}
+
 TEST_F(HixlCSClientUT, CreateFailServerPortZero) {
   HixlClientConfig config{};
   HixlClientDesc desc{};
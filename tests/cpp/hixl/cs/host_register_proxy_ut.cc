@@ -10,6 +10,8 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <vector>
+#include "ascendcl_stub.h"
 #include "host_register_proxy.h"
 #include "hixl/hixl_types.h"
 
@@ -25,11 +27,33 @@ int32_t GetUniqueDevPhyId() {
   return dev_id++;
 }
 
+class CountingHostRegisterStub : public llm::AclRuntimeStub {
+ public:
+  aclError aclrtHostRegister(void *ptr, uint64_t size, aclrtHostRegisterType type, void **devPtr) override {
+    registered_sizes_.emplace_back(size);
+    return llm::AclRuntimeStub::aclrtHostRegister(ptr, size, type, devPtr);
+  }
+
+  aclError aclrtHostUnregister(void *ptr) override {
+    unregistered_addrs_.emplace_back(ptr);
+    return llm::AclRuntimeStub::aclrtHostUnregister(ptr);
+  }
+
+  std::vector<uint64_t> registered_sizes_;
+  std::vector<void *> unregistered_addrs_;
+};
+
+// 模拟两个engine的endpoint作为缓存owner
+const int kOwnerA = 1;
+const int kOwnerB = 2;
+
 }  // namespace
 
 class HostRegisterProxyTest : public ::testing::Test {
  protected:
-  void TearDown() override {}
+  void TearDown() override {
+    llm::AclRuntimeStub::Reset();
+  }
 };
 
 // 测试成功注册 host 内存
@@ -274,4 +298,172 @@ TEST_F(HostRegisterProxyTest, RefCntOverUnregister) {
   EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, host_addr), SUCCESS);
 }
 
+// ========== 区间缓存相关测试 ==========
+
+// 测试已注册区间内的子区间直接复用，返回偏移后的 device 地址
+TEST_F(HostRegisterProxyTest, SubRangeServedByRegisteredRegion) {
+  auto acl_stub = std::make_shared<CountingHostRegisterStub>();
+  llm::AclRuntimeStub::SetInstance(acl_stub);
+  const int32_t dev_phy_id = GetUniqueDevPhyId();
+  std::vector<uint8_t> buffer(4 * kTestMemSize);
+  void *device_addr = nullptr;
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, buffer.data(), buffer.size(), device_addr), SUCCESS);
+
+  void *sub_device_addr = nullptr;
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, buffer.data() + kTestMemSize, kTestMemSize, sub_device_addr),
+            SUCCESS);
+  EXPECT_EQ(sub_device_addr, static_cast<uint8_t *>(device_addr) + kTestMemSize);
+  EXPECT_EQ(acl_stub->registered_sizes_.size(), 1U);
+
+  void *retrieved_dev_addr = nullptr;
+  EXPECT_EQ(HostRegisterProxy::GetRegisteredDeviceAddrByDev(dev_phy_id, buffer.data() + 100, retrieved_dev_addr),
+            SUCCESS);
+  EXPECT_EQ(retrieved_dev_addr, static_cast<uint8_t *>(device_addr) + 100);
+
+  // 整段注销后，子区间仍持有引用，区间不释放
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, buffer.data()), SUCCESS);
+  EXPECT_TRUE(acl_stub->unregistered_addrs_.empty());
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, buffer.data() + kTestMemSize), SUCCESS);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[0], buffer.data());
+}
+
+// 测试开启空闲缓存后，重复注册/注销不再调用 aclrtHostRegister/aclrtHostUnregister
+TEST_F(HostRegisterProxyTest, IdleCacheDefersUnregister) {
+  auto acl_stub = std::make_shared<CountingHostRegisterStub>();
+  llm::AclRuntimeStub::SetInstance(acl_stub);
+  const HostRegisterCachePolicy policy{&kOwnerA, 4 * kTestMemSize};
+  const int32_t dev_phy_id = GetUniqueDevPhyId();
+  std::vector<uint8_t> buffer(kTestMemSize);
+  void *device_addr = nullptr;
+  constexpr int kCycleCount = 3;
+  for (int i = 0; i < kCycleCount; ++i) {
+    ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, buffer.data(), buffer.size(), device_addr), SUCCESS);
+    EXPECT_EQ(device_addr, buffer.data());
+    EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, buffer.data(), policy), SUCCESS);
+  }
+  EXPECT_EQ(acl_stub->registered_sizes_.size(), 1U);
+  EXPECT_TRUE(acl_stub->unregistered_addrs_.empty());
+
+  // 空闲区间对调用方而言已注销
+  void *retrieved_dev_addr = nullptr;
+  EXPECT_NE(HostRegisterProxy::GetRegisteredDeviceAddrByDev(dev_phy_id, buffer.data(), retrieved_dev_addr), SUCCESS);
+
+  // owner释放缓存后立即注销
+  HostRegisterProxy::ReleaseIdleCacheByDev(dev_phy_id, &kOwnerA);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[0], buffer.data());
+}
+
+// 测试注册与空闲区间相邻的内存时合并为一次注册
+TEST_F(HostRegisterProxyTest, IdleCacheMergesAdjacentRegions) {
+  auto acl_stub = std::make_shared<CountingHostRegisterStub>();
+  llm::AclRuntimeStub::SetInstance(acl_stub);
+  const HostRegisterCachePolicy policy{&kOwnerA, 4 * kTestMemSize};
+  const int32_t dev_phy_id = GetUniqueDevPhyId();
+  std::vector<uint8_t> buffer(2 * kTestMemSize);
+  void *first = buffer.data();
+  void *second = buffer.data() + kTestMemSize;
+  void *device_addr = nullptr;
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, first, kTestMemSize, device_addr), SUCCESS);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, first, policy), SUCCESS);
+
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, second, kTestMemSize, device_addr), SUCCESS);
+  EXPECT_EQ(device_addr, second);
+  ASSERT_EQ(acl_stub->registered_sizes_.size(), 2U);
+  EXPECT_EQ(acl_stub->registered_sizes_[1], 2 * kTestMemSize);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+
+  // 合并后的区间覆盖第一段，再次注册无需调用 aclrtHostRegister
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, first, kTestMemSize, device_addr), SUCCESS);
+  EXPECT_EQ(device_addr, first);
+  EXPECT_EQ(acl_stub->registered_sizes_.size(), 2U);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, first, policy), SUCCESS);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, second, policy), SUCCESS);
+  EXPECT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+  HostRegisterProxy::ReleaseIdleCacheByDev(dev_phy_id, &kOwnerA);
+  EXPECT_EQ(acl_stub->unregistered_addrs_.size(), 2U);
+}
+
+// 测试空闲区间超出容量时按 LRU 淘汰最久未使用的区间
+TEST_F(HostRegisterProxyTest, IdleCacheEvictsLeastRecentlyUsed) {
+  auto acl_stub = std::make_shared<CountingHostRegisterStub>();
+  llm::AclRuntimeStub::SetInstance(acl_stub);
+  const HostRegisterCachePolicy policy{&kOwnerA, 2 * kTestMemSize};
+  const int32_t dev_phy_id = GetUniqueDevPhyId();
+  // 各段之间留空隙，避免相邻合并
+  std::vector<uint8_t> buffer(6 * kTestMemSize);
+  void *addrs[] = {buffer.data(), buffer.data() + 2 * kTestMemSize, buffer.data() + 4 * kTestMemSize};
+  void *device_addr = nullptr;
+  for (void *addr : addrs) {
+    ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, addr, kTestMemSize, device_addr), SUCCESS);
+    EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, addr, policy), SUCCESS);
+  }
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[0], addrs[0]);
+
+  // 仍在缓存中的区间可直接复用
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, addrs[1], kTestMemSize, device_addr), SUCCESS);
+  EXPECT_EQ(acl_stub->registered_sizes_.size(), 3U);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, addrs[1], policy), SUCCESS);
+  HostRegisterProxy::ReleaseIdleCacheByDev(dev_phy_id, &kOwnerA);
+}
+
+// 测试同一起始地址注册更短区间时复用已注册区间，注销按后进先出释放引用
+TEST_F(HostRegisterProxyTest, SameStartSubRangeServedByRegisteredRegion) {
+  auto acl_stub = std::make_shared<CountingHostRegisterStub>();
+  llm::AclRuntimeStub::SetInstance(acl_stub);
+  const int32_t dev_phy_id = GetUniqueDevPhyId();
+  std::vector<uint8_t> buffer(4 * kTestMemSize);
+  void *device_addr = nullptr;
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, buffer.data(), buffer.size(), device_addr), SUCCESS);
+  void *sub_device_addr = nullptr;
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, buffer.data(), kTestMemSize, sub_device_addr), SUCCESS);
+  EXPECT_EQ(sub_device_addr, device_addr);
+  EXPECT_EQ(acl_stub->registered_sizes_.size(), 1U);
+
+  // 同起始地址的更长区间与活跃区间冲突
+  void *bad_device_addr = nullptr;
+  EXPECT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, buffer.data(), 8 * kTestMemSize, bad_device_addr),
+            PARAM_INVALID);
+
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, buffer.data()), SUCCESS);
+  EXPECT_TRUE(acl_stub->unregistered_addrs_.empty());
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, buffer.data()), SUCCESS);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[0], buffer.data());
+}
+
+// 测试各owner的空闲缓存分别计数，淘汰与释放不影响其他owner
+TEST_F(HostRegisterProxyTest, IdleCacheIsolatedPerOwner) {
+  auto acl_stub = std::make_shared<CountingHostRegisterStub>();
+  llm::AclRuntimeStub::SetInstance(acl_stub);
+  const HostRegisterCachePolicy policy_a{&kOwnerA, kTestMemSize};
+  const HostRegisterCachePolicy policy_b{&kOwnerB, kTestMemSize};
+  const int32_t dev_phy_id = GetUniqueDevPhyId();
+  std::vector<uint8_t> buffer(6 * kTestMemSize);
+  void *addr_a = buffer.data();
+  void *addr_b = buffer.data() + 2 * kTestMemSize;
+  void *addr_a2 = buffer.data() + 4 * kTestMemSize;
+  void *device_addr = nullptr;
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, addr_a, kTestMemSize, device_addr), SUCCESS);
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, addr_b, kTestMemSize, device_addr), SUCCESS);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, addr_a, policy_a), SUCCESS);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, addr_b, policy_b), SUCCESS);
+  EXPECT_TRUE(acl_stub->unregistered_addrs_.empty());
+
+  // owner A超出容量只淘汰自身最久未使用的区间
+  ASSERT_EQ(HostRegisterProxy::RegisterByDev(dev_phy_id, addr_a2, kTestMemSize, device_addr), SUCCESS);
+  EXPECT_EQ(HostRegisterProxy::UnregisterByDev(dev_phy_id, addr_a2, policy_a), SUCCESS);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 1U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[0], addr_a);
+
+  HostRegisterProxy::ReleaseIdleCacheByDev(dev_phy_id, &kOwnerA);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 2U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[1], addr_a2);
+  HostRegisterProxy::ReleaseIdleCacheByDev(dev_phy_id, &kOwnerB);
+  ASSERT_EQ(acl_stub->unregistered_addrs_.size(), 3U);
+  EXPECT_EQ(acl_stub->unregistered_addrs_[2], addr_b);
+}
+
 }  // namespace hixl
@@ -22,6 +22,7 @@
 #include <unistd.h>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include "nlohmann/json.hpp"
 #include "cs/hixl_cs.h"
 #include "hixl/hixl_types.h"
 #include "common/ctrl_msg.h"
@@ -201,6 +202,65 @@ class HixlCSTest : public ::testing::Test {
     ret = CtrlMsgPlugin::Send(client_fd, &body, static_cast<uint64_t>(sizeof(body)));
     EXPECT_EQ(ret, SUCCESS);
   }
+
+  void SendMemDirSubscribeReq(int32_t client_fd, uint64_t dst_ep_handle, uint64_t known_version) {
+    CtrlMsgHeader header{};
+    header.magic = kMagicNumber;
+    header.body_size = static_cast<uint64_t>(sizeof(CtrlMsgType) + sizeof(MemDirSubscribeReq));
+    CtrlMsgType msg_type = CtrlMsgType::kMemDirSubscribeReq;
+    MemDirSubscribeReq body{};
+    body.dst_ep_handle = dst_ep_handle;
+    body.known_version = known_version;
+    auto ret = CtrlMsgPlugin::Send(client_fd, &header, static_cast<uint64_t>(sizeof(header)));
+    EXPECT_EQ(ret, SUCCESS);
+    ret = CtrlMsgPlugin::Send(client_fd, &msg_type, static_cast<uint64_t>(sizeof(msg_type)));
+    EXPECT_EQ(ret, SUCCESS);
+    ret = CtrlMsgPlugin::Send(client_fd, &body, static_cast<uint64_t>(sizeof(body)));
+    EXPECT_EQ(ret, SUCCESS);
+  }
+
+  void RecvJsonMsg(int32_t client_fd, CtrlMsgType expect_type, nlohmann::json &j) {
+    CtrlMsgHeader recv_header{};
+    auto ret = CtrlMsgPlugin::Recv(client_fd, &recv_header, static_cast<uint64_t>(sizeof(recv_header)), kRecvTimeoutMs);
+    ASSERT_EQ(ret, SUCCESS);
+    ASSERT_EQ(recv_header.magic, kMagicNumber);
+    ASSERT_GT(recv_header.body_size, static_cast<uint64_t>(sizeof(CtrlMsgType)));
+    std::vector<char> body(static_cast<size_t>(recv_header.body_size));
+    ret = CtrlMsgPlugin::Recv(client_fd, body.data(), static_cast<uint64_t>(body.size()), kRecvTimeoutMs);
+    ASSERT_EQ(ret, SUCCESS);
+    EXPECT_EQ(*reinterpret_cast<CtrlMsgType *>(body.data()), expect_type);
+    j = nlohmann::json::parse(body.begin() + sizeof(CtrlMsgType), body.end());
+  }
+
+  void SendMemDirUpdateAck(int32_t client_fd, uint64_t version) {
+    CtrlMsgHeader header{};
+    header.magic = kMagicNumber;
+    header.body_size = static_cast<uint64_t>(sizeof(CtrlMsgType) + sizeof(MemDirUpdateAck));
+    CtrlMsgType msg_type = CtrlMsgType::kMemDirUpdateAck;
+    MemDirUpdateAck body{};
+    body.version = version;
+    auto ret = CtrlMsgPlugin::Send(client_fd, &header, static_cast<uint64_t>(sizeof(header)));
+    EXPECT_EQ(ret, SUCCESS);
+    ret = CtrlMsgPlugin::Send(client_fd, &msg_type, static_cast<uint64_t>(sizeof(msg_type)));
+    EXPECT_EQ(ret, SUCCESS);
+    ret = CtrlMsgPlugin::Send(client_fd, &body, static_cast<uint64_t>(sizeof(body)));
+    EXPECT_EQ(ret, SUCCESS);
+  }
+
+  // 订阅由server线程池异步处理，等待订阅生效后再注册内存，保证收到的是增量而非全量目录
+  bool WaitMemDirSubscribed(HixlServerHandle server_handle) {
+    auto *server = static_cast<HixlCSServer *>(server_handle);
+    for (uint32_t waited = 0U; waited < kRecvTimeoutMs; waited += kTimeSleepMs) {
+      {
+        std::lock_guard<std::mutex> lock(server->dir_mutex_);
+        if (!server->mem_dir_subscribers_.empty()) {
+          return true;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(kTimeSleepMs));
+    }
+    return false;
+  }
 };
 
 TEST_F(HixlCSTest, TestHixlCSServer) {
@@ -582,6 +642,127 @@ TEST_F(HixlCSTest, TestHixlCSClient2Server) {
   EXPECT_EQ(ret, SUCCESS);
 }
 
+TEST_F(HixlCSTest, TestMemDirSubscribePushesRegisterAndDeregister) {
+  HixlServerHandle server_handle = nullptr;
+  int32_t client_fd = -1;
+  SetupServerAndSendMatchReq(server_handle, client_fd);
+  MatchEndpointResp match_resp{};
+  GetMatchEndpointResp(client_fd, match_resp);
+  SendGetRemoteMemReq(client_fd, match_resp.dst_ep_handle);
+  nlohmann::json snapshot;
+  RecvJsonMsg(client_fd, CtrlMsgType::kGetRemoteMemResp, snapshot);
+  ASSERT_TRUE(snapshot.contains("version"));
+  const uint64_t version = snapshot["version"].get<uint64_t>();
+  SendMemDirSubscribeReq(client_fd, match_resp.dst_ep_handle, version);
+  ASSERT_TRUE(WaitMemDirSubscribed(server_handle));
+
+  CommMem mem{};
+  mem.type = COMM_MEM_TYPE_HOST;
+  mem.size = sizeof(int32_t);
+  mem.addr = &kHostMems[0];
+  MemHandle mem_handle = nullptr;
+  EXPECT_EQ(HixlCSServerRegMem(server_handle, "pushed", &mem, &mem_handle), SUCCESS);
+  nlohmann::json added;
+  RecvJsonMsg(client_fd, CtrlMsgType::kMemDirUpdate, added);
+  EXPECT_EQ(added["version"].get<uint64_t>(), version + 1U);
+  EXPECT_FALSE(added["reset"].get<bool>());
+  ASSERT_EQ(added["added"].size(), 1U);
+  EXPECT_EQ(added["added"][0]["tag"].get<std::string>(), "pushed");
+  EXPECT_EQ(added["added"][0]["mem"]["addr"].get<uint64_t>(), reinterpret_cast<uintptr_t>(mem.addr));
+  EXPECT_FALSE(added["added"][0]["export_desc"].empty());
+  EXPECT_TRUE(added["removed"].empty());
+
+  // 注销须等待client确认已屏蔽该内存后才返回
+  std::atomic<bool> unreg_done{false};
+  std::thread unreg_thread([server_handle, mem_handle, &unreg_done]() {
+    EXPECT_EQ(HixlCSServerUnregMem(server_handle, mem_handle), SUCCESS);
+    unreg_done = true;
+  });
+  nlohmann::json removed;
+  RecvJsonMsg(client_fd, CtrlMsgType::kMemDirUpdate, removed);
+  EXPECT_EQ(removed["version"].get<uint64_t>(), version + 2U);
+  EXPECT_TRUE(removed["added"].empty());
+  ASSERT_EQ(removed["removed"].size(), 1U);
+  EXPECT_EQ(removed["removed"][0].get<uint64_t>(), reinterpret_cast<uintptr_t>(mem.addr));
+  std::this_thread::sleep_for(std::chrono::milliseconds(kTimeSleepMs * kNum2));
+  EXPECT_FALSE(unreg_done.load());
+  const auto ack_time = std::chrono::steady_clock::now();
+  SendMemDirUpdateAck(client_fd, version + 2U);
+  unreg_thread.join();
+  EXPECT_TRUE(unreg_done.load());
+  EXPECT_LT(std::chrono::steady_clock::now() - ack_time, std::chrono::milliseconds(kRecvTimeoutMs));
+
+  (void)close(client_fd);
+  EXPECT_EQ(HixlCSServerDestroy(server_handle), SUCCESS);
+}
+
+TEST_F(HixlCSTest, TestMemDirDeregisterStopsWaitingOnSubscriberDisconnect) {
+  HixlServerHandle server_handle = nullptr;
+  int32_t client_fd = -1;
+  SetupServerAndSendMatchReq(server_handle, client_fd);
+  MatchEndpointResp match_resp{};
+  GetMatchEndpointResp(client_fd, match_resp);
+  SendGetRemoteMemReq(client_fd, match_resp.dst_ep_handle);
+  nlohmann::json snapshot;
+  RecvJsonMsg(client_fd, CtrlMsgType::kGetRemoteMemResp, snapshot);
+  const uint64_t version = snapshot["version"].get<uint64_t>();
+  SendMemDirSubscribeReq(client_fd, match_resp.dst_ep_handle, version);
+  ASSERT_TRUE(WaitMemDirSubscribed(server_handle));
+
+  CommMem mem{};
+  mem.type = COMM_MEM_TYPE_HOST;
+  mem.size = sizeof(int32_t);
+  mem.addr = &kHostMems[0];
+  MemHandle mem_handle = nullptr;
+  EXPECT_EQ(HixlCSServerRegMem(server_handle, "fenced", &mem, &mem_handle), SUCCESS);
+  nlohmann::json added;
+  RecvJsonMsg(client_fd, CtrlMsgType::kMemDirUpdate, added);
+
+  std::thread unreg_thread([server_handle, mem_handle]() {
+    EXPECT_EQ(HixlCSServerUnregMem(server_handle, mem_handle), SUCCESS);
+  });
+  nlohmann::json removed;
+  RecvJsonMsg(client_fd, CtrlMsgType::kMemDirUpdate, removed);
+  ASSERT_EQ(removed["removed"].size(), 1U);
+  // client未确认即断开，断连清理取消订阅后注销不再等待
+  const auto close_time = std::chrono::steady_clock::now();
+  (void)close(client_fd);
+  unreg_thread.join();
+  EXPECT_LT(std::chrono::steady_clock::now() - close_time, std::chrono::milliseconds(kRecvTimeoutMs));
+  EXPECT_EQ(HixlCSServerDestroy(server_handle), SUCCESS);
+}
+
+TEST_F(HixlCSTest, TestMemDirSubscribeWithStaleVersionPushesFullDir) {
+  HixlServerHandle server_handle = nullptr;
+  int32_t client_fd = -1;
+  SetupServerAndSendMatchReq(server_handle, client_fd);
+  MatchEndpointResp match_resp{};
+  GetMatchEndpointResp(client_fd, match_resp);
+  SendGetRemoteMemReq(client_fd, match_resp.dst_ep_handle);
+  nlohmann::json snapshot;
+  RecvJsonMsg(client_fd, CtrlMsgType::kGetRemoteMemResp, snapshot);
+  const uint64_t version = snapshot["version"].get<uint64_t>();
+  const size_t snapshot_num = snapshot["mem_descs"].size();
+
+  // 快照之后、订阅之前注册的内存，订阅时以全量目录补齐
+  CommMem mem{};
+  mem.type = COMM_MEM_TYPE_HOST;
+  mem.size = sizeof(int32_t);
+  mem.addr = &kHostMems[0];
+  MemHandle mem_handle = nullptr;
+  EXPECT_EQ(HixlCSServerRegMem(server_handle, "late", &mem, &mem_handle), SUCCESS);
+  SendMemDirSubscribeReq(client_fd, match_resp.dst_ep_handle, version);
+  nlohmann::json full;
+  RecvJsonMsg(client_fd, CtrlMsgType::kMemDirUpdate, full);
+  EXPECT_TRUE(full["reset"].get<bool>());
+  EXPECT_EQ(full["version"].get<uint64_t>(), version + 1U);
+  EXPECT_EQ(full["added"].size(), snapshot_num + 1U);
+
+  (void)close(client_fd);
+  EXPECT_EQ(HixlCSServerUnregMem(server_handle, mem_handle), SUCCESS);
+  EXPECT_EQ(HixlCSServerDestroy(server_handle), SUCCESS);
+}
+
 TEST_F(HixlCSTest, TestHixlCSServerDisconnectionCleanup) {
   auto log_capture = std::make_shared<llm::LogCaptureStub>();
   // 添加要捕获的日志模式
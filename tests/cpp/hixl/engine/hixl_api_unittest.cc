@@ -8,6 +8,7 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <set>
 #include <vector>
 #include <atomic>
 #include <cstdlib>
@@ -543,6 +544,53 @@ TEST_F(HixlUTest, TestHixlTransferAsyncWithMultiThread) {
   RunMultiThreadTransferAsyncTest();
 }
 
+TEST_F(HixlUTest, TestHixlGetTransferStatistics) {
+  Hixl engine1;
+  Hixl engine2;
+  SetupEngines(engine1, engine2);
+  int32_t src = 1;
+  MemHandle handle1 = nullptr;
+  RegisterInt32Mem(engine1, &src, handle1);
+  int32_t dst = 2;
+  MemHandle handle2 = nullptr;
+  RegisterInt32Mem(engine2, &dst, handle2);
+
+  PeerTransferStatistics statistics;
+  EXPECT_EQ(engine1.GetTransferStatistics("127.0.0.1:26201", statistics), SUCCESS);
+  EXPECT_EQ(statistics.read.total_ops, 0U);
+  EXPECT_EQ(statistics.write.total_ops, 0U);
+
+  EXPECT_EQ(engine1.Connect("127.0.0.1:26201"), SUCCESS);
+  TransferOpDesc desc{reinterpret_cast<uintptr_t>(&src), reinterpret_cast<uintptr_t>(&dst), sizeof(int32_t)};
+  EXPECT_EQ(engine1.TransferSync("127.0.0.1:26201", READ, {desc, desc}), SUCCESS);
+  TransferReq req = nullptr;
+  ASSERT_EQ(engine1.TransferAsync("127.0.0.1:26201", WRITE, {desc}, {}, req), SUCCESS);
+  TransferStatus status = TransferStatus::WAITING;
+  for (int i = 0; i < 10 && status == TransferStatus::WAITING; ++i) {
+    EXPECT_EQ(engine1.GetTransferStatus(req, status), SUCCESS);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(status, TransferStatus::COMPLETED);
+
+  EXPECT_EQ(engine1.GetTransferStatistics("127.0.0.1:26201", statistics), SUCCESS);
+  EXPECT_GT(statistics.window_ms, 0U);
+  EXPECT_EQ(statistics.read.total_ops, 1U);
+  EXPECT_EQ(statistics.read.total_bytes, 2U * sizeof(int32_t));
+  EXPECT_GT(statistics.read.bytes_per_second, 0.0);
+  EXPECT_EQ(statistics.write.total_ops, 1U);
+  EXPECT_EQ(statistics.write.total_bytes, sizeof(int32_t));
+  EXPECT_LE(statistics.write.p50_latency_us, statistics.write.max_latency_us);
+
+  // 断链后丢弃该远端的统计
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26201"), SUCCESS);
+  EXPECT_EQ(engine1.GetTransferStatistics("127.0.0.1:26201", statistics), SUCCESS);
+  EXPECT_EQ(statistics.read.total_ops, 0U);
+  EXPECT_EQ(engine1.DeregisterMem(handle1), SUCCESS);
+  EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
 TEST_F(HixlUTest, TestHixlGetTransferStatusFalied) {
   llm::AutoCommResRuntimeMock::SetDevice(0);
   Hixl engine1;
@@ -654,6 +702,93 @@ TEST_F(HixlUTest, TestHixlSendGetNotifies) {
   engine2.Finalize();
 }
 
+TEST_F(HixlUTest, TestHixlSendNotifiesAndConsume) {
+  llm::AutoCommResRuntimeMock::SetDevice(0);
+  Hixl engine1;
+  std::map<AscendString, AscendString> options1;
+  EXPECT_EQ(engine1.Initialize("127.0.0.1:26200", options1), SUCCESS);
+
+  llm::AutoCommResRuntimeMock::SetDevice(1);
+  Hixl engine2;
+  std::map<AscendString, AscendString> options2;
+  EXPECT_EQ(engine2.Initialize("127.0.0.1:26201", options2), SUCCESS);
+
+  EXPECT_EQ(engine1.Connect("127.0.0.1:26201"), SUCCESS);
+
+  // 1000条notify拆为多个批量帧，超过确认窗口前不等待确认
+  constexpr size_t kNotifyNum = 1000U;
+  std::vector<NotifyDesc> notifies(kNotifyNum);
+  for (size_t i = 0U; i < kNotifyNum; ++i) {
+    notifies[i].name = AscendString(("batch_notify" + std::to_string(i)).c_str());
+    notifies[i].notify_msg = AscendString(("message " + std::to_string(i)).c_str());
+  }
+  EXPECT_EQ(engine1.SendNotifies("127.0.0.1:26201", notifies), SUCCESS);
+
+  std::set<std::string> received;
+  EXPECT_EQ(engine2.ConsumeNotifies([&received](const NotifyView &view) {
+    received.emplace(std::string(view.name, view.name_len) + "|" + std::string(view.notify_msg, view.notify_msg_len));
+  }),
+            SUCCESS);
+  EXPECT_EQ(received.size(), kNotifyNum);
+  for (size_t i = 0U; i < kNotifyNum; ++i) {
+    EXPECT_EQ(received.count("batch_notify" + std::to_string(i) + "|message " + std::to_string(i)), 1U);
+  }
+
+  std::vector<NotifyDesc> remaining;
+  EXPECT_EQ(engine2.GetNotifies(remaining), SUCCESS);
+  EXPECT_TRUE(remaining.empty());
+
+  NotifyDesc too_long;
+  too_long.name = AscendString(std::string(1025U, 'x').c_str());
+  EXPECT_EQ(engine1.SendNotifies("127.0.0.1:26201", {too_long}), PARAM_INVALID);
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26201"), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
+TEST_F(HixlUTest, TestHixlSendNotifiesRetriesRejectedFramesOnly) {
+  llm::AutoCommResRuntimeMock::SetDevice(0);
+  Hixl engine1;
+  std::map<AscendString, AscendString> options1;
+  EXPECT_EQ(engine1.Initialize("127.0.0.1:26200", options1), SUCCESS);
+
+  llm::AutoCommResRuntimeMock::SetDevice(1);
+  Hixl engine2;
+  std::map<AscendString, AscendString> options2;
+  EXPECT_EQ(engine2.Initialize("127.0.0.1:26201", options2), SUCCESS);
+
+  EXPECT_EQ(engine1.Connect("127.0.0.1:26201"), SUCCESS);
+
+  // 超过对端4096条队列上限，队列满时被拒的帧在消费后重发，每条notify恰好收到一次
+  constexpr size_t kNotifyNum = 6000U;
+  std::vector<NotifyDesc> notifies(kNotifyNum);
+  for (size_t i = 0U; i < kNotifyNum; ++i) {
+    notifies[i].name = AscendString(("retry_notify" + std::to_string(i)).c_str());
+    notifies[i].notify_msg = AscendString("done");
+  }
+  std::map<std::string, size_t> received;
+  std::atomic<bool> stop{false};
+  std::thread consumer([&engine2, &received, &stop]() {
+    while (!stop.load()) {
+      (void)engine2.ConsumeNotifies(
+          [&received](const NotifyView &view) { ++received[std::string(view.name, view.name_len)]; });
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  EXPECT_EQ(engine1.SendNotifies("127.0.0.1:26201", notifies, 5000), SUCCESS);
+  stop.store(true);
+  consumer.join();
+  (void)engine2.ConsumeNotifies(
+      [&received](const NotifyView &view) { ++received[std::string(view.name, view.name_len)]; });
+  EXPECT_EQ(received.size(), kNotifyNum);
+  for (const auto &kv : received) {
+    EXPECT_EQ(kv.second, 1U) << kv.first;
+  }
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26201"), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
 TEST_F(HixlUTest, TestHixlMultiGetNotifies) {
   llm::AutoCommResRuntimeMock::SetDevice(0);
   Hixl engine1;
@@ -1121,6 +1121,43 @@ TEST_F(HixlClientUTest, GetTransferStatusReqInvalidTest) {
   std::cout << "TransferStatus: " << static_cast<int>(status) << std::endl;
 }
 
+// TransferAsync 优先级测试：BULK请求按块窗口下发，存在未完成的LATENCY_CRITICAL请求时不下发新块
+TEST_F(HixlClientUTest, BulkTransferChunkedAndYieldsToLatencyCritical) {
+  ClientConfig config{};
+  config.rdma_tc = kDefaultRdmaTc;
+  config.rdma_sl = kDefaultRdmaSl;
+  config.bulk_chunk_size = sizeof(uint16_t);
+  client_ = MakeUnique<HixlClient>("127.0.0.1", kServerPort, config);
+  SetupTransferTest();
+  auto op_descs = CreateTransferOps();
+  TransferArgs critical_args{};
+  critical_args.priority = TransferPriority::LATENCY_CRITICAL;
+  TransferReq critical_req = nullptr;
+  ASSERT_EQ(client_->TransferAsync(op_descs, WRITE, critical_args, critical_req), SUCCESS);
+  TransferArgs bulk_args{};
+  bulk_args.priority = TransferPriority::BULK;
+  TransferReq bulk_req = nullptr;
+  ASSERT_EQ(client_->TransferAsync(op_descs, WRITE, bulk_args, bulk_req), SUCCESS);
+  ASSERT_NE(bulk_req, nullptr);
+
+  TransferStatus status = TransferStatus::FAILED;
+  for (int32_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(client_->GetTransferStatus(bulk_req, status), SUCCESS);
+    EXPECT_EQ(status, TransferStatus::WAITING);
+  }
+  ASSERT_EQ(client_->bulk_transfers_.count(bulk_req), 1U);
+  EXPECT_TRUE(client_->bulk_transfers_[bulk_req]->inflight.empty());
+  EXPECT_EQ(client_->GetTransferStatus(critical_req, status), SUCCESS);
+  EXPECT_EQ(status, TransferStatus::COMPLETED);
+
+  // 4字节拆为两个2字节块：时延敏感请求结束时两块在同一窗口内一并下发，无需逐块查询推进
+  EXPECT_EQ(client_->bulk_transfers_[bulk_req]->inflight.size(), 2U);
+  EXPECT_EQ(client_->bulk_transfers_[bulk_req]->next_chunk, 2U);
+  EXPECT_EQ(client_->GetTransferStatus(bulk_req, status), SUCCESS);
+  EXPECT_EQ(status, TransferStatus::COMPLETED);
+  EXPECT_EQ(client_->GetTransferStatus(bulk_req, status), PARAM_INVALID);
+}
+
 // Segment::AddRange 函数测试：正常场景 - 添加单个内存范围
 TEST_F(HixlClientUTest, SegmentAddRangeSuccessTest) {
   Segment segment(MemType::MEM_DEVICE);
@@ -14,6 +14,8 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 #include <gtest/gtest.h>
 #include <sys/socket.h>
@@ -29,6 +31,7 @@
 #include "hixl/hixl_types.h"
 #include "engine/engine_factory.h"
 #include "common/ctrl_msg_plugin.h"
+#include "common/transfer_telemetry.h"
 #include "engine/hixl_options.h"
 #include "cs/hixl_cs_client.h"
 #include "hixl/hixl.h"
@@ -36,6 +39,7 @@
 #include "test_mmpa_utils.h"
 #include "depends/sys_api/src/sys_api_wrap.h"
 #include "depends/mmpa/src/mmpa_stub.h"
+#include "depends/hccl/src/hccl_stub.h"
 #include "hixl_test_helpers.h"
 
 namespace hixl {
@@ -545,6 +549,98 @@ TEST_F(HixlEngineTest, TestTransferAsync) {
   engine2.Finalize();
 }
 
+TEST_F(HixlEngineTest, TestTransferThroughRemoteHandle) {
+  SetSocStub("Ascend910B1", 0, 12, 99, 88);
+  Hixl engine1;
+  EXPECT_EQ(engine1.Initialize("127.0.0.1", options1), SUCCESS);
+  Hixl engine2;
+  EXPECT_EQ(engine2.Initialize("127.0.0.1:26300", options2), SUCCESS);
+
+  int32_t src = 1;
+  MemHandle handle1 = nullptr;
+  test_helpers::RegisterInt32DeviceMem(engine1, src, handle1);
+  int32_t dst = 2;
+  MemHandle handle2 = nullptr;
+  test_helpers::RegisterInt32DeviceMem(engine2, dst, handle2);
+
+  // 未开启自动建链时，解析要求已建链
+  RemoteHandle remote = nullptr;
+  EXPECT_EQ(engine1.ResolveRemote("127.0.0.1:26300", remote, kTimeOut), NOT_CONNECTED);
+  EXPECT_EQ(engine1.Connect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  ASSERT_EQ(engine1.ResolveRemote("127.0.0.1:26300", remote, kTimeOut), SUCCESS);
+  ASSERT_NE(remote, nullptr);
+
+  TransferOpDesc desc{reinterpret_cast<uintptr_t>(&src), reinterpret_cast<uintptr_t>(&dst), sizeof(int32_t)};
+  EXPECT_EQ(engine1.TransferSync(remote, READ, {desc}), SUCCESS);
+  EXPECT_EQ(src, 2);
+  src = 1;
+  TransferReq req = nullptr;
+  ASSERT_EQ(engine1.TransferAsync(remote, WRITE, {desc}, {}, req), SUCCESS);
+  TransferStatus status = TransferStatus::WAITING;
+  while (status == TransferStatus::WAITING) {
+    ASSERT_EQ(engine1.GetTransferStatus(req, status), SUCCESS);
+  }
+  EXPECT_EQ(status, TransferStatus::COMPLETED);
+  EXPECT_EQ(dst, 1);
+  EXPECT_EQ(engine1.TransferSync(static_cast<RemoteHandle>(nullptr), READ, {desc}), PARAM_INVALID);
+
+  // 断链后句柄失效，需重新解析
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26300"), SUCCESS);
+  EXPECT_EQ(engine1.TransferSync(remote, READ, {desc}), NOT_CONNECTED);
+  EXPECT_EQ(engine1.ReleaseRemote(remote), SUCCESS);
+  EXPECT_EQ(engine1.ReleaseRemote(remote), PARAM_INVALID);
+
+  EXPECT_EQ(engine1.DeregisterMem(handle1), SUCCESS);
+  EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
+TEST_F(HixlEngineTest, TestResolveRemoteWithAutoConnect) {
+  HixlEngine engine1("127.0.0.1");
+  HixlEngine engine2("127.0.0.1:26300");
+  int32_t src = 1;
+  int32_t dst = 2;
+  MemHandle handle1 = nullptr;
+  MemHandle handle2 = nullptr;
+  InitAutoConnectEngines(engine1, engine2, src, dst, handle1, handle2);
+
+  std::unique_ptr<RemoteHandleImpl> remote;
+  ASSERT_EQ(engine1.ResolveRemote("127.0.0.1:26300", kTimeOut, remote), SUCCESS);
+  ASSERT_NE(remote, nullptr);
+  EXPECT_NE(engine1.client_manager_.GetClient("127.0.0.1:26300"), nullptr);
+  TransferOpDesc desc{reinterpret_cast<uintptr_t>(&src), reinterpret_cast<uintptr_t>(&dst), sizeof(int32_t)};
+  src = 3;
+  EXPECT_EQ(engine1.TransferSyncResolved(*remote, WRITE, {desc}, kTimeOut), SUCCESS);
+  EXPECT_EQ(dst, 3);
+
+  // 请求级错误不影响链路，句柄继续可用
+  int32_t unregistered = 4;
+  TransferOpDesc invalid_desc{reinterpret_cast<uintptr_t>(&unregistered), reinterpret_cast<uintptr_t>(&dst),
+                              sizeof(int32_t)};
+  ClientPtr client = engine1.client_manager_.GetClient("127.0.0.1:26300");
+  EXPECT_EQ(engine1.TransferSyncResolved(*remote, READ, {invalid_desc}, kTimeOut), PARAM_INVALID);
+  EXPECT_EQ(engine1.client_manager_.GetClient("127.0.0.1:26300"), client);
+  EXPECT_EQ(engine1.TransferSyncResolved(*remote, WRITE, {desc}, kTimeOut), SUCCESS);
+
+  // 链路故障后后台重建，旧句柄失效，重新解析后可继续传输
+  SetNextNbiFailure(HCCL_E_INTERNAL);
+  EXPECT_EQ(engine1.TransferSyncResolved(*remote, WRITE, {desc}, kTimeOut), FAILED);
+  ClientPtr rebuilt = engine1.client_manager_.AwaitClient("127.0.0.1:26300", kTimeOut);
+  ASSERT_NE(rebuilt, nullptr);
+  EXPECT_NE(rebuilt, client);
+  EXPECT_EQ(engine1.TransferSyncResolved(*remote, WRITE, {desc}, kTimeOut), NOT_CONNECTED);
+  ASSERT_EQ(engine1.ResolveRemote("127.0.0.1:26300", kTimeOut, remote), SUCCESS);
+  src = 5;
+  EXPECT_EQ(engine1.TransferSyncResolved(*remote, WRITE, {desc}, kTimeOut), SUCCESS);
+  EXPECT_EQ(dst, 5);
+
+  EXPECT_EQ(engine1.DeregisterMem(handle1), SUCCESS);
+  EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
 TEST_F(HixlEngineTest, TestInitFailed) {
   SetSocStub("Ascend910B1", 0, 12, 99, 88);
   // invalid ip
@@ -733,6 +829,96 @@ TEST_F(HixlEngineTest, TestNotifyWithMaxLengthFields) {
   CleanupEngines(engine1, engine2);
 }
 
+TEST_F(HixlEngineTest, TestMemNotifySlotOrderedAfterAsyncWriteAndReleasedOnDisconnect) {
+  SetSocStub("Ascend910B1", 0, 12, 99, 88);
+  options1[hixl::OPTION_ENABLE_MEM_NOTIFY] = "1";
+  options2[hixl::OPTION_ENABLE_MEM_NOTIFY] = "1";
+  HixlEngine engine1("127.0.0.1");
+  CreateAndInitEngine(engine1, options1);
+  HixlEngine engine2("127.0.0.1:26300");
+  CreateAndInitEngine(engine2, options2);
+  ASSERT_NE(engine2.server_.notify_slot_base_, nullptr);
+
+  int32_t src = 1;
+  MemHandle handle1 = nullptr;
+  Register(engine1, &src, handle1);
+  int32_t dst = 2;
+  MemHandle handle2 = nullptr;
+  Register(engine2, &dst, handle2);
+
+  EXPECT_EQ(engine1.Connect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  auto client = engine1.client_manager_.GetClient("127.0.0.1:26300");
+  ASSERT_NE(client, nullptr);
+  ASSERT_NE(client->remote_notify_ring_, 0U);
+
+  // 未查询状态的异步WRITE与槽位写同通道，notify直接排在其后异步下发，不在host侧等待数据写结束
+  TransferOpDesc desc{reinterpret_cast<uintptr_t>(&src), reinterpret_cast<uintptr_t>(&dst), sizeof(int32_t)};
+  TransferReq req = nullptr;
+  ASSERT_EQ(engine1.TransferAsync("127.0.0.1:26300", WRITE, {desc}, {}, req), SUCCESS);
+  NotifyDesc notify;
+  notify.name = AscendString("slot_notify");
+  notify.notify_msg = AscendString("data ready");
+  EXPECT_EQ(engine1.SendNotify("127.0.0.1:26300", notify, kTimeOut), SUCCESS);
+  EXPECT_TRUE(client->fenced_reqs_.empty());
+  EXPECT_EQ(client->notify_writes_.size(), 1U);
+  TransferStatus status = TransferStatus::WAITING;
+  for (int32_t i = 0; i < kMaxRetryCount && status == TransferStatus::WAITING; ++i) {
+    EXPECT_EQ(engine1.GetTransferStatus(req, status), SUCCESS);
+  }
+  EXPECT_EQ(status, TransferStatus::COMPLETED);
+  EXPECT_EQ(dst, 1);
+
+  std::vector<NotifyDesc> notifies;
+  for (int32_t i = 0; i < kMaxRetryCount && notifies.empty(); ++i) {
+    EXPECT_EQ(engine2.GetNotifies(notifies), SUCCESS);
+    if (notifies.empty()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(kInterval));
+    }
+  }
+  ASSERT_EQ(notifies.size(), 1U);
+  EXPECT_EQ(std::string(notifies[0].name.GetString()), "slot_notify");
+  EXPECT_EQ(std::string(notifies[0].notify_msg.GetString()), "data ready");
+  EXPECT_EQ(client->notify_slot_seq_, 1U);
+  {
+    std::lock_guard<std::mutex> lock(engine2.server_.notify_slot_mutex_);
+    EXPECT_EQ(engine2.server_.notify_slot_peers_.size(), 1U);
+  }
+
+  // 断开后server释放该对端的槽位环，不会因对端累计超过kMaxNotifySlotPeers而拒绝新连接
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  bool released = false;
+  for (int32_t i = 0; i < kMaxRetryCount * kMaxRetryCount && !released; ++i) {
+    {
+      std::lock_guard<std::mutex> lock(engine2.server_.notify_slot_mutex_);
+      released = engine2.server_.notify_slot_peers_.empty() && engine2.server_.notify_slot_fds_.empty();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(kInterval));
+  }
+  EXPECT_TRUE(released);
+
+  // 重连后重新分配槽位环并从seq 1开始
+  EXPECT_EQ(engine1.Connect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  client = engine1.client_manager_.GetClient("127.0.0.1:26300");
+  ASSERT_NE(client, nullptr);
+  ASSERT_NE(client->remote_notify_ring_, 0U);
+  EXPECT_EQ(client->notify_slot_seq_, 0U);
+  EXPECT_EQ(engine1.SendNotify("127.0.0.1:26300", notify, kTimeOut), SUCCESS);
+  notifies.clear();
+  for (int32_t i = 0; i < kMaxRetryCount && notifies.empty(); ++i) {
+    EXPECT_EQ(engine2.GetNotifies(notifies), SUCCESS);
+    if (notifies.empty()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(kInterval));
+    }
+  }
+  EXPECT_EQ(notifies.size(), 1U);
+
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  EXPECT_EQ(engine1.DeregisterMem(handle1), SUCCESS);
+  EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
 TEST_F(HixlEngineTest, TestAutoConnectSync) {
   HixlEngine engine1("127.0.0.1");
   HixlEngine engine2("127.0.0.1:26300");
@@ -802,7 +988,7 @@ TEST_F(HixlEngineTest, TestParseAutoConnectConfigInvalid) {
   }
 }
 
-TEST_F(HixlEngineTest, TestAutoConnectAutoDisconnect) {
+TEST_F(HixlEngineTest, TestAutoConnectKeepsLinkOnRequestFailure) {
   HixlEngine engine1("127.0.0.1");
   HixlEngine engine2("127.0.0.1:26300");
   int32_t src = 1;
@@ -811,12 +997,19 @@ TEST_F(HixlEngineTest, TestAutoConnectAutoDisconnect) {
   MemHandle handle2 = nullptr;
   InitAutoConnectEngines(engine1, engine2, src, dst, handle1, handle2);
 
+  TransferOpDesc desc = TriggerAutoConnectReadTransfer(engine1, src, dst);
+  ClientPtr client = engine1.client_manager_.GetClient("127.0.0.1:26300");
+  ASSERT_NE(client, nullptr);
   int32_t unregistered = 3;
   TransferOpDesc invalid_desc{reinterpret_cast<uintptr_t>(&unregistered), reinterpret_cast<uintptr_t>(&dst),
                               sizeof(int32_t)};
-  EXPECT_NE(engine1.TransferSync("127.0.0.1:26300", READ, {invalid_desc}, kTimeOut), SUCCESS);
-  // 如果断链成功，显式 Disconnect 应返回失败（因为 client 已经不存在了）
-  EXPECT_NE(engine1.Disconnect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  EXPECT_EQ(engine1.TransferSync("127.0.0.1:26300", READ, {invalid_desc}, kTimeOut), PARAM_INVALID);
+  // 请求级错误不断链，后续请求复用同一条链路
+  EXPECT_EQ(engine1.client_manager_.GetClient("127.0.0.1:26300"), client);
+  src = 4;
+  EXPECT_EQ(engine1.TransferSync("127.0.0.1:26300", WRITE, {desc}, kTimeOut), SUCCESS);
+  EXPECT_EQ(dst, 4);
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26300", kTimeOut), SUCCESS);
   EXPECT_EQ(engine1.DeregisterMem(handle1), SUCCESS);
   EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
 
@@ -824,6 +1017,67 @@ TEST_F(HixlEngineTest, TestAutoConnectAutoDisconnect) {
   engine2.Finalize();
 }
 
+TEST_F(HixlEngineTest, TestChannelFaultRebuildsExplicitConnection) {
+  SetSocStub("Ascend910B1", 0, 12, 99, 88);
+  HixlEngine engine1("127.0.0.1");
+  CreateAndInitEngine(engine1, options1);
+  HixlEngine engine2("127.0.0.1:26300");
+  CreateAndInitEngine(engine2, options2);
+  int32_t src = 1;
+  int32_t dst = 2;
+  MemHandle handle1 = nullptr;
+  MemHandle handle2 = nullptr;
+  Register(engine1, &src, handle1);
+  Register(engine2, &dst, handle2);
+  ASSERT_EQ(engine1.Connect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  ClientPtr client = engine1.client_manager_.GetClient("127.0.0.1:26300");
+  ASSERT_NE(client, nullptr);
+
+  // 注入传输失败，链路在后台重建，下一次请求等待重建完成后走新链路
+  TransferOpDesc desc{reinterpret_cast<uintptr_t>(&src), reinterpret_cast<uintptr_t>(&dst), sizeof(int32_t)};
+  SetNextNbiFailure(HCCL_E_INTERNAL);
+  EXPECT_EQ(engine1.TransferSync("127.0.0.1:26300", WRITE, {desc}, kTimeOut), FAILED);
+  src = 6;
+  EXPECT_EQ(engine1.TransferSync("127.0.0.1:26300", WRITE, {desc}, kTimeOut), SUCCESS);
+  EXPECT_EQ(dst, 6);
+  ClientPtr rebuilt = engine1.client_manager_.GetClient("127.0.0.1:26300");
+  ASSERT_NE(rebuilt, nullptr);
+  EXPECT_NE(rebuilt, client);
+  // 重建沿用显式建链时的超时与非lazy方式
+  EXPECT_EQ(rebuilt->GetConfig().timeout_ms, static_cast<uint32_t>(kTimeOut));
+  EXPECT_FALSE(rebuilt->GetConfig().is_lazy);
+
+  EXPECT_EQ(engine1.Disconnect("127.0.0.1:26300", kTimeOut), SUCCESS);
+  EXPECT_EQ(engine1.DeregisterMem(handle1), SUCCESS);
+  EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
+  engine1.Finalize();
+  engine2.Finalize();
+}
+
+TEST_F(HixlEngineTest, TestFinalizeWhileRebuildingDoesNotDeadlock) {
+  SetSocStub("Ascend910B1", 0, 12, 99, 88);
+  HixlEngine engine1("127.0.0.1");
+  CreateAndInitEngine(engine1, options1);
+  HixlEngine engine2("127.0.0.1:26300");
+  CreateAndInitEngine(engine2, options2);
+  int32_t src = 1;
+  int32_t dst = 2;
+  MemHandle handle1 = nullptr;
+  MemHandle handle2 = nullptr;
+  Register(engine1, &src, handle1);
+  Register(engine2, &dst, handle2);
+  ASSERT_EQ(engine1.Connect("127.0.0.1:26300", kTimeOut), SUCCESS);
+
+  // 传输失败后立即Finalize，持有engine锁等待重建线程退出时不能与重建互相等待
+  TransferOpDesc desc{reinterpret_cast<uintptr_t>(&src), reinterpret_cast<uintptr_t>(&dst), sizeof(int32_t)};
+  SetNextNbiFailure(HCCL_E_INTERNAL);
+  EXPECT_EQ(engine1.TransferSync("127.0.0.1:26300", WRITE, {desc}, kTimeOut), FAILED);
+  engine1.Finalize();
+  EXPECT_TRUE(engine1.client_manager_.IsEmpty());
+  EXPECT_EQ(engine2.DeregisterMem(handle2), SUCCESS);
+  engine2.Finalize();
+}
+
 TEST_F(HixlEngineTest, TestParseTcAndSlWithValidValue) {
   std::string tc_log_pattern = "Set rdma traffic class to 128";
   std::string sl_log_pattern = "Set rdma service level to 5";
@@ -1083,7 +1337,7 @@ class MockClientHandler : public IClientHandler {
     return SUCCESS;
   }
   Status TransferSync(const std::vector<TransferOpDesc> &, TransferOp, uint32_t) override {
-    return SUCCESS;
+    return sync_ret;
   }
   Status GetTransferStatus(const TransferReq &req, TransferStatus &status) override {
     auto it = status_by_req.find(req);
@@ -1094,14 +1348,19 @@ class MockClientHandler : public IClientHandler {
     status = it->second;
     return SUCCESS;
   }
+  bool IsOrderedBefore(const TransferReq &req, const std::vector<TransferOpDesc> &) const override {
+    return ordered_reqs.count(req) > 0U;
+  }
   Status Finalize() override {
     return SUCCESS;
   }
   void Dump(const char *, DumpLogLevel = DumpLogLevel::EVENT) const override {}
 
   std::map<TransferReq, TransferStatus> status_by_req;
+  std::set<TransferReq> ordered_reqs;
   TransferStatus default_status = TransferStatus::WAITING;
   Status default_ret = SUCCESS;
+  Status sync_ret = SUCCESS;
 };
 
 static ClientPtr CreateMockClient() {
@@ -1194,6 +1453,230 @@ TEST(ClientManagerTest, GetOrCreateClientReturnsExistingClient) {
   EXPECT_EQ(manager.Finalize(), SUCCESS);
 }
 
+TEST(ClientManagerTest, ClassifyTransferFailureSeparatesRequestAndChannel) {
+  for (Status ret : {PARAM_INVALID, RESOURCE_EXHAUSTED, UNSUPPORTED, TIMEOUT}) {
+    EXPECT_EQ(ClassifyTransferFailure(ret, 1U), FailureScope::kRequest);
+  }
+  for (Status ret : {FAILED, NOT_CONNECTED}) {
+    EXPECT_EQ(ClassifyTransferFailure(ret), FailureScope::kChannel);
+  }
+  // 连续超时达到上限后升级为链路级
+  EXPECT_EQ(ClassifyTransferFailure(TIMEOUT, 2U), FailureScope::kRequest);
+  EXPECT_EQ(ClassifyTransferFailure(TIMEOUT, 3U), FailureScope::kChannel);
+}
+
+// 单次超时不重建链路，连续超时才重建；中间有一次成功即重新计数
+TEST(ClientManagerTest, ConsecutiveTimeoutsEscalateToChannelFailure) {
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  auto client = CreateMockClient(std::move(handler));
+  const std::vector<TransferOpDesc> descs{{0x1000U, 0x2000U, 8U}};
+  mock_handler->sync_ret = TIMEOUT;
+  EXPECT_EQ(client->TransferSync(descs, READ, kTimeOut), TIMEOUT);
+  EXPECT_EQ(client->TransferSync(descs, READ, kTimeOut), TIMEOUT);
+  EXPECT_EQ(client->GetConsecutiveTimeouts(), 2U);
+  EXPECT_EQ(ClassifyTransferFailure(TIMEOUT, client->GetConsecutiveTimeouts()), FailureScope::kRequest);
+
+  mock_handler->sync_ret = SUCCESS;
+  EXPECT_EQ(client->TransferSync(descs, READ, kTimeOut), SUCCESS);
+  EXPECT_EQ(client->GetConsecutiveTimeouts(), 0U);
+
+  mock_handler->sync_ret = TIMEOUT;
+  for (uint32_t i = 0U; i < 3U; ++i) {
+    EXPECT_EQ(client->TransferSync(descs, READ, kTimeOut), TIMEOUT);
+  }
+  EXPECT_EQ(ClassifyTransferFailure(TIMEOUT, client->GetConsecutiveTimeouts()), FailureScope::kChannel);
+}
+
+// 移除BULK请求时已下发块仍未结束，需保留并在后续查询中回收，不能随请求一起丢弃
+TEST(ClientManagerTest, RemoveBulkTransferKeepsInflightChunkUntilFinished) {
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  auto client = CreateMockClient(std::move(handler));
+  const TransferReq chunk = reinterpret_cast<TransferReq>(0x5000);
+  const TransferReq done_chunk = reinterpret_cast<TransferReq>(0x5001);
+  mock_handler->status_by_req[chunk] = TransferStatus::WAITING;
+  mock_handler->status_by_req[done_chunk] = TransferStatus::COMPLETED;
+  auto bulk = std::make_unique<HixlClient::BulkTransfer>();
+  bulk->chunks.resize(3U);
+  bulk->next_chunk = 2U;
+  bulk->inflight = {chunk, done_chunk};
+  const TransferReq bulk_req = bulk.get();
+  client->bulk_transfers_[bulk_req] = std::move(bulk);
+  client->req_map_[bulk_req] = TransferInfo{0U, READ, AscendString()};
+
+  client->RemoveTransferReq(bulk_req);
+  EXPECT_TRUE(client->bulk_transfers_.empty());
+  ASSERT_EQ(client->abandoned_chunks_.size(), 1U);
+  EXPECT_EQ(client->abandoned_chunks_.front(), chunk);
+
+  // 后续查询任意请求时回收已结束的块
+  const TransferReq req = reinterpret_cast<TransferReq>(0x6000);
+  client->req_map_[req] = TransferInfo{0U, READ, AscendString()};
+  mock_handler->status_by_req[req] = TransferStatus::COMPLETED;
+  TransferStatus status = TransferStatus::WAITING;
+  EXPECT_EQ(client->GetTransferStatus(req, status), SUCCESS);
+  EXPECT_EQ(client->abandoned_chunks_.size(), 1U);
+  mock_handler->status_by_req[chunk] = TransferStatus::COMPLETED;
+  client->req_map_[req] = TransferInfo{0U, READ, AscendString()};
+  EXPECT_EQ(client->GetTransferStatus(req, status), SUCCESS);
+  EXPECT_TRUE(client->abandoned_chunks_.empty());
+}
+
+// 窗口内任一块失败即结束整个BULK请求，不再下发后续块，其余在途块留待回收
+TEST(ClientManagerTest, BulkTransferFailsOnAnyInflightChunk) {
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  auto client = CreateMockClient(std::move(handler));
+  const TransferReq waiting_chunk = reinterpret_cast<TransferReq>(0x5000);
+  const TransferReq failed_chunk = reinterpret_cast<TransferReq>(0x5001);
+  mock_handler->status_by_req[waiting_chunk] = TransferStatus::WAITING;
+  mock_handler->status_by_req[failed_chunk] = TransferStatus::FAILED;
+  HixlClient::BulkTransfer bulk;
+  bulk.chunks.resize(4U);
+  bulk.next_chunk = 2U;
+  bulk.inflight = {waiting_chunk, failed_chunk};
+
+  TransferStatus status = TransferStatus::WAITING;
+  EXPECT_EQ(client->QueryBulkTransfer(bulk, status), SUCCESS);
+  EXPECT_EQ(status, TransferStatus::FAILED);
+  EXPECT_TRUE(bulk.inflight.empty());
+  EXPECT_EQ(bulk.next_chunk, 2U);
+  ASSERT_EQ(client->abandoned_chunks_.size(), 1U);
+  EXPECT_EQ(client->abandoned_chunks_.front(), waiting_chunk);
+}
+
+// notify只等待未与其同通道保序的WRITE请求，READ请求与保序的WRITE请求不阻塞notify
+TEST(ClientManagerTest, NotifyFencesOnlyUnorderedCoveredWrites) {
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  auto client = CreateMockClient(std::move(handler));
+  const TransferReq ordered_write = reinterpret_cast<TransferReq>(0x5000);
+  const TransferReq unordered_write = reinterpret_cast<TransferReq>(0x5001);
+  const TransferReq read = reinterpret_cast<TransferReq>(0x5002);
+  client->req_map_[ordered_write] = TransferInfo{0U, WRITE, AscendString()};
+  client->req_map_[unordered_write] = TransferInfo{0U, WRITE, AscendString()};
+  client->req_map_[read] = TransferInfo{0U, READ, AscendString()};
+  mock_handler->ordered_reqs.insert(ordered_write);
+  mock_handler->status_by_req[unordered_write] = TransferStatus::WAITING;
+
+  EXPECT_EQ(client->FenceCoveredWrites({}, 1), TIMEOUT);
+  EXPECT_TRUE(client->fenced_reqs_.empty());
+  mock_handler->status_by_req[unordered_write] = TransferStatus::COMPLETED;
+  EXPECT_EQ(client->FenceCoveredWrites({}, kTimeOut), SUCCESS);
+  ASSERT_EQ(client->fenced_reqs_.size(), 1U);
+  EXPECT_EQ(client->fenced_reqs_[unordered_write], TransferStatus::COMPLETED);
+
+  // BULK写的剩余块在notify前全部下发，不受窗口限制
+  auto bulk = std::make_unique<HixlClient::BulkTransfer>();
+  bulk->operation = WRITE;
+  bulk->chunks.resize(kBulkInflightChunks + 2U);
+  auto *bulk_ptr = bulk.get();
+  client->bulk_transfers_[bulk_ptr] = std::move(bulk);
+  client->req_map_[bulk_ptr] = TransferInfo{0U, WRITE, AscendString()};
+  mock_handler->ordered_reqs.insert(nullptr);
+  EXPECT_EQ(client->FenceCoveredWrites({}, kTimeOut), SUCCESS);
+  EXPECT_EQ(bulk_ptr->next_chunk, kBulkInflightChunks + 2U);
+  EXPECT_EQ(client->fenced_reqs_.count(bulk_ptr), 0U);
+}
+
+// 槽位写失败后待其余在途槽位写结束再重新同步
+TEST(ClientManagerTest, FailedNotifyWriteMarksSlotsForResync) {
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  auto client = CreateMockClient(std::move(handler));
+  const TransferReq failed_write = reinterpret_cast<TransferReq>(0x5000);
+  const TransferReq waiting_write = reinterpret_cast<TransferReq>(0x5001);
+  mock_handler->status_by_req[failed_write] = TransferStatus::FAILED;
+  mock_handler->status_by_req[waiting_write] = TransferStatus::WAITING;
+  client->notify_writes_ = {failed_write, waiting_write};
+
+  EXPECT_FALSE(client->ReapNotifyWrites());
+  EXPECT_TRUE(client->notify_resync_pending_);
+  ASSERT_EQ(client->notify_writes_.size(), 1U);
+  EXPECT_EQ(client->notify_writes_.front(), waiting_write);
+  client->remote_notify_ring_ = 0x1000U;
+  EXPECT_EQ(client->PrepareNotifySlots(1), TIMEOUT);
+  EXPECT_TRUE(client->notify_resync_pending_);
+}
+
+TEST(ClientManagerTest, TransferStatisticsUseRequestInfoAndCachedPeer) {
+  TransferTelemetry telemetry;
+  ClientConfig config{};
+  config.remote_engine = "127.0.0.1:26300";
+  config.telemetry_peer = telemetry.GetPeer(config.remote_engine);
+  auto client = std::make_shared<HixlClient>("127.0.0.1", 26300, config);
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  client->client_handler_ = std::move(handler);
+  client->is_connected_ = true;
+
+  TransferOpDesc desc{0x1000U, 0x2000U, 64U};
+  EXPECT_EQ(client->TransferSync({desc, desc}, READ, 1000U), SUCCESS);
+  TransferReq req = reinterpret_cast<TransferReq>(0x7000);
+  EXPECT_EQ(client->TransferAsync({desc}, WRITE, TransferArgs{}, req), SUCCESS);
+  ASSERT_EQ(client->req_map_.count(req), 1U);
+  EXPECT_EQ(client->req_map_[req].bytes, 64U);
+  TransferStatus status = TransferStatus::WAITING;
+  EXPECT_EQ(client->GetTransferStatus(req, status), SUCCESS);
+  EXPECT_EQ(telemetry.Query(config.remote_engine).write.total_ops, 0U);
+  mock_handler->status_by_req[req] = TransferStatus::COMPLETED;
+  EXPECT_EQ(client->GetTransferStatus(req, status), SUCCESS);
+  EXPECT_EQ(status, TransferStatus::COMPLETED);
+  const auto statistics = telemetry.Query(config.remote_engine);
+  EXPECT_EQ(statistics.read.total_ops, 1U);
+  EXPECT_EQ(statistics.read.total_bytes, 128U);
+  EXPECT_EQ(statistics.write.total_ops, 1U);
+  EXPECT_EQ(statistics.write.total_bytes, 64U);
+  // 起始时间随请求对象释放，不在client之外遗留
+  EXPECT_TRUE(client->req_map_.empty());
+}
+
+TEST(ClientManagerTest, ClearTransferReqsQueriesInflightBulkChunk) {
+  auto handler = std::make_unique<MockClientHandler>();
+  auto *mock_handler = handler.get();
+  auto client = CreateMockClient(std::move(handler));
+  const TransferReq chunk = reinterpret_cast<TransferReq>(0x5000);
+  mock_handler->status_by_req[chunk] = TransferStatus::COMPLETED;
+  auto bulk = std::make_unique<HixlClient::BulkTransfer>();
+  bulk->chunks.resize(1U);
+  bulk->next_chunk = 1U;
+  bulk->inflight = {chunk};
+  auto *bulk_ptr = bulk.get();
+  client->bulk_transfers_[bulk_ptr] = std::move(bulk);
+  client->req_map_[bulk_ptr] = TransferInfo{0U, READ, AscendString()};
+  client->fenced_reqs_[bulk_ptr] = TransferStatus::WAITING;
+
+  client->ClearTransferReqs();
+  EXPECT_TRUE(client->bulk_transfers_.empty());
+  EXPECT_TRUE(client->req_map_.empty());
+  EXPECT_TRUE(client->fenced_reqs_.empty());
+  EXPECT_TRUE(client->abandoned_chunks_.empty());
+}
+
+TEST(ClientManagerTest, RebuildClientAsyncDetachesBrokenClientAndReleasesWaiters) {
+  ClientManager manager;
+  EXPECT_EQ(manager.Initialize(false), SUCCESS);
+  auto client = CreateMockClient();
+  manager.clients_["127.0.0.1:26300"] = client;
+  const TransferReq req = reinterpret_cast<TransferReq>(0x1000);
+  manager.RegisterTransferReq(req, client, nullptr);
+
+  // 非当前注册的client不会触发重建
+  auto stale = CreateMockClient();
+  auto prepare = []() { return FAILED; };
+  EXPECT_FALSE(manager.RebuildClientAsync(stale, {}, prepare));
+  EXPECT_EQ(manager.GetClient("127.0.0.1:26300"), client);
+
+  EXPECT_TRUE(manager.RebuildClientAsync(client, {}, prepare));
+  EXPECT_FALSE(manager.RebuildClientAsync(client, {}, prepare));
+  // 重建失败后等待方被唤醒，链路保持断开
+  EXPECT_EQ(manager.AwaitClient("127.0.0.1:26300", kTimeOut), nullptr);
+  EXPECT_EQ(manager.GetClientByReq(req), nullptr);
+  EXPECT_FALSE(client->is_connected_);
+  EXPECT_EQ(manager.Finalize(), SUCCESS);
+}
+
 TEST(HixlEngineLifecycleTest, CheckInitializedRejectsConnectAndRegisterMem) {
   HixlEngine engine("127.0.0.1:26200");
   engine.is_initialized_ = false;
@@ -1372,7 +1855,7 @@ TEST(HixlEngineBatchStatusTest, SkipWaitingAndMaxQueryCountFilterResults) {
   EXPECT_EQ(engine.client_manager_.Finalize(), SUCCESS);
 }
 
-TEST(HixlEngineBatchStatusTest, FailedRetAutoDisconnectDedupForSameEngine) {
+TEST(HixlEngineBatchStatusTest, FailedRetChannelFaultDedupForSameEngine) {
   HixlEngine engine("127.0.0.1:26200");
   DisconnectedBatchStatusContext ctx{};
   SetupDisconnectedEngineWithFailedTransferReqs(engine, ctx, nullptr, nullptr);
@@ -214,6 +214,28 @@ TEST_F(HixlOptionsUTest, ParseAutoConnectEmpty) {
   EXPECT_EQ(HixlOptions::Parse(options, result), PARAM_INVALID);
 }
 
+TEST_F(HixlOptionsUTest, ParseEnableMemNotify) {
+  std::map<AscendString, AscendString> options;
+  options[hixl::OPTION_ENABLE_MEM_NOTIFY] = "1";
+  HixlOptions result;
+  EXPECT_EQ(HixlOptions::Parse(options, result), SUCCESS);
+  ASSERT_TRUE(result.EnableMemNotify().has_value());
+  EXPECT_TRUE(*result.EnableMemNotify());
+  options[hixl::OPTION_ENABLE_MEM_NOTIFY] = "2";
+  EXPECT_EQ(HixlOptions::Parse(options, result), PARAM_INVALID);
+}
+
+TEST_F(HixlOptionsUTest, ParseEnableMultiRail) {
+  std::map<AscendString, AscendString> options;
+  options[hixl::OPTION_ENABLE_MULTI_RAIL] = "1";
+  HixlOptions result;
+  EXPECT_EQ(HixlOptions::Parse(options, result), SUCCESS);
+  ASSERT_TRUE(result.EnableMultiRail().has_value());
+  EXPECT_TRUE(*result.EnableMultiRail());
+  options[hixl::OPTION_ENABLE_MULTI_RAIL] = "";
+  EXPECT_EQ(HixlOptions::Parse(options, result), PARAM_INVALID);
+}
+
 TEST_F(HixlOptionsUTest, ParseGlobalResourceConfigFabricMemory) {
   std::map<AscendString, AscendString> options;
   options[hixl::OPTION_GLOBAL_RESOURCE_CONFIG] =
@@ -651,6 +673,32 @@ TEST_F(HixlOptionsUTest, ParseConfigQosMax) {
   EXPECT_EQ(static_cast<uint32_t>(result.GlobalResourceCfg()->comm_resource_config.qos.value()), 7U);
 }
 
+TEST_F(HixlOptionsUTest, ParseConfigTransport) {
+  std::map<ge::AscendString, ge::AscendString> options;
+  HixlOptions result;
+  EXPECT_EQ(HixlOptions::Parse(options, result), SUCCESS);
+  EXPECT_FALSE(result.UseLoopbackTransport());
+
+  options[ge::AscendString(hixl::OPTION_GLOBAL_RESOURCE_CONFIG)] =
+      ge::AscendString(R"({"comm_resource_config.transport": "loopback"})");
+  EXPECT_EQ(HixlOptions::Parse(options, result), SUCCESS);
+  EXPECT_TRUE(result.UseLoopbackTransport());
+
+  options[ge::AscendString(hixl::OPTION_GLOBAL_RESOURCE_CONFIG)] =
+      ge::AscendString(R"({"comm_resource_config.transport": "hcomm"})");
+  HixlOptions hcomm_result;
+  EXPECT_EQ(HixlOptions::Parse(options, hcomm_result), SUCCESS);
+  EXPECT_FALSE(hcomm_result.UseLoopbackTransport());
+
+  options[ge::AscendString(hixl::OPTION_GLOBAL_RESOURCE_CONFIG)] =
+      ge::AscendString(R"({"comm_resource_config.transport": "shm"})");
+  HixlOptions invalid_result;
+  EXPECT_EQ(HixlOptions::Parse(options, invalid_result), PARAM_INVALID);
+  options[ge::AscendString(hixl::OPTION_GLOBAL_RESOURCE_CONFIG)] =
+      ge::AscendString(R"({"comm_resource_config.transport": 1})");
+  EXPECT_EQ(HixlOptions::Parse(options, invalid_result), PARAM_INVALID);
+}
+
 TEST_F(HixlOptionsUTest, ParseConfigQosInValidMin) {
   std::map<ge::AscendString, ge::AscendString> options;
   std::string json_str = R"({"comm_resource_config.qos": -1})";
@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#define private public
+#include "engine/multi_rail.h"
+#undef private
+#include "engine/endpoint_matcher.h"
+#include "common/hixl_inner_types.h"
+
+namespace hixl {
+namespace test {
+namespace {
+constexpr uint64_t kLocalBase = 0x100000000ULL;
+constexpr uint64_t kRemoteBase = 0x200000000ULL;
+
+void AddFakeRails(MultiRail &multi_rail, size_t extra_num) {
+  for (size_t i = 0U; i < extra_num; ++i) {
+    multi_rail.rails_.push_back(MultiRail::Rail{nullptr, HandlerCreateArgs::EndpointPair{}, {}});
+    multi_rail.bandwidth_.push_back(1.0);
+    multi_rail.samples_.push_back(0U);
+  }
+}
+
+uint64_t SumLen(const std::vector<HixlOneSideOpDesc> &descs) {
+  uint64_t total = 0U;
+  for (const auto &desc : descs) {
+    total += desc.len;
+  }
+  return total;
+}
+
+EndpointConfig MakeRoceEp(const std::string &comm_id) {
+  EndpointConfig ep{};
+  ep.protocol = kProtocolRoce;
+  ep.comm_id = comm_id;
+  ep.placement = kPlacementDevice;
+  return ep;
+}
+}  // namespace
+
+TEST(MultiRailUTest, SingleRailKeepsDescriptorsIntact) {
+  MultiRail multi_rail(CommType::COMM_TYPE_ROCE, nullptr);
+  std::vector<TransferOpDesc> op_descs = {{kLocalBase, kRemoteBase, 64ULL * kMinRailStripeSize}};
+  std::vector<std::vector<HixlOneSideOpDesc>> per_rail;
+  multi_rail.Split(op_descs, per_rail);
+  ASSERT_EQ(per_rail.size(), 1U);
+  ASSERT_EQ(per_rail[0].size(), 1U);
+  EXPECT_EQ(per_rail[0][0].len, op_descs[0].len);
+}
+
+TEST(MultiRailUTest, LargeDescriptorSplitByBandwidth) {
+  MultiRail multi_rail(CommType::COMM_TYPE_ROCE, nullptr);
+  AddFakeRails(multi_rail, 1U);
+  multi_rail.RecordCompletion(0U, 3000U, 1U);
+  multi_rail.RecordCompletion(1U, 1000U, 1U);
+  const uint64_t len = 64ULL * kMinRailStripeSize;
+  std::vector<TransferOpDesc> op_descs = {{kLocalBase, kRemoteBase, len}};
+  std::vector<std::vector<HixlOneSideOpDesc>> per_rail;
+  multi_rail.Split(op_descs, per_rail);
+  ASSERT_EQ(per_rail.size(), 2U);
+  ASSERT_EQ(per_rail[0].size(), 1U);
+  ASSERT_EQ(per_rail[1].size(), 1U);
+  // 慢链路取按权重的对齐份额，余量归最快链路，两段首尾相接
+  EXPECT_EQ(per_rail[1][0].len, len / 4U);
+  EXPECT_EQ(per_rail[1][0].local_buf, reinterpret_cast<void *>(kLocalBase));
+  EXPECT_EQ(per_rail[0][0].local_buf, reinterpret_cast<void *>(kLocalBase + len / 4U));
+  EXPECT_EQ(per_rail[0][0].remote_buf, reinterpret_cast<void *>(kRemoteBase + len / 4U));
+  EXPECT_EQ(SumLen(per_rail[0]) + SumLen(per_rail[1]), len);
+}
+
+TEST(MultiRailUTest, SmallDescriptorsBalancedAcrossRails) {
+  MultiRail multi_rail(CommType::COMM_TYPE_ROCE, nullptr);
+  AddFakeRails(multi_rail, 3U);
+  std::vector<TransferOpDesc> op_descs;
+  for (uint64_t i = 0U; i < 8U; ++i) {
+    op_descs.push_back({kLocalBase + i * 4096U, kRemoteBase + i * 4096U, 4096U});
+  }
+  std::vector<std::vector<HixlOneSideOpDesc>> per_rail;
+  multi_rail.Split(op_descs, per_rail);
+  ASSERT_EQ(per_rail.size(), 4U);
+  for (const auto &descs : per_rail) {
+    EXPECT_EQ(descs.size(), 2U);
+  }
+}
+
+TEST(MultiRailUTest, UnmeasuredRailUsesMeanBandwidth) {
+  MultiRail multi_rail(CommType::COMM_TYPE_ROCE, nullptr);
+  AddFakeRails(multi_rail, 1U);
+  multi_rail.RecordCompletion(0U, 5000U, 1U);
+  const auto weights = multi_rail.SnapshotWeights();
+  ASSERT_EQ(weights.size(), 2U);
+  EXPECT_DOUBLE_EQ(weights[1], weights[0]);
+  multi_rail.RecordCompletion(0U, 1000U, 1U);
+  EXPECT_DOUBLE_EQ(multi_rail.GetBandwidth(0U), 0.75 * 5000.0 + 0.25 * 1000.0);
+}
+
+TEST(MultiRailUTest, QueryFailureReleasesOtherRails) {
+  MultiRail multi_rail(CommType::COMM_TYPE_ROCE, nullptr);
+  AddFakeRails(multi_rail, 2U);
+  StripedRequest req;
+  for (uint32_t rail = 0U; rail < 3U; ++rail) {
+    req.pending.push_back(StripedRequest::RailHandle{rail, nullptr, kMinRailStripeSize});
+  }
+  // 空句柄查询失败，首个分片失败后其余分片交还对应链路client且不阻塞等待，调用方随即丢弃该请求
+  HixlCompleteStatus status = HIXL_COMPLETE_STATUS_WAITING;
+  EXPECT_NE(multi_rail.Query(req, status), SUCCESS);
+  EXPECT_EQ(status, HIXL_COMPLETE_STATUS_FAILED);
+  EXPECT_TRUE(req.pending.empty());
+}
+
+TEST(MultiRailUTest, MatchRailPairsSkipsUsedEndpoints) {
+  std::vector<EndpointConfig> local = {MakeRoceEp("10.0.0.1"), MakeRoceEp("10.0.0.2"), MakeRoceEp("10.0.0.3")};
+  std::vector<EndpointConfig> remote = {MakeRoceEp("10.0.1.1"), MakeRoceEp("10.0.1.2")};
+  std::vector<HandlerCreateArgs::EndpointPair> primary = {{local[0], remote[0], CommType::COMM_TYPE_ROCE}};
+  std::vector<HandlerCreateArgs::EndpointPair> rail_pairs;
+  EndpointMatcher::MatchRailPairs(local, remote, primary, kMaxRailNum, rail_pairs);
+  ASSERT_EQ(rail_pairs.size(), 1U);
+  EXPECT_EQ(rail_pairs[0].local.comm_id, "10.0.0.2");
+  EXPECT_EQ(rail_pairs[0].remote.comm_id, "10.0.1.2");
+  EXPECT_EQ(rail_pairs[0].type, CommType::COMM_TYPE_ROCE);
+
+  rail_pairs.clear();
+  EndpointMatcher::MatchRailPairs(local, remote, primary, 1U, rail_pairs);
+  EXPECT_TRUE(rail_pairs.empty());
+}
+}  // namespace test
+}  // namespace hixl
@@ -94,6 +94,22 @@ TEST_F(FabricMemConfigParserUTest, AllFieldsParsedCorrectly) {
   EXPECT_TRUE(grc->fabric_memory.enable_aicpu_unfold.value());
 }
 
+TEST_F(FabricMemConfigParserUTest, CacheFieldsParsedAndReserveNumBounded) {
+  auto options = MakeOptionsWithJson(
+      R"({"fabric_memory.cache_capacity": 4096, "fabric_memory.reserve_block_size": 64,
+          "fabric_memory.reserve_block_num": 32})");
+  HixlOptions result;
+  EXPECT_EQ(HixlOptions::Parse(options, result), SUCCESS);
+  auto grc = result.GlobalResourceCfg();
+  ASSERT_TRUE(grc.has_value());
+  EXPECT_EQ(grc->fabric_memory.cache_capacity.value(), 4096UL);
+  EXPECT_EQ(grc->fabric_memory.reserve_block_size.value(), 64UL);
+  EXPECT_EQ(grc->fabric_memory.reserve_block_num.value(), 32UL);
+
+  auto invalid = MakeOptionsWithJson(R"({"fabric_memory": {"reserve_block_num": 65536}})");
+  EXPECT_EQ(HixlOptions::Parse(invalid, result), PARAM_INVALID);
+}
+
 TEST_F(FabricMemConfigParserUTest, InvalidJsonReturnsError) {
   auto options = MakeOptionsWithJson("{invalid json");
   HixlOptions result;
@@ -1158,6 +1158,68 @@ TEST_F(FabricMemTransferServiceUTest, ExportToShareableHandleFailsWhenExportAclF
   VirtualMemoryManager::GetInstance().Finalize();
 }
 
+TEST_F(FabricMemTransferServiceUTest, MallocMemReusesCachedAllocationOfSameSizeClass) {
+  VirtualMemoryManager::GetInstance().Finalize();
+  ASSERT_EQ(VirtualMemoryManager::GetInstance().Initialize(), SUCCESS);
+  constexpr size_t kBlockSize = 2UL * 1024UL * 1024UL;
+  FabricMemCacheConfig config;
+  config.cache_capacity = 2U * kBlockSize;
+  config.reserve_block_size = kBlockSize;
+  config.reserve_block_num = 1U;
+  ASSERT_EQ(FabricMemAllocator::Initialize(config), SUCCESS);
+  EXPECT_EQ(runtime_->malloc_physical_count_, 1U);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), kBlockSize);
+
+  // The reserved block serves a smaller request of the same size class without driver calls.
+  void *first = nullptr;
+  ASSERT_EQ(FabricMemTransferService::MallocMem(MEM_DEVICE, kLen, &first), SUCCESS);
+  EXPECT_EQ(runtime_->malloc_physical_count_, 1U);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), 0U);
+
+  // Freed allocation keeps its mapping and is handed out again.
+  ASSERT_EQ(FabricMemTransferService::FreeMem(first), SUCCESS);
+  EXPECT_EQ(runtime_->free_physical_count_, 0U);
+  aclrtMemFabricHandle handle{};
+  EXPECT_EQ(FabricMemTransferService::ExportToShareableHandle(first, handle), PARAM_INVALID);
+  void *second = nullptr;
+  ASSERT_EQ(FabricMemTransferService::MallocMem(MEM_DEVICE, kBlockSize, &second), SUCCESS);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(runtime_->malloc_physical_count_, 1U);
+
+  // An exported share handle cannot be revoked, so the allocation is released rather than reused.
+  ASSERT_EQ(FabricMemTransferService::ExportToShareableHandle(second, handle), SUCCESS);
+  EXPECT_EQ(runtime_->mem_export_count_, 1U);
+  ASSERT_EQ(FabricMemTransferService::FreeMem(second), SUCCESS);
+  EXPECT_EQ(runtime_->free_physical_count_, 1U);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), 0U);
+  void *third = nullptr;
+  ASSERT_EQ(FabricMemTransferService::MallocMem(MEM_DEVICE, kBlockSize, &third), SUCCESS);
+  EXPECT_EQ(runtime_->malloc_physical_count_, 2U);
+
+  // A second engine shares the cache; finalizing the first one keeps the cache alive for it.
+  FabricMemCacheConfig other_config;
+  other_config.cache_capacity = 2U * kBlockSize;
+  ASSERT_EQ(FabricMemAllocator::Initialize(other_config), SUCCESS);
+  ASSERT_EQ(FabricMemTransferService::FreeMem(third), SUCCESS);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), kBlockSize);
+  FabricMemAllocator::Finalize(config);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), kBlockSize);
+  EXPECT_EQ(runtime_->free_physical_count_, 1U);
+  FabricMemAllocator::Finalize(other_config);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), 0U);
+  EXPECT_EQ(runtime_->free_physical_count_, 2U);
+  VirtualMemoryManager::GetInstance().Finalize();
+}
+
+TEST_F(FabricMemTransferServiceUTest, AllocationCacheRejectsReserveNumWithoutBlockSize) {
+  FabricMemCacheConfig config;
+  config.cache_capacity = 4UL * 1024UL * 1024UL;
+  config.reserve_block_num = 1U;
+  EXPECT_EQ(FabricMemAllocator::Initialize(config), PARAM_INVALID);
+  EXPECT_EQ(runtime_->malloc_physical_count_, 0U);
+  EXPECT_EQ(FabricMemAllocator::GetCachedBytes(), 0U);
+}
+
 TEST_F(FabricMemTransferServiceUTest, MallocMemFreesPhysicalWhenReserveFails) {
   VirtualMemoryManager::GetInstance().Finalize();
 
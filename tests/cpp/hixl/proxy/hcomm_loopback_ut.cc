@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2026 Huawei Technologies Co., Ltd.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+/**
+ * @file hcomm_loopback_ut.cc
+ * @brief HcommLoopback 单元测试
+ *
+ * 测试覆盖：
+ * - 内存注册/导出/导入的描述符往返
+ * - 单边读写以内存拷贝完成
+ * - BatchTransfer 读写混合与不支持的传输类型
+ * - Channel 状态查询
+ * - 未导入或已注销范围的读写被拒绝，伪造的本进程描述符无法导入
+ * - HcommProxy 仅将标记过的 endpoint 及其 channel 路由到回环后端
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+#include "hccl/hccl_types.h"
+#include "proxy/hcomm_loopback.h"
+#include "proxy/hcomm_proxy.h"
+
+namespace hixl {
+
+class HcommLoopbackTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    EndpointDesc endpoint_desc{};
+    endpoint_desc.protocol = COMM_PROTOCOL_ROCE;
+    HcommLoopback::MarkEndpoint(endpoint_desc);
+    ASSERT_EQ(HcommLoopback::EndpointCreate(&endpoint_desc, &endpoint_), HCCL_SUCCESS);
+  }
+
+  void TearDown() override {
+    EXPECT_EQ(HcommLoopback::EndpointDestroy(endpoint_), HCCL_SUCCESS);
+  }
+
+  // 注册并导入一段host内存，返回导入侧看到的地址
+  void *RegisterAndImport(std::vector<uint8_t> &buffer, HcommMemHandle &mem_handle) {
+    CommMem mem{COMM_MEM_TYPE_HOST, buffer.data(), buffer.size()};
+    EXPECT_EQ(HcommLoopback::MemReg(endpoint_, "ut", &mem, &mem_handle), HCCL_SUCCESS);
+    void *mem_desc = nullptr;
+    uint32_t mem_desc_len = 0U;
+    EXPECT_EQ(HcommLoopback::MemExport(endpoint_, mem_handle, &mem_desc, &mem_desc_len), HCCL_SUCCESS);
+    CommMem imported{};
+    EXPECT_EQ(HcommLoopback::MemImport(endpoint_, mem_desc, mem_desc_len, &imported), HCCL_SUCCESS);
+    EXPECT_EQ(imported.type, COMM_MEM_TYPE_HOST);
+    EXPECT_EQ(imported.size, buffer.size());
+    return imported.addr;
+  }
+
+  EndpointHandle endpoint_ = nullptr;
+};
+
+TEST_F(HcommLoopbackTest, ExportImportRoundTrip) {
+  std::vector<uint8_t> remote(256U, 0U);
+  HcommMemHandle mem_handle = nullptr;
+  EXPECT_EQ(RegisterAndImport(remote, mem_handle), remote.data());
+
+  uint8_t bad_desc[sizeof(uint64_t) * 4U] = {};
+  CommMem imported{};
+  EXPECT_EQ(HcommLoopback::MemImport(endpoint_, bad_desc, sizeof(bad_desc), &imported), HCCL_E_PARA);
+  EXPECT_EQ(HcommLoopback::MemImport(endpoint_, bad_desc, 1U, &imported), HCCL_E_PARA);
+  EXPECT_EQ(HcommLoopback::MemUnreg(endpoint_, mem_handle), HCCL_SUCCESS);
+  EXPECT_EQ(HcommLoopback::MemUnreg(endpoint_, mem_handle), HCCL_E_PARA);
+}
+
+TEST_F(HcommLoopbackTest, ReadWriteCopyMemory) {
+  std::vector<uint8_t> remote(128U, 0U);
+  std::vector<uint8_t> local(128U, 0xA5U);
+  HcommMemHandle mem_handle = nullptr;
+  auto *remote_addr = static_cast<uint8_t *>(RegisterAndImport(remote, mem_handle));
+
+  EXPECT_EQ(HcommLoopback::Write(1U, 1U, remote_addr, local.data(), local.size()), HCCL_SUCCESS);
+  EXPECT_EQ(remote, local);
+
+  (void)memset(remote.data(), 0x3C, remote.size());
+  EXPECT_EQ(HcommLoopback::Read(1U, 1U, local.data(), remote_addr + 64U, 64U), HCCL_SUCCESS);
+  EXPECT_EQ(local[0], 0x3CU);
+  EXPECT_EQ(local[63], 0x3CU);
+  EXPECT_EQ(local[64], 0xA5U);
+  EXPECT_EQ(HcommLoopback::ChannelFence(1U, 1U), HCCL_SUCCESS);
+  EXPECT_EQ(HcommLoopback::Write(1U, 1U, nullptr, local.data(), 1U), HCCL_E_PTR);
+  EXPECT_EQ(HcommLoopback::Write(1U, 1U, nullptr, nullptr, 0U), HCCL_SUCCESS);
+  EXPECT_EQ(HcommLoopback::MemUnreg(endpoint_, mem_handle), HCCL_SUCCESS);
+}
+
+TEST_F(HcommLoopbackTest, BatchTransferMixedOps) {
+  std::vector<uint8_t> remote(64U, 0x11U);
+  std::vector<uint8_t> local(64U, 0x22U);
+  HcommMemHandle mem_handle = nullptr;
+  auto *remote_addr = static_cast<uint8_t *>(RegisterAndImport(remote, mem_handle));
+
+  HcommBatchTransferDesc descs[3] = {};
+  descs[0].transType = HCOMM_TRANSFER_TYPE_WRITE;
+  descs[0].transferInfo.write.dst = remote_addr;
+  descs[0].transferInfo.write.src = local.data();
+  descs[0].transferInfo.write.len = 32U;
+  descs[1].transType = HCOMM_TRANSFER_TYPE_READ;
+  descs[1].transferInfo.read.dst = local.data() + 32U;
+  descs[1].transferInfo.read.src = remote_addr + 32U;
+  descs[1].transferInfo.read.len = 32U;
+  descs[2].transType = HCOMM_TRANSFER_TYPE_NOTIFY_RECORD;
+  EXPECT_EQ(HcommLoopback::BatchTransfer(1U, 1U, descs, 3U), HCCL_SUCCESS);
+  EXPECT_EQ(remote[0], 0x22U);
+  EXPECT_EQ(remote[32], 0x11U);
+  EXPECT_EQ(local[32], 0x11U);
+
+  descs[0].transType = HCOMM_TRANSFER_TYPE_WRITE_REDUCE;
+  EXPECT_EQ(HcommLoopback::BatchTransfer(1U, 1U, descs, 1U), HCCL_E_NOT_SUPPORT);
+  EXPECT_EQ(HcommLoopback::MemUnreg(endpoint_, mem_handle), HCCL_SUCCESS);
+}
+
+TEST_F(HcommLoopbackTest, ChannelStatusFollowsLifecycle) {
+  HcommChannelDesc channel_desc{};
+  ChannelHandle channel = 0U;
+  ASSERT_EQ(HcommLoopback::ChannelCreate(endpoint_, COMM_ENGINE_CPU, &channel_desc, 1U, &channel), HCCL_SUCCESS);
+  int32_t status = -1;
+  EXPECT_EQ(HcommLoopback::ChannelGetStatus(&channel, 1U, &status), HCCL_SUCCESS);
+  EXPECT_EQ(status, 0);
+  EXPECT_EQ(HcommLoopback::ChannelDestroy(&channel, 1U), HCCL_SUCCESS);
+  EXPECT_EQ(HcommLoopback::ChannelGetStatus(&channel, 1U, &status), HCCL_SUCCESS);
+  EXPECT_EQ(status, 2);
+
+  uint32_t port = 1U;
+  EXPECT_EQ(HcommLoopback::EndpointGetListenPort(endpoint_, &port), HCCL_SUCCESS);
+  EXPECT_EQ(port, 0U);
+}
+
+TEST_F(HcommLoopbackTest, RejectsRangesOutsideImportedMemory) {
+  std::vector<uint8_t> remote(64U, 0U);
+  std::vector<uint8_t> local(64U, 0x5AU);
+  std::vector<uint8_t> other(64U, 0U);
+  HcommMemHandle mem_handle = nullptr;
+  auto *remote_addr = static_cast<uint8_t *>(RegisterAndImport(remote, mem_handle));
+
+  EXPECT_EQ(HcommLoopback::Write(1U, 1U, other.data(), local.data(), local.size()), HCCL_E_PARA);
+  EXPECT_EQ(HcommLoopback::Read(1U, 1U, local.data(), remote_addr + 32U, 64U), HCCL_E_PARA);
+  EXPECT_EQ(other[0], 0U);
+
+  // 注销后导入的范围随之失效，不再回退到进程内拷贝
+  EXPECT_EQ(HcommLoopback::MemUnreg(endpoint_, mem_handle), HCCL_SUCCESS);
+  EXPECT_EQ(HcommLoopback::Write(1U, 1U, remote_addr, local.data(), local.size()), HCCL_E_PARA);
+  EXPECT_EQ(remote[0], 0U);
+}
+
+TEST_F(HcommLoopbackTest, RejectsUnregisteredLocalDesc) {
+  std::vector<uint8_t> remote(64U, 0U);
+  CommMem mem{COMM_MEM_TYPE_HOST, remote.data(), remote.size()};
+  HcommMemHandle mem_handle = nullptr;
+  ASSERT_EQ(HcommLoopback::MemReg(endpoint_, "ut", &mem, &mem_handle), HCCL_SUCCESS);
+  void *mem_desc = nullptr;
+  uint32_t mem_desc_len = 0U;
+  ASSERT_EQ(HcommLoopback::MemExport(endpoint_, mem_handle, &mem_desc, &mem_desc_len), HCCL_SUCCESS);
+
+  // 同进程描述符的地址或长度与注册记录不一致时拒绝导入
+  const std::vector<uint8_t> exported(static_cast<uint8_t *>(mem_desc),
+                                      static_cast<uint8_t *>(mem_desc) + mem_desc_len);
+  std::vector<uint8_t> forged = exported;
+  uint64_t size = 0U;
+  const size_t size_offset = sizeof(uint32_t) + sizeof(int32_t) + sizeof(uint64_t);
+  (void)memcpy(&size, forged.data() + size_offset, sizeof(size));
+  size *= 2U;
+  (void)memcpy(forged.data() + size_offset, &size, sizeof(size));
+  CommMem imported{};
+  EXPECT_EQ(HcommLoopback::MemImport(endpoint_, forged.data(), mem_desc_len, &imported), HCCL_E_PARA);
+
+  // 注销后原描述符同样无法导入
+  EXPECT_EQ(HcommLoopback::MemUnreg(endpoint_, mem_handle), HCCL_SUCCESS);
+  EXPECT_EQ(HcommLoopback::MemImport(endpoint_, exported.data(), mem_desc_len, &imported), HCCL_E_PARA);
+}
+
+TEST(HcommLoopbackRouteTest, ProxyRoutesOnlyMarkedEndpoints) {
+  EndpointDesc endpoint_desc{};
+  endpoint_desc.protocol = COMM_PROTOCOL_ROCE;
+  EXPECT_FALSE(HcommLoopback::IsMarkedEndpoint(endpoint_desc));
+  HcommProxy::MarkLoopbackEndpoint(endpoint_desc);
+  EXPECT_TRUE(HcommLoopback::IsMarkedEndpoint(endpoint_desc));
+
+  EndpointHandle endpoint = nullptr;
+  ASSERT_EQ(HcommProxy::EndpointCreate(&endpoint_desc, &endpoint), HCCL_SUCCESS);
+  EXPECT_TRUE(HcommLoopback::OwnsEndpoint(endpoint));
+  HcommChannelDesc channel_desc{};
+  ChannelHandle channel = 0U;
+  ASSERT_EQ(HcommProxy::ChannelCreate(endpoint, COMM_ENGINE_CPU, &channel_desc, 1U, &channel), HCCL_SUCCESS);
+  EXPECT_TRUE(HcommLoopback::OwnsChannel(channel));
+  EXPECT_EQ(HcommProxy::ChannelFenceOnThread(0U, channel), HCCL_SUCCESS);
+  EXPECT_FALSE(HcommLoopback::OwnsChannel(1U));
+  EXPECT_EQ(HcommProxy::ChannelDestroy(&channel, 1U), HCCL_SUCCESS);
+  EXPECT_EQ(HcommProxy::EndpointDestroy(endpoint), HCCL_SUCCESS);
+  EXPECT_FALSE(HcommLoopback::OwnsEndpoint(endpoint));
+}
+}  // namespace hixl
@@ -8,6 +8,8 @@
  * See LICENSE in the root of the software repository for the full text of the License.
  */
 
+#include <array>
+#include <atomic>
 #include <vector>
 #include <cstdlib>
 #include <gtest/gtest.h>
@@ -75,6 +77,57 @@ class MockRuntime : public llm::AclRuntimeStub {
   int32_t count_ = 0;
 };
 
+class D2HCopyCountingRuntime : public DataCacheEngineRuntimeMock {
+ public:
+  aclError aclrtMemcpyAsync(void *dst, size_t dest_max, const void *src, size_t src_count, aclrtMemcpyKind kind,
+                            aclrtStream stream) override {
+    if (kind == ACL_MEMCPY_DEVICE_TO_HOST) {
+      ++async_d2h_count_;
+    }
+    return DataCacheEngineRuntimeMock::aclrtMemcpyAsync(dst, dest_max, src, src_count, kind, stream);
+  }
+
+  std::atomic<int32_t> async_d2h_count_{0};
+};
+
+class StreamSyncCountingRuntime : public DataCacheEngineRuntimeMock {
+ public:
+  aclError aclrtSynchronizeStreamWithTimeout(aclrtStream stream, int32_t timeout) override {
+    ++sync_count_;
+    return DataCacheEngineRuntimeMock::aclrtSynchronizeStreamWithTimeout(stream, timeout);
+  }
+
+  std::atomic<int32_t> sync_count_{0};
+};
+
+// device 0支持aclrtMemcpyBatch，device 1返回不支持，按device统计批量拷贝调用次数
+class BatchCopyPerDeviceRuntime : public DataCacheEngineRuntimeMock {
+ public:
+  aclError aclrtMemcpyBatch(void **dsts, size_t *destMax, void **srcs, size_t *sizes, size_t numBatches,
+                            aclrtMemcpyBatchAttr *attrs, size_t *attrsIndexex, size_t numAttrs,
+                            size_t *failIndex) override {
+    const auto &device_loc =
+        (attrs[0].dstLoc.type == ACL_MEM_LOCATION_TYPE_DEVICE) ? attrs[0].dstLoc : attrs[0].srcLoc;
+    if (device_loc.id >= batch_counts_.size()) {
+      return ACL_ERROR_RT_PARAM_INVALID;
+    }
+    ++batch_counts_[device_loc.id];
+    if (device_loc.id != 0U) {
+      return ACL_ERROR_RT_FEATURE_NOT_SUPPORT;
+    }
+    return llm::AclRuntimeStub::aclrtMemcpyBatch(dsts, destMax, srcs, sizes, numBatches, attrs, attrsIndexex,
+                                                 numAttrs, failIndex);
+  }
+
+  aclError aclrtCreateContext(aclrtContext *context, int32_t deviceId) override {
+    ++created_contexts_;
+    return DataCacheEngineRuntimeMock::aclrtCreateContext(context, deviceId);
+  }
+
+  std::array<std::atomic<int32_t>, 2U> batch_counts_{};
+  std::atomic<int32_t> created_contexts_{0};
+};
+
 void DrainTaskBatcher(llm::TaskBatcher &generator) {
   std::vector<llm::BufferSlice> buffer_slices;
   while (true) {
@@ -239,6 +292,49 @@ TEST_F(DataCacheEngineTest, RemoveCacheIndices_PrefixKey) {
   cache_engine_.Finalize();
 }
 
+TEST_F(DataCacheEngineTest, RemoveCacheIndices_KeepsOtherCaches) {
+  std::map<ge::AscendString, ge::AscendString> options;
+  options[llm::LLM_OPTION_MEM_POOL_CONFIG] = "{\"memory_size\": 262144}";
+  EXPECT_EQ(cache_engine_.Initialize(options), ge::SUCCESS);
+
+  CacheDesc cache_desc{};
+  cache_desc.num_tensors = 1;
+  cache_desc.placement = 0;
+  cache_desc.shape = {2, 16};
+  cache_desc.data_type = ge::DT_INT32;
+  std::vector<std::vector<int32_t>> host_buffers(3, std::vector<int32_t>(32));
+  std::vector<Cache> caches(host_buffers.size());
+  for (size_t i = 0U; i < caches.size(); ++i) {
+    caches[i].per_device_tensor_addrs = {{reinterpret_cast<uintptr_t>(host_buffers[i].data())}};
+  }
+
+  EXPECT_EQ(cache_engine_.Register(cache_desc, {MakeCacheKey(10, 1, UINT64_MAX), MakeCacheKey(11, 1, UINT64_MAX)},
+                                   caches[0]), ge::SUCCESS);
+  EXPECT_EQ(cache_engine_.Register(cache_desc, {MakeCacheKey(20, 1, UINT64_MAX), MakeCacheKey(21, 1, UINT64_MAX)},
+                                   caches[1]), ge::SUCCESS);
+
+  // Unregister only drops the keys owned by cache 0
+  EXPECT_EQ(cache_engine_.Unregister(caches[0].cache_id), ge::SUCCESS);
+  CacheEntry cache_entry;
+  DataCacheKey data_cache_key;
+  EXPECT_FALSE(cache_manager_.GetCacheEntry(std::make_pair(10UL, 1UL), false, cache_entry));
+  EXPECT_FALSE(cache_manager_.GetCacheEntry(std::make_pair(11UL, 1UL), false, cache_entry));
+  EXPECT_FALSE(cache_manager_.GetCacheKey(std::make_pair(caches[0].cache_id, 1UL), data_cache_key));
+  EXPECT_TRUE(cache_manager_.GetCacheEntry(std::make_pair(20UL, 1UL), false, cache_entry));
+  EXPECT_TRUE(cache_manager_.GetCacheKey(std::make_pair(caches[1].cache_id, 1UL), data_cache_key));
+  EXPECT_EQ(data_cache_key, std::make_pair(21UL, 1UL));
+
+  // a released key can be bound to a new cache and survives unregistering other caches
+  EXPECT_EQ(cache_engine_.Register(cache_desc, {MakeCacheKey(11, 1, UINT64_MAX)}, caches[2]), ge::SUCCESS);
+  EXPECT_EQ(cache_engine_.Unregister(caches[1].cache_id), ge::SUCCESS);
+  EXPECT_FALSE(cache_manager_.GetCacheEntry(std::make_pair(21UL, 1UL), false, cache_entry));
+  EXPECT_TRUE(cache_manager_.GetCacheEntry(std::make_pair(11UL, 1UL), false, cache_entry));
+  EXPECT_EQ(cache_engine_.Unregister(caches[2].cache_id), ge::SUCCESS);
+  EXPECT_FALSE(cache_manager_.GetCacheEntry(std::make_pair(11UL, 1UL), false, cache_entry));
+
+  cache_engine_.Finalize();
+}
+
 TEST_F(DataCacheEngineTest, CopyCache_C2C) {
   std::map<ge::AscendString, ge::AscendString> options;
   // 4 * 64K
@@ -368,6 +464,113 @@ TEST_F(DataCacheEngineTest, CopyCache_B2B) {
   cache_engine_.Finalize();
 }
 
+TEST_F(DataCacheEngineTest, CopyCache_B2B_MultiDevice) {
+  constexpr size_t kDeviceNum = 2U;
+  constexpr size_t kTensorNumPerDevice = 2U;
+  constexpr int64_t kNumBlocks = 8;
+  constexpr int64_t kBlockElems = 4;
+  constexpr int64_t kTensorSize = kNumBlocks * kBlockElems * static_cast<int64_t>(sizeof(int32_t));
+  ASSERT_EQ(cache_manager_.Initialize(false, {0, 1}), ge::SUCCESS);
+
+  std::vector<std::vector<int32_t>> src_tensors(kDeviceNum * kTensorNumPerDevice,
+                                                std::vector<int32_t>(kNumBlocks * kBlockElems));
+  std::vector<std::vector<int32_t>> dst_tensors(kDeviceNum * kTensorNumPerDevice,
+                                                std::vector<int32_t>(kNumBlocks * kBlockElems, -1));
+  std::vector<uintptr_t> src_addrs;
+  std::vector<uintptr_t> dst_addrs;
+  for (size_t i = 0U; i < src_tensors.size(); ++i) {
+    std::iota(src_tensors[i].begin(), src_tensors[i].end(), static_cast<int32_t>(i * 1000U));
+    src_addrs.emplace_back(reinterpret_cast<uintptr_t>(src_tensors[i].data()));
+    dst_addrs.emplace_back(reinterpret_cast<uintptr_t>(dst_tensors[i].data()));
+  }
+  CacheDesc cache_desc{};
+  cache_desc.num_tensors = kDeviceNum * kTensorNumPerDevice;
+  cache_desc.shape = {kNumBlocks, kBlockElems};
+  cache_desc.data_type = ge::DT_INT32;
+  cache_desc.cache_mem_type = CacheMemType::BLOCKS;
+  // host -> device，走批量拷贝
+  cache_desc.placement = static_cast<uint32_t>(CachePlacement::HOST);
+  ASSERT_EQ(cache_manager_.RegisterCacheEntry(100, {}, cache_desc, src_addrs, kTensorSize), ge::SUCCESS);
+  cache_desc.placement = static_cast<uint32_t>(CachePlacement::DEVICE);
+  ASSERT_EQ(cache_manager_.RegisterCacheEntry(101, {}, cache_desc, dst_addrs, kTensorSize), ge::SUCCESS);
+
+  CopyCacheParam cache_param{};
+  cache_param.src_cache_id = 100;
+  cache_param.dst_cache_id = 101;
+  // (1, 2)与(2, 3)两侧均连续，合并为一次拷贝
+  const std::vector<std::pair<uint64_t, uint64_t>> block_infos = {{1, 2}, {2, 3}, {5, 0}, {7, 7}};
+  cache_param.copy_block_infos = block_infos;
+  EXPECT_EQ(cache_manager_.CopyCache(cache_param), ge::SUCCESS);
+
+  for (size_t i = 0U; i < dst_tensors.size(); ++i) {
+    std::vector<int32_t> expected(kNumBlocks * kBlockElems, -1);
+    for (const auto &block_info : block_infos) {
+      std::copy_n(src_tensors[i].begin() + block_info.first * kBlockElems, kBlockElems,
+                  expected.begin() + block_info.second * kBlockElems);
+    }
+    EXPECT_EQ(dst_tensors[i], expected) << "tensor index = " << i;
+  }
+
+  cache_param.copy_block_infos = {{0, 8}};
+  EXPECT_EQ(cache_manager_.CopyCache(cache_param), ge::LLM_PARAM_INVALID);
+  EXPECT_EQ(cache_manager_.UnregisterCacheEntry(100), ge::SUCCESS);
+  EXPECT_EQ(cache_manager_.UnregisterCacheEntry(101), ge::SUCCESS);
+  cache_manager_.Finalize();
+}
+
+TEST_F(DataCacheEngineTest, CopyCache_H2D_BatchCopyPerDevice) {
+  auto runtime = std::make_shared<BatchCopyPerDeviceRuntime>();
+  llm::AclRuntimeStub::SetInstance(runtime);
+  constexpr size_t kDeviceNum = 2U;
+  constexpr int64_t kNumBlocks = 4;
+  constexpr int64_t kBlockElems = 4;
+  constexpr int64_t kTensorSize = kNumBlocks * kBlockElems * static_cast<int64_t>(sizeof(int32_t));
+  ASSERT_EQ(cache_manager_.Initialize(false, {0, 1}), ge::SUCCESS);
+  // 当前device复用已有context，仅device 1新建
+  EXPECT_EQ(runtime->created_contexts_.load(), 1);
+
+  std::vector<std::vector<int32_t>> src_tensors(kDeviceNum, std::vector<int32_t>(kNumBlocks * kBlockElems));
+  std::vector<std::vector<int32_t>> dst_tensors(kDeviceNum, std::vector<int32_t>(kNumBlocks * kBlockElems, -1));
+  std::vector<uintptr_t> src_addrs;
+  std::vector<uintptr_t> dst_addrs;
+  for (size_t i = 0U; i < kDeviceNum; ++i) {
+    std::iota(src_tensors[i].begin(), src_tensors[i].end(), static_cast<int32_t>(i * 1000U));
+    src_addrs.emplace_back(reinterpret_cast<uintptr_t>(src_tensors[i].data()));
+    dst_addrs.emplace_back(reinterpret_cast<uintptr_t>(dst_tensors[i].data()));
+  }
+  CacheDesc cache_desc{};
+  cache_desc.num_tensors = kDeviceNum;
+  cache_desc.shape = {kNumBlocks, kBlockElems};
+  cache_desc.data_type = ge::DT_INT32;
+  cache_desc.cache_mem_type = CacheMemType::BLOCKS;
+  cache_desc.placement = static_cast<uint32_t>(CachePlacement::HOST);
+  ASSERT_EQ(cache_manager_.RegisterCacheEntry(100, {}, cache_desc, src_addrs, kTensorSize), ge::SUCCESS);
+  cache_desc.placement = static_cast<uint32_t>(CachePlacement::DEVICE);
+  ASSERT_EQ(cache_manager_.RegisterCacheEntry(101, {}, cache_desc, dst_addrs, kTensorSize), ge::SUCCESS);
+
+  CopyCacheParam cache_param{};
+  cache_param.src_cache_id = 100;
+  cache_param.dst_cache_id = 101;
+  cache_param.copy_block_infos = {{0, 1}};
+  EXPECT_EQ(cache_manager_.CopyCache(cache_param), ge::SUCCESS);
+  cache_param.copy_block_infos = {{2, 3}};
+  EXPECT_EQ(cache_manager_.CopyCache(cache_param), ge::SUCCESS);
+
+  for (size_t i = 0U; i < kDeviceNum; ++i) {
+    std::vector<int32_t> expected(kNumBlocks * kBlockElems, -1);
+    std::copy_n(src_tensors[i].begin(), kBlockElems, expected.begin() + kBlockElems);
+    std::copy_n(src_tensors[i].begin() + 2 * kBlockElems, kBlockElems, expected.begin() + 3 * kBlockElems);
+    EXPECT_EQ(dst_tensors[i], expected) << "tensor index = " << i;
+  }
+  // device 0两次均走批量拷贝；device 1首次返回不支持后只在该device上回退，不影响device 0
+  EXPECT_EQ(runtime->batch_counts_[0U].load(), 2);
+  EXPECT_EQ(runtime->batch_counts_[1U].load(), 1);
+
+  EXPECT_EQ(cache_manager_.UnregisterCacheEntry(100), ge::SUCCESS);
+  EXPECT_EQ(cache_manager_.UnregisterCacheEntry(101), ge::SUCCESS);
+  cache_manager_.Finalize();
+}
+
 TEST_F(DataCacheEngineTest, InitializeMemoryPool_Failed) {
   DataCacheEngine cache_engine;
   CacheManager cache_manager;
@@ -432,6 +635,64 @@ TEST_F(DataCacheEngineTest, PullCache_D2H_C2C) {
   EXPECT_EQ(actual, (std::vector<int32_t>{1, 2, 3, 4}));
 }
 
+TEST_F(DataCacheEngineTest, PullCache_D2H_C2C_StagedAsyncCopy) {
+  auto runtime = std::make_shared<D2HCopyCountingRuntime>();
+  llm::AclRuntimeStub::SetInstance(runtime);
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {4, 128};
+  src_cache_desc.data_type = ge::DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {2, 128};
+  dst_cache_desc.placement = 0;
+  dst_cache_desc.remote_accessible = false;
+
+  llm::PullCacheParam pull_cache_param{};
+  pull_cache_param.batch_index = 1;
+
+  // host缓存由锁页内存池申请且不可远端访问，经device中转buffer并异步拷贝到host
+  DataCacheEngineTestRunner test_runner(100 * 1024 * 1024, true);
+  test_runner.Initialize(src_cache_desc, dst_cache_desc, pull_cache_param);
+  ASSERT_EQ(test_runner.Run(pull_cache_param), ge::SUCCESS);
+  EXPECT_GT(runtime->async_d2h_count_.load(), 0);
+
+  std::vector<int32_t> pull_result(2 * 128);
+  test_runner.GetCacheData(pull_result);
+  std::vector<int32_t> actual(&pull_result[128], &pull_result[128 + 4]);
+  EXPECT_EQ(actual, (std::vector<int32_t>{1, 2, 3, 4}));
+}
+
+TEST_F(DataCacheEngineTest, PullCache_D2H_C2C_StagedSyncCopy) {
+  auto runtime = std::make_shared<D2HCopyCountingRuntime>();
+  llm::AclRuntimeStub::SetInstance(runtime);
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {4, 128};
+  src_cache_desc.data_type = ge::DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {2, 128};
+  dst_cache_desc.placement = 0;
+  dst_cache_desc.remote_accessible = false;
+
+  llm::PullCacheParam pull_cache_param{};
+  pull_cache_param.batch_index = 1;
+
+  // 用户注册的host内存可能为可分页内存，仍同步拷贝
+  DataCacheEngineTestRunner test_runner;
+  test_runner.Initialize(src_cache_desc, dst_cache_desc, pull_cache_param);
+  ASSERT_EQ(test_runner.Run(pull_cache_param), ge::SUCCESS);
+  EXPECT_EQ(runtime->async_d2h_count_.load(), 0);
+
+  std::vector<int32_t> pull_result(2 * 128);
+  test_runner.GetCacheData(pull_result);
+  std::vector<int32_t> actual(&pull_result[128], &pull_result[128 + 4]);
+  EXPECT_EQ(actual, (std::vector<int32_t>{1, 2, 3, 4}));
+}
+
 TEST_F(DataCacheEngineTest, PullCache_D2H_C2C_with_layer_range) {
   llm::CacheDesc src_cache_desc{};
   src_cache_desc.num_tensors = 8;
@@ -1253,6 +1514,122 @@ TEST_F(DataCacheEngineTest, PullCache_D2D_B2B_BatchGet) {
   EXPECT_EQ(actual, (std::vector<int32_t>{1, 2, 3, 4}));
 }
 
+TEST_F(DataCacheEngineTest, PullCaches_D2D_B2B_BatchGet) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {128, 128};
+  src_cache_desc.data_type = ge::DT_INT32;
+  src_cache_desc.placement = 1;
+  src_cache_desc.cache_mem_type = CacheMemType::BLOCKS;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.placement = 1;
+
+  llm::PullCacheParam pull_cache_param{};
+  pull_cache_param.prompt_blocks = {5};
+  pull_cache_param.decoder_blocks = {9};
+
+  DataCacheEngineTestRunner test_runner(2 * 1024 * 1024, false, true);
+  test_runner.Initialize(src_cache_desc, dst_cache_desc, pull_cache_param);
+  // 首次拉取会同步远端cache访问表
+  ASSERT_EQ(test_runner.Run(pull_cache_param), ge::SUCCESS);
+
+  std::vector<llm::PullCacheTask> tasks(3);
+  for (auto &task : tasks) {
+    task.cache_id = test_runner.GetDstCache().cache_id;
+    task.cache_key.prompt_cluster_id = 0;
+    task.cache_key.prompt_cache_id = 1;
+  }
+  tasks[0].pull_cache_param.prompt_blocks = {0, 1};
+  tasks[0].pull_cache_param.decoder_blocks = {1, 2};
+  tasks[1].pull_cache_param.prompt_blocks = {4};
+  tasks[1].pull_cache_param.decoder_blocks = {6};
+  tasks[2].cache_key.prompt_cache_id = 100;
+  tasks[2].pull_cache_param.prompt_blocks = {3};
+  tasks[2].pull_cache_param.decoder_blocks = {3};
+
+  auto runtime = std::make_shared<StreamSyncCountingRuntime>();
+  llm::AclRuntimeStub::SetInstance(runtime);
+  std::vector<ge::Status> rets;
+  EXPECT_EQ(test_runner.GetDstTestContext().CacheEngine().PullCaches(tasks, rets), ge::LLM_KV_CACHE_NOT_EXIST);
+  EXPECT_EQ(rets, (std::vector<ge::Status>{ge::SUCCESS, ge::SUCCESS, ge::LLM_KV_CACHE_NOT_EXIST}));
+  // 两个有效项合并为一次BatchTransfer，只同步一次stream
+  EXPECT_EQ(runtime->sync_count_.load(), 1);
+
+  std::vector<int32_t> pull_result(128 * 128);
+  test_runner.GetCacheData(pull_result);
+  EXPECT_EQ(std::vector<int32_t>(&pull_result[128], &pull_result[128 + 4]), (std::vector<int32_t>{1, 2, 3, 4}));
+  EXPECT_EQ(std::vector<int32_t>(&pull_result[256], &pull_result[256 + 2]), (std::vector<int32_t>{129, 130}));
+  EXPECT_EQ(std::vector<int32_t>(&pull_result[768], &pull_result[768 + 2]), (std::vector<int32_t>{513, 514}));
+
+  // 未建链集群的项单独失败，其余项仍正常拉取
+  tasks[2].cache_key.prompt_cluster_id = 1;
+  EXPECT_EQ(test_runner.GetDstTestContext().CacheEngine().PullCaches(tasks, rets), ge::LLM_NOT_YET_LINK);
+  EXPECT_EQ(rets, (std::vector<ge::Status>{ge::SUCCESS, ge::SUCCESS, ge::LLM_NOT_YET_LINK}));
+}
+
+TEST_F(DataCacheEngineTest, PullCaches_D2D_B2B_BatchRequest) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {128, 128};
+  src_cache_desc.data_type = ge::DT_INT32;
+  src_cache_desc.placement = 1;
+  src_cache_desc.cache_mem_type = CacheMemType::BLOCKS;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.placement = 1;
+
+  llm::PullCacheParam pull_cache_param{};
+  pull_cache_param.prompt_blocks = {5};
+  pull_cache_param.decoder_blocks = {9};
+
+  DataCacheEngineTestRunner test_runner;
+  test_runner.Initialize(src_cache_desc, dst_cache_desc, pull_cache_param);
+
+  std::vector<llm::PullCacheTask> tasks(4);
+  for (auto &task : tasks) {
+    task.cache_id = test_runner.GetDstCache().cache_id;
+    task.cache_key.prompt_cluster_id = 0;
+    task.cache_key.prompt_cache_id = 1;
+  }
+  tasks[0].pull_cache_param.prompt_blocks = {0, 1};
+  tasks[0].pull_cache_param.decoder_blocks = {1, 2};
+  tasks[1].pull_cache_param.prompt_blocks = {4};
+  tasks[1].pull_cache_param.decoder_blocks = {6};
+  // 远端不存在的key与越界的block只影响本项
+  tasks[2].cache_key.prompt_cache_id = 100;
+  tasks[2].pull_cache_param.prompt_blocks = {3};
+  tasks[2].pull_cache_param.decoder_blocks = {3};
+  tasks[3].pull_cache_param.prompt_blocks = {128};
+  tasks[3].pull_cache_param.decoder_blocks = {3};
+  const std::vector<ge::Status> expected_rets{ge::SUCCESS, ge::SUCCESS, ge::LLM_KV_CACHE_NOT_EXIST,
+                                              ge::LLM_PARAM_INVALID};
+
+  // 对端不支持合并请求时逐项请求
+  auto &cache_engine = test_runner.GetDstTestContext().CacheEngine();
+  auto sequential_runtime = std::make_shared<StreamSyncCountingRuntime>();
+  llm::AclRuntimeStub::SetInstance(sequential_runtime);
+  test_runner.GetDstTestContext().GetCommEntry().SetRemoteBatchPullSupported(false);
+  std::vector<ge::Status> rets;
+  EXPECT_NE(cache_engine.PullCaches(tasks, rets), ge::SUCCESS);
+  EXPECT_EQ(rets, expected_rets);
+
+  auto batch_runtime = std::make_shared<StreamSyncCountingRuntime>();
+  llm::AclRuntimeStub::SetInstance(batch_runtime);
+  test_runner.GetDstTestContext().GetCommEntry().SetRemoteBatchPullSupported(true);
+  EXPECT_NE(cache_engine.PullCaches(tasks, rets), ge::SUCCESS);
+  EXPECT_EQ(rets, expected_rets);
+  // 合并为一次请求后stream同步次数少于逐项请求
+  EXPECT_LT(batch_runtime->sync_count_.load(), sequential_runtime->sync_count_.load());
+  llm::AclRuntimeStub::Reset();
+
+  std::vector<int32_t> pull_result(128 * 128);
+  test_runner.GetCacheData(pull_result);
+  EXPECT_EQ(std::vector<int32_t>(&pull_result[128], &pull_result[128 + 4]), (std::vector<int32_t>{1, 2, 3, 4}));
+  EXPECT_EQ(std::vector<int32_t>(&pull_result[256], &pull_result[256 + 2]), (std::vector<int32_t>{129, 130}));
+  EXPECT_EQ(std::vector<int32_t>(&pull_result[768], &pull_result[768 + 2]), (std::vector<int32_t>{513, 514}));
+}
+
 TEST_F(DataCacheEngineTest, PullCache_D2D_B2B_CheckFailed) {
   llm::CacheDesc src_cache_desc{};
   src_cache_desc.num_tensors = 8;
@@ -12,6 +12,7 @@
 #include <netinet/in.h>
 #include <sys/socket.h>
 #include <unistd.h>
+#include <thread>
 #include "common/llm_utils.h"
 #include "common/msg_handler_plugin.h"
 #include "common/llm_checker.h"
@@ -110,6 +111,28 @@ TEST_F(LLMUtilsTest, TestMsgHandlerPlugin) {
   EXPECT_TRUE(s < 0);
 }
 
+TEST_F(LLMUtilsTest, MsgHandlerPluginSendRecvMsg) {
+  int32_t sockets[2] = {-1, -1};
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+  // 大于socket缓冲区的消息需要多次writev才能发完
+  const std::vector<std::string> payloads{"", "hello", std::string(512U * 1024U, 'x')};
+  std::thread sender([&sockets, &payloads]() {
+    for (size_t i = 0U; i < payloads.size(); ++i) {
+      EXPECT_EQ(MsgHandlerPlugin::SendMsg(sockets[0], static_cast<int32_t>(i), payloads[i]), ge::SUCCESS);
+    }
+  });
+  for (size_t i = 0U; i < payloads.size(); ++i) {
+    int32_t msg_type = -1;
+    std::vector<char> msg;
+    ASSERT_EQ(MsgHandlerPlugin::RecvMsg(sockets[1], msg_type, msg), ge::SUCCESS);
+    EXPECT_EQ(msg_type, static_cast<int32_t>(i));
+    EXPECT_EQ(std::string(msg.data(), msg.size() - 1U), payloads[i]);
+  }
+  sender.join();
+  close(sockets[0]);
+  close(sockets[1]);
+}
+
 TEST_F(LLMUtilsTest, ConnectFailureLeavesInvalidFd) {
   const int32_t bound_fd = socket(AF_INET, SOCK_STREAM, 0);
   ASSERT_GE(bound_fd, 0);
@@ -251,6 +251,40 @@ class MockRuntime : public llm::AclRuntimeStub {
 
   int32_t count_ = 0;
 };
+
+class CountEventRuntimeMock : public llm::AclRuntimeStub {
+ public:
+  aclError aclrtCreateEvent(aclrtEvent *event) override {
+    ++create_count_;
+    return llm::AclRuntimeStub::aclrtCreateEvent(event);
+  }
+
+  int32_t create_count_ = 0;
+};
+
+class RecordEventFailRuntimeMock : public llm::AclRuntimeStub {
+ public:
+  aclError aclrtRecordEvent(aclrtEvent event, aclrtStream stream) override {
+    if ((fail_at_ > 0) && (++record_count_ == fail_at_)) {
+      return ACL_ERROR_FAILURE;
+    }
+    return llm::AclRuntimeStub::aclrtRecordEvent(event, stream);
+  }
+
+  int32_t fail_at_ = 0;
+  int32_t record_count_ = 0;
+};
+
+void PrepareLayersTransferCacheConfig(const llm::Cache &src_cache, const llm::Cache &dst_cache,
+                                      llm::TransferCacheConfig &transfer_cache_config,
+                                      std::vector<std::pair<uint64_t, uint64_t>> &layer_indices) {
+  transfer_cache_config.src_cache_id = src_cache.cache_id;
+  transfer_cache_config.tensor_num_per_layer = 2U;
+  // dst_addrs holds the addrs of every layer in the order of layer_indices
+  transfer_cache_config.dst_addrs = std::vector<uintptr_t>(dst_cache.per_device_tensor_addrs[0].begin(),
+                                                           dst_cache.per_device_tensor_addrs[0].end());
+  layer_indices = {{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+}
 }  // namespace
 
 class DataCacheEngineSTest : public ::testing::Test {
@@ -1096,6 +1130,214 @@ TEST_F(DataCacheEngineSTest, TransferDataCache_D2H_C2B) {
   EXPECT_EQ(actual, (std::vector<int32_t>{0, 0, 1, 2, 0, 0, 3, 4}));
 }
 
+TEST_F(DataCacheEngineSTest, TransferCacheLayers_D2D_C2C) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {1, 128};
+  src_cache_desc.data_type = DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {4, 128};
+
+  llm::PullCacheParam pull_cache_param{};
+  DataCacheEngineRunner data_cache_engine_runner;
+  data_cache_engine_runner.LlmDatadistInitAndLink(src_cache_desc, dst_cache_desc, pull_cache_param, false, true);
+  const auto &src_cache = data_cache_engine_runner.GetSrcCache();
+  const auto &dst_cache = data_cache_engine_runner.GetDstCache();
+  constexpr uint64_t kCacheKeyByIdType = 2UL;
+  llm::TransferCacheConfig transfer_cache_config{};
+  transfer_cache_config.src_cache_id = src_cache.cache_id;
+  transfer_cache_config.model_id_or_cache_id = static_cast<uint64_t>(dst_cache.cache_id);
+  transfer_cache_config.dst_batch_index = 1U;
+  transfer_cache_config.type = kCacheKeyByIdType;
+  transfer_cache_config.tensor_num_per_layer = 2U;
+  llm::TransferBlockConfig transfer_block_config{};
+  // all layers are resolved and sent by one call
+  const std::vector<std::pair<uint64_t, uint64_t>> layer_indices{{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+  EXPECT_EQ(data_cache_engine_runner.GetLlmDataDist().TransferCacheLayers(0, transfer_cache_config, layer_indices,
+                                                                          transfer_block_config),
+            ge::SUCCESS);
+  // dst layer out of range fails before anything is sent
+  const std::vector<std::pair<uint64_t, uint64_t>> invalid_layer_indices{{0, 0}, {1, 4}};
+  EXPECT_EQ(data_cache_engine_runner.GetLlmDataDist().TransferCacheLayers(0, transfer_cache_config,
+                                                                          invalid_layer_indices, transfer_block_config),
+            ge::LLM_PARAM_INVALID);
+
+  std::vector<int32_t> pull_result(4 * 128);
+  auto pulled_data = reinterpret_cast<int32_t *>(dst_cache.per_device_tensor_addrs[0][0]);
+  memcpy(pull_result.data(), pulled_data, sizeof(int32_t) * pull_result.size());
+  data_cache_engine_runner.ReleaseResource();
+
+  std::vector<int32_t> actual(&pull_result[128], &pull_result[128 + 4]);
+  EXPECT_EQ(actual, (std::vector<int32_t>{1, 2, 3, 4}));
+}
+
+TEST_F(DataCacheEngineSTest, TransferCacheLayers_D2D_C2C_SubmitLayers) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {1, 128};
+  src_cache_desc.data_type = DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {4, 128};
+
+  llm::PullCacheParam pull_cache_param{};
+  DataCacheEngineRunner data_cache_engine_runner;
+  data_cache_engine_runner.LlmDatadistInitAndLink(src_cache_desc, dst_cache_desc, pull_cache_param);
+  const auto &dst_cache = data_cache_engine_runner.GetDstCache();
+  llm::TransferCacheConfig transfer_cache_config{};
+  std::vector<std::pair<uint64_t, uint64_t>> layer_indices;
+  PrepareLayersTransferCacheConfig(data_cache_engine_runner.GetSrcCache(), dst_cache, transfer_cache_config,
+                                   layer_indices);
+  llm::TransferBlockConfig transfer_block_config{};
+  std::vector<uint64_t> ready_layers;
+  std::vector<std::pair<uint64_t, ge::Status>> done_layers;
+  auto &llm_data_dist = data_cache_engine_runner.GetLlmDataDist();
+  const LayerReadyCallback ready_callback = [&ready_layers, &llm_data_dist](uint64_t layer_index) -> ge::Status {
+    // 等待层就绪期间不持有传输锁，其他传输任务可以并发下发
+    EXPECT_TRUE(llm_data_dist.transfer_mutex_.try_lock());
+    llm_data_dist.transfer_mutex_.unlock();
+    ready_layers.emplace_back(layer_index);
+    return ge::SUCCESS;
+  };
+  const LayerDoneCallback done_callback = [&done_layers](uint64_t layer_index, ge::Status ret) {
+    done_layers.emplace_back(layer_index, ret);
+  };
+  // every layer goes through SubmitLayer of one job, callbacks follow the submission order
+  EXPECT_EQ(data_cache_engine_runner.GetLlmDataDist().TransferCacheLayers(
+                0, transfer_cache_config, layer_indices, transfer_block_config, ready_callback, done_callback),
+            ge::SUCCESS);
+  EXPECT_EQ(ready_layers, (std::vector<uint64_t>{0, 1, 2, 3}));
+  EXPECT_EQ(done_layers, (std::vector<std::pair<uint64_t, ge::Status>>{
+                             {0, ge::SUCCESS}, {1, ge::SUCCESS}, {2, ge::SUCCESS}, {3, ge::SUCCESS}}));
+
+  // dst_addrs must cover all layers
+  transfer_cache_config.dst_addrs.pop_back();
+  EXPECT_EQ(data_cache_engine_runner.GetLlmDataDist().TransferCacheLayers(0, transfer_cache_config, layer_indices,
+                                                                          transfer_block_config),
+            ge::LLM_PARAM_INVALID);
+
+  std::vector<int32_t> pull_result(4);
+  memcpy(pull_result.data(), reinterpret_cast<void *>(dst_cache.per_device_tensor_addrs[0][0]),
+         sizeof(int32_t) * pull_result.size());
+  data_cache_engine_runner.ReleaseResource();
+  EXPECT_EQ(pull_result, (std::vector<int32_t>{1, 2, 3, 4}));
+}
+
+TEST_F(DataCacheEngineSTest, TransferCacheLayers_D2D_C2C_LayerNotReady) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {1, 128};
+  src_cache_desc.data_type = DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {4, 128};
+
+  llm::PullCacheParam pull_cache_param{};
+  DataCacheEngineRunner data_cache_engine_runner;
+  data_cache_engine_runner.LlmDatadistInitAndLink(src_cache_desc, dst_cache_desc, pull_cache_param);
+  llm::TransferCacheConfig transfer_cache_config{};
+  std::vector<std::pair<uint64_t, uint64_t>> layer_indices;
+  PrepareLayersTransferCacheConfig(data_cache_engine_runner.GetSrcCache(), data_cache_engine_runner.GetDstCache(),
+                                   transfer_cache_config, layer_indices);
+  llm::TransferBlockConfig transfer_block_config{};
+  std::vector<uint64_t> ready_layers;
+  std::vector<std::pair<uint64_t, ge::Status>> done_layers;
+  const LayerReadyCallback ready_callback = [&ready_layers](uint64_t layer_index) -> ge::Status {
+    ready_layers.emplace_back(layer_index);
+    return (layer_index == 2U) ? ge::LLM_PARAM_INVALID : ge::SUCCESS;
+  };
+  const LayerDoneCallback done_callback = [&done_layers](uint64_t layer_index, ge::Status ret) {
+    done_layers.emplace_back(layer_index, ret);
+  };
+  // layers submitted before the failure still complete, later layers are not submitted
+  EXPECT_EQ(data_cache_engine_runner.GetLlmDataDist().TransferCacheLayers(
+                0, transfer_cache_config, layer_indices, transfer_block_config, ready_callback, done_callback),
+            ge::LLM_PARAM_INVALID);
+  data_cache_engine_runner.ReleaseResource();
+  EXPECT_EQ(ready_layers, (std::vector<uint64_t>{0, 1, 2}));
+  EXPECT_EQ(done_layers, (std::vector<std::pair<uint64_t, ge::Status>>{
+                             {0, ge::SUCCESS}, {1, ge::SUCCESS}, {2, ge::LLM_PARAM_INVALID}}));
+}
+
+TEST_F(DataCacheEngineSTest, TransferCacheLayers_D2D_C2C_RecordEventFailed) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {1, 128};
+  src_cache_desc.data_type = DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {4, 128};
+
+  llm::PullCacheParam pull_cache_param{};
+  auto runtime_mock = std::make_shared<RecordEventFailRuntimeMock>();
+  llm::AclRuntimeStub::SetInstance(runtime_mock);
+  DataCacheEngineRunner data_cache_engine_runner;
+  data_cache_engine_runner.LlmDatadistInitAndLink(src_cache_desc, dst_cache_desc, pull_cache_param);
+  llm::TransferCacheConfig transfer_cache_config{};
+  std::vector<std::pair<uint64_t, uint64_t>> layer_indices;
+  PrepareLayersTransferCacheConfig(data_cache_engine_runner.GetSrcCache(), data_cache_engine_runner.GetDstCache(),
+                                   transfer_cache_config, layer_indices);
+  llm::TransferBlockConfig transfer_block_config{};
+  std::vector<std::pair<uint64_t, ge::Status>> done_layers;
+  const LayerDoneCallback done_callback = [&done_layers](uint64_t layer_index, ge::Status ret) {
+    done_layers.emplace_back(layer_index, ret);
+  };
+  // the event of the second layer fails to record
+  runtime_mock->fail_at_ = 2;
+  EXPECT_NE(data_cache_engine_runner.GetLlmDataDist().TransferCacheLayers(
+                0, transfer_cache_config, layer_indices, transfer_block_config, nullptr, done_callback),
+            ge::SUCCESS);
+  data_cache_engine_runner.ReleaseResource();
+  llm::AclRuntimeStub::Reset();
+  EXPECT_EQ(done_layers, (std::vector<std::pair<uint64_t, ge::Status>>{{0, ge::SUCCESS}, {1, ge::FAILED}}));
+}
+
+TEST_F(DataCacheEngineSTest, TransferDataCache_D2D_C2C_ReuseEvent) {
+  llm::CacheDesc src_cache_desc{};
+  src_cache_desc.num_tensors = 8;
+  src_cache_desc.shape = {1, 128};
+  src_cache_desc.data_type = DT_INT32;
+  src_cache_desc.placement = 1;
+
+  llm::CacheDesc dst_cache_desc = src_cache_desc;
+  dst_cache_desc.shape = {4, 128};
+
+  llm::PullCacheParam pull_cache_param{};
+  auto runtime_mock = std::make_shared<CountEventRuntimeMock>();
+  llm::AclRuntimeStub::SetInstance(runtime_mock);
+  DataCacheEngineRunner data_cache_engine_runner;
+  data_cache_engine_runner.LlmDatadistInitAndLink(src_cache_desc, dst_cache_desc, pull_cache_param);
+  const auto &src_cache = data_cache_engine_runner.GetSrcCache();
+  const auto &dst_cache = data_cache_engine_runner.GetDstCache();
+  llm::TransferCacheConfig transfer_cache_config{};
+  transfer_cache_config.src_cache_id = src_cache.cache_id;
+  transfer_cache_config.tensor_num_per_layer = 2U;
+  llm::TransferBlockConfig transfer_block_config{};
+  const int32_t create_count_before = runtime_mock->create_count_;
+  // layer by layer transfer reuses the pooled event of the transfer stream
+  for (uint64_t layer_index = 0U; layer_index < 4U; ++layer_index) {
+    transfer_cache_config.layer_index = layer_index;
+    transfer_cache_config.dst_addrs =
+        std::vector<uintptr_t>(dst_cache.per_device_tensor_addrs[0].begin() + layer_index * 2,
+                               dst_cache.per_device_tensor_addrs[0].begin() + layer_index * 2 + 2);
+    EXPECT_EQ(data_cache_engine_runner.GetLlmDataDist().TransferCache(0, transfer_cache_config, transfer_block_config),
+              ge::SUCCESS);
+  }
+  EXPECT_EQ(runtime_mock->create_count_ - create_count_before, 1);
+
+  std::vector<int32_t> pull_result(4);
+  memcpy(pull_result.data(), reinterpret_cast<void *>(dst_cache.per_device_tensor_addrs[0][0]),
+         sizeof(int32_t) * pull_result.size());
+  data_cache_engine_runner.ReleaseResource();
+  llm::AclRuntimeStub::Reset();
+  EXPECT_EQ(pull_result, (std::vector<int32_t>{1, 2, 3, 4}));
+}
+
 TEST_F(DataCacheEngineSTest, PullDataCache_D2D_C2C_with_layer_range) {
   llm::CacheDesc src_cache_desc{};
   src_cache_desc.num_tensors = 8;
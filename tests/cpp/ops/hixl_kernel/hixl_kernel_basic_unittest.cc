@@ -95,10 +95,11 @@ static void ResetHalEschedStub() {
   g_hal_esched_submit_call_count = 0;
 }
 
-uint32_t SyncContext(ThreadHandle thread, uint32_t op, uint32_t *state) {
+uint32_t SyncContext(ThreadHandle thread, uint32_t op, uint32_t *state, uint32_t ctx_id = 0U) {
   HixlTransferContextSyncEntry entry{};
   entry.thread = thread;
   entry.op = op;
+  entry.ctx_id = ctx_id;
   uint32_t result_state = TRANSFER_THREAD_STATE_DELETED;
   HixlTransferContextSyncParam param{};
   param.entry_list_addr = reinterpret_cast<uint64_t>(&entry);
@@ -528,6 +529,61 @@ TEST_F(HixlBatchTransferTest, DeleteBusyContextReturnsDeletingThenDeleted) {
   EXPECT_EQ(state, TRANSFER_THREAD_STATE_DELETED);
 }
 
+TEST_F(HixlBatchTransferTest, LookupByCtxIdBypassesThreadMap) {
+  constexpr ThreadHandle kSlotThread = 910110ULL;
+  constexpr uint32_t kCtxId = 7U;
+  uint32_t state = TRANSFER_THREAD_STATE_DELETED;
+  ASSERT_EQ(SyncContext(kSlotThread, TRANSFER_CONTEXT_OP_ADD, &state, kCtxId), SUCCESS);
+  ASSERT_EQ(state, TRANSFER_THREAD_STATE_INITIALIZED);
+
+  std::shared_ptr<TransferContext> holder;
+  TransferContext *ctx = TransferContextManager::Instance().Lookup(kCtxId, kSlotThread, holder);
+  ASSERT_NE(ctx, nullptr);
+  EXPECT_EQ(holder, nullptr);
+  EXPECT_EQ(ctx, TransferContextManager::Instance().Get(kSlotThread).get());
+
+  std::array<std::array<uint8_t, 8>, 1> local_addr{};
+  std::array<std::array<uint8_t, 8>, 1> remote_addr{};
+  std::array<uint64_t, 1> lens_storage{8};
+  auto args = CreateTestArgs<1>(local_addr, remote_addr, lens_storage, 0, 0, kSlotThread);
+  args.param.ctx_id = kCtxId;
+  g_mock_batch_transfer_ret = HCCL_SUCCESS;
+  EXPECT_EQ(HixlBatchPut(&args.param), SUCCESS);
+  EXPECT_EQ(g_mock_batch_transfer_call_count, 1u);
+
+  ASSERT_EQ(SyncContext(kSlotThread, TRANSFER_CONTEXT_OP_DELETE, &state, kCtxId), SUCCESS);
+  EXPECT_EQ(state, TRANSFER_THREAD_STATE_DELETED);
+  EXPECT_EQ(HixlBatchPut(&args.param), FAILED);
+  EXPECT_EQ(g_mock_batch_transfer_call_count, 1u);
+}
+
+TEST_F(HixlBatchTransferTest, StaleCtxIdFallsBackToThreadLookup) {
+  constexpr ThreadHandle kOldThread = 910111ULL;
+  constexpr ThreadHandle kNewThread = 910112ULL;
+  constexpr uint32_t kCtxId = 8U;
+  uint32_t state = TRANSFER_THREAD_STATE_DELETED;
+  ASSERT_EQ(SyncContext(kOldThread, TRANSFER_CONTEXT_OP_ADD, &state, kCtxId), SUCCESS);
+  // 槽位仍被占用时不换绑，新thread退化为按thread查表
+  ASSERT_EQ(SyncContext(kNewThread, TRANSFER_CONTEXT_OP_ADD, &state, kCtxId), SUCCESS);
+  std::shared_ptr<TransferContext> holder;
+  TransferContext *ctx = TransferContextManager::Instance().Lookup(kCtxId, kNewThread, holder);
+  ASSERT_NE(ctx, nullptr);
+  EXPECT_EQ(ctx, holder.get());
+  EXPECT_NE(ctx, TransferContextManager::Instance().Get(kOldThread).get());
+
+  // 上一任thread删除后，槽位换绑到新thread
+  ASSERT_EQ(SyncContext(kOldThread, TRANSFER_CONTEXT_OP_DELETE, &state, kCtxId), SUCCESS);
+  ASSERT_EQ(SyncContext(kNewThread, TRANSFER_CONTEXT_OP_ADD, &state, kCtxId), SUCCESS);
+  holder.reset();
+  ctx = TransferContextManager::Instance().Lookup(kCtxId, kNewThread, holder);
+  ASSERT_NE(ctx, nullptr);
+  EXPECT_EQ(holder, nullptr);
+  EXPECT_EQ(ctx->thread.load(), kNewThread);
+  EXPECT_EQ(TransferContextManager::Instance().Lookup(kCtxId, kOldThread, holder), nullptr);
+
+  ASSERT_EQ(SyncContext(kNewThread, TRANSFER_CONTEXT_OP_DELETE, &state, kCtxId), SUCCESS);
+}
+
 class HixlSyncTransferContextTest : public ::testing::Test {
  protected:
   void TearDown() override {
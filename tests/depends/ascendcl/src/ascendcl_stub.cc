@@ -240,6 +240,12 @@ aclError AclRuntimeStub::aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent eve
   return ACL_ERROR_NONE;
 }
 
+aclError AclRuntimeStub::aclrtResetEvent(aclrtEvent event, aclrtStream stream) {
+  (void)event;
+  (void)stream;
+  return ACL_ERROR_NONE;
+}
+
 aclError AclRuntimeStub::aclrtStreamQuery(aclrtStream stream, aclrtStreamStatus *status) {
   if (status == nullptr) {
     return ACL_ERROR_INVALID_PARAM;
@@ -896,6 +902,10 @@ aclError aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent event) {
   return llm::AclRuntimeStub::GetInstance()->aclrtStreamWaitEvent(stream, event);
 }
 
+aclError aclrtResetEvent(aclrtEvent event, aclrtStream stream) {
+  return llm::AclRuntimeStub::GetInstance()->aclrtResetEvent(event, stream);
+}
+
 aclError aclrtStreamQuery(aclrtStream stream, aclrtStreamStatus *status) {
   return llm::AclRuntimeStub::GetInstance()->aclrtStreamQuery(stream, status);
 }
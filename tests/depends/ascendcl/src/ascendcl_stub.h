@@ -69,6 +69,7 @@ class AclRuntimeStub {
   virtual aclError aclrtStreamAbort(aclrtStream stream);
   virtual aclError aclrtStreamStop(aclrtStream stream);
   virtual aclError aclrtStreamWaitEvent(aclrtStream stream, aclrtEvent event);
+  virtual aclError aclrtResetEvent(aclrtEvent event, aclrtStream stream);
   virtual aclError aclrtStreamQuery(aclrtStream stream, aclrtStreamStatus *status);
   virtual aclError aclrtSetStreamFailureMode(aclrtStream stream, uint64_t mode);
   virtual aclError aclrtSynchronizeStream(aclrtStream stream);
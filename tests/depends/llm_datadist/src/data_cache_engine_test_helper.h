@@ -430,6 +430,10 @@ class DataCacheEngineTestRunner {
     return src_test_context_;
   }
 
+  DataCacheEngineTestContext &GetDstTestContext() {
+    return dst_test_context_;
+  }
+
   void SetRegisterDevMem(bool register_dev_mem) {
     register_dev_mem_ = register_dev_mem;
   }
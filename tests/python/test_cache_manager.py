@@ -406,6 +406,33 @@ class LlmCacheManagerSt(unittest.TestCase):
         cache_mgr.deallocate_blocks_cache(dst_blocks_cache)
         cache_mgr.deallocate_cache(src_cache)
 
+    def test_pull_caches(self):
+        self.create_link()
+        cache_mgr = self.llm_datadist.cache_manager
+        cache_desc = CacheDesc(2, [2, 4], DataType.DT_INT8, Placement.DEVICE)
+        cache_keys = [CacheKey(2, 0, 0), CacheKey(2, 1, 0)]
+        src_cache = cache_mgr.allocate_cache(cache_desc, cache_keys)
+        dst_cache = cache_mgr.allocate_cache(cache_desc)
+        dst_blocks_cache = cache_mgr.allocate_blocks_cache(cache_desc)
+
+        tasks = [PullTask(cache_keys[0], dst_cache, batch_index=0, size=4),
+                 PullTask(cache_keys[1], dst_blocks_cache, [], [0]),
+                 # 参数非法的任务单独失败, 不影响其余任务
+                 PullTask(cache_keys[0], dst_cache, batch_index=0, size=0),
+                 PullTask(cache_keys[1], dst_blocks_cache, [], [])]
+        rets = cache_mgr.pull_caches(tasks)
+        self.assertEqual(rets, [LLMStatusCode.LLM_SUCCESS, LLMStatusCode.LLM_SUCCESS,
+                                LLMStatusCode.LLM_PARAM_INVALID, LLMStatusCode.LLM_PARAM_INVALID])
+
+        with self.assertRaises(LLMException):
+            cache_mgr.pull_caches([])
+        with self.assertRaises(TypeError):
+            cache_mgr.pull_caches([cache_keys[0]])
+
+        cache_mgr.deallocate_blocks_cache(dst_blocks_cache)
+        cache_mgr.deallocate_cache(dst_cache)
+        cache_mgr.deallocate_cache(src_cache)
+
 class LlmCacheManagerDecoderSt(unittest.TestCase):
 
     def setUp(self) -> None: